@@ -27,6 +27,7 @@
 #include "IOHAL.h"
 #include "Icu_17_GtmCcu6.h"
 #include "DIO_WrapAPI.h"
+#include "SPDSNS.h"
 
 
 
@@ -37,16 +38,12 @@ extern uint32 RTMCLD_u32MaxLoad4SR;
 uint8 ShrExp_SolenoidFeed_s[2] = {0xFF, 0xFF};
 uint8 ShrExp_Pos_stPos;
 uint8 ShrExp_Pos_stQual;
-uint8 Gear_Speed[3];
 
 
 void Dio_WrapAPI_Init(void)
 {
 	ShrExp_SolenoidFeed_s[0] = 0xFF;
 	ShrExp_SolenoidFeed_s[1] = 0xFF;
-	Gear_Speed[0] = 0;
-	Gear_Speed[1] = 0;
-	Gear_Speed[2] = 0;
 }
 
 /****************************************************
@@ -181,103 +178,34 @@ void ShrExp_Get_Switch(uint8 idx, uint8 *b)
 
 void ShrExp_Get_Speed( uint8 idx, uint16 *n, uint8 *sDir, uint8 *bSply, uint8 *stDiaRdy, uint8 *stDiaDsbc)
 {
+	SPDSNS_tstSnapshot stSnap;
 
-	uint32 PWM_Freq_Speed;
-	uint32 PWM_Freq_Speed_Org;
-	
-	uint32 PWM_Duty_Speed;
-
-	uint8 ret = 0;
-	uint32  u32LocalDutyCycle_Time = 0;
-
-	//uint8 Gear_Count[3];
-	 
-	uint32 PWM_Time = 0;
-	uint8 PWM_Channel = 0xFF;
-	float TempDuty;
-
-	
-	    if((idx > 2) || (n == NULL_PTR) || (sDir == NULL_PTR) || (bSply == NULL_PTR) ||(stDiaRdy == NULL_PTR) ||(stDiaDsbc == NULL_PTR))
+	    if((idx >= SPDSNS_u8NB_SNS) || (n == NULL_PTR) || (sDir == NULL_PTR) || (bSply == NULL_PTR) ||(stDiaRdy == NULL_PTR) ||(stDiaDsbc == NULL_PTR))
 	    	{
-			*bSply = 0;
+			if(bSply != NULL_PTR)
+			{
+				*bSply = 0;
+			}
 			return;
 	    	}
 		else
 		{
 
 		}
-		
-		switch(idx)
-		{
-			case 0:
-				if(Gear_Speed[0] == 0)
-				{
-					Gear_Speed[0] = 30;
-				} 
-				 PWM_Freq_Speed_Org = IOHWABS_udtREAD_CHANNEL(M_G4_SPD_SNS_PWM_FRQ);
-				 PWM_Duty_Speed = IOHWABS_udtREAD_CHANNEL(M_G4_SPD_SNS_PWM_DUTYCYC);
-				 PWM_Freq_Speed =(uint32)(PWM_Freq_Speed_Org << 2);
-				 *n = (uint16)((uint32)(PWM_Freq_Speed *60)/Gear_Speed[0]); 
-				 ret = 1;
-				 break;
-			case 1:
-				if(Gear_Speed[1] == 0)
-				{
-					Gear_Speed[1] = 40;
-				} 
-				PWM_Freq_Speed_Org = IOHWABS_udtREAD_CHANNEL(M_C4_SPD_SNS_PWM_FRQ);
-	     			PWM_Duty_Speed = IOHWABS_udtREAD_CHANNEL(M_C4_SPD_SNS_PWM_DUTYCYC);
-				PWM_Freq_Speed =(uint32)(PWM_Freq_Speed_Org << 2);
-				*n = (uint16)((uint32)(PWM_Freq_Speed *60)/Gear_Speed[1]); 
-				ret = 1;
-				break;
-			case 2:
-				if(Gear_Speed[2] == 0)
-				{
-					Gear_Speed[2] = 89;
-				} 
-				PWM_Freq_Speed_Org = IOHWABS_udtREAD_CHANNEL(M_TOSS_PWM_FRQ);
-				PWM_Duty_Speed = IOHWABS_udtREAD_CHANNEL(M_TOSS_PWM_DUTYCYC);
-				PWM_Freq_Speed =(uint32)(PWM_Freq_Speed_Org << 2);
-				*n = (uint16)((uint32)(PWM_Freq_Speed *60)/Gear_Speed[2]); 
-				 ret = 1;
-				break;
-				
-			default:
-			break;
-		}	
-		
-	   if(ret == 1)
-	   {
-		    TempDuty = (float32)((float32)100-(float32)((float32) PWM_Duty_Speed*100/16384));
-		    u32LocalDutyCycle_Time = (float32)(10000*TempDuty)/PWM_Freq_Speed_Org;
-			
-		    PWM_Time = u32LocalDutyCycle_Time;
-
-		   if ((PWM_Time >= 50) && (PWM_Time <= 70))
-		   {
-		   	*sDir = 1;
-		   }
-		   else if((PWM_Time >= 102) && (PWM_Time <= 138))
-	   	   {
-			*sDir = 2;
-	   	   }
-		   else
-		   {
-			*sDir = 0;
-		   }
-		   *bSply = 1;
-	   }
-	   	
+
+		/* idx 0: G4, 1: C4, 2: TOSS, averaged and filtered every 1ms by SPDSNS */
+		SPDSNS_vidGetSnapshot(&stSnap);
+		*n = stSnap.au16Spd[idx];
+		*sDir = stSnap.au8Dir[idx];
+		/* no signal since init or timeout: speed 0 and direction unknown are not supplied values */
+		*bSply = (stSnap.au8Sts[idx] == SPDSNS_u8STS_VLD) ? 1 : 0;
 }
 
 
 
 void Shrexp_set_Speed ( uint8 nPlsPerRe[])
 {
-	Gear_Speed[0] = *nPlsPerRe;
-	Gear_Speed[1] = *(nPlsPerRe + 1);
-	Gear_Speed[2] = *(nPlsPerRe + 2);
+	SPDSNS_vidSetPlsPerRev(nPlsPerRe);
 }
 
 			
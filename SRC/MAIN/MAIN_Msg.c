@@ -37,6 +37,7 @@
 #include "MAIN_Msg.h"
 
 #include "MSG.h"
+#include "IfxStm_reg.h"
 
 //<<#include "Com.h"
 //>>
@@ -54,12 +55,48 @@ extern FUNC(uint8, COM_CODE) Com_SendSignal
 );
 
 /******************************************************************************/
-/* GLOBAL FUNCTION DEFINITION                                                 */
+/* DEFINES                                                                    */
+/******************************************************************************/
+/* Free running STM0 time base (100 MHz, 0.01 us per tick)                    */
+#define MAIN_MSG_u32GET_TIME_STAMP()     ((uint32)MODULE_STM0.TIM0.U)
+
+/* Rx frames under latency measurement                                        */
+#define MAIN_MSG_u8LAT_ABS1_IDX          0
+#define MAIN_MSG_u8LAT_ABS2_IDX          1
+#define MAIN_MSG_u8LAT_ECM1_IDX          2
+#define MAIN_MSG_u8LAT_ECM2_IDX          3
+#define MAIN_MSG_u8LAT_ESC1_IDX          4
+#define MAIN_MSG_u8LAT_FRAME_NB          5
+
+/* Rx latency histogram: 32 bins of 500 us, last bin collects the remainder   */
+#define MAIN_MSG_u8LAT_BIN_NB            32
+#define MAIN_MSG_u32LAT_BIN_TICKS        50000u
+
+/* Tx frames under jitter measurement                                         */
+#define MAIN_MSG_u8JIT_TCU1_IDX          0
+#define MAIN_MSG_u8JIT_TCU2_IDX          1
+#define MAIN_MSG_u8JIT_FRAME_NB          2
+
+/* Nominal Tx signal update period: 10 ms                                     */
+#define MAIN_MSG_u32TX_PRD_10MS_TICKS    1000000u
+
+/******************************************************************************/
+/* LOCAL FUNCTION DECLARATION                                                 */
 /******************************************************************************/
 
 #define MAIN_START_SEC_CODE
 #include "MAIN_MemMap.h"
 
+static void MAIN_MSGvidTimingInit(void);
+static void MAIN_MSGvidRxLatUpdate(uint8 u8Idx, const volatile uint32 *pu32AckCnt,
+                                   const volatile uint32 *pu32AckTs);
+static void MAIN_MSGvidRxLatEval(void);
+static void MAIN_MSGvidTxJitUpdate(uint8 u8Idx);
+
+/******************************************************************************/
+/* GLOBAL FUNCTION DEFINITION                                                 */
+/******************************************************************************/
+
 /******************************************************************************/
 /*                                                                            */
 /* !Description: MAIN MSG initialization                                      */
@@ -173,6 +210,10 @@ void MAIN_MSGvidInit(void)
 	   MAIN_MSGf32TrsmTOilPhys = MAIN_MSG_TRSMTOIL_NEUTRAL;
 	   MAIN_MSGbTrsmTOilWrnLmpReq = MAIN_MSG_TRSMTOILWRNLMPREQ_INIT;
 
+	/* ========================================================================== */
+	/* CAN MSG timing measurement Init                                            */
+	/* ========================================================================== */
+	   MAIN_MSGvidTimingInit();
 }
 
 void MAIN_MSGvidRx_Tsk10ms( void )
@@ -269,6 +310,26 @@ void MAIN_MSGvidRx_Tsk10ms( void )
          &MAIN_MSGbTcsCtrlActv,
          &MAIN_MSGbTcsFlgFlt);
 /* ESC1 */
+
+      /* Rx latency: Com acknowledge to application signal update */
+      if (MAIN_MSGbTimingMeasOnC != FALSE)
+      {
+         MAIN_MSGvidRxLatUpdate(MAIN_MSG_u8LAT_ABS1_IDX,
+                                &BSW_u32CbkRxAckCnt_SGABS1,
+                                &BSW_u32CbkRxAckTs_SGABS1);
+         MAIN_MSGvidRxLatUpdate(MAIN_MSG_u8LAT_ABS2_IDX,
+                                &BSW_u32CbkRxAckCnt_SGABS2,
+                                &BSW_u32CbkRxAckTs_SGABS2);
+         MAIN_MSGvidRxLatUpdate(MAIN_MSG_u8LAT_ECM1_IDX,
+                                &BSW_u32CbkRxAckCnt_SGECM1,
+                                &BSW_u32CbkRxAckTs_SGECM1);
+         MAIN_MSGvidRxLatUpdate(MAIN_MSG_u8LAT_ECM2_IDX,
+                                &BSW_u32CbkRxAckCnt_SGECM2,
+                                &BSW_u32CbkRxAckTs_SGECM2);
+         MAIN_MSGvidRxLatUpdate(MAIN_MSG_u8LAT_ESC1_IDX,
+                                &BSW_u32CbkRxAckCnt_SGESC1,
+                                &BSW_u32CbkRxAckTs_SGESC1);
+      }
 	}
 }
 void MAIN_MSGvidRx_Tsk20ms( void )
@@ -335,7 +396,10 @@ void MAIN_MSGvidRx_Tsk1000ms( void )
 {
    if (MAIN_MSGRxBenchOnC == 0)
    	{
-
+      if (MAIN_MSGbTimingMeasOnC != FALSE)
+      {
+         MAIN_MSGvidRxLatEval();
+      }
    	}
 }
 
@@ -351,6 +415,7 @@ void MAIN_MSGvidTx_Tsk10ms( void )
 //<<      MAIN_MSGf32TrsmMsgCntPhys = xxx;
 //<<      MAIN_MSGf32TrsmNInpPhys = xxx;
       /* TCU1 Period:10ms. Direction:Tx */
+      MAIN_MSGvidTxJitUpdate(MAIN_MSG_u8JIT_TCU1_IDX);
       MAIN_MSGvidTxTCU1(
          MAIN_MSGf32EngNIdleReqPhys,
          &MAIN_MSGu8EngNIdleReq,
@@ -377,6 +442,7 @@ void MAIN_MSGvidTx_Tsk10ms( void )
 //<<      MAIN_MSGf32TrsmTOilPhys = xxx;
 //<<      MAIN_MSGbTrsmTOilWrnLmpReq = xxx;
       /* TCU2 Period:10ms. Direction:Tx */
+      MAIN_MSGvidTxJitUpdate(MAIN_MSG_u8JIT_TCU2_IDX);
       MAIN_MSGvidTxTCU2(
          MAIN_MSGf32EngTqIndIncReqdByTrsmPhys,
          &MAIN_MSGu8EngTqIndIncReqdByTrsm,
@@ -1082,6 +1148,197 @@ void MAIN_MSGvidTxTCU2(
    Com_SendSignal(ComConf_ComSignal_SGTrsmTOilWrnLmpReq_337T, &Arg_bTrsmTOilWrnLmpReqRaw);
 }
 
+/******************************************************************************/
+/* LOCAL FUNCTION DEFINITION                                                  */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                                                                            */
+/* !Function    : MAIN_MSGvidTimingInit                                       */
+/* !Description : Clear the Rx latency and Tx jitter measurements             */
+/* !Number      : MAIN.MSG.3                                                  */
+/* !Reference   : NONE                                                        */
+/*                                                                            */
+/******************************************************************************/
+static void MAIN_MSGvidTimingInit(void)
+{
+   uint8 u8LocIdx;
+   uint8 u8LocBin;
+
+
+   for (u8LocIdx = 0; u8LocIdx < MAIN_MSG_u8LAT_FRAME_NB; u8LocIdx++)
+   {
+      MAIN_MSGau32RxLatAckCnt[u8LocIdx] = 0;
+      MAIN_MSGau32RxLatCnt[u8LocIdx] = 0;
+      MAIN_MSGau32RxLatP50[u8LocIdx] = 0;
+      MAIN_MSGau32RxLatP99[u8LocIdx] = 0;
+      MAIN_MSGau32RxLatMax[u8LocIdx] = 0;
+      for (u8LocBin = 0; u8LocBin < MAIN_MSG_u8LAT_BIN_NB; u8LocBin++)
+      {
+         MAIN_MSGau32RxLatHist[u8LocIdx][u8LocBin] = 0;
+      }
+   }
+
+   for (u8LocIdx = 0; u8LocIdx < MAIN_MSG_u8JIT_FRAME_NB; u8LocIdx++)
+   {
+      MAIN_MSGau32TxTimeStamp[u8LocIdx] = 0;
+      MAIN_MSGau32TxPrdMin[u8LocIdx] = UINT32_MAX;
+      MAIN_MSGau32TxPrdMax[u8LocIdx] = 0;
+      MAIN_MSGau32TxJitMax[u8LocIdx] = 0;
+   }
+}
+
+/******************************************************************************/
+/*                                                                            */
+/* !Function    : MAIN_MSGvidRxLatUpdate                                      */
+/* !Description : Add one Rx latency sample when a new frame was acknowledged */
+/*                by Com since the previous call. The latency is the time     */
+/*                from the Com Rx acknowledge callback to the update of the   */
+/*                application signals.                                        */
+/* !Number      : MAIN.MSG.4                                                  */
+/* !Reference   : NONE                                                        */
+/*                                                                            */
+/******************************************************************************/
+static void MAIN_MSGvidRxLatUpdate(uint8 u8Idx, const volatile uint32 *pu32AckCnt,
+                                   const volatile uint32 *pu32AckTs)
+{
+   uint32 u32LocNow;
+   uint32 u32LocAckCnt;
+   uint32 u32LocAckTs;
+   uint32 u32LocLat;
+   uint32 u32LocBin;
+
+
+   u32LocNow = MAIN_MSG_u32GET_TIME_STAMP();
+   u32LocAckCnt = *pu32AckCnt;
+   u32LocAckTs = *pu32AckTs;
+
+   /* Skip the sample if no new frame, or if a frame arrived while reading */
+   if (  (u32LocAckCnt != MAIN_MSGau32RxLatAckCnt[u8Idx])
+      && (u32LocAckCnt == *pu32AckCnt)
+      )
+   {
+      MAIN_MSGau32RxLatAckCnt[u8Idx] = u32LocAckCnt;
+
+      u32LocLat = u32LocNow - u32LocAckTs;
+      u32LocBin = u32LocLat / MAIN_MSG_u32LAT_BIN_TICKS;
+      if (u32LocBin >= MAIN_MSG_u8LAT_BIN_NB)
+      {
+         u32LocBin = MAIN_MSG_u8LAT_BIN_NB - 1;
+      }
+      MAIN_MSGau32RxLatHist[u8Idx][u32LocBin]++;
+      MAIN_MSGau32RxLatCnt[u8Idx]++;
+
+      if (u32LocLat > MAIN_MSGau32RxLatMax[u8Idx])
+      {
+         MAIN_MSGau32RxLatMax[u8Idx] = u32LocLat;
+      }
+   }
+}
+
+/******************************************************************************/
+/*                                                                            */
+/* !Function    : MAIN_MSGvidRxLatEval                                        */
+/* !Description : Compute the 50th and 99th Rx latency percentiles from the   */
+/*                histograms, as upper bound of the bin reaching the rank.    */
+/* !Number      : MAIN.MSG.5                                                  */
+/* !Reference   : NONE                                                        */
+/*                                                                            */
+/******************************************************************************/
+static void MAIN_MSGvidRxLatEval(void)
+{
+   uint8  u8LocIdx;
+   uint8  u8LocBin;
+   uint32 u32LocCnt;
+   uint32 u32LocCum;
+   uint32 u32LocRankP50;
+   uint32 u32LocRankP99;
+   uint32 u32LocP50;
+   uint32 u32LocP99;
+
+
+   for (u8LocIdx = 0; u8LocIdx < MAIN_MSG_u8LAT_FRAME_NB; u8LocIdx++)
+   {
+      u32LocCnt = MAIN_MSGau32RxLatCnt[u8LocIdx];
+      if (u32LocCnt != 0)
+      {
+         /* Ranks rounded up: ceil(n * p / 100) */
+         u32LocRankP50 = (u32LocCnt / 2) + (u32LocCnt % 2);
+         u32LocRankP99 = u32LocCnt - (u32LocCnt / 100);
+         u32LocCum = 0;
+         u32LocP50 = 0;
+         u32LocP99 = 0;
+
+         for (u8LocBin = 0; u8LocBin < MAIN_MSG_u8LAT_BIN_NB; u8LocBin++)
+         {
+            u32LocCum += MAIN_MSGau32RxLatHist[u8LocIdx][u8LocBin];
+            if ((u32LocP50 == 0) && (u32LocCum >= u32LocRankP50))
+            {
+               u32LocP50 = (uint32)(u8LocBin + 1) * MAIN_MSG_u32LAT_BIN_TICKS;
+            }
+            if ((u32LocP99 == 0) && (u32LocCum >= u32LocRankP99))
+            {
+               u32LocP99 = (uint32)(u8LocBin + 1) * MAIN_MSG_u32LAT_BIN_TICKS;
+            }
+         }
+         MAIN_MSGau32RxLatP50[u8LocIdx] = u32LocP50;
+         MAIN_MSGau32RxLatP99[u8LocIdx] = u32LocP99;
+      }
+   }
+}
+
+/******************************************************************************/
+/*                                                                            */
+/* !Function    : MAIN_MSGvidTxJitUpdate                                      */
+/* !Description : Update min/max period and jitter of the Tx signal update    */
+/*                of one 10 ms Tx frame. The time stamp is dropped while the  */
+/*                measurement is off, so no stale period is recorded.         */
+/* !Number      : MAIN.MSG.6                                                  */
+/* !Reference   : NONE                                                        */
+/*                                                                            */
+/******************************************************************************/
+static void MAIN_MSGvidTxJitUpdate(uint8 u8Idx)
+{
+   uint32 u32LocNow;
+   uint32 u32LocPrd;
+   uint32 u32LocJit;
+
+
+   u32LocNow = MAIN_MSG_u32GET_TIME_STAMP();
+
+   /* First call after init or activation only records the time stamp */
+   if (MAIN_MSGbTimingMeasOnC == FALSE)
+   {
+      u32LocNow = 0;
+   }
+   else if (MAIN_MSGau32TxTimeStamp[u8Idx] != 0)
+   {
+      u32LocPrd = u32LocNow - MAIN_MSGau32TxTimeStamp[u8Idx];
+      if (u32LocPrd < MAIN_MSGau32TxPrdMin[u8Idx])
+      {
+         MAIN_MSGau32TxPrdMin[u8Idx] = u32LocPrd;
+      }
+      if (u32LocPrd > MAIN_MSGau32TxPrdMax[u8Idx])
+      {
+         MAIN_MSGau32TxPrdMax[u8Idx] = u32LocPrd;
+      }
+
+      if (u32LocPrd > MAIN_MSG_u32TX_PRD_10MS_TICKS)
+      {
+         u32LocJit = u32LocPrd - MAIN_MSG_u32TX_PRD_10MS_TICKS;
+      }
+      else
+      {
+         u32LocJit = MAIN_MSG_u32TX_PRD_10MS_TICKS - u32LocPrd;
+      }
+      if (u32LocJit > MAIN_MSGau32TxJitMax[u8Idx])
+      {
+         MAIN_MSGau32TxJitMax[u8Idx] = u32LocJit;
+      }
+   }
+   MAIN_MSGau32TxTimeStamp[u8Idx] = u32LocNow;
+}
+
 
 
 #define MAIN_STOP_SEC_CODE
@@ -70,7 +70,14 @@
 #include "TST_DEM.h"
 #include "TST_VADC.h"
 #include "TST_TLE8242.h"
+#if defined(TST_SPISIM_bENA) && (TST_SPISIM_bENA == 1)
+#include "TST_SPISIM.h"
+#endif
+#if defined(TST_SBRMSIM_bENA) && (TST_SBRMSIM_bENA == 1)
+#include "TST_SBRMSIM.h"
+#endif
 #include "TLE8242_wrapper.h"
+#include "Trim_8242.h"
 #include "Trim_8242_App.h"
 /*Inlcude HCU header file*/
 //#include "Subsystem.h"
@@ -231,6 +238,9 @@ CAT1_ISR(ISR_GRP_0_END_OF_CONV)
    VADC_au32IsrPeriod[0]    = u32LocTimeStamp - VADC_au32IsrTimeStamp[0];
    VADC_au32IsrTimeStamp[0] = u32LocTimeStamp;
 
+   VADC_vidIsrStatUpdate(VADC_u8ISR_STAT_GRP_0_IDX, u32LocTimeStamp);
+   VADC_vidSampleConvRes();
+
    //VADC_au16ConvRes[VADC_u8ANA_P14_RES_IDX] = VADC_u16GET_VALUE(ANA_P14);
    //VADC_au16ConvRes[VADC_u8ANA_P48_RES_IDX]  = VADC_u16GET_VALUE(ANA_P48);
 
@@ -447,6 +457,9 @@ TASK(TASK_INIT)
 /******************************************************************************/
 TASK(TASK_TIME_1MS)
 {
+#if defined(TST_SBRMSIM_bENA) && (TST_SBRMSIM_bENA == 1)
+   TST_SBRMSIM_vidMainFunction();
+#endif
    BSW_1msPreCall();
    MAIN_u32TskCtr1ms=MAIN_u32TskCtr1ms+1;
 
@@ -525,6 +538,9 @@ TASK(TASK_TIME_2MS)
 /******************************************************************************/
 TASK(TASK_TIME_5MS)
 {
+#if defined(TST_SPISIM_bENA) && (TST_SPISIM_bENA == 1)
+   TST_SPISIM_vidMainFunction();
+#endif
    BSW_5msPreCall();
    MAIN_u32TskCtr5ms=MAIN_u32TskCtr5ms+1;
 
@@ -577,6 +593,7 @@ TASK(TASK_TIME_10MS)
    TST_ADC_vidMainFunction();
    Trim_InitGainAndOffset();
    Trim_Feedback_InitGainAndOffset();
+   Trim_vidTempMainFunction();
    MAIN_MSGvidRx_Tsk10ms();
 
    /*
@@ -161,10 +161,10 @@ void ShrExp_Set_Solenoid(uint8 idx, uint8 mode, uint16 iout, uint16 iDth, uint16
 			iDth_temp = iDth/10;
 			
 			/*do trim function*/
-			TLE8242_af32TarCnrtMa[idx_temp] = Trim_CalculateGainAndOffset(idx_temp,iout_temp);
+			TLE8242_au16TarCnrtMa[idx_temp] = Trim_CalculateGainAndOffset(idx_temp,iout_temp);
 		
 			TLE8242_au8OpenLoop[idx_temp] = mode;
-			TLE8242_af32DitherAmplMa[idx_temp] = iDth_temp*2;
+			TLE8242_au16DitherAmplMa[idx_temp] = iDth_temp*2;
 			TLE8242_af32DitherFrq[idx_temp] = fDth;
 			
 			/*backup the data*/
@@ -247,7 +247,7 @@ void ShrExp_Get_Solenoid(uint8 idx, uint16 *iln, uint8 *stDiaRdy, uint8 *stDiaDs
 		if(Idx_OUT3_8242 != idx_temp)
 		{
 			//*iln = TLE8242AvgCurma[idx];
-			feedback_current_temp = (uint16)(TLE8242_af32AvgCrntMa[idx_temp]);
+			feedback_current_temp = TLE8242_au16AvgCrntMa[idx_temp];
 			iln_temp = Trim_Feedback_CalculateGainAndOffset(idx_temp,feedback_current_temp);
 			
 			*iln = iln_temp*10;   // resolution 0.1mA/bit
@@ -39,6 +39,7 @@
 
 #include "CCP.h"
 #include "CCPUSR.h"
+#include "CCPUSR_Xcp.h"
 
 #include "Evp.h"
 #include "Scu.h"
@@ -48,6 +49,7 @@
 #include "Pwm_17_Gtm.h"
 #include "IOHAL.h"
 #include "Ovc.h"
+#include "DEVHAL.h"
 #include "Vadc.h"
 #include "Os_api.h"
 #include "Gpt.h"
@@ -69,6 +71,10 @@
 #include "TLE8242.h"
 #include "DIO_WrapAPI.h"
 #include "RbBaseSw.h"
+#include "SPDSNS.h"
+#if defined(TST_SPISIM_bENA) && (TST_SPISIM_bENA == 1)
+#include "TST_SPISIM.h"
+#endif
 /******************************************************************************/
 /* DEFINES                                                                    */
 /******************************************************************************/
@@ -200,6 +206,9 @@ void BSW_vidInit(void)
    SWFAIL_vidInit();
    DEVHAL_vidInit();
    OVC_vidInit();
+#if defined(TST_SPISIM_bENA) && (TST_SPISIM_bENA == 1)
+   TST_SPISIM_vidInit();
+#endif
    TLF35584_vidInit(TLF35584_u8CHIP_STEP_B);
    TLE8242_vidInit();
    Dio_WrapAPI_Init();
@@ -207,6 +216,7 @@ void BSW_vidInit(void)
 
    IOHAL_vidInit();
    PWD_vidInit();
+   SPDSNS_vidInit();
    
    
    
@@ -298,7 +308,8 @@ void BSW_vidEnable(void)
 void BSW_1msPreCall(void)
 {
    BSW_u32FrtTM1msGlbCnt=BSW_u32FrtTM1msGlbCnt+1;
-   
+   SubRom_MainFunction();
+   SPDSNS_vidMainFunction();
 }
 
 /******************************************************************************/
@@ -315,6 +326,9 @@ void BSW_1msPreCall(void)
 void BSW_1msPostCall(void)
 {
    CCP_vidDaqListSetEvent(CCP_u8DAQ_EVT_EVENT_FAST);
+#if (CCPUSR_coXCP == CCP_coACVD)
+   CCPUSR_vidXcpDaqEvt(CCP_u8DAQ_EVT_EVENT_FAST);
+#endif
    if (BSW_bSPYBenchOnC != 0)
    {
       SPY_vidWrBuf();
@@ -436,8 +450,8 @@ void BSW_5msPreCall(void)
 /******************************************************************************/
 void BSW_5msPostCall(void)
 {
-	TLE8242_vidCtrlManagement();
 	TLE8242_vidDiagManagement();
+	TLE8242_vidCtrlManagement();
 	TLE8242_vidFaultDet();
 }
 
@@ -454,6 +468,8 @@ void BSW_5msPostCall(void)
 /******************************************************************************/
 void BSW_10msPreCall(void)
 {
+   OVC_vidPageSwtTaskBnd();
+
    BSW_u32FrtTM10msGlbCnt=BSW_u32FrtTM10msGlbCnt+1;
    
    BSW_u32FrtTemp3Cnt=BSW_u32FrtTemp3Cnt+1;
@@ -526,6 +542,14 @@ void BSW_10msPreCall(void)
 void BSW_10msPostCall(void)
 {
     CCP_vidDaqListSetEvent(CCP_u8DAQ_EVT_EVENT_MEDIUM);
+#if (CCPUSR_coXCP == CCP_coACVD)
+    CCPUSR_vidXcpDaqEvt(CCP_u8DAQ_EVT_EVENT_MEDIUM);
+#endif
+#if (CCP_coASYNC_RESP == CCP_coACVD)
+    CCP_vidAsyncRespMonr();
+#endif
+    OVC_vidPageCpyMgr();
+    DEVHAL_vidCalibStoreMainFunction();
 }
 
 /******************************************************************************/
@@ -663,6 +687,9 @@ void BSW_100msPreCall(void)
 void BSW_100msPostCall(void)
 {
    CCP_vidDaqListSetEvent(CCP_u8DAQ_EVT_EVENT_SLOW);
+#if (CCPUSR_coXCP == CCP_coACVD)
+   CCPUSR_vidXcpDaqEvt(CCP_u8DAQ_EVT_EVENT_SLOW);
+#endif
    CCP_vidMainFunction();
 }
 
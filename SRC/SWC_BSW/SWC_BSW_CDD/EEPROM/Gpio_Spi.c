@@ -101,6 +101,46 @@ void GpioSpiBurstWrite(unsigned long addr, unsigned short *ptr, unsigned long le
 	SpiBurstWrite(addr, ptr, length);
 }
 
+/*================================================================================================*/
+/**
+* @brief   This function is called in order to start an asynchronous read of multiple data.
+* @details The transfer runs in SubRom_MainFunction, notif is called at the end.
+*
+* @param[in]      addr      The request address.
+* @param[in]      ptr    	The pointer of data buffer to be stored.
+* @param[in]      length    The length of data to be read.
+* @param[in]      notif     End notification, can be 0.
+*
+* @return EepOpeStatus
+*
+* @implements BR93H66-W.
+*/
+/*================================================================================================*/
+EepOpeStatus GpioSpiAsyncBurstRead(unsigned long addr, unsigned short *ptr, unsigned long length, SubRomNotifType notif)
+{
+	return SpiAsyncBurstRead(addr, ptr, length, notif);
+}
+
+/*================================================================================================*/
+/**
+* @brief   This function is called in order to start an asynchronous write of multiple data.
+* @details The transfer runs in SubRom_MainFunction, notif is called at the end.
+*
+* @param[in]      addr      The request address.
+* @param[in]      ptr    	The pointer of data buffer to be wrote.
+* @param[in]      length    The length of data to be wrote.
+* @param[in]      notif     End notification, can be 0.
+*
+* @return EepOpeStatus
+*
+* @implements BR93H66-W.
+*/
+/*================================================================================================*/
+EepOpeStatus GpioSpiAsyncBurstWrite(unsigned long addr, const unsigned short *ptr, unsigned long length, SubRomNotifType notif)
+{
+	return SpiAsyncBurstWrite(addr, ptr, length, notif);
+}
+
 #ifdef __cplusplus
 }
 #endif
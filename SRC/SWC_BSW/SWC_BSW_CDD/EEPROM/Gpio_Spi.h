@@ -21,6 +21,8 @@
 #ifndef GPIO_SPI_H
 #define GPIO_SPI_H
 
+#include "SubRom.h"
+
 void GpioSpiWriteOneData(unsigned long addr, unsigned short WrPara);
 
 unsigned short GpioSpiReadOneData(unsigned long addr);
@@ -29,4 +31,8 @@ void GpioSpiBurstRead(unsigned long addr, unsigned short *ptr, unsigned long len
 
 void GpioSpiBurstWrite(unsigned long addr, unsigned short *ptr, unsigned long length);
 
+EepOpeStatus GpioSpiAsyncBurstRead(unsigned long addr, unsigned short *ptr, unsigned long length, SubRomNotifType notif);
+
+EepOpeStatus GpioSpiAsyncBurstWrite(unsigned long addr, const unsigned short *ptr, unsigned long length, SubRomNotifType notif);
+
 #endif
@@ -65,14 +65,12 @@ void ShrExp_SubRom_Init(void)
 
 void ShrExp_Get_SbrmIntBuffer(unsigned char *status, unsigned short *dat_p, unsigned long numDat)
 {
-	if(*status == BUSY )
+	/* BUSY is taken from the driver only, the value left in *status by a previous call is not an input */
+	if(SpiGetOpeStatus() == BUSY)	/* read still running in SubRom_MainFunction */
 	{
+		*status = BUSY;
 		return;
 	}
-	else
-	{
-		
-	}
 	
 	if(numDat > MAX_READ_BYTE)
 	{
@@ -118,14 +116,11 @@ void ShrExp_Get_SbrmIntBuffer(unsigned char *status, unsigned short *dat_p, unsi
 /*================================================================================================*/
 void ShrExp_Read_SbrmData(unsigned char * status, unsigned long adStart, unsigned long numDat)
 {
-	if(*status == BUSY )
+	if(SpiGetOpeStatus() == BUSY)	/* previous transfer not finished */
 	{
+		*status = BUSY;
 		return;
 	}
-	else
-	{
-		
-	}
 	
 	if(numDat > MAX_READ_BYTE)
 	{
@@ -135,22 +130,18 @@ void ShrExp_Read_SbrmData(unsigned char * status, unsigned long adStart, unsigne
 	{
 		*status = TOOSHORT;	/* length too short */
 	}
-	else
-	{
-		
-	}
-	
-	if(adStart <= MAX_READ_ADDR)
+	else if(adStart <= MAX_READ_ADDR)
 	{
 		*status = ACCEPTED;	/* address is ok, operation is accepted */
 	}
 	else
 	{
-		
+		*status = INVALID;
 	}
 	if(*status == ACCEPTED)
 	{
-		GpioSpiBurstRead(adStart, g_ucIntRamArray, numDat);		
+		/* clocked by SubRom_MainFunction, BUSY until done */
+		GpioSpiAsyncBurstRead(adStart, g_ucIntRamArray, numDat, 0);		
 	}
 	else
 	{
@@ -30,8 +30,48 @@ extern "C"
 #include "IOHAL.h"
 #include "Dio.h"
 #include "SubRom.h"
+#if defined(TST_SBRMSIM_bENA) && (TST_SBRMSIM_bENA == 1)
+#include "TST_SBRMSIM.h"
+#endif
+
+/* frames of an asynchronous transfer */
+typedef enum tagAsyncFrame
+{
+	FRAME_READ = 0u,	/* read command then 16*length data bits, one CS cycle */
+	FRAME_WEN,			/* write enable */
+	FRAME_WRITE,		/* write command and one data word, then write cycle */
+	FRAME_WDS			/* write disable, last frame of a write */
+}AsyncFrame;
+
+/* steps of the asynchronous state machine */
+typedef enum tagAsyncStep
+{
+	STEP_IDLE = 0u,
+	STEP_START,			/* frame to be started */
+	STEP_SHIFT,			/* frame bits being clocked */
+	STEP_WAIT_READY		/* write cycle, R/B polled once per call */
+}AsyncStep;
+
+typedef struct tagAsyncJob
+{
+	AsyncStep step;
+	AsyncFrame frame;
+	unsigned long addr;
+	unsigned short *rdPtr;
+	const unsigned short *wrPtr;
+	unsigned long length;
+	unsigned long count;	/* words done */
+	unsigned long bitIdx;
+	unsigned long nbBit;
+	unsigned short cmd;
+	unsigned short data;
+	unsigned short waitCnt;
+	EepOpeStatus result;
+	SubRomNotifType notif;
+}AsyncJob;
 
 EepOpeStatus OpeStatus = IDLE;
+static AsyncJob Async;
 
 /*================================================================================================*/
 /**
@@ -51,6 +91,7 @@ void SubRom_Init(void)
 	Dio_WriteChannel(DioConf_DioChannel_M_SUBROM_CLK, 1);
 	Dio_WriteChannel(DioConf_DioChannel_M_SUBROM_W, 1);
 	OpeStatus = IDLE;
+	Async.step = STEP_IDLE;
 	delay_us(POWERON);
 }
 
@@ -730,6 +771,319 @@ unsigned char SpiGetOpeStatus(void)
 	return (unsigned char)OpeStatus;
 }
 
+/*================================================================================================*/
+/**
+* @brief   One clock cycle of an asynchronous frame.
+* @details MOSI is set and MISO sampled while SCK is low, the EEPROM latches MOSI and shifts out
+*		   the next data bit on the rising edge.
+*
+* @param[in]      mosi		the bit to be sent
+*
+* @return unsigned char	the bit read on MISO
+*
+* @implements BR93H66-W.
+*/
+/*================================================================================================*/
+static unsigned char SpiAsyncClock(unsigned char mosi)
+{
+	unsigned char miso;
+	
+	Clr_SCK();
+	if(mosi)
+	{
+		Set_MOSI();
+	}
+	else
+	{
+		Clr_MOSI();
+	}
+	miso = Read_MISO();
+	delay_us(ASYNC_PHASE_TIME);
+	Set_SCK();
+	delay_us(ASYNC_PHASE_TIME);
+	
+	return miso;
+}
+
+/*================================================================================================*/
+/**
+* @brief   This function is called in order to start the current frame of the asynchronous job.
+* @details Builds the command word the same way as the blocking functions: dummy clock, start bit,
+*		   instruction and address, followed by the data bits of the frame.
+*
+* @param[in]      no
+*
+* @return void
+*
+* @implements BR93H66-W.
+*/
+/*================================================================================================*/
+static void SpiAsyncFrameStart(void)
+{
+	switch(Async.frame)
+	{
+		case FRAME_READ:
+			Async.cmd = (HEADER<<10) | (READ<<8) | (Async.addr & 0xff);
+			Async.nbBit = 2 + 2 + 8 + 1 + 16*Async.length;
+			Async.data = 0;
+			break;
+		case FRAME_WEN:
+			Async.cmd = (HEADER<<10) | (WEN<<8) | 0xff;
+			Async.nbBit = 2 + 2 + 8;
+			break;
+		case FRAME_WRITE:
+			Async.cmd = (HEADER<<10) | (WRITE<<8) | ((Async.addr + Async.count) & 0xff);
+			Async.data = Async.wrPtr[Async.count];
+			Async.nbBit = 2 + 2 + 8 + 16;
+			break;
+		default:
+			Async.cmd = (HEADER<<10) | (WDS<<8) | 0x3f;
+			Async.nbBit = 2 + 2 + 8;
+			break;
+	}
+	Async.bitIdx = 0;
+	
+	Clr_MOSI();
+	delay_us(ASYNC_PHASE_TIME);
+	Clr_SCK();
+	delay_us(ASYNC_PHASE_TIME);
+	Set_CS();
+	Async.step = STEP_SHIFT;
+}
+
+/*================================================================================================*/
+/**
+* @brief   This function is called in order to end the asynchronous job and notify the caller.
+*
+* @param[in]      status	DONE or FAULT
+*
+* @return void
+*
+* @implements BR93H66-W.
+*/
+/*================================================================================================*/
+static void SpiAsyncEnd(EepOpeStatus status)
+{
+	Async.step = STEP_IDLE;
+	OpeStatus = status;
+	if(Async.notif != 0)
+	{
+		Async.notif(status);
+	}
+}
+
+/*================================================================================================*/
+/**
+* @brief   This function is called in order to end the current frame and select the next one.
+*
+* @param[in]      no
+*
+* @return void
+*
+* @implements BR93H66-W.
+*/
+/*================================================================================================*/
+static void SpiAsyncFrameEnd(void)
+{
+	Clr_SCK();
+	delay_us(ASYNC_PHASE_TIME);
+	Clr_CS();
+	delay_us(ASYNC_PHASE_TIME);
+	Set_SCK();
+	Set_MOSI();
+	
+	switch(Async.frame)
+	{
+		case FRAME_READ:
+			SpiAsyncEnd(DONE);
+			break;
+		case FRAME_WEN:
+			Async.frame = FRAME_WRITE;
+			Async.step = STEP_START;
+			break;
+		case FRAME_WRITE:
+			/* CS high again shows R/B on MISO */
+			delay_us(ASYNC_PHASE_TIME);
+			Set_CS();
+			Async.waitCnt = 0;
+			Async.step = STEP_WAIT_READY;
+			break;
+		default:
+			SpiAsyncEnd(Async.result);
+			break;
+	}
+}
+
+/*================================================================================================*/
+/**
+* @brief   This function is called in order to start an asynchronous read of multiple data.
+* @details The transfer is clocked by SubRom_MainFunction, ASYNC_BIT_PER_CALL clock cycles per call,
+*		   the status is BUSY until the end, then DONE and notif is called.
+*		   Must not be mixed with the blocking functions while BUSY.
+*
+* @param[in]      addr      The request address.
+* @param[in]      ptr    	The pointer of data buffer to be stored, valid until the end.
+* @param[in]      length    The length of data to be read.
+* @param[in]      notif     End notification, can be 0.
+*
+* @return EepOpeStatus	ACCEPTED, BUSY if a transfer is ongoing, INVALID for a wrong parameter
+*
+* @implements BR93H66-W.
+*/
+/*================================================================================================*/
+EepOpeStatus SpiAsyncBurstRead(unsigned long addr, unsigned short *ptr, unsigned long length, SubRomNotifType notif)
+{
+	if(Async.step != STEP_IDLE)
+	{
+		return BUSY;
+	}
+	if((ptr == 0) || (length == 0))
+	{
+		return INVALID;
+	}
+	
+	Async.frame = FRAME_READ;
+	Async.addr = addr;
+	Async.rdPtr = ptr;
+	Async.length = length;
+	Async.count = 0;
+	Async.result = DONE;
+	Async.notif = notif;
+	OpeStatus = BUSY;
+	Async.step = STEP_START;
+	
+	return ACCEPTED;
+}
+
+/*================================================================================================*/
+/**
+* @brief   This function is called in order to start an asynchronous write of multiple data.
+* @details Write enable, then one write command and write cycle per data, then write disable. The
+*		   write cycles are polled once per SubRom_MainFunction call, the status is FAULT if one
+*		   does not end within ASYNC_WRITE_TIMEOUT calls, the remaining data are then not written.
+*
+* @param[in]      addr      The request address.
+* @param[in]      ptr    	The pointer of data buffer to be wrote, valid until the end.
+* @param[in]      length    The length of data to be wrote.
+* @param[in]      notif     End notification, can be 0.
+*
+* @return EepOpeStatus	ACCEPTED, BUSY if a transfer is ongoing, INVALID for a wrong parameter
+*
+* @implements BR93H66-W.
+*/
+/*================================================================================================*/
+EepOpeStatus SpiAsyncBurstWrite(unsigned long addr, const unsigned short *ptr, unsigned long length, SubRomNotifType notif)
+{
+	if(Async.step != STEP_IDLE)
+	{
+		return BUSY;
+	}
+	if((ptr == 0) || (length == 0))
+	{
+		return INVALID;
+	}
+	
+	Async.frame = FRAME_WEN;
+	Async.addr = addr;
+	Async.wrPtr = ptr;
+	Async.length = length;
+	Async.count = 0;
+	Async.result = DONE;
+	Async.notif = notif;
+	OpeStatus = BUSY;
+	Async.step = STEP_START;
+	
+	return ACCEPTED;
+}
+
+/*================================================================================================*/
+/**
+* @brief   This function is called every 1ms in order to clock the asynchronous transfer.
+* @details At most ASYNC_BIT_PER_CALL clock cycles per call, a frame can span several calls, CS
+*		   stays high in between (the EEPROM clock has no minimum frequency).
+*
+* @param[in]      no
+*
+* @return void
+*
+* @implements BR93H66-W.
+*/
+/*================================================================================================*/
+void SubRom_MainFunction(void)
+{
+	unsigned long budget = ASYNC_BIT_PER_CALL;
+	unsigned long idx;
+	unsigned char mosi;
+	unsigned char miso;
+	
+	while((budget > 0) && (Async.step != STEP_IDLE))
+	{
+		if(Async.step == STEP_START)
+		{
+			SpiAsyncFrameStart();
+		}
+		else if(Async.step == STEP_SHIFT)
+		{
+			idx = Async.bitIdx;
+			if(idx < 12) /* command */
+			{
+				mosi = (Async.cmd>>(12 - idx - 1))&0x01;
+			}
+			else if(Async.frame == FRAME_WRITE) /* write data */
+			{
+				mosi = (Async.data>>(15 - (idx - 12)))&0x01;
+			}
+			else /* read data, first bit is the dummy 0 */
+			{
+				mosi = 0;
+			}
+			miso = SpiAsyncClock(mosi);
+			
+			if((Async.frame == FRAME_READ) && (idx >= 13))
+			{
+				Async.data = (Async.data<<1) | miso;
+				if(((idx - 13)%16) == 15)
+				{
+					Async.rdPtr[Async.count++] = Async.data;
+					Async.data = 0;
+				}
+			}
+			
+			Async.bitIdx++;
+			budget--;
+			if(Async.bitIdx >= Async.nbBit)
+			{
+				SpiAsyncFrameEnd();
+			}
+		}
+		else /* STEP_WAIT_READY */
+		{
+			if(Read_MISO())
+			{
+				Clr_CS();
+				Set_MOSI();
+				Async.count++;
+				Async.frame = (Async.count < Async.length) ? FRAME_WRITE : FRAME_WDS;
+				Async.step = STEP_START;
+			}
+			else if(++Async.waitCnt >= ASYNC_WRITE_TIMEOUT)
+			{
+				/* remaining data dropped, write disable still sent */
+				Clr_CS();
+				Set_MOSI();
+				Async.result = FAULT;
+				Async.frame = FRAME_WDS;
+				Async.step = STEP_START;
+			}
+			else
+			{
+				/* next call */
+				budget = 0;
+			}
+		}
+	}
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -32,6 +32,10 @@
 #define WAITCS_TIME	500
 #define WRITETIMEOUT 38000
 #define HEADER	1
+/* asynchronous transfer, SubRom_MainFunction called every 1ms */
+#define ASYNC_PHASE_TIME	1	/* us, half clock period, >= tSKH / tSKL / tCSS */
+#define ASYNC_BIT_PER_CALL	32	/* clock cycles per SubRom_MainFunction call */
+#define ASYNC_WRITE_TIMEOUT	10	/* SubRom_MainFunction calls, >= tE/W */
 
 /* Eeprom Operation Mode */
 typedef enum tagEepOpeMode
@@ -58,6 +62,9 @@ typedef enum tagEepOpeStatus
 	INVALID = 0xff
 }EepOpeStatus;
 
+/* end of asynchronous transfer: DONE, or FAULT if a write cycle timed out */
+typedef void (*SubRomNotifType)(EepOpeStatus status);
+
 extern EepOpeStatus OpeStatus;
 
 void delay_us(unsigned int us);
@@ -94,4 +101,10 @@ void SpiWaitWriteFinish(void);
 
 unsigned char SpiGetOpeStatus(void);
 
+EepOpeStatus SpiAsyncBurstRead(unsigned long addr, unsigned short *ptr, unsigned long length, SubRomNotifType notif);
+
+EepOpeStatus SpiAsyncBurstWrite(unsigned long addr, const unsigned short *ptr, unsigned long length, SubRomNotifType notif);
+
+void SubRom_MainFunction(void);
+
 #endif
@@ -21,6 +21,9 @@
 /*                                                                                                                    */
 /**********************************************************************************************************************/
 /* 1 / EVP_vidInit                                                                                                    */
+/* 2 / EVP_bSetPwm                                                                                                    */
+/* 3 / EVP_bCommitPwm                                                                                                 */
+/* 4 / EVP_vidWritePwm                                                                                                */
 /************************************************ </AUTO_FILE_HEADER> *************************************************/
 /* PVCS Information                                                                                                   */
 /* $Archive::   P:/VE_S97/LOG/60_ComponentArchive/Archives/COMP_SWC_BSW_MCAL_MPC5676/adc_api.h_v                     $*/
@@ -42,6 +45,8 @@
 #define EVP_START_SEC_CODE
 #include "EVP_MemMap.h"
 
+static void EVP_vidWritePwm(uint8 u8GrpIdx, uint32 u32Prd, uint16 u16Duty, boolean bFrcUpd);
+
 /*********************************************** <AUTO_FUNCTION_HEADER> ***********************************************/
 /*                                                                                                                    */
 /* !FuncName    : EVP_vidInit                                                                                         */
@@ -101,13 +106,18 @@ void EVP_vidInit(void)
 
    EVP_akstGrp[EVP_u8GRP_0_IDX].pstTgc->ENDIS_STAT.U = EVP_u32GRP_0_ENDIS_STAT_CHAN_ENA;
 
+   /* !Comment: first commit always writes the duty cycle */
+   EVP_au32PrdCmt[EVP_u8GRP_0_IDX]        = EVP_akstGrp[EVP_u8GRP_0_IDX].astCfgChan[0].SR0.U;
+   EVP_au16DutyCmt[EVP_u8GRP_0_IDX][0]    = UINT16_MAX;
+   EVP_abUpdPnd[EVP_u8GRP_0_IDX]          = FALSE;
+   EVP_au16MissPrdUpdCnt[EVP_u8GRP_0_IDX] = 0u;
 }
 
 /*********************************************** <AUTO_FUNCTION_HEADER> ***********************************************/
 /*                                                                                                                    */
 /* !FuncName    : EVP_bSetPwm                                                                                         */
 /*                                                                                                                    */
-/* !Description : Set period and duty cycles                                                                          */
+/* !Description : Stage period and duty cycle of a group and commit them                                              */
 /* !Number      : 2                                                                                                   */
 /* !Reference   : NONE                                                                                                */
 /*                                                                                                                    */
@@ -121,39 +131,133 @@ void EVP_vidInit(void)
 
 boolean EVP_bSetPwm(uint8 u8GrpIdx, uint32 u32Prd, const uint16 * pu16Duty)
 {
-   Ifx_GTM_TOM_CH_TYPE * pstLocPtr;
-   const EVP_tstGrp    * pkstGrp;
    boolean               bStatus;
-   uint32                u32Ton;
 
 
-   bStatus = TRUE;
+   bStatus = FALSE;
    if (u8GrpIdx < EVP_u8NB_GROUP)
    {      
-      pkstGrp = &EVP_akstGrp[u8GrpIdx];
-      pkstGrp->pstTgc->GLB_CTRL.U = pkstGrp->u32UpdDisa;
-
-      pstLocPtr             = pkstGrp->pstCh;
-      //u32Prd = MATHSRV_udtCLAMP(u32Prd, EVP_u16PRD_MIN, EVP_u16PRD_MAX);
-      pstLocPtr->SR0.U      = u32Prd;
-	  u32Ton = (((u32Prd * (uint32)(*pu16Duty)) + (1u << 13)) >> 14);
-	  u32Ton = MATHSRV_udtMIN(u32Ton, u32Prd);
-	  pstLocPtr->SR1.U      = u32Ton;
-	 pstLocPtr++;
-	 pstLocPtr->SR1.U      = u32Ton;
-	 u32Ton = u32Ton + EVP_u16DELAY_5MICROS;
-	 u32Ton = MATHSRV_udtMIN(u32Ton, u32Prd);
-	 pstLocPtr->SR0.U       = u32Ton;
-      
-	  pkstGrp->pstTgc->GLB_CTRL.U = pkstGrp->u32UpdEna;
+      EVP_au32Prd[u8GrpIdx]     = u32Prd;
+      EVP_au16Duty[u8GrpIdx][0] = *pu16Duty;
+      bStatus = EVP_bCommitPwm(u8GrpIdx, FALSE);
    }
-   else
+   return(bStatus);
+}
+
+/*********************************************** <AUTO_FUNCTION_HEADER> ***********************************************/
+/*                                                                                                                    */
+/* !FuncName    : EVP_bCommitPwm                                                                                      */
+/*                                                                                                                    */
+/* !Description : Commit the staged period and duty cycle (EVP_SetPrd / EVP_SetDuty) of a group                       */
+/* !Number      : 3                                                                                                   */
+/* !Reference   : NONE                                                                                                */
+/*                                                                                                                    */
+/* !Trace_To    : NONE                                                                                                */
+/*                                                                                                                    */
+/********************************************** </AUTO_FUNCTION_HEADER> ***********************************************/
+/* !Trigger  : ISR                                                                                                    */
+/*                                                                                                                    */
+/* !LastAuthor  :  E. Moas                                                                                            */
+/********************************************* <AUTO_FUNCTION_PROTOTYPE> **********************************************/
+
+boolean EVP_bCommitPwm(uint8 u8GrpIdx, boolean bFrcUpd)
+{
+   boolean               bStatus;
+
+
+   bStatus = FALSE;
+   if (  (u8GrpIdx < EVP_u8NB_GROUP)
+      && (EVP_au32Prd[u8GrpIdx] != 0u))
    {
-      bStatus = FALSE;
+      bStatus = TRUE;
+      /* !Comment: nothing is written to the TOM when the staged values are already the committed ones */
+      if (  (bFrcUpd != FALSE)
+         || (EVP_au32Prd[u8GrpIdx] != EVP_au32PrdCmt[u8GrpIdx])
+         || (EVP_au16Duty[u8GrpIdx][0] != EVP_au16DutyCmt[u8GrpIdx][0]))
+      {
+         EVP_vidWritePwm(u8GrpIdx, EVP_au32Prd[u8GrpIdx], EVP_au16Duty[u8GrpIdx][0], bFrcUpd);
+      }
    }
    return(bStatus);
 }
 
+/*********************************************** <AUTO_FUNCTION_HEADER> ***********************************************/
+/*                                                                                                                    */
+/* !FuncName    : EVP_vidWritePwm                                                                                     */
+/*                                                                                                                    */
+/* !Description : Write the shadow registers of a group with its update disabled                                      */
+/* !Number      : 4                                                                                                   */
+/* !Reference   : NONE                                                                                                */
+/*                                                                                                                    */
+/* !Trace_To    : NONE                                                                                                */
+/*                                                                                                                    */
+/********************************************** </AUTO_FUNCTION_HEADER> ***********************************************/
+/* !Trigger  : ISR                                                                                                    */
+/*                                                                                                                    */
+/* !LastAuthor  :  E. Moas                                                                                            */
+/********************************************* <AUTO_FUNCTION_PROTOTYPE> **********************************************/
+
+static void EVP_vidWritePwm(uint8 u8GrpIdx, uint32 u32Prd, uint16 u16Duty, boolean bFrcUpd)
+{
+   Ifx_GTM_TOM_CH_TYPE * pstLocPtr;
+   const EVP_tstGrp    * pkstGrp;
+   boolean               bLocPrdEnd;
+   boolean               bLocMiss;
+   uint32                u32Ton;
+
+
+   pkstGrp = &EVP_akstGrp[u8GrpIdx];
+   pkstGrp->pstTgc->GLB_CTRL.U = pkstGrp->u32UpdDisa;
+
+   /* !Comment: CCU0TC of the period channel is set at each period end, even with its interrupt disabled */
+   pstLocPtr  = pkstGrp->pstCh;
+   bLocPrdEnd = ((pstLocPtr->IRQ_NOTIFY.U & GTM_TOM_CHx_IRQ_NOTIFY_CCU0TC) != 0u) ? TRUE : FALSE;
+   pstLocPtr->IRQ_NOTIFY.U = GTM_TOM_CHx_IRQ_NOTIFY_CCU0TC;
+   /* !Comment: the previous commit is overwritten before it reached the outputs */
+   bLocMiss = ((EVP_abUpdPnd[u8GrpIdx] != FALSE) && (bLocPrdEnd == FALSE)) ? TRUE : FALSE;
+
+   if (u32Prd != EVP_au32PrdCmt[u8GrpIdx])
+   {
+      pstLocPtr->SR0.U   = u32Prd;
+   }
+   u32Ton = (((u32Prd * (uint32)u16Duty) + (1u << 13)) >> 14);
+   u32Ton = MATHSRV_udtMIN(u32Ton, u32Prd);
+   pstLocPtr->SR1.U      = u32Ton;
+   pstLocPtr++;
+   pstLocPtr->SR1.U      = u32Ton;
+   u32Ton = u32Ton + EVP_u16DELAY_5MICROS;
+   u32Ton = MATHSRV_udtMIN(u32Ton, u32Prd);
+   pstLocPtr->SR0.U      = u32Ton;
+
+   if (bFrcUpd != FALSE)
+   {
+      /* !Comment: shadow registers copied at once by the host trigger, the counter is not reset */
+      pkstGrp->pstTgc->FUPD_CTRL.U = pkstGrp->u32FrcUpdEna;
+      pkstGrp->pstTgc->GLB_CTRL.U  = pkstGrp->u32UpdEna | GTM_TOM_TGC_GLB_CTRL_HOST_TRIG_SET_TRIG_REQ;
+      pkstGrp->pstTgc->FUPD_CTRL.U = pkstGrp->u32FrcUpdDisa;
+      EVP_abUpdPnd[u8GrpIdx] = FALSE;
+   }
+   else
+   {
+      pkstGrp->pstTgc->GLB_CTRL.U = pkstGrp->u32UpdEna;
+      EVP_abUpdPnd[u8GrpIdx] = TRUE;
+      if ((pkstGrp->pstCh->IRQ_NOTIFY.U & GTM_TOM_CHx_IRQ_NOTIFY_CCU0TC) != 0u)
+      {
+         /* !Comment: period end while the update was disabled, the new values start one period late */
+         pkstGrp->pstCh->IRQ_NOTIFY.U = GTM_TOM_CHx_IRQ_NOTIFY_CCU0TC;
+         bLocMiss = TRUE;
+      }
+   }
+
+   if (  (bLocMiss != FALSE)
+      && (EVP_au16MissPrdUpdCnt[u8GrpIdx] < UINT16_MAX))
+   {
+      EVP_au16MissPrdUpdCnt[u8GrpIdx]++;
+   }
+   EVP_au32PrdCmt[u8GrpIdx]     = u32Prd;
+   EVP_au16DutyCmt[u8GrpIdx][0] = u16Duty;
+}
+
 #define EVP_STOP_SEC_CODE
 #include "EVP_MemMap.h"
 
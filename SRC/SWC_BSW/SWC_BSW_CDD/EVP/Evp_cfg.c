@@ -43,6 +43,8 @@ const EVP_tstGrp EVP_akstGrp[EVP_u8NB_GROUP] =
        },
        EVP_u32GRP_0_UPDATE_ENABLE,
        EVP_u32GRP_0_UPDATE_DISABLE,
+       EVP_u32GRP_0_FORCE_UPDATE_ENABLE,
+       EVP_u32GRP_0_FORCE_UPDATE_DISABLE,
        EVP_u32GRP_0_SIZE
     }
 };
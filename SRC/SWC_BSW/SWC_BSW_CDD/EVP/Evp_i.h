@@ -73,6 +73,8 @@
 #define GTM_TOM_CHx_CTRL_GCM_GATED_COUNTER_MODE_DISA   (0u << 29)
 #define GTM_TOM_CHx_CTRL_GCM_GATED_COUNTER_MODE_ENA    (1u << 29)
 
+#define GTM_TOM_CHx_IRQ_NOTIFY_CCU0TC                  (1u << 0)
+
 #define GTM_TOM_TGC_GLB_CTRL_HOST_TRIG_NOP          (0u << 0)
 #define GTM_TOM_TGC_GLB_CTRL_HOST_TRIG_SET_TRIG_REQ (1u << 0)
 #define GTM_TOM_TGC_GLB_CTRL_RST_CH0_NOP        (0u << 8)
@@ -275,6 +277,14 @@
 #define EVP_u32GRP_0_UPDATE_ENABLE \
   ( GTM_TOM_TGC_GLB_CTRL_UPEN_CTRL1_UPD_ENA \
   | GTM_TOM_TGC_GLB_CTRL_UPEN_CTRL2_UPD_ENA)
+
+#define EVP_u32GRP_0_FORCE_UPDATE_DISABLE \
+  ( GTM_TOM_TGC_FUPD_CTRL_FUPD_CTRL1_FORCE_DISA \
+  | GTM_TOM_TGC_FUPD_CTRL_FUPD_CTRL2_FORCE_DISA)
+
+#define EVP_u32GRP_0_FORCE_UPDATE_ENABLE \
+  ( GTM_TOM_TGC_FUPD_CTRL_FUPD_CTRL1_FORCE_ENA \
+  | GTM_TOM_TGC_FUPD_CTRL_FUPD_CTRL2_FORCE_ENA)
  
 #define EVP_u32GRP_0_OUTEN_CTRL \
    ( GTM_TOM_OUTEN_CTRL_OUTEN_CTRL1_NOP \
@@ -318,6 +328,8 @@ typedef struct
    EVP_tstCfgChan         astCfgChan[EVP_u8NB_CH_MAX_BY_GROUP];
    uint32                 u32UpdEna;
    uint32                 u32UpdDisa;
+   uint32                 u32FrcUpdEna;
+   uint32                 u32FrcUpdDisa;
    uint8                  u8Size;
 } EVP_tstGrp;
 
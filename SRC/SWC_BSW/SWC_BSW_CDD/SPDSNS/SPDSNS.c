@@ -0,0 +1,396 @@
+/**********************************************************************************************************************/
+/* !Layer           : HAL                                                                                             */
+/* !Component       : SPDSNS                                                                                          */
+/* !Description     : Transmission speed sensors measurement service                                                  */
+/*                                                                                                                    */
+/* !File            : SPDSNS.c                                                                                        */
+/* !Description     : Period averaging, outlier rejection and zero speed detection of the G4, C4 and TOSS sensors     */
+/*                                                                                                                    */
+/* !Reference       :                                                                                                 */
+/*                                                                                                                    */
+/* Coding language  : C                                                                                               */
+/*                                                                                                                    */
+/* COPYRIGHT VALEO all rights reserved                                                                                */
+/**********************************************************************************************************************/
+/* Dimension Informations
+ * %PCMS_HEADER_SUBSTITUTION_START:%
+ * The PID has this format: <Product ID>:<Item ID>.<Variant>-<Item Type>;<Revision>
+ * %PID:%
+ * %PCMS_HEADER_SUBSTITUTION_END:%
+ **********************************************************************************************************************/
+
+#include "Std_Types.h"
+#include "Std_Limits.h"
+
+#include "Icu_17_GtmCcu6.h"
+#include "SPDSNS.h"
+
+#define SPDSNS_START_SEC_CODE
+#include "SPDSNS_MemMap.h"
+
+/* ICU channel of each sensor, SPDSNS_u8IDX_* order */
+static const Icu_17_GtmCcu6_ChannelType SPDSNS_kaudtIcuCh[SPDSNS_u8NB_SNS] =
+{
+   IcuConf_IcuChannel_M_G4_SPD_SNS,
+   IcuConf_IcuChannel_M_C4_SPD_SNS,
+   IcuConf_IcuChannel_M_TOSS
+};
+
+static uint8 SPDSNS_u8GetNbSmpl(void);
+static void SPDSNS_vidRstWin(uint8 u8Sns);
+static boolean SPDSNS_bAddSmpl(uint8 u8Sns, uint32 u32Prd);
+static uint16 SPDSNS_u16CalcSpd(uint8 u8Sns, uint32 u32Tick, uint8 u8NbPrd);
+static uint8 SPDSNS_u8CalcDir(uint32 u32InactTick);
+static void SPDSNS_vidUpdSns(uint8 u8Sns);
+
+/**********************************************************************************************************************/
+/* !FuncName    : SPDSNS_vidInit                                                                                      */
+/* !Description : Reset of the windows and snapshot, start of the signal measurement of the speed channels            */
+/*                                                                                                                    */
+/* !LastAuthor  :                                                                                                     */
+/**********************************************************************************************************************/
+void SPDSNS_vidInit(void)
+{
+   uint8 u8LocSns;
+
+   for (u8LocSns = 0u; u8LocSns < SPDSNS_u8NB_SNS; u8LocSns++)
+   {
+      SPDSNS_au8PlsPerRev[u8LocSns]     = SPDSNS_kau8PlsPerRevDft[u8LocSns];
+      SPDSNS_au16SmplAge[u8LocSns]      = UINT16_MIN;
+      SPDSNS_stWork.au16Spd[u8LocSns]   = UINT16_MIN;
+      SPDSNS_stWork.au8Dir[u8LocSns]    = SPDSNS_u8DIR_UNKNOWN;
+      SPDSNS_stWork.au8Sts[u8LocSns]    = SPDSNS_u8STS_NO_SIG;
+      SPDSNS_vidRstWin(u8LocSns);
+      Icu_17_GtmCcu6_StartSignalMeasurement(SPDSNS_kaudtIcuCh[u8LocSns]);
+   }
+   SPDSNS_astSnap[0] = SPDSNS_stWork;
+   SPDSNS_astSnap[1] = SPDSNS_stWork;
+   SPDSNS_u8SnapIdx  = 0u;
+   SPDSNS_u8SnapSeq  = 0u;
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : SPDSNS_vidMainFunction                                                                              */
+/* !Description : Called every 1 ms: consumes the new ICU periods and publishes the snapshot of all the sensors       */
+/*                                                                                                                    */
+/* !LastAuthor  :                                                                                                     */
+/**********************************************************************************************************************/
+void SPDSNS_vidMainFunction(void)
+{
+   uint8 u8LocSns;
+   uint8 u8LocIdx;
+
+   for (u8LocSns = 0u; u8LocSns < SPDSNS_u8NB_SNS; u8LocSns++)
+   {
+      SPDSNS_vidUpdSns(u8LocSns);
+   }
+
+   /* !Comment: readers copy the active buffer, a publish during their copy is detected with the sequence counter */
+   u8LocIdx = (uint8)(SPDSNS_u8SnapIdx ^ 1u);
+   SPDSNS_astSnap[u8LocIdx] = SPDSNS_stWork;
+   SPDSNS_u8SnapIdx = u8LocIdx;
+   SPDSNS_u8SnapSeq = (uint8)(SPDSNS_u8SnapSeq + 1u);
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : SPDSNS_vidSetPlsPerRev                                                                              */
+/* !Description : Pulses per revolution of the G4, C4 and TOSS targets, 0 keeps the default calibration               */
+/*                                                                                                                    */
+/* !LastAuthor  :                                                                                                     */
+/**********************************************************************************************************************/
+void SPDSNS_vidSetPlsPerRev(const uint8 *pku8PlsPerRev)
+{
+   uint8 u8LocSns;
+
+   if (pku8PlsPerRev != NULL_PTR)
+   {
+      for (u8LocSns = 0u; u8LocSns < SPDSNS_u8NB_SNS; u8LocSns++)
+      {
+         if (pku8PlsPerRev[u8LocSns] != 0u)
+         {
+            SPDSNS_au8PlsPerRev[u8LocSns] = pku8PlsPerRev[u8LocSns];
+         }
+         else
+         {
+            SPDSNS_au8PlsPerRev[u8LocSns] = SPDSNS_kau8PlsPerRevDft[u8LocSns];
+         }
+      }
+   }
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : SPDSNS_vidGetSnapshot                                                                               */
+/* !Description : Consistent copy of the speed, direction and status of all the sensors                              */
+/*                                                                                                                    */
+/* !LastAuthor  :                                                                                                     */
+/**********************************************************************************************************************/
+void SPDSNS_vidGetSnapshot(SPDSNS_tstSnapshot *pstSnap)
+{
+   uint8 u8LocSeq;
+
+   if (pstSnap != NULL_PTR)
+   {
+      do
+      {
+         u8LocSeq = SPDSNS_u8SnapSeq;
+         *pstSnap = SPDSNS_astSnap[SPDSNS_u8SnapIdx];
+      } while (u8LocSeq != SPDSNS_u8SnapSeq);
+   }
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : SPDSNS_u8GetNbSmpl                                                                                  */
+/* !Description : Window size from the calibration, bounded to the buffer                                             */
+/*                                                                                                                    */
+/* !LastAuthor  :                                                                                                     */
+/**********************************************************************************************************************/
+static uint8 SPDSNS_u8GetNbSmpl(void)
+{
+   uint8 u8LocNb;
+
+   u8LocNb = SPDSNS_ku8NbSmpl;
+   if (u8LocNb == 0u)
+   {
+      u8LocNb = 1u;
+   }
+   else if (u8LocNb > SPDSNS_u8NB_SMPL_MAX)
+   {
+      u8LocNb = SPDSNS_u8NB_SMPL_MAX;
+   }
+   else
+   {
+      /* !Comment: calibration used as is */
+   }
+   return u8LocNb;
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : SPDSNS_vidRstWin                                                                                    */
+/* !Description : Empties the period window of one sensor                                                             */
+/*                                                                                                                    */
+/* !LastAuthor  :                                                                                                     */
+/**********************************************************************************************************************/
+static void SPDSNS_vidRstWin(uint8 u8Sns)
+{
+   SPDSNS_au32SmplSum[u8Sns]   = 0u;
+   SPDSNS_au8SmplCnt[u8Sns]    = 0u;
+   SPDSNS_au8SmplIdx[u8Sns]    = 0u;
+   SPDSNS_au8OutlierCnt[u8Sns] = 0u;
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : SPDSNS_bAddSmpl                                                                                     */
+/* !Description : Adds a period to the window unless it is an outlier. SPDSNS_ku8OutlierNbMax consecutive outliers    */
+/*                are taken as a real speed step and restart the window.                                              */
+/*                                                                                                                    */
+/* !LastAuthor  :                                                                                                     */
+/**********************************************************************************************************************/
+static boolean SPDSNS_bAddSmpl(uint8 u8Sns, uint32 u32Prd)
+{
+   uint8 u8LocNb;
+   uint8 u8LocCnt;
+   uint8 u8LocIdx;
+   uint32 u32LocAvg;
+   uint32 u32LocDev;
+   boolean bLocAdd;
+
+   bLocAdd  = TRUE;
+   u8LocNb  = SPDSNS_u8GetNbSmpl();
+   if (SPDSNS_au8SmplCnt[u8Sns] > u8LocNb)
+   {
+      /* !Comment: window size calibration decreased */
+      SPDSNS_vidRstWin(u8Sns);
+   }
+   u8LocCnt = SPDSNS_au8SmplCnt[u8Sns];
+
+   if (u8LocCnt != 0u)
+   {
+      u32LocAvg = SPDSNS_au32SmplSum[u8Sns] / u8LocCnt;
+      if (u32Prd > u32LocAvg)
+      {
+         u32LocDev = u32Prd - u32LocAvg;
+      }
+      else
+      {
+         u32LocDev = u32LocAvg - u32Prd;
+      }
+
+      /* !Comment: u32LocAvg is below 2^24 (TIM width): no overflow */
+      if ((u32LocDev * 100u) > (u32LocAvg * SPDSNS_ku8OutlierTolPct))
+      {
+         if (SPDSNS_au8OutlierCnt[u8Sns] < SPDSNS_ku8OutlierNbMax)
+         {
+            SPDSNS_au8OutlierCnt[u8Sns]++;
+            bLocAdd = FALSE;
+         }
+         else
+         {
+            SPDSNS_vidRstWin(u8Sns);
+            u8LocCnt = 0u;
+         }
+      }
+   }
+
+   if (bLocAdd != FALSE)
+   {
+      SPDSNS_au8OutlierCnt[u8Sns] = 0u;
+      u8LocIdx = SPDSNS_au8SmplIdx[u8Sns];
+      if (u8LocCnt >= u8LocNb)
+      {
+         SPDSNS_au32SmplSum[u8Sns] -= SPDSNS_au32SmplBuf[u8Sns][u8LocIdx];
+      }
+      else
+      {
+         SPDSNS_au8SmplCnt[u8Sns] = (uint8)(u8LocCnt + 1u);
+      }
+      SPDSNS_au32SmplBuf[u8Sns][u8LocIdx] = u32Prd;
+      SPDSNS_au32SmplSum[u8Sns] += u32Prd;
+
+      u8LocIdx++;
+      if (u8LocIdx >= u8LocNb)
+      {
+         u8LocIdx = 0u;
+      }
+      SPDSNS_au8SmplIdx[u8Sns] = u8LocIdx;
+   }
+   return bLocAdd;
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : SPDSNS_u16CalcSpd                                                                                   */
+/* !Description : Speed in rpm of u8NbPrd periods lasting u32Tick TIM ticks, rounded and saturated                    */
+/*                                                                                                                    */
+/* !LastAuthor  :                                                                                                     */
+/**********************************************************************************************************************/
+static uint16 SPDSNS_u16CalcSpd(uint8 u8Sns, uint32 u32Tick, uint8 u8NbPrd)
+{
+   uint64 u64LocDen;
+   uint64 u64LocSpd;
+   uint16 u16LocSpd;
+
+   u64LocDen = (uint64)u32Tick * SPDSNS_au8PlsPerRev[u8Sns];
+   if (u64LocDen == 0u)
+   {
+      u16LocSpd = UINT16_MIN;
+   }
+   else
+   {
+      u64LocSpd = (((uint64)SPDSNS_u32TICK_PER_MIN * u8NbPrd) + (u64LocDen >> 1)) / u64LocDen;
+      if (u64LocSpd > UINT16_MAX)
+      {
+         u16LocSpd = UINT16_MAX;
+      }
+      else
+      {
+         u16LocSpd = (uint16)u64LocSpd;
+      }
+   }
+   return u16LocSpd;
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : SPDSNS_u8CalcDir                                                                                    */
+/* !Description : Rotation direction coded by the inactive time of the sensor pulse                                   */
+/*                                                                                                                    */
+/* !LastAuthor  :                                                                                                     */
+/**********************************************************************************************************************/
+static uint8 SPDSNS_u8CalcDir(uint32 u32InactTick)
+{
+   uint8 u8LocDir;
+
+   if (  (u32InactTick >= SPDSNS_kau16DirInactMin[0])
+      && (u32InactTick <= SPDSNS_kau16DirInactMax[0]))
+   {
+      u8LocDir = SPDSNS_u8DIR_FWD;
+   }
+   else if (  (u32InactTick >= SPDSNS_kau16DirInactMin[1])
+           && (u32InactTick <= SPDSNS_kau16DirInactMax[1]))
+   {
+      u8LocDir = SPDSNS_u8DIR_REV;
+   }
+   else
+   {
+      u8LocDir = SPDSNS_u8DIR_UNKNOWN;
+   }
+   return u8LocDir;
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : SPDSNS_vidUpdSns                                                                                    */
+/* !Description : One sensor: new period from the ICU, else decay of the speed with the time without edge and zero    */
+/*                speed after SPDSNS_ku16ToutMs                                                                       */
+/*                                                                                                                    */
+/* !LastAuthor  :                                                                                                     */
+/**********************************************************************************************************************/
+static void SPDSNS_vidUpdSns(uint8 u8Sns)
+{
+   Icu_17_GtmCcu6_DutyCycleType stLocDuty;
+   uint32 u32LocAvg;
+   uint32 u32LocElapsed;
+   uint16 u16LocSpd;
+   boolean bLocNew;
+
+   bLocNew = FALSE;
+   Icu_17_GtmCcu6_GetDutyCycleValues(SPDSNS_kaudtIcuCh[u8Sns], &stLocDuty);
+   if (  (stLocDuty.PeriodTime != 0u)
+      && (stLocDuty.ActiveTime <= stLocDuty.PeriodTime))
+   {
+      bLocNew = SPDSNS_bAddSmpl(u8Sns, stLocDuty.PeriodTime);
+   }
+
+   if (bLocNew != FALSE)
+   {
+      SPDSNS_au16SmplAge[u8Sns]     = 0u;
+      SPDSNS_stWork.au16Spd[u8Sns]  = SPDSNS_u16CalcSpd(u8Sns,
+                                                        SPDSNS_au32SmplSum[u8Sns],
+                                                        SPDSNS_au8SmplCnt[u8Sns]);
+      SPDSNS_stWork.au8Dir[u8Sns]   = SPDSNS_u8CalcDir(stLocDuty.PeriodTime - stLocDuty.ActiveTime);
+      SPDSNS_stWork.au8Sts[u8Sns]   = SPDSNS_u8STS_VLD;
+   }
+   else
+   {
+      if (SPDSNS_au16SmplAge[u8Sns] < UINT16_MAX)
+      {
+         SPDSNS_au16SmplAge[u8Sns]++;
+      }
+
+      if (SPDSNS_au16SmplAge[u8Sns] >= SPDSNS_ku16ToutMs)
+      {
+         /* !Comment: restart before the 24 bit TIM counter wraps, as PWD does at timeout */
+         Icu_17_GtmCcu6_StopSignalMeasurement(SPDSNS_kaudtIcuCh[u8Sns]);
+         Icu_17_GtmCcu6_StartSignalMeasurement(SPDSNS_kaudtIcuCh[u8Sns]);
+         SPDSNS_vidRstWin(u8Sns);
+         SPDSNS_au16SmplAge[u8Sns]    = 0u;
+         SPDSNS_stWork.au16Spd[u8Sns] = UINT16_MIN;
+         SPDSNS_stWork.au8Dir[u8Sns]  = SPDSNS_u8DIR_UNKNOWN;
+         if (SPDSNS_stWork.au8Sts[u8Sns] == SPDSNS_u8STS_VLD)
+         {
+            SPDSNS_stWork.au8Sts[u8Sns] = SPDSNS_u8STS_TOUT;
+         }
+      }
+      else if (  (SPDSNS_stWork.au8Sts[u8Sns] == SPDSNS_u8STS_VLD)
+              && (SPDSNS_au8SmplCnt[u8Sns] != 0u))
+      {
+         /* !Comment: no edge for at least (age - 1) ms: the speed is at most one period over that time */
+         u32LocAvg     = SPDSNS_au32SmplSum[u8Sns] / SPDSNS_au8SmplCnt[u8Sns];
+         u32LocElapsed = (uint32)(SPDSNS_au16SmplAge[u8Sns] - 1u) * SPDSNS_u32TICK_PER_MS;
+         if (u32LocElapsed > u32LocAvg)
+         {
+            u16LocSpd = SPDSNS_u16CalcSpd(u8Sns, u32LocElapsed, 1u);
+            if (u16LocSpd < SPDSNS_stWork.au16Spd[u8Sns])
+            {
+               SPDSNS_stWork.au16Spd[u8Sns] = u16LocSpd;
+            }
+         }
+      }
+      else
+      {
+         /* !Comment: no signal yet or zero speed */
+      }
+   }
+}
+
+#define SPDSNS_STOP_SEC_CODE
+#include "SPDSNS_MemMap.h"
+
+/*--------------------------------------------------- END OF FILE ----------------------------------------------------*/
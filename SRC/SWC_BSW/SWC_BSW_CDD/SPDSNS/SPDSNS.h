@@ -0,0 +1,146 @@
+/**********************************************************************************************************************/
+/* !Layer           : HAL                                                                                             */
+/* !Component       : SPDSNS                                                                                          */
+/* !Description     : Transmission speed sensors measurement service                                                  */
+/*                                                                                                                    */
+/* !File            : SPDSNS.h                                                                                        */
+/* !Description     : Header file for SPDSNS component                                                                */
+/*                                                                                                                    */
+/* !Reference       :                                                                                                 */
+/*                                                                                                                    */
+/* Coding language  : C                                                                                               */
+/*                                                                                                                    */
+/* COPYRIGHT VALEO all rights reserved                                                                                */
+/**********************************************************************************************************************/
+/* Dimension Informations
+ * %PCMS_HEADER_SUBSTITUTION_START:%
+ * The PID has this format: <Product ID>:<Item ID>.<Variant>-<Item Type>;<Revision>
+ * %PID:%
+ * %PCMS_HEADER_SUBSTITUTION_END:%
+ **********************************************************************************************************************/
+
+#ifndef SPDSNS_H
+#define SPDSNS_H
+
+#include "Std_Types.h"
+
+/**********************************************************************************************************************/
+/* DEFINES                                                                                                            */
+/**********************************************************************************************************************/
+/* sensor index, same order as ShrExp_Get_Speed */
+#define SPDSNS_u8IDX_G4                   0u
+#define SPDSNS_u8IDX_C4                   1u
+#define SPDSNS_u8IDX_TOSS                 2u
+#define SPDSNS_u8NB_SNS                   3u
+
+/* size of the period averaging window */
+#define SPDSNS_u8NB_SMPL_MAX              8u
+
+/* GTM TIM count frequency of the speed channels (25 ns) */
+#define SPDSNS_u32TICK_FRQ                40000000uL
+#define SPDSNS_u32TICK_PER_MS             (SPDSNS_u32TICK_FRQ / 1000uL)
+#define SPDSNS_u32TICK_PER_MIN            (SPDSNS_u32TICK_FRQ * 60uL)
+
+/* snapshot status */
+#define SPDSNS_u8STS_NO_SIG               0u
+#define SPDSNS_u8STS_VLD                  1u
+#define SPDSNS_u8STS_TOUT                 2u
+
+/* snapshot direction */
+#define SPDSNS_u8DIR_UNKNOWN              0u
+#define SPDSNS_u8DIR_FWD                  1u
+#define SPDSNS_u8DIR_REV                  2u
+
+/**********************************************************************************************************************/
+/* TYPES                                                                                                              */
+/**********************************************************************************************************************/
+typedef struct
+{
+   uint16 au16Spd[SPDSNS_u8NB_SNS];    /* rpm */
+   uint8  au8Dir[SPDSNS_u8NB_SNS];     /* SPDSNS_u8DIR_* */
+   uint8  au8Sts[SPDSNS_u8NB_SNS];     /* SPDSNS_u8STS_* */
+} SPDSNS_tstSnapshot;
+
+/**********************************************************************************************************************/
+/* CALIBRATION DECLARATION                                                                                            */
+/**********************************************************************************************************************/
+
+#define SPDSNS_START_SEC_CALIB_UNSPECIFIED
+#include "SPDSNS_MemMap.h"
+
+extern const uint8  SPDSNS_kau8PlsPerRevDft[SPDSNS_u8NB_SNS];
+extern const uint8  SPDSNS_ku8NbSmpl;
+extern const uint8  SPDSNS_ku8OutlierTolPct;
+extern const uint8  SPDSNS_ku8OutlierNbMax;
+extern const uint16 SPDSNS_ku16ToutMs;
+extern const uint16 SPDSNS_kau16DirInactMin[2];
+extern const uint16 SPDSNS_kau16DirInactMax[2];
+
+#define SPDSNS_STOP_SEC_CALIB_UNSPECIFIED
+#include "SPDSNS_MemMap.h"
+
+/**********************************************************************************************************************/
+/* DATA DECLARATION                                                                                                   */
+/**********************************************************************************************************************/
+
+#define SPDSNS_START_SEC_VAR_CLEARED_8BIT
+#include "SPDSNS_MemMap.h"
+
+extern uint8 SPDSNS_au8PlsPerRev[SPDSNS_u8NB_SNS];
+extern uint8 SPDSNS_au8SmplCnt[SPDSNS_u8NB_SNS];
+extern uint8 SPDSNS_au8SmplIdx[SPDSNS_u8NB_SNS];
+extern uint8 SPDSNS_au8OutlierCnt[SPDSNS_u8NB_SNS];
+extern volatile uint8 SPDSNS_u8SnapIdx;
+extern volatile uint8 SPDSNS_u8SnapSeq;
+
+#define SPDSNS_STOP_SEC_VAR_CLEARED_8BIT
+#include "SPDSNS_MemMap.h"
+
+
+#define SPDSNS_START_SEC_VAR_CLEARED_16BIT
+#include "SPDSNS_MemMap.h"
+
+extern uint16 SPDSNS_au16SmplAge[SPDSNS_u8NB_SNS];
+
+#define SPDSNS_STOP_SEC_VAR_CLEARED_16BIT
+#include "SPDSNS_MemMap.h"
+
+
+#define SPDSNS_START_SEC_VAR_CLEARED_32BIT
+#include "SPDSNS_MemMap.h"
+
+extern uint32 SPDSNS_au32SmplBuf[SPDSNS_u8NB_SNS][SPDSNS_u8NB_SMPL_MAX];
+extern uint32 SPDSNS_au32SmplSum[SPDSNS_u8NB_SNS];
+
+#define SPDSNS_STOP_SEC_VAR_CLEARED_32BIT
+#include "SPDSNS_MemMap.h"
+
+
+#define SPDSNS_START_SEC_VAR_CLEARED_UNSPECIFIED
+#include "SPDSNS_MemMap.h"
+
+extern SPDSNS_tstSnapshot SPDSNS_stWork;
+extern volatile SPDSNS_tstSnapshot SPDSNS_astSnap[2];
+
+#define SPDSNS_STOP_SEC_VAR_CLEARED_UNSPECIFIED
+#include "SPDSNS_MemMap.h"
+
+
+/**********************************************************************************************************************/
+/* FUNCTIONS DECLARATION                                                                                              */
+/**********************************************************************************************************************/
+
+#define SPDSNS_START_SEC_CODE
+#include "SPDSNS_MemMap.h"
+
+extern void SPDSNS_vidInit(void);
+extern void SPDSNS_vidMainFunction(void);
+extern void SPDSNS_vidSetPlsPerRev(const uint8 *pku8PlsPerRev);
+extern void SPDSNS_vidGetSnapshot(SPDSNS_tstSnapshot *pstSnap);
+
+#define SPDSNS_STOP_SEC_CODE
+#include "SPDSNS_MemMap.h"
+
+#endif /* SPDSNS_H */
+
+/*--------------------------------------------------- END OF FILE ----------------------------------------------------*/
@@ -0,0 +1,95 @@
+/**********************************************************************************************************************/
+/* !Layer           : HAL                                                                                             */
+/* !Component       : SPDSNS                                                                                          */
+/* !Description     : Transmission speed sensors measurement service                                                  */
+/*                                                                                                                    */
+/* !File            : SPDSNS_Def.c                                                                                    */
+/* !Description     : Calibrations and variables of the SPDSNS component                                              */
+/*                                                                                                                    */
+/* !Reference       :                                                                                                 */
+/*                                                                                                                    */
+/* Coding language  : C                                                                                               */
+/*                                                                                                                    */
+/* COPYRIGHT VALEO all rights reserved                                                                                */
+/**********************************************************************************************************************/
+/* Dimension Informations
+ * %PCMS_HEADER_SUBSTITUTION_START:%
+ * The PID has this format: <Product ID>:<Item ID>.<Variant>-<Item Type>;<Revision>
+ * %PID:%
+ * %PCMS_HEADER_SUBSTITUTION_END:%
+ **********************************************************************************************************************/
+
+#include "Std_Types.h"
+#include "SPDSNS.h"
+
+/**********************************************************************************************************************/
+/* CALIBRATION DEFINITION                                                                                             */
+/**********************************************************************************************************************/
+
+#define SPDSNS_START_SEC_CALIB_UNSPECIFIED
+#include "SPDSNS_MemMap.h"
+
+/* pulses per revolution used until Shrexp_set_Speed gives the application ones: G4, C4, TOSS */
+const uint8  SPDSNS_kau8PlsPerRevDft[SPDSNS_u8NB_SNS] = {30u, 40u, 89u};
+/* number of periods averaged, 1..SPDSNS_u8NB_SMPL_MAX */
+const uint8  SPDSNS_ku8NbSmpl = 8u;
+/* a period farther than this from the window average is rejected */
+const uint8  SPDSNS_ku8OutlierTolPct = 50u;
+/* consecutive rejected periods accepted as a real speed step: the window restarts */
+const uint8  SPDSNS_ku8OutlierNbMax = 3u;
+/* no period during this time: zero speed and measurement restart (TIM 24 bit overflows after 419 ms) */
+const uint16 SPDSNS_ku16ToutMs = 250u;
+/* inactive time of the sensor pulse in TIM ticks: [0] forward, [1] reverse */
+const uint16 SPDSNS_kau16DirInactMin[2] = {500u, 1020u};
+const uint16 SPDSNS_kau16DirInactMax[2] = {709u, 1389u};
+
+#define SPDSNS_STOP_SEC_CALIB_UNSPECIFIED
+#include "SPDSNS_MemMap.h"
+
+/**********************************************************************************************************************/
+/* DATA DEFINITION                                                                                                    */
+/**********************************************************************************************************************/
+
+#define SPDSNS_START_SEC_VAR_CLEARED_8BIT
+#include "SPDSNS_MemMap.h"
+
+uint8 SPDSNS_au8PlsPerRev[SPDSNS_u8NB_SNS];
+uint8 SPDSNS_au8SmplCnt[SPDSNS_u8NB_SNS];
+uint8 SPDSNS_au8SmplIdx[SPDSNS_u8NB_SNS];
+uint8 SPDSNS_au8OutlierCnt[SPDSNS_u8NB_SNS];
+volatile uint8 SPDSNS_u8SnapIdx;
+volatile uint8 SPDSNS_u8SnapSeq;
+
+#define SPDSNS_STOP_SEC_VAR_CLEARED_8BIT
+#include "SPDSNS_MemMap.h"
+
+
+#define SPDSNS_START_SEC_VAR_CLEARED_16BIT
+#include "SPDSNS_MemMap.h"
+
+uint16 SPDSNS_au16SmplAge[SPDSNS_u8NB_SNS];
+
+#define SPDSNS_STOP_SEC_VAR_CLEARED_16BIT
+#include "SPDSNS_MemMap.h"
+
+
+#define SPDSNS_START_SEC_VAR_CLEARED_32BIT
+#include "SPDSNS_MemMap.h"
+
+uint32 SPDSNS_au32SmplBuf[SPDSNS_u8NB_SNS][SPDSNS_u8NB_SMPL_MAX];
+uint32 SPDSNS_au32SmplSum[SPDSNS_u8NB_SNS];
+
+#define SPDSNS_STOP_SEC_VAR_CLEARED_32BIT
+#include "SPDSNS_MemMap.h"
+
+
+#define SPDSNS_START_SEC_VAR_CLEARED_UNSPECIFIED
+#include "SPDSNS_MemMap.h"
+
+SPDSNS_tstSnapshot SPDSNS_stWork;
+volatile SPDSNS_tstSnapshot SPDSNS_astSnap[2];
+
+#define SPDSNS_STOP_SEC_VAR_CLEARED_UNSPECIFIED
+#include "SPDSNS_MemMap.h"
+
+/*--------------------------------------------------- END OF FILE ----------------------------------------------------*/
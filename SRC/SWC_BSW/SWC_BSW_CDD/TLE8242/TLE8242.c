@@ -34,6 +34,9 @@
 
 
 #include "Spi.h"
+#if defined(TST_SPISIM_bENA) && (TST_SPISIM_bENA == 1)
+#include "TST_SPISIM.h"
+#endif
 #include "Dio.h"
 #include "Gtm.h"
 
@@ -119,11 +122,11 @@
  *
  * ************************************************************************************************************************/
 
-static float32 TLE8242_saf32CnrtTarOld[TLE8242_u8MAX_CH_NR];
-static float32 TLE8242_saf32PwmFrqOld[TLE8242_u8MAX_CH_NR];
+static uint16 TLE8242_sau16CnrtTarOld[TLE8242_u8MAX_CH_NR];
+static uint16 TLE8242_sau16PwmFrqOld[TLE8242_u8MAX_CH_NR];
 static uint16 TLE8242_sau16KPOld[TLE8242_u8MAX_CH_NR];
 static uint16 TLE8242_sau16KIOld[TLE8242_u8MAX_CH_NR];
-static float32 TLE8242_saf32DitherAmplOld[TLE8242_u8MAX_CH_NR];
+static uint16 TLE8242_sau16DitherAmplOld[TLE8242_u8MAX_CH_NR];
 static float32 TLE8242_saf32DitherFrqOld[TLE8242_u8MAX_CH_NR];
 static float32 TLE8242_saf32DutyCycleOld[TLE8242_u8MAX_CH_NR];
 static uint8 TLE8242_su8CtrlModOld[TLE8242_u8MAX_CH_NR];
@@ -133,8 +136,17 @@ static uint16 TLE8242_su8CurReadCnt[TLE8242_u8CH_NR][8];
 
 static uint8 TLE8242_su8CurVld[TLE8242_u8CH_NR][2];
 uint16 TLE8242_su16FltSts[TLE8242_u8MAX_CH_NR][6];
+// fault detection: one word per fault type, one bit per channel.
+static uint32 TLE8242_sau32DiagWordOld[TLE8242_u8CH_NR][2];
+static uint16 TLE8242_sau16FltRaw[TLE8242_u8MAX_NR_FLT];
+static uint16 TLE8242_sau16FltDeb[TLE8242_u8MAX_NR_FLT];
+static uint16 TLE8242_sau16FltDebCnt0[TLE8242_u8MAX_NR_FLT];
+static uint16 TLE8242_sau16FltDebCnt1[TLE8242_u8MAX_NR_FLT];
 // for ctrl message.
 static uint8 TLE8242_su8MsgSndCnt[TLE8242_u8CH_NR];
+// dirty registers per scheduler group, one bit per channel.
+static uint8 TLE8242_sau8SchedDirty[TLE8242_u8CH_NR][TLE8242_u8SCHED_NB_GRP];
+static boolean TLE8242_sabSchedDiagReq[TLE8242_u8CH_NR];
 
 #define TLE8242_STOP_SEC_VAR_UNSPECIFIED
 #include "MemMap.h"
@@ -150,6 +162,7 @@ void TLE8242_vidInit(void)
 {
   	/*Trim function ini*/
 	Trim_InitGainAndOffset();
+	TLE8242_vidInitCrntGain();
   
     TLE8242_astInitTxBuf[0][0].u32Data = (uint32)TLE8242_astSpiTx[0].ControlMethodandFaultMaskConfiguration.u32Data;
     TLE8242_astInitTxBuf[0][1].u32Data = (uint32)TLE8242_astSpiTx[0].DiagnosticConfigurationchannel[0].u32Data;
@@ -253,12 +266,10 @@ void TLE8242_vidParseResponse(void)
 
 #if TLE8242_bUSE_INT_BUF == 1
         Spi_ReadIB(SpiConf_SpiChannel_TLE8242_1_CTRL_CH+u8LocIdx, (uint8 *) TLE8242_astCtrlRxBuf[u8LocIdx]);
-        Spi_ReadIB(SpiConf_SpiChannel_TLE8242_1_DIAG_CH+u8LocIdx, (uint8 *) TLE8242_astDiagRxBuf[u8LocIdx]);
 #endif
 
-        TLE8242_vidConvMsgInfo(TLE8242_astCtrlRxBuf[u8LocIdx], TLE8242_su8MsgSndCnt[u8LocIdx], u8LocIdx);
-        //TLE8242_vidConvMsgInfo(TLE8242_astDiagRxBuf[u8LocIdx], TLE8242_kau8ChBufSizeCfg[u8LocIdx+4], u8LocIdx);
-        TLE8242_vidConvMsgInfo(TLE8242_astDiagRxBuf[u8LocIdx], TLE8242_kau8ChBufSizeCfg[2], u8LocIdx);
+        // the diagnosis reads are part of the control sequence, the answer to the last command is in the next frame.
+        TLE8242_vidConvMsgInfo(TLE8242_astCtrlRxBuf[u8LocIdx], TLE8242_su8MsgSndCnt[u8LocIdx] + 1, u8LocIdx);
 
 
         // As for TLE8242, only can read one channel one time, can not send 8 frames to get all the current feedback, you will get nothing.
@@ -274,14 +285,14 @@ void TLE8242_vidParseResponse(void)
         {
             //TLE8242_af32AvgCrntMa[u8LocChIdx] = TLE8242_f32RvsTrimTar(u8LocChIdx, TLE8242_f32GetCrntFb(u8LocChIdx, AvgCurrent), TEMP_s16PhysTempPcb>>4);
 			//TLE8242_af32AvgCrntMa[u8LocChIdx] = Trim_Feedback_CalculateGainAndOffset(u8LocChIdx,TLE8242_f32GetCrntFb(u8LocChIdx, AvgCurrent));
-			TLE8242_af32AvgCrntMa[u8LocChIdx] =  TLE8242_f32GetCrntFb(u8LocChIdx, TLE8242_AVG_CRNT);
+			TLE8242_au16AvgCrntMa[u8LocChIdx] =  TLE8242_u16GetCrntFb(u8LocChIdx, TLE8242_AVG_CRNT);
         }
         if (TLE8242_su8CurVld[u8LocIdx][1])
         {
             //TLE8242_af32MaxCnrtMa[u8LocChIdx] = TLE8242_f32RvsTrimTar(u8LocChIdx, TLE8242_f32GetCrntFb(u8LocChIdx, MaxCurrent), TEMP_s16PhysTempPcb>>4);
             //TLE8242_af32MinCnrtMa[u8LocChIdx] = TLE8242_f32RvsTrimTar(u8LocChIdx, TLE8242_f32GetCrntFb(u8LocChIdx, MinCurrent), TEMP_s16PhysTempPcb>>4);
-			TLE8242_af32MaxCnrtMa[u8LocChIdx] = TLE8242_f32GetCrntFb(u8LocChIdx, TLE8242_MAX_CRNT); //Trim_Feedback_CalculateGainAndOffset(u8LocChIdx,TLE8242_f32GetCrntFb(u8LocChIdx, MaxCurrent));
-			TLE8242_af32MinCnrtMa[u8LocChIdx] = TLE8242_f32GetCrntFb(u8LocChIdx, TLE8242_MIN_CRNT); //Trim_Feedback_CalculateGainAndOffset(u8LocChIdx,TLE8242_f32GetCrntFb(u8LocChIdx, MinCurrent));
+			TLE8242_au16MaxCnrtMa[u8LocChIdx] = TLE8242_u16GetCrntFb(u8LocChIdx, TLE8242_MAX_CRNT); //Trim_Feedback_CalculateGainAndOffset(u8LocChIdx,TLE8242_u16GetCrntFb(u8LocChIdx, MaxCurrent));
+			TLE8242_au16MinCnrtMa[u8LocChIdx] = TLE8242_u16GetCrntFb(u8LocChIdx, TLE8242_MIN_CRNT); //Trim_Feedback_CalculateGainAndOffset(u8LocChIdx,TLE8242_u16GetCrntFb(u8LocChIdx, MinCurrent));
         }
         //Todo this should be a calibration.
 
@@ -303,66 +314,250 @@ void TLE8242_vidParseResponse(void)
 
 
 }
+/**********************************************************************************************************************/
+/* !FuncName    : TLE8242_vidFltDecDiagWord                                                                                    */
+/* !Description :                                  */
+/* Decode one diagnosis read word (4 channels, 6 bits each) into the raw fault words. The short circuit bits are only */
+/* taken when their test bit is set, otherwise the last result is kept.                                                */
+/**********************************************************************************************************************/
+static void TLE8242_vidFltDecDiagWord(uint32 u32LocWord, uint8 u8LocFirstChIdx)
+{
+    uint8 u8LocIdx, u8LocFld;
+    uint16 u16LocChMsk;
+
+    for (u8LocIdx = 0; u8LocIdx < 4; u8LocIdx++)
+    {
+        u8LocFld = (uint8)((u32LocWord >> ((3 - u8LocIdx) * TLE8242_u8_FLT_NB_BIT)) & TLE8242_u8_FLT_CH_MSK);
+        u16LocChMsk = (uint16)(1 << (u8LocFirstChIdx + u8LocIdx));
+
+        if (0 != (u8LocFld & ((1 << TLE8242_u8_FLT_OL_OFF_BIT) | (1 << TLE8242_u8_FLT_OL_ON_BIT))))
+        {
+            TLE8242_sau16FltRaw[TLE8242_OPEN] |= u16LocChMsk;
+        }
+        else
+        {
+            TLE8242_sau16FltRaw[TLE8242_OPEN] &= (uint16)~u16LocChMsk;
+        }
+        if (0 != (u8LocFld & (1 << TLE8242_u8_FLT_OFF_TST_BIT)))
+        {
+            if (0 != (u8LocFld & (1 << TLE8242_u8_FLT_SC_BIT)))
+            {
+                TLE8242_sau16FltRaw[TLE8242_SHORT_TO_GND] |= u16LocChMsk;
+            }
+            else
+            {
+                TLE8242_sau16FltRaw[TLE8242_SHORT_TO_GND] &= (uint16)~u16LocChMsk;
+            }
+        }
+        if (0 != (u8LocFld & (1 << TLE8242_u8_FLT_SCS_TST_BIT)))
+        {
+            if (0 != (u8LocFld & (1 << TLE8242_u8_FLT_SCS_BIT)))
+            {
+                TLE8242_sau16FltRaw[TLE8242_SHORT_TO_BATT] |= u16LocChMsk;
+            }
+            else
+            {
+                TLE8242_sau16FltRaw[TLE8242_SHORT_TO_BATT] &= (uint16)~u16LocChMsk;
+            }
+        }
+    }
+}
+
 /**********************************************************************************************************************/
 /* !FuncName    : TLE8242_vidFaultDet                                                                                    */
 /* !Description :                                  */
-/*                                                                                                                    */
+/* The diagnosis words are only decoded when they changed. All channels of one fault type are debounced together with */
+/* a 2 bit vertical counter: a bit toggles after 4 consecutive samples different from the debounced state. Fault     */
+/* status and Dem are only updated on a toggle, so nothing is done per channel while no fault comes or goes.         */
 /* !LastAuthor  : gsun5                                                                                          */
 /**********************************************************************************************************************/
 void TLE8242_vidFaultDet(void)
 {
-    uint8 u8LocChIdx = 0, u8LocFltIdx = 0, u8LocRes;
-    Dem_EventIdType u8LocEveIdx ;
+    uint8 u8LocChIdx, u8LocChipIdx, u8LocMsgIdx, u8LocFltIdx;
+    uint16 u16LocLoadMsk, u16LocDelta, u16LocToggle;
+    uint32 u32LocWord;
 
+    for (u8LocChipIdx = 0; u8LocChipIdx < TLE8242_u8CH_NR; u8LocChipIdx++)
+    {
+        for (u8LocMsgIdx = 0; u8LocMsgIdx < 2; u8LocMsgIdx++)
+        {
+            u32LocWord = TLE8242_astSpiRx[u8LocChipIdx].DiagnosticReadchannel[u8LocMsgIdx].u32Data;
+            if (u32LocWord != TLE8242_sau32DiagWordOld[u8LocChipIdx][u8LocMsgIdx])
+            {
+                TLE8242_sau32DiagWordOld[u8LocChipIdx][u8LocMsgIdx] = u32LocWord;
+                TLE8242_vidFltDecDiagWord(u32LocWord, (uint8)((u8LocChipIdx * 8) + (u8LocMsgIdx * 4)));
+            }
+        }
+    }
 
-    for ( u8LocChIdx = 0; u8LocChIdx < TLE8242_u8MAX_CH_NR; u8LocChIdx++)
+    // over/under load come from the current feedback, only channels with a target can be faulty.
+    TLE8242_sau16FltRaw[TLE8242_OVERLOAD] = 0;
+    TLE8242_sau16FltRaw[TLE8242_UNDERLOAD] = 0;
+    for (u8LocChIdx = 0; u8LocChIdx < TLE8242_u8MAX_CH_NR; u8LocChIdx++)
     {
-        for(u8LocFltIdx = 0; u8LocFltIdx < TLE8242_u8MAX_NR_FLT; u8LocFltIdx++)
+        if (0 != TLE8242_au16TarCnrtMa[u8LocChIdx])
         {
-        	 u8LocEveIdx = TLE8242_tstFltDev.astChDemID[u8LocChIdx].audtIdxType[u8LocFltIdx];
-        	 u8LocRes = TLE8242_tstFltDev.astFltFct[u8LocFltIdx](u8LocChIdx);
-        	 TLE8242_su16FltSts[u8LocChIdx][u8LocFltIdx] = u8LocRes;
+            u16LocLoadMsk = (uint16)(1 << u8LocChIdx);
+            if (TLE8242_bGetChOverLoadFlt(u8LocChIdx))
+            {
+                TLE8242_sau16FltRaw[TLE8242_OVERLOAD] |= u16LocLoadMsk;
+            }
+            if (TLE8242_bGetChUnderLoadFlt(u8LocChIdx))
+            {
+                TLE8242_sau16FltRaw[TLE8242_UNDERLOAD] |= u16LocLoadMsk;
+            }
+        }
+    }
 
-        	//Dem_SetEventStatus(u8LocEveIdx , (u8LocRes)?DEM_EVENT_STATUS_PREFAILED:DEM_EVENT_STATUS_PREPASSED);
+    for (u8LocFltIdx = 0; u8LocFltIdx < TLE8242_u8MAX_NR_FLT; u8LocFltIdx++)
+    {
+        u16LocDelta = TLE8242_sau16FltRaw[u8LocFltIdx] ^ TLE8242_sau16FltDeb[u8LocFltIdx];
+        TLE8242_sau16FltDebCnt1[u8LocFltIdx] = (TLE8242_sau16FltDebCnt1[u8LocFltIdx] ^ TLE8242_sau16FltDebCnt0[u8LocFltIdx]) & u16LocDelta;
+        TLE8242_sau16FltDebCnt0[u8LocFltIdx] = (uint16)~TLE8242_sau16FltDebCnt0[u8LocFltIdx] & u16LocDelta;
+        u16LocToggle = u16LocDelta & (uint16)~(TLE8242_sau16FltDebCnt0[u8LocFltIdx] | TLE8242_sau16FltDebCnt1[u8LocFltIdx]);
+
+        if (0 != u16LocToggle)
+        {
+            TLE8242_sau16FltDeb[u8LocFltIdx] ^= u16LocToggle;
+            for (u8LocChIdx = 0; u8LocChIdx < TLE8242_u8MAX_CH_NR; u8LocChIdx++)
+            {
+                if (0 != (u16LocToggle & (1 << u8LocChIdx)))
+                {
+                    TLE8242_su16FltSts[u8LocChIdx][u8LocFltIdx] = (TLE8242_sau16FltDeb[u8LocFltIdx] >> u8LocChIdx) & 1;
+#if TLE8242_bDEM_REPORT == 1
+                    Dem_SetEventStatus(TLE8242_tstFltDev.astChDemID[u8LocChIdx].audtIdxType[u8LocFltIdx],
+                                       (TLE8242_su16FltSts[u8LocChIdx][u8LocFltIdx]) ? DEM_EVENT_STATUS_FAILED : DEM_EVENT_STATUS_PASSED);
+#endif
+                }
+            }
         }
     }
+}
+
+
+
+/**********************************************************************************************************************/
+/* !FuncName    : TLE8242_u32SchedGetReg                                                                                    */
+/* !Description :                                  */
+/* Return the tx register of a scheduler group for one channel of the chip.                                          */
+/**********************************************************************************************************************/
+static uint32 TLE8242_u32SchedGetReg(uint8 u8LocChipIdx, uint8 u8LocGrp, uint8 u8LocChIdx)
+{
+    uint32 u32LocReg;
 
+    switch (u8LocGrp)
+    {
+    case TLE8242_u8SCHED_CTRL_MOD:
+        u32LocReg = (uint32)TLE8242_astSpiTx[u8LocChipIdx].ControlMethodandFaultMaskConfiguration.u32Data;
+        break;
+    case TLE8242_u8SCHED_MAI_PERD:
+        u32LocReg = (uint32)TLE8242_astSpiTx[u8LocChipIdx].MainPeriodSet[u8LocChIdx].u32Data;
+        break;
+    case TLE8242_u8SCHED_DITHER_PERD:
+        u32LocReg = (uint32)TLE8242_astSpiTx[u8LocChipIdx].DitherPeriodSet[u8LocChIdx].u32Data;
+        break;
+    case TLE8242_u8SCHED_CRNT_DITHER:
+        u32LocReg = (uint32)TLE8242_astSpiTx[u8LocChipIdx].CurrentandDitherAmplitudeSet[u8LocChIdx].u32Data;
+        break;
+    case TLE8242_u8SCHED_PWM_DUTY:
+        u32LocReg = (uint32)TLE8242_astSpiTx[u8LocChipIdx].PWMDutyCycle[u8LocChIdx].u32Data;
+        break;
+    default: /* TLE8242_u8SCHED_KP_KI */
+        u32LocReg = (uint32)TLE8242_astSpiTx[u8LocChipIdx].ControlVariableSetKPandKI[u8LocChIdx].u32Data;
+        break;
+    }
+    return u32LocReg;
 }
 
+/**********************************************************************************************************************/
+/* !FuncName    : TLE8242_u8SchedPack                                                                                    */
+/* !Description :                                  */
+/* Pack the dirty registers of one chip, group by group in priority order, then the cyclic reads.                    */
+/* The frame is built from the tx register at pack time, so several changes of one register in between are sent     */
+/* once. Writes which do not fit stay dirty for the next cycle. The last frame of the buffer is always left free:    */
+/* the answer to frame n is shifted out during frame n+1.                                                             */
+/**********************************************************************************************************************/
+static uint8 TLE8242_u8SchedPack(uint8 u8LocChipIdx)
+{
+    uint8 u8LocGrp, u8LocChIdx, u8LocMsk, u8LocFrmCnt, u8LocFrmMax, u8LocBacklog;
+    TLE8242_DummyMsgID *pstLocBuf;
 
+    pstLocBuf = TLE8242_astCtrlTxBuf[u8LocChipIdx];
+    u8LocFrmCnt = 0;
+    u8LocBacklog = 0;
+    u8LocFrmMax = TLE8242_u8MAX_FRM_CTRL_CH_1 - 1 - TLE8242_u8SCHED_NB_READ;
+
+    for (u8LocGrp = 0; u8LocGrp < TLE8242_u8SCHED_NB_GRP; u8LocGrp++)
+    {
+        u8LocMsk = TLE8242_sau8SchedDirty[u8LocChipIdx][u8LocGrp];
+        for (u8LocChIdx = 0; (u8LocMsk != 0) && (u8LocFrmCnt < u8LocFrmMax); u8LocChIdx++)
+        {
+            if (0 != (u8LocMsk & (1 << u8LocChIdx)))
+            {
+                pstLocBuf[u8LocFrmCnt].u32Data = TLE8242_u32SchedGetReg(u8LocChipIdx, u8LocGrp, u8LocChIdx);
+                pstLocBuf[u8LocFrmCnt].bits.bRW = 1;
+                u8LocFrmCnt++;
+                u8LocMsk &= (uint8)~(1 << u8LocChIdx);
+            }
+        }
+        TLE8242_sau8SchedDirty[u8LocChipIdx][u8LocGrp] = u8LocMsk;
+        for (; u8LocMsk != 0; u8LocMsk &= (uint8)(u8LocMsk - 1))
+        {
+            u8LocBacklog++;
+        }
+    }
+
+    /* cyclic reads: current and duty cycle feedback of the round robin channel, then the diagnosis. */
+    u8LocChIdx = TLE8242_su8CurReadChNr[u8LocChipIdx];
+    pstLocBuf[u8LocFrmCnt++].u32Data = (uint32)TLE8242_astSpiTx[u8LocChipIdx].MaxMinCurrentRead[u8LocChIdx].u32Data;
+    pstLocBuf[u8LocFrmCnt++].u32Data = (uint32)TLE8242_astSpiTx[u8LocChipIdx].AverageCurrentReadOverDitherPeriod[u8LocChIdx].u32Data;
+    pstLocBuf[u8LocFrmCnt].u32Data = (uint32)TLE8242_astSpiTx[u8LocChipIdx].PWMDutyCycle[u8LocChIdx].u32Data;
+    pstLocBuf[u8LocFrmCnt++].bits.bRW = 0;
+    if (FALSE != TLE8242_sabSchedDiagReq[u8LocChipIdx])
+    {
+        TLE8242_sabSchedDiagReq[u8LocChipIdx] = FALSE;
+        for (u8LocGrp = 0; u8LocGrp < TLE8242_u8SCHED_NB_DIAG_FRM; u8LocGrp++)
+        {
+            pstLocBuf[u8LocFrmCnt++].u32Data = TLE8242_kastDiagTxBuf[u8LocChipIdx][u8LocGrp].u32Data;
+        }
+    }
+    TLE8242_su8CurReadCnt[u8LocChipIdx][u8LocChIdx]++;
+
+    TLE8242_au8SchedBacklog[u8LocChipIdx] = u8LocBacklog;
+    TLE8242_au8SchedFrmCycle[u8LocChipIdx] = u8LocFrmCnt;
+    if (u8LocFrmCnt > TLE8242_au8SchedFrmCycleMax[u8LocChipIdx])
+    {
+        TLE8242_au8SchedFrmCycleMax[u8LocChipIdx] = u8LocFrmCnt;
+    }
+    return u8LocFrmCnt;
+}
 
 /**********************************************************************************************************************/
 /* !FuncName    : TLE8242_vidCtrlManagement                                                                                    */
 /* !Description :                                  */
-/* This function will update the control message and send to tle8242, should be called at the end of 1ms.
- * For TLE8242, if no parameter change, we should not send any write commands, for now we choose internal buffer,
- * so we just send message #0, later will try to send the read command if no change for this parameter.
+/* This function will update the control message and send to tle8242, should be called at the end of 5ms.
+ * A changed parameter only marks its register dirty, TLE8242_u8SchedPack then builds one control sequence per chip
+ * with the dirty registers in priority order and the cyclic reads, so nothing is sent for unchanged parameters.
  *             */
 /* !LastAuthor  : gsun5                                                                                          */
 /**********************************************************************************************************************/
 void TLE8242_vidCtrlManagement(void)
 {
     uint8 u8LocIdx,u8LocIdx1;
-    uint8 u8LocChipIdx, u8LocChIdx;
+    uint8 u8LocChipIdx, u8LocChIdx, u8LocChMsk;
     static uint16 su16LocDitherFrqChg = 0;
     boolean bLocFltSts, bLocFltSts1;
-    uint8 au8LocCfgChg[TLE8242_u8CH_NR] = { 0
-#if TLE8242_u8CH_NR > 1
-            , 0
-#endif
-};
-    TLE8242_su8MsgSndCnt[0] = 0;
-    /* TLE8242_su8MsgSndCnt[1] = 0; */
 
     for (u8LocIdx = 0; u8LocIdx < TLE8242_u8MAX_CH_NR; ++u8LocIdx)
     {
         u8LocChipIdx = u8LocIdx / 8;
         u8LocChIdx = u8LocIdx % 8;
-        if (TLE8242_saf32PwmFrqOld[u8LocIdx] != TLE8242_au16PwmFrq[u8LocIdx])
+        u8LocChMsk = (uint8)(1 << u8LocChIdx);
+        if (TLE8242_sau16PwmFrqOld[u8LocIdx] != TLE8242_au16PwmFrq[u8LocIdx])
         {
-            TLE8242_saf32PwmFrqOld[u8LocIdx] = TLE8242_au16PwmFrq[u8LocIdx];
+            TLE8242_sau16PwmFrqOld[u8LocIdx] = TLE8242_au16PwmFrq[u8LocIdx];
             TLE8242_vidSetPWMFrq(u8LocIdx, TLE8242_au16PwmFrq[u8LocIdx]);
-            TLE8242_astCtrlTxBuf[u8LocChipIdx][TLE8242_su8MsgSndCnt[u8LocChipIdx]++].u32Data = (uint32) TLE8242_astSpiTx[u8LocChipIdx].MainPeriodSet[u8LocChIdx].u32Data;
+            TLE8242_sau8SchedDirty[u8LocChipIdx][TLE8242_u8SCHED_MAI_PERD] |= u8LocChMsk;
         }
         if ((TLE8242_sau16KPOld[u8LocIdx] != TLE8242_kau16KP[u8LocIdx]) || (TLE8242_sau16KIOld[u8LocIdx] != TLE8242_kau16KI[u8LocIdx]))
         {
@@ -370,14 +565,13 @@ void TLE8242_vidCtrlManagement(void)
             TLE8242_sau16KIOld[u8LocIdx] = TLE8242_kau16KI[u8LocIdx];
             TLE8242_vidSetKP(u8LocIdx, TLE8242_kau16KP[u8LocIdx]);
             TLE8242_vidSetKI(u8LocIdx, TLE8242_kau16KI[u8LocIdx]);
-            TLE8242_astCtrlTxBuf[u8LocChipIdx][TLE8242_su8MsgSndCnt[u8LocChipIdx]++].u32Data =
-                            (uint32) TLE8242_astSpiTx[u8LocChipIdx].ControlVariableSetKPandKI[u8LocChIdx].u32Data;
+            TLE8242_sau8SchedDirty[u8LocChipIdx][TLE8242_u8SCHED_KP_KI] |= u8LocChMsk;
         }
         if(TLE8242_stGetCtrlMod(u8LocIdx) != TLE8242_au8OpenLoop[u8LocIdx])
         {
             TLE8242_vidSetCtrlMod(u8LocIdx, TLE8242_au8OpenLoop[u8LocIdx]);
  			TLE8242_su8CtrlModOld[u8LocIdx] = TLE8242_au8OpenLoop[u8LocIdx];
-            au8LocCfgChg[u8LocChipIdx]= 1;
+            TLE8242_sau8SchedDirty[u8LocChipIdx][TLE8242_u8SCHED_CTRL_MOD] |= 1;
         }
         if (TLE8242_u8_DIRECT_MOD == TLE8242_stGetCtrlMod(u8LocIdx))
         {
@@ -385,7 +579,7 @@ void TLE8242_vidCtrlManagement(void)
 			{
 			    TLE8242_saf32DutyCycleOld[u8LocIdx] = TLE8242_af32DutyCycle[u8LocIdx];
             	TLE8242_vidSetPwmDutyCycle(u8LocIdx, TLE8242_af32DutyCycle[u8LocIdx]);
-            	TLE8242_astCtrlTxBuf[u8LocChipIdx][TLE8242_su8MsgSndCnt[u8LocChipIdx]++].u32Data = (uint32) TLE8242_astSpiTx[u8LocChipIdx].PWMDutyCycle[u8LocChIdx].u32Data;        
+            	TLE8242_sau8SchedDirty[u8LocChipIdx][TLE8242_u8SCHED_PWM_DUTY] |= u8LocChMsk;
 			}
 		}
         else
@@ -394,31 +588,33 @@ void TLE8242_vidCtrlManagement(void)
             // but for the TLE8242_astSpiRx, it will be updated the next cycle, so we use this static variable "su16LocDitherFrqChg" to update the dither ampl next cycle.
 
             // If there is a scgnd/scbat fault, we need to set the target to 0ma, to switch off the lsd.
+            // The cut-off uses the raw fault word, not the debounced status: it acts on the first diagnosis read
+            // reporting the short, the debounced status is only for the fault reporting.
             //Dem_GetEventFailed(TLE8242_tstFltDev.astChDemID[u8LocIdx].audtIdxType[TLE8242_SHORT_TO_GND], &bLocFltSts);
             //Dem_GetEventFailed(TLE8242_tstFltDev.astChDemID[u8LocIdx].audtIdxType[TLE8242_SHORT_TO_BATT], &bLocFltSts1);
-			bLocFltSts  = TLE8242_su16FltSts[u8LocIdx][TLE8242_SHORT_TO_GND];
-			bLocFltSts1 = TLE8242_su16FltSts[u8LocIdx][TLE8242_SHORT_TO_BATT];
+			bLocFltSts  = (0 != (TLE8242_sau16FltRaw[TLE8242_SHORT_TO_GND] & (1 << u8LocIdx)));
+			bLocFltSts1 = (0 != (TLE8242_sau16FltRaw[TLE8242_SHORT_TO_BATT] & (1 << u8LocIdx)));
 			
 			if(bLocFltSts || bLocFltSts1)
             {
-              TLE8242_af32TarCnrtMa[u8LocIdx] = 0;
+              TLE8242_au16TarCnrtMa[u8LocIdx] = 0;
             }
 
-            if((su16LocDitherFrqChg&(1<<u8LocIdx))||(TLE8242_saf32CnrtTarOld[u8LocIdx] != TLE8242_af32TarCnrtMa[u8LocIdx]) || \
-				(TLE8242_saf32DitherAmplOld[u8LocIdx] != TLE8242_af32DitherAmplMa[u8LocIdx]))
+            if((su16LocDitherFrqChg&(1<<u8LocIdx))||(TLE8242_sau16CnrtTarOld[u8LocIdx] != TLE8242_au16TarCnrtMa[u8LocIdx]) || \
+				(TLE8242_sau16DitherAmplOld[u8LocIdx] != TLE8242_au16DitherAmplMa[u8LocIdx]))
             {	
             	if(0 != TLE8242GetDitherFrq(u8LocIdx))
             	{
-					TLE8242_saf32DitherAmplOld[u8LocIdx] = TLE8242_af32DitherAmplMa[u8LocIdx];
-					TLE8242_vidSetDitherAmpBuf(u8LocIdx, TLE8242_af32DitherAmplMa[u8LocIdx]);
+					TLE8242_sau16DitherAmplOld[u8LocIdx] = TLE8242_au16DitherAmplMa[u8LocIdx];
+					TLE8242_vidSetDitherAmpBuf(u8LocIdx, TLE8242_au16DitherAmplMa[u8LocIdx]);
                     su16LocDitherFrqChg &= ~(1<<u8LocIdx);
             	}
 
-				TLE8242_saf32CnrtTarOld[u8LocIdx] = TLE8242_af32TarCnrtMa[u8LocIdx];
-                //TLE8242_af32TarCnrtAftTrimMa[u8LocIdx] = TLE8242_f32CalcTrimTar(u8LocIdx, TLE8242_af32TarCnrtMa[u8LocIdx], TEMP_s16PhysTempPcb>>4);
-                TLE8242_af32TarCnrtAftTrimMa[u8LocIdx] = TLE8242_af32TarCnrtMa[u8LocIdx];//Trim_CalculateGainAndOffset(u8LocIdx, TLE8242_af32TarCnrtMa[u8LocIdx]);
-                TLE8242_vidSetCrntTarBuf(u8LocIdx, TLE8242_af32TarCnrtAftTrimMa[u8LocIdx]);
-                TLE8242_astCtrlTxBuf[u8LocChipIdx][TLE8242_su8MsgSndCnt[u8LocChipIdx]++].u32Data = (uint32) TLE8242_astSpiTx[u8LocChipIdx].CurrentandDitherAmplitudeSet[u8LocChIdx].u32Data;
+				TLE8242_sau16CnrtTarOld[u8LocIdx] = TLE8242_au16TarCnrtMa[u8LocIdx];
+                //TLE8242_au16TarCnrtAftTrimMa[u8LocIdx] = TLE8242_f32CalcTrimTar(u8LocIdx, TLE8242_au16TarCnrtMa[u8LocIdx], TEMP_s16PhysTempPcb>>4);
+                TLE8242_au16TarCnrtAftTrimMa[u8LocIdx] = TLE8242_au16TarCnrtMa[u8LocIdx];//Trim_CalculateGainAndOffset(u8LocIdx, TLE8242_au16TarCnrtMa[u8LocIdx]);
+                TLE8242_vidSetCrntTarBuf(u8LocIdx, TLE8242_au16TarCnrtAftTrimMa[u8LocIdx]);
+                TLE8242_sau8SchedDirty[u8LocChipIdx][TLE8242_u8SCHED_CRNT_DITHER] |= u8LocChMsk;
             }
         }
 
@@ -426,7 +622,7 @@ void TLE8242_vidCtrlManagement(void)
         {
             TLE8242_saf32DitherFrqOld[u8LocIdx] = TLE8242_af32DitherFrq[u8LocIdx];
             TLE8242_vidSetDitherFrqBuf(u8LocIdx, TLE8242_af32DitherFrq[u8LocIdx]);
-            TLE8242_astCtrlTxBuf[u8LocChipIdx][TLE8242_su8MsgSndCnt[u8LocChipIdx]++].u32Data = (uint32) TLE8242_astSpiTx[u8LocChipIdx].DitherPeriodSet[u8LocChIdx].u32Data;
+            TLE8242_sau8SchedDirty[u8LocChipIdx][TLE8242_u8SCHED_DITHER_PERD] |= u8LocChMsk;
             /*
              * If the channel's dither frequency had changed, the ampl should be calc ref to the new dither frequency.
              * */
@@ -436,71 +632,39 @@ void TLE8242_vidCtrlManagement(void)
 
     for (u8LocIdx = 0; u8LocIdx < TLE8242_u8CH_NR; ++u8LocIdx)
     {
-        TLE8242_astCtrlTxBuf[u8LocIdx][TLE8242_su8MsgSndCnt[u8LocIdx]++].u32Data = (uint32)TLE8242_astSpiTx[u8LocIdx].MaxMinCurrentRead[TLE8242_su8CurReadChNr[u8LocIdx]].u32Data;
-        TLE8242_astCtrlTxBuf[u8LocIdx][TLE8242_su8MsgSndCnt[u8LocIdx]++].u32Data = (uint32)TLE8242_astSpiTx[u8LocIdx].AverageCurrentReadOverDitherPeriod[TLE8242_su8CurReadChNr[u8LocIdx]].u32Data;
-        if (1 == au8LocCfgChg[u8LocIdx])
-        {
-            au8LocCfgChg[u8LocIdx] = 0;
-            TLE8242_astCtrlTxBuf[u8LocIdx][TLE8242_su8MsgSndCnt[u8LocIdx]++].u32Data = (uint32) TLE8242_astSpiTx[u8LocIdx].ControlMethodandFaultMaskConfiguration.u32Data;
-        }
-        for (u8LocChIdx = 0; u8LocChIdx < TLE8242_kau8ChNrPerChip[u8LocIdx]; u8LocChIdx++)
+        TLE8242_su8MsgSndCnt[u8LocIdx] = TLE8242_u8SchedPack(u8LocIdx);
+#if TLE8242_bUSE_INT_BUF == 1
+        for (u8LocIdx1 = TLE8242_su8MsgSndCnt[u8LocIdx]; u8LocIdx1 < TLE8242_u8MAX_FRM_CTRL_CH_1; u8LocIdx1++)
         {
-            TLE8242_astSpiTx[u8LocIdx].PWMDutyCycle[u8LocChIdx].bits.bRW = 0;
-            TLE8242_astCtrlTxBuf[u8LocIdx][TLE8242_su8MsgSndCnt[u8LocIdx]++].u32Data = (uint32)TLE8242_astSpiTx[u8LocIdx].PWMDutyCycle[u8LocChIdx].u32Data;
+            TLE8242_astCtrlTxBuf[u8LocIdx][u8LocIdx1].u32Data = 0;
         }
-        TLE8242_su8CurReadCnt[u8LocIdx][TLE8242_su8CurReadChNr[u8LocIdx]]++;
-    }
-#if TLE8242_bUSE_INT_BUF == 1
-    for (u8LocIdx1 = TLE8242_su8MsgSndCnt[0]; u8LocIdx1 < TLE8242_u8MAX_FRM_CTRL_CH_1; u8LocIdx1++)
-    {
-        TLE8242_astCtrlTxBuf[0][u8LocIdx1].u32Data = 0;
-    }
-	Spi_WriteIB(SpiConf_SpiChannel_TLE8242_1_CTRL_CH, (const uint8 *) TLE8242_astCtrlTxBuf[0]);
-	
-#if TLE8242_u8CH_NR> 1
-    for (u8LocIdx1 = TLE8242_su8MsgSndCnt[1]; u8LocIdx1 < TLE8242_u8MAX_FRM_CTRL_CH_2; u8LocIdx1++)
-    {
-        TLE8242_astCtrlTxBuf[1][u8LocIdx1].u32Data = 0;
-    }
-    
-    Spi_WriteIB(SpiConf_SpiChannel_TLE8242_2_CTRL_CH, (const uint8 *) TLE8242_astCtrlTxBuf[1]);
-#endif
-    if((TLE8242_astCtrlTxBuf[0][0].bits.udtMsgID != 0) || (TLE8242_astCtrlTxBuf[1][0].bits.udtMsgID != 0))
-    {
-        Spi_AsyncTransmit(SpiConf_SpiSequence_TLE8242_CTRL_SEQ);
-    }
+        Spi_WriteIB(SpiConf_SpiChannel_TLE8242_1_CTRL_CH + u8LocIdx, (const uint8 *) TLE8242_astCtrlTxBuf[u8LocIdx]);
+        /* the internal buffer is always sent in full */
+        TLE8242_au16SpiBytesCycle[u8LocIdx] = TLE8242_u8MAX_FRM_CTRL_CH_1 * 4;
 #else
-    TLE8242_astCtrlTxBuf[0][TLE8242_su8MsgSndCnt[0]++].u32Data = 0;
-    Spi_SetupEB(SpiConf_SpiChannel_TLE8242_1_CTRL_CH, (const Spi_DataType*) &TLE8242_astCtrlTxBuf[0][0], (Spi_DataType *) &TLE8242_astCtrlRxBuf[0][0], TLE8242_su8MsgSndCnt[0]);
-#if TLE8242_u8CH_NR> 1
-    TLE8242_astCtrlTxBuf[1][TLE8242_su8MsgSndCnt[1]++].u32Data = 0;
-    //Spi_SetupEB(SpiConf_SpiChannel_TLE8242_2_CTRL_CH, (const Spi_DataType*) &TLE8242_astCtrlTxBuf[1][0], (Spi_DataType *) &TLE8242_astCtrlRxBuf[1][0], TLE8242_su8MsgSndCnt[1]);
+        /* one trailing frame to shift out the answer to the last command */
+        TLE8242_astCtrlTxBuf[u8LocIdx][TLE8242_su8MsgSndCnt[u8LocIdx]].u32Data = 0;
+        Spi_SetupEB(SpiConf_SpiChannel_TLE8242_1_CTRL_CH + u8LocIdx, (const Spi_DataType*) &TLE8242_astCtrlTxBuf[u8LocIdx][0], (Spi_DataType *) &TLE8242_astCtrlRxBuf[u8LocIdx][0], TLE8242_su8MsgSndCnt[u8LocIdx] + 1);
+        TLE8242_au16SpiBytesCycle[u8LocIdx] = (TLE8242_su8MsgSndCnt[u8LocIdx] + 1) * 4;
 #endif
+    }
     Spi_AsyncTransmit(SpiConf_SpiSequence_TLE8242_CTRL_SEQ);
-#endif
 }
 /**********************************************************************************************************************/
 /* !FuncName    : TLE8242_vidDiagManagement                                                                                    */
 /* !Description :                                  */
-/*                                                                                                                    */
+/* Request the diagnosis reads. They are sent with the next control sequence, so this function has to be called     */
+/* before TLE8242_vidCtrlManagement.                                                                                  */
 /* !LastAuthor  : gsun5                                                                                          */
 /**********************************************************************************************************************/
 void TLE8242_vidDiagManagement(void)
 {
-#if TLE8242_bUSE_INT_BUF == 1
-    Spi_WriteIB(SpiConf_SpiChannel_TLE8242_1_DIAG_CH, (const uint8 *) &TLE8242_kastDiagTxBuf[0]);
-
-#if TLE8242_u8CH_NR> 1
-    Spi_WriteIB(SpiConf_SpiChannel_TLE8242_1_DIAG_CH, (const uint8 *) &TLE8242_kastDiagTxBuf[1]);
-#endif
-#else
-    Spi_SetupEB(SpiConf_SpiChannel_TLE8242_1_DIAG_CH, (const Spi_DataType*) &TLE8242_kastDiagTxBuf[0][0], (Spi_DataType *) &TLE8242_astDiagRxBuf[0][0], TLE8242_u8MAX_FRM_DIAG_CH_1);
+    uint8 u8LocIdx;
 
-#if TLE8242_u8CH_NR> 1
-    Spi_SetupEB(SpiConf_SpiChannel_TLE8242_2_DIAG_CH, (const Spi_DataType*) &TLE8242_kastDiagTxBuf[1][0], (Spi_DataType *) &TLE8242_astDiagRxBuf[1][0], TLE8242_u8MAX_FRM_DIAG_CH_2);
-#endif
-#endif
-    Spi_AsyncTransmit(SpiConf_SpiSequence_TLE8242_DIAG_SEQ);
+    for (u8LocIdx = 0; u8LocIdx < TLE8242_u8CH_NR; ++u8LocIdx)
+    {
+        TLE8242_sabSchedDiagReq[u8LocIdx] = TRUE;
+    }
 }
 
 #define TLE8242_STOP_SEC_CODE
@@ -50,15 +50,29 @@
 #define TLE8242_bUSE_INT_BUF         1
 
 #define TLE8242_u8MAX_FRM_INIT_CH_1     6
-#define TLE8242_u8MAX_FRM_CTRL_CH_1     57
+#define TLE8242_u8MAX_FRM_CTRL_CH_1     24
 #define TLE8242_u8MAX_FRM_DIAG_CH_1     12
 #if TLE8242_u8CH_NR > 1
 #define TLE8242_u8MAX_FRM_INIT_CH_2     6
-#define TLE8242_u8MAX_FRM_CTRL_CH_2     50
+#define TLE8242_u8MAX_FRM_CTRL_CH_2     24
 #define TLE8242_u8MAX_FRM_DIAG_CH_2     4
 #endif
 
 #define TLE8242_u8MAX_NR_FLT			6
+/* report the debounced faults to Dem, the event ids below are still test values. */
+#define TLE8242_bDEM_REPORT          0
+
+/* control sequence scheduler: register groups in send priority order (0 first). */
+#define TLE8242_u8SCHED_CTRL_MOD        0
+#define TLE8242_u8SCHED_MAI_PERD        1
+#define TLE8242_u8SCHED_DITHER_PERD     2
+#define TLE8242_u8SCHED_CRNT_DITHER     3
+#define TLE8242_u8SCHED_PWM_DUTY        4
+#define TLE8242_u8SCHED_KP_KI           5
+#define TLE8242_u8SCHED_NB_GRP          6
+/* frames reserved for the reads: max/min, average, duty cycle and the diagnosis. */
+#define TLE8242_u8SCHED_NB_DIAG_FRM     3
+#define TLE8242_u8SCHED_NB_READ         (3 + TLE8242_u8SCHED_NB_DIAG_FRM)
 
 
 
@@ -181,6 +195,8 @@ typedef struct
 #define TLE8242_u8_FLT_SCS_TST_BIT      (2)
 #define TLE8242_u8_FLT_OL_OFF_BIT            (1)
 #define TLE8242_u8_FLT_OL_ON_BIT             (0)
+#define TLE8242_u8_FLT_NB_BIT                (6)
+#define TLE8242_u8_FLT_CH_MSK                (0x3F)
 
 
 #define TLE8242_u8_IC_VERS_MSG_ID 0
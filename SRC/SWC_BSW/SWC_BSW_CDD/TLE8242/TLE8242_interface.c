@@ -91,6 +91,10 @@ static uint16 TLE8242_su16ScsSts = 0;
 static uint16 TLE8242_su16ScSts = 0;
 static uint16 TLE8242_su16OpenLoadSts = 0;
 
+/* Q28 gains of the current <-> set-point conversion, derived from the shunt at init. */
+static uint32 TLE8242_su32CrntToSetPointGain = 0;
+static uint32 TLE8242_su32SetPointToCrntGain = 0;
+
 
 
 
@@ -100,32 +104,67 @@ static uint16 TLE8242_su16OpenLoadSts = 0;
  * function declaration.
  * */
 
-uint32 TLE8242_u32CnvCrntToSetPoint(float32 f32CrntTar)
+/**********************************************************************************************************************/
+/* !FuncName    : TLE8242_vidInitCrntGain                                                                                    */
+/* !Description :                                  */
+/* Set-point = mA * 2048 * R_Shunt / 320. Both directions are kept as Q28 integer gains so that the 1ms path does     */
+/* not need any float operation. The float64 computation here is done once at init.                                  */
+/**********************************************************************************************************************/
+void TLE8242_vidInitCrntGain(void)
 {
-	float32 f32LocLocTmp;
-	uint32 u16Locsetpoint;
+	float64 f64LocGain;
 
+	f64LocGain = ((float64)TLE8242_kf32R_Shunt * 2048.0 * TLE8242_u32CRNT_GAIN_ONE) / 320.0;
+	TLE8242_su32CrntToSetPointGain = (uint32)(f64LocGain + 0.5);
 
-	f32LocLocTmp = f32CrntTar * 2048;
-	f32LocLocTmp = f32LocLocTmp * TLE8242_kf32R_Shunt;
-	f32LocLocTmp = f32LocLocTmp / 320;
+	if (0 != TLE8242_kf32R_Shunt)
+	{
+		f64LocGain = (320.0 * TLE8242_u32CRNT_GAIN_ONE) / (2048.0 * (float64)TLE8242_kf32R_Shunt);
+		TLE8242_su32SetPointToCrntGain = (uint32)(f64LocGain + 0.5);
+	}
+	else
+	{
+		TLE8242_su32SetPointToCrntGain = 0;
+	}
+}
 
-	f32LocLocTmp += 0.5;
+/**********************************************************************************************************************/
+/* !FuncName    : TLE8242_u32CnvCrntToSetPoint                                                                                    */
+/* !Description :                                  */
+/* round(mA * gain / div). The product is reduced to 32 bit before the division. Within 1 LSB of the float32 path it  */
+/* replaces, see TST_MATHSRV_Crnt.c.                                                                                  */
+/**********************************************************************************************************************/
+uint32 TLE8242_u32CnvCrntToSetPoint(uint16 u16LocCrntMa, uint32 u32LocDiv)
+{
+	uint32 u32LocTmp;
 
-	u16Locsetpoint = (uint32)f32LocLocTmp;
-	return (u16Locsetpoint);
+	if (0 == u32LocDiv)
+	{
+		u32LocDiv = 1;
+	}
+	u32LocTmp = (uint32)(((uint64)u16LocCrntMa * TLE8242_su32CrntToSetPointGain) >> (TLE8242_u8CRNT_GAIN_SHIFT - 10));
 
+	return ((u32LocTmp + (u32LocDiv << 9)) / (u32LocDiv << 10));
 }
-float32 TLE8242_f32CnvpointToCrnt(uint32 setpoint)
-{
-	float32 f32LocLocTmp;
 
-	f32LocLocTmp = setpoint * 320;
-	f32LocLocTmp = f32LocLocTmp/2048;
-	f32LocLocTmp = f32LocLocTmp/TLE8242_kf32R_Shunt;
+/**********************************************************************************************************************/
+/* !FuncName    : TLE8242_u16CnvPointToCrnt                                                                                    */
+/* !Description :                                  */
+/* floor(setpoint * gain / (2^shift * div)) in mA. Within 1 mA of the float32 path it replaces: near an integer       */
+/* mA the Q28 gain and the float32 quotient may truncate to each side of it, see TST_MATHSRV_Crnt.c.                  */
+/**********************************************************************************************************************/
+uint16 TLE8242_u16CnvPointToCrnt(uint32 u32LocSetPoint, uint8 u8LocShift, uint32 u32LocDiv)
+{
+	uint32 u32LocTmp;
 
-	return (f32LocLocTmp);
+	if (0 == u32LocDiv)
+	{
+		u32LocDiv = 1;
+	}
+	u32LocTmp = (uint32)(((uint64)u32LocSetPoint * TLE8242_su32SetPointToCrntGain) >> (TLE8242_u8CRNT_GAIN_SHIFT + u8LocShift));
+	u32LocTmp = u32LocTmp / u32LocDiv;
 
+	return ((uint16)((u32LocTmp > 0xFFFFU) ? 0xFFFFU : u32LocTmp));
 }
 //SPI Message #0 - IC Version / Manufacturer
 Tle8242ICManufIDTyp TLE8242_stGetIcManufID (uint8 u8LocChIdx)
@@ -489,13 +528,13 @@ void TLE8242_vidSetOptEnaDeactive (uint8 u8LocChIdx, Tle8242OptEnableDeactiveTyp
     TLE8242_astSpiTx[u8LocChipIdx].CurrentandDitherAmplitudeSet[u8ChIdx].bits.EN = stEN;
 
 }
-void TLE8242_vidSetCrntTarBuf (uint8 u8LocChIdx, CurrentsetpointType f32LocCrntTar)
+void TLE8242_vidSetCrntTarBuf (uint8 u8LocChIdx, CurrentsetpointType u16LocCrntTar)
 {
     uint8 u8LocChipIdx,  u8ChIdx;
-    uint16 u16SetPoint;
+    uint32 u16SetPoint;
 
 
-    u16SetPoint = TLE8242_u32CnvCrntToSetPoint(f32LocCrntTar);
+    u16SetPoint = TLE8242_u32CnvCrntToSetPoint(u16LocCrntTar, 1);
 
     u8LocChipIdx = u8LocChIdx / 8;
     u8ChIdx = (u8LocChIdx % 8);
@@ -505,14 +544,14 @@ void TLE8242_vidSetCrntTarBuf (uint8 u8LocChIdx, CurrentsetpointType f32LocCrntT
 
 }
 
-CurrentsetpointType TLE8242_f32GetCrntTar (uint8 u8LocChIdx)
+CurrentsetpointType TLE8242_u16GetCrntTar (uint8 u8LocChIdx)
 {
     uint8 u8LocChipIdx,  u8ChIdx;
 
     u8LocChipIdx = u8LocChIdx / 8;
     u8ChIdx = (u8LocChIdx % 8);
 
-    return ((CurrentsetpointType)(TLE8242_f32CnvpointToCrnt(TLE8242_astSpiRx[u8LocChipIdx].CurrentandDitherAmplitudeSet[u8ChIdx].bits.Currentsetpoint)));
+    return ((CurrentsetpointType)(TLE8242_u16CnvPointToCrnt(TLE8242_astSpiRx[u8LocChipIdx].CurrentandDitherAmplitudeSet[u8ChIdx].bits.Currentsetpoint, 0, 1)));
 
 }
 
@@ -524,24 +563,20 @@ CurrentsetpointType TLE8242_f32GetCrntTar (uint8 u8LocChIdx)
 /* This function should be called after TLE8242_vidSetDitherFrq(), because the ampl is related to the dither frequency.       */
 /* !LastAuthor  : gsun5                                                                                          */
 /**********************************************************************************************************************/
-void TLE8242_vidSetDitherAmpBuf(uint8 u8LocChIdx, float32 f32LocCrnt)
+void TLE8242_vidSetDitherAmpBuf(uint8 u8LocChIdx, uint16 u16LocCrnt)
 {
 
-    uint16 u16LocSteps, u16LocSetPoint;
+    uint16 u16LocSteps;
+    uint32 u32LocSetPoint;
 
     u16LocSteps = TLE8242_u16GetStepsNr(u8LocChIdx);
-    u16LocSetPoint = (uint16)((float)((TLE8242_u32CnvCrntToSetPoint(f32LocCrnt/u16LocSteps))*TLE8242_u8DITHER_SETPOINT_TO_CURRENT_POINT/2)+0.5);
+    u32LocSetPoint = (TLE8242_u32CnvCrntToSetPoint(u16LocCrnt, u16LocSteps) * TLE8242_u8DITHER_SETPOINT_TO_CURRENT_POINT) / 2;
 
-    TLE8242_vidSetDitherStepSize(u8LocChIdx, u16LocSetPoint);
+    TLE8242_vidSetDitherStepSize(u8LocChIdx, (DitherstepsizeType)((u32LocSetPoint > 0xFFFFU) ? 0xFFFFU : u32LocSetPoint));
 }
-float32 TLE8242_f32GetDitherAmp(uint8 u8LocChIdx)
+uint16 TLE8242_u16GetDitherAmp(uint8 u8LocChIdx)
 {
-    uint16 u16LocDitherSteps;
-    float32 f32LocCrnt;
-
-    u16LocDitherSteps = TLE8242_u16GetStepsNr(u8LocChIdx);
-    f32LocCrnt = (TLE8242_f32CnvpointToCrnt(TLE8242_u16GetDitherStepSize(u8LocChIdx)) / TLE8242_u8DITHER_SETPOINT_TO_CURRENT_POINT);
-    return f32LocCrnt;
+    return (TLE8242_u16CnvPointToCrnt(TLE8242_u16GetDitherStepSize(u8LocChIdx), 0, TLE8242_u8DITHER_SETPOINT_TO_CURRENT_POINT));
 }
 
 DitherstepsizeType TLE8242_u16GetDitherStepSize (uint8 u8LocChIdx)
@@ -642,13 +677,19 @@ boolean TLE8242GetDitherEnabled(uint8 u8LocChIdx)
 //SPI Message #12 - Max / Min Current Read
 //SPI Message #13 - Average Current Read Over Dither Period
 
-float32 TLE8242_f32GetCrntFb(uint8 u8LocChIdx, Tle8242CurrentType stTtype)
+/**********************************************************************************************************************/
+/* !FuncName    : TLE8242_u16GetCrntFb                                                                                    */
+/* !Description :                                  */
+/* The raw value is the sum over the averaging window: the power of two part of the ratio is a shift, only the        */
+/* number of dither steps is a real division.                                                                         */
+/**********************************************************************************************************************/
+uint16 TLE8242_u16GetCrntFb(uint8 u8LocChIdx, Tle8242CurrentType stTtype)
 {
     boolean u8LocEna;
     Tle8242CtrlModTyp stLocMod;
-    float32 f32LocFb;
     uint8 u8LocChipIdx,  u8ChIdx;
-    uint32 u32LocCrntRaw, u32LocRat;
+    uint8 u8LocRatShift;
+    uint32 u32LocCrntRaw = 0, u32LocRat;
 
     u8LocChipIdx = u8LocChIdx / 8;
     u8ChIdx = (u8LocChIdx % 8);
@@ -670,24 +711,24 @@ float32 TLE8242_f32GetCrntFb(uint8 u8LocChIdx, Tle8242CurrentType stTtype)
         break;
     }
 
+    u32LocRat = 1;
     if ((TLE8242_DIRECT_PWM_MOD == stLocMod) && (512 == TLE8242_u32GetDivM(u8LocChIdx)))
     {
         if (TLE8242_AVG_CRNT == stTtype)
         {
             if (u8LocEna)
             {
-                uint8 steps = TLE8242_u16GetStepsNr(u8LocChIdx);
-
-                u32LocRat = 16 * 4 * steps;
+                u32LocRat = TLE8242_u16GetStepsNr(u8LocChIdx);
+                u8LocRatShift = 6; /* 16 * 4 * steps */
             }
             else
             {
-                u32LocRat = 16;
+                u8LocRatShift = 4; /* 16 */
             }
         }
         else
         {
-            u32LocRat = 4;
+            u8LocRatShift = 2; /* 4 */
         }
     }
     else
@@ -696,23 +737,21 @@ float32 TLE8242_f32GetCrntFb(uint8 u8LocChIdx, Tle8242CurrentType stTtype)
         {
             if (u8LocEna)
             {
-                uint8 steps = TLE8242_u16GetStepsNr(u8LocChIdx);
-
-                u32LocRat = (16 * steps);
+                u32LocRat = TLE8242_u16GetStepsNr(u8LocChIdx);
+                u8LocRatShift = 4; /* 16 * steps */
             }
             else
             {
-                u32LocRat = (4);
+                u8LocRatShift = 2; /* 4 */
             }
         }
         else
         {
-            u32LocRat = 1;
+            u8LocRatShift = 0;
         }
     }
-    f32LocFb = TLE8242_f32CnvpointToCrnt(u32LocCrntRaw) / u32LocRat;
 
-    return f32LocFb;
+    return TLE8242_u16CnvPointToCrnt(u32LocCrntRaw, u8LocRatShift, u32LocRat);
 }
 Tle8242ValidType TLE8242_bGetCrntVld(uint8 u8LocChIdx, Tle8242CurrentType stTtype)
 {
@@ -837,9 +876,9 @@ boolean TLE8242_bGetChOverLoadFlt(uint8 u8LocChIdx)
 {
 	boolean bLocFlt = 0;
 
-	if(0 != TLE8242_af32TarCnrtMa[u8LocChIdx])
+	if(0 != TLE8242_au16TarCnrtMa[u8LocChIdx])
 	{
-		bLocFlt = (((TLE8242_af32TarCnrtMa[u8LocChIdx] - TLE8242_af32AvgCrntMa[u8LocChIdx])/TLE8242_af32TarCnrtMa[u8LocChIdx]) > TLE8242_kf32OverUnderLoadThd);
+		bLocFlt = (((float32)((sint32)TLE8242_au16TarCnrtMa[u8LocChIdx] - (sint32)TLE8242_au16AvgCrntMa[u8LocChIdx])/TLE8242_au16TarCnrtMa[u8LocChIdx]) > TLE8242_kf32OverUnderLoadThd);
 	}
 	return bLocFlt;
 }
@@ -847,9 +886,9 @@ boolean TLE8242_bGetChUnderLoadFlt(uint8 u8LocChIdx)
 {
 	boolean bLocFlt = 0;
 
-	if(0 != TLE8242_af32TarCnrtMa[u8LocChIdx])
+	if(0 != TLE8242_au16TarCnrtMa[u8LocChIdx])
 	{
-		bLocFlt = (((TLE8242_af32AvgCrntMa[u8LocChIdx] - TLE8242_af32TarCnrtMa[u8LocChIdx])/TLE8242_af32TarCnrtMa[u8LocChIdx]) > TLE8242_kf32OverUnderLoadThd);
+		bLocFlt = (((float32)((sint32)TLE8242_au16AvgCrntMa[u8LocChIdx] - (sint32)TLE8242_au16TarCnrtMa[u8LocChIdx])/TLE8242_au16TarCnrtMa[u8LocChIdx]) > TLE8242_kf32OverUnderLoadThd);
 	}
 	return bLocFlt;
 }
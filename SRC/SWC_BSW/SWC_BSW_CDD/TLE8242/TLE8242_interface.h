@@ -39,6 +39,10 @@
 #include "TLE8242_cfg.h"
 
 
+/* Q format of the integer current <-> set-point gains. */
+#define TLE8242_u8CRNT_GAIN_SHIFT     28
+#define TLE8242_u32CRNT_GAIN_ONE      ((uint32)1 << TLE8242_u8CRNT_GAIN_SHIFT)
+
 #define TLE8242_START_SEC_VAR_UNSPECIFIED
 #include "MemMap.h"
  typedef enum
@@ -78,7 +82,7 @@ typedef enum{
 }
 Tle8242OptEnableDeactiveType;
 typedef uint16 DitherstepsizeType;
-typedef float32 CurrentsetpointType;
+typedef uint16 CurrentsetpointType; /* mA */
 typedef uint32 KIType;
 typedef uint32 KPType;
 typedef enum{
@@ -146,10 +150,10 @@ extern KIType TLE8242_u32GetKI (uint8 u8LocChIdx);
 extern void TLE8242_vidSetKI (uint8 u8LocChIdx, KIType u32Locki);
 extern void TLE8242_vidSetDitherStepSize (uint8 u8LocChIdx, DitherstepsizeType u16LocSize);
 extern void TLE8242_vidSetOptEnaDeactive (uint8 u8LocChIdx, Tle8242OptEnableDeactiveType enuLocen);
-extern void TLE8242_vidSetCrntTarBuf (uint8 u8LocChIdx, CurrentsetpointType f32LocCnrt);
-extern CurrentsetpointType TLE8242_f32GetCrntTar (uint8 u8LocChIdx);
-extern void TLE8242_vidSetDitherAmpBuf(uint8 u8LocChIdx, float32 f32LocCnrt);
-extern float32 TLE8242_f32GetDitherAmp(uint8 u8LocChIdx);
+extern void TLE8242_vidSetCrntTarBuf (uint8 u8LocChIdx, CurrentsetpointType u16LocCnrt);
+extern CurrentsetpointType TLE8242_u16GetCrntTar (uint8 u8LocChIdx);
+extern void TLE8242_vidSetDitherAmpBuf(uint8 u8LocChIdx, uint16 u16LocCnrt);
+extern uint16 TLE8242_u16GetDitherAmp(uint8 u8LocChIdx);
 extern DitherstepsizeType TLE8242_u16GetDitherStepSize (uint8 u8LocChIdx);
 extern Tle8242OptEnableDeactiveType TLE8242GetOptEnableDeactive (uint8 u8LocChIdx);
 extern void TLE8242_vidSetDitherFrqBuf(uint8 u8LocChIdx, float32 f32LocFrq);
@@ -157,13 +161,14 @@ extern float32 TLE8242GetDitherFrq(uint8 u8LocChIdx);
 extern uint8 TLE8242_u16GetStepsNr(uint8 u8LocChIdx);
 extern void TLE8242SetNumberOfSteps(uint8 u8LocChIdx, uint8 numberofsteps);
 extern boolean TLE8242GetDitherEnabled(uint8 u8LocChIdx);
-extern float32 TLE8242_f32GetCrntFb(uint8 u8LocChIdx, Tle8242CurrentType enuLocType);
+extern uint16 TLE8242_u16GetCrntFb(uint8 u8LocChIdx, Tle8242CurrentType enuLocType);
 extern Tle8242ValidType TLE8242_bGetCrntVld(uint8 u8LocChIdx, Tle8242CurrentType enuLocType);
 extern boolean TLE8242_bGetGenericFalg(uint8 u8LocChIdx, Tle8242GenericFlagType enuLocType);
 extern float32 TLE8242_f32GetPwmDutyCycle(uint8 u8LocChIdx);
 extern void TLE8242_vidSetPwmDutyCycle(uint8 u8LocChIdx, float32 f32LocDuty);
-extern uint32 TLE8242_u32CnvCrntToSetPoint(float32 f32LocCnrt);
-extern float32 TLE8242_f32CnvpointToCrnt(uint32 u32LocSetPoint);
+extern void TLE8242_vidInitCrntGain(void);
+extern uint32 TLE8242_u32CnvCrntToSetPoint(uint16 u16LocCrntMa, uint32 u32LocDiv);
+extern uint16 TLE8242_u16CnvPointToCrnt(uint32 u32LocSetPoint, uint8 u8LocShift, uint32 u32LocDiv);
 
 extern boolean TLE8242_bGetChOpenLoadFlt(uint8 u8LocChIdx);
 extern boolean TLE8242_bGetChOverLoadFlt(uint8 u8LocChIdx);
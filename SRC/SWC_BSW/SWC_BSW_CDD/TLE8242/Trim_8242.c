@@ -3,12 +3,21 @@
 #include "Dio.h"
 #include "TLE8242_wrapper.h"
 #include "Trim_8242.h"
+#include "Trim_8242_App.h"
 
 
 #define TLE8242_START_SEC_VAR_UNSPECIFIED
 #include "MemMap.h"														
 EOL_DATA ParaForGainAndOffset[8];
-GainOfset GainAndOffset[8];
+boolean Trim_bParaChg = TRUE;
+sint16 Trim_s16PcbTempFilt;
+/* compensated gain and offset, double buffered: the 10ms update writes the inactive half then switches the index, */
+/* the set point path reads the index once and gets a consistent set without lock.                               */
+static GainOfset Trim_sastGainAndOffset[2][8];
+static volatile uint8 Trim_su8SnapIdx;
+static boolean Trim_sbSnapVld = FALSE;
+static sint32 Trim_ss32PcbTempFiltQ4;
+static sint16 Trim_ss16PcbTempUsed;
 #define TLE8242_STOP_SEC_VAR_UNSPECIFIED
 #include "MemMap.h"
 
@@ -20,6 +29,11 @@ void Trim_InitGainAndOffset(void)
 	
 	for(index = 0;index < 8; index++)
 	{
+		if((ParaForGainAndOffset[index].grd_grd != Flash_trimDataBuf[index][0]) || (ParaForGainAndOffset[index].grd_ofs != Flash_trimDataBuf[index][1]) ||
+		   (ParaForGainAndOffset[index].ofs_grd != Flash_trimDataBuf[index][2]) || (ParaForGainAndOffset[index].ofs_ofs != Flash_trimDataBuf[index][3]))
+		{
+			Trim_bParaChg = TRUE;
+		}
 		ParaForGainAndOffset[index].grd_grd = Flash_trimDataBuf[index][0];
 		ParaForGainAndOffset[index].grd_ofs = Flash_trimDataBuf[index][1];
 		ParaForGainAndOffset[index].ofs_grd = Flash_trimDataBuf[index][2];
@@ -29,12 +43,107 @@ void Trim_InitGainAndOffset(void)
 	
 }
 
+/*
+ * Gain and offset of one channel at the PCB temperature: linear EOL model (the temperature is mirrored below 0 and
+ * limited to 45 / 105 as before) or interpolation in the calibration tables, limited to the first / last breakpoint.
+ */
+void Trim_vidCompGainOfs(const EOL_DATA *para, uint8 index, sint16 PCB_temprature, GainOfset *result)
+{
+	uint8 bkpt;
+	sint32 delta_temp, span_temp;
+
+	if(0 == Trim_kau8TempModel[index])
+	{
+		if(PCB_temprature < 0)
+		{
+		  PCB_temprature = 0-PCB_temprature;
+		  
+		  if(PCB_temprature > 45)
+			{
+			PCB_temprature = 45;
+			}
+		}
+		else if(PCB_temprature > 105)
+		{
+			PCB_temprature = 105;
+		}
+		else
+		{
+		}
+		result->gain = PCB_temprature*para->grd_grd+para->grd_ofs;
+		result->offset = PCB_temprature*para->ofs_grd+para->ofs_ofs;
+	}
+	else
+	{
+		if(PCB_temprature <= Trim_kas16TempBkpt[0])
+		{
+			result->gain = Trim_kas32GainBkpt[index][0];
+			result->offset = Trim_kas32OfsBkpt[index][0];
+		}
+		else if(PCB_temprature >= Trim_kas16TempBkpt[TRIM_u8NB_TEMP_BKPT - 1])
+		{
+			result->gain = Trim_kas32GainBkpt[index][TRIM_u8NB_TEMP_BKPT - 1];
+			result->offset = Trim_kas32OfsBkpt[index][TRIM_u8NB_TEMP_BKPT - 1];
+		}
+		else
+		{
+			for(bkpt = 1; PCB_temprature > Trim_kas16TempBkpt[bkpt]; bkpt++)
+			{
+			}
+			delta_temp = PCB_temprature - Trim_kas16TempBkpt[bkpt - 1];
+			span_temp = Trim_kas16TempBkpt[bkpt] - Trim_kas16TempBkpt[bkpt - 1];
+			result->gain = Trim_kas32GainBkpt[index][bkpt - 1] +
+			               (sint32)(((sint64)(Trim_kas32GainBkpt[index][bkpt] - Trim_kas32GainBkpt[index][bkpt - 1]) * delta_temp) / span_temp);
+			result->offset = Trim_kas32OfsBkpt[index][bkpt - 1] +
+			                 (sint32)(((sint64)(Trim_kas32OfsBkpt[index][bkpt] - Trim_kas32OfsBkpt[index][bkpt - 1]) * delta_temp) / span_temp);
+		}
+	}
+}
+
+/*
+ * 10ms: filter the PCB temperature and republish the target and feedback gain/offset when it moved by more than
+ * Trim_ks16TempHys or when the EOL data changed, instead of computing them at each call.
+ */
+void Trim_vidTempMainFunction(void)
+{
+	uint8 index, next;
+	sint16 PCB_temprature = 0;
+	sint16 delta_temp;
+
+	Dio_Get_PCBTemp(&PCB_temprature);
+	if(FALSE == Trim_sbSnapVld)
+	{
+		Trim_ss32PcbTempFiltQ4 = (sint32)PCB_temprature << 4;
+	}
+	else
+	{
+		Trim_ss32PcbTempFiltQ4 += (((sint32)PCB_temprature << 4) - Trim_ss32PcbTempFiltQ4) >> Trim_ku8TempFiltShift;
+	}
+	Trim_s16PcbTempFilt = (sint16)(Trim_ss32PcbTempFiltQ4 >> 4);
+
+	delta_temp = Trim_s16PcbTempFilt - Trim_ss16PcbTempUsed;
+	if((FALSE == Trim_sbSnapVld) || (FALSE != Trim_bParaChg) || (delta_temp > Trim_ks16TempHys) || (delta_temp < -Trim_ks16TempHys))
+	{
+		Trim_bParaChg = FALSE;
+		Trim_ss16PcbTempUsed = Trim_s16PcbTempFilt;
+
+		next = Trim_su8SnapIdx ^ 1;
+		for(index = 0;index < 8; index++)
+		{
+			Trim_vidCompGainOfs(&ParaForGainAndOffset[index], index, Trim_ss16PcbTempUsed, &Trim_sastGainAndOffset[next][index]);
+		}
+		Trim_su8SnapIdx = next;
+		Trim_Feedback_vidPublish(Trim_ss16PcbTempUsed);
+		Trim_sbSnapVld = TRUE;
+	}
+}
+
 uint16 Trim_CalculateGainAndOffset(uint8 index,uint16 target_current)
 {
 	sint32 ADC_current = 0;
-	sint16 PCB_temprature = 0;
 	uint16 Trim_current;
 	sint32 target_current_temp = 0;
+	const GainOfset *snap;
 	
 	target_current_temp = target_current;
 	if(index >= 8)
@@ -53,36 +162,24 @@ uint16 Trim_CalculateGainAndOffset(uint8 index,uint16 target_current)
 		}
 		else
 		{
-			//PCB_temprature = 25;
-			Dio_Get_PCBTemp(&PCB_temprature);
-			if(PCB_temprature < 0)
-			{
-			  PCB_temprature = 0-PCB_temprature;
-			  
-			  if(PCB_temprature > 45)
-				{
-				PCB_temprature = 45;
-				}
-			}
-			else if(PCB_temprature > 105)
-			{
-				PCB_temprature = 105;
-			}
-			else
+			if(FALSE == Trim_sbSnapVld)
 			{
+				Trim_vidTempMainFunction();
 			}
+			snap = &Trim_sastGainAndOffset[Trim_su8SnapIdx][index];
 			
-			GainAndOffset[index].gain = PCB_temprature*ParaForGainAndOffset[index].grd_grd+ParaForGainAndOffset[index].grd_ofs;
-			GainAndOffset[index].offset = PCB_temprature*ParaForGainAndOffset[index].ofs_grd+ParaForGainAndOffset[index].ofs_ofs;
-			
-			ADC_current = (((sint32)((target_current_temp )* GainAndOffset[index].gain + GainAndOffset[index].offset))/32768);//2^15 = 32768
+			ADC_current = (((sint32)((target_current_temp )* snap->gain + snap->offset))/32768);//2^15 = 32768
 			
 			if(ADC_current > 2048)
 			{
 				ADC_current = 2048;
 			}
+			else if(ADC_current < 0)
+			{
+				ADC_current = 0;
+			}
 			
-			Trim_current = (uint16)(ADC_current * CurrentPerLSB);
+			Trim_current = (uint16)((ADC_current * 125) >> 7); //CurrentPerLSB = 0.9765625 = 125/128
 		}
 			
 
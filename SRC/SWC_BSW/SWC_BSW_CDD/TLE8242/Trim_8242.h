@@ -39,9 +39,11 @@ typedef struct
 #include "MemMap.h"
 extern void Trim_InitGainAndOffset(void);
 extern uint16 Trim_CalculateGainAndOffset(uint8 index,uint16 target_current);
+extern void Trim_vidCompGainOfs(const EOL_DATA *para, uint8 index, sint16 PCB_temprature, GainOfset *result);
+extern void Trim_vidTempMainFunction(void);
 
-
-extern GainOfset GainAndOffset[8];
+extern boolean Trim_bParaChg;
+extern sint16 Trim_s16PcbTempFilt;
 #define TLE8242_STOP_SEC_CODE
 #include "MemMap.h"
 
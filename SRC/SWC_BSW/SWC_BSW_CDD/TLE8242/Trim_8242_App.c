@@ -13,7 +13,10 @@
 /*****************************************************************/
 /*************feedback_trim_current*********************************/
 EOL_DATA Feedback_ParaForGainAndOffset[8];
-GainOfset Feedback_GainAndOffset[8];
+/* double buffered like the target trim, published by Trim_vidTempMainFunction */
+static GainOfset Feedback_GainAndOffset[2][8];
+static volatile uint8 Feedback_su8SnapIdx;
+static boolean Feedback_sbSnapVld = FALSE;
 
 void Trim_Feedback_InitGainAndOffset(void)
 {
@@ -21,6 +24,11 @@ void Trim_Feedback_InitGainAndOffset(void)
 	
 	for(index = 0;index < 8; index++)
 	{
+		if((Feedback_ParaForGainAndOffset[index].grd_grd != Flash_trimDataBuf[index][0]) || (Feedback_ParaForGainAndOffset[index].grd_ofs != Flash_trimDataBuf[index][1]) ||
+		   (Feedback_ParaForGainAndOffset[index].ofs_grd != Flash_trimDataBuf[index][2]) || (Feedback_ParaForGainAndOffset[index].ofs_ofs != Flash_trimDataBuf[index][3]))
+		{
+			Trim_bParaChg = TRUE;
+		}
 		Feedback_ParaForGainAndOffset[index].grd_grd = Flash_trimDataBuf[index][0];
 		Feedback_ParaForGainAndOffset[index].grd_ofs = Flash_trimDataBuf[index][1];
 		Feedback_ParaForGainAndOffset[index].ofs_grd = Flash_trimDataBuf[index][2];
@@ -30,14 +38,27 @@ void Trim_Feedback_InitGainAndOffset(void)
 	
 }
 
+void Trim_Feedback_vidPublish(sint16 PCB_temprature)
+{
+	uint8 index, next;
+
+	next = Feedback_su8SnapIdx ^ 1;
+	for(index = 0;index < 8; index++)
+	{
+		Trim_vidCompGainOfs(&Feedback_ParaForGainAndOffset[index], index, PCB_temprature, &Feedback_GainAndOffset[next][index]);
+	}
+	Feedback_su8SnapIdx = next;
+	Feedback_sbSnapVld = TRUE;
+}
+
 uint16 Trim_Feedback_CalculateGainAndOffset(uint8 index,uint16 feedback_current)
 {
-	sint16 PCB_temprature = 0;
-	sint32 feedback_trim_current = 0;
-	sint32 feedback_current_temp = 0;
+	sint64 feedback_trim_current = 0;
+	sint64 feedback_current_temp = 0;
 	uint16 feedback_return_current = 0;
+	const GainOfset *snap;
 	
-	feedback_current_temp = (sint32)feedback_current;
+	feedback_current_temp = (sint64)feedback_current;
 	if(index >= 8)
 	{
 		 feedback_return_current = 0;
@@ -47,38 +68,23 @@ uint16 Trim_Feedback_CalculateGainAndOffset(uint8 index,uint16 feedback_current)
 	else
 	{
 		{
-			//PCB_temprature = 25;
-			Dio_Get_PCBTemp(&PCB_temprature);
-			if(PCB_temprature < 0)
+			if(FALSE == Feedback_sbSnapVld)
 			{
-			  PCB_temprature = 0-PCB_temprature;
-			  
-			  if(PCB_temprature > 45)
-				{
-				PCB_temprature = 45;
-				}
+				Trim_vidTempMainFunction();
 			}
-			else if(PCB_temprature > 105)
-			{
-				PCB_temprature = 105;
-			}
-			else
-			{
-			}
-			
-			Feedback_GainAndOffset[index].gain = PCB_temprature*Feedback_ParaForGainAndOffset[index].grd_grd+Feedback_ParaForGainAndOffset[index].grd_ofs;
-			Feedback_GainAndOffset[index].offset = PCB_temprature*Feedback_ParaForGainAndOffset[index].ofs_grd+Feedback_ParaForGainAndOffset[index].ofs_ofs;
+			snap = &Feedback_GainAndOffset[Feedback_su8SnapIdx][index];
 			
-            if(Feedback_GainAndOffset[index].gain == 0)
+			/* (feedback*1.024*32768 - offset)/gain, scaled by 1000 to stay in integer */
+            if(snap->gain == 0)
             {
-				feedback_trim_current = ((((feedback_current_temp*1.024)*32768) - Feedback_GainAndOffset[index].offset)/32768);	
+				feedback_trim_current = ((feedback_current_temp*33554432) - ((sint64)snap->offset*1000))/32768000;	
 
 				if(feedback_trim_current < 0)
 					feedback_trim_current = 0;				
 			}
 			else
 			{
-				feedback_trim_current = ((((feedback_current_temp*1.024)*32768) - Feedback_GainAndOffset[index].offset)/Feedback_GainAndOffset[index].gain);	
+				feedback_trim_current = ((feedback_current_temp*33554432) - ((sint64)snap->offset*1000))/((sint64)snap->gain*1000);	
 
 				if(feedback_trim_current < 0)
 					feedback_trim_current = 0;			
@@ -94,5 +100,3 @@ uint16 Trim_Feedback_CalculateGainAndOffset(uint8 index,uint16 feedback_current)
 
 #define TLE8242_STOP_SEC_CODE
 #include "MemMap.h"
-
-
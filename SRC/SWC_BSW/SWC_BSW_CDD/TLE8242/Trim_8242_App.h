@@ -8,6 +8,7 @@
 
 extern void Trim_Feedback_InitGainAndOffset(void);
 extern uint16 Trim_Feedback_CalculateGainAndOffset(uint8 index,uint16 feedback_current);
+extern void Trim_Feedback_vidPublish(sint16 PCB_temprature);
 
 #define TLE8242_STOP_SEC_CODE
 #include "MemMap.h"
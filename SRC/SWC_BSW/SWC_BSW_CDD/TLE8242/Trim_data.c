@@ -1,4 +1,5 @@
 #include "Std_Types.h"
+#include "Trim_data.h"
 
 /*********************************************************************************************/
 /*Flash_trimDataBuf[index][] = {sint32 grd_grd,sint32 grd_ofs,sint32 ofs_grd,sint32 ofs_ofs};*/		
@@ -13,6 +14,31 @@ const sint32 Flash_trimDataBuf[8][4] = {{2,33612,669,446474},
 								  {2,33612,669,446474},
 								  {2,33612,669,446474},
 								  {2,33612,669,446474}};
+
+/*********************************************************************************************/
+/*temperature compensation: recompute when the filtered PCB temperature moved by Trim_ks16TempHys*/
+/*Trim_kau8TempModel[index]: 0 linear EOL model above, 1 piecewise tables below              */
+/*********************************************************************************************/
+const sint16 Trim_ks16TempHys = 2;
+const uint8 Trim_ku8TempFiltShift = 3;
+const uint8 Trim_kau8TempModel[8] = {0,0,0,0,0,0,0,0};
+const sint16 Trim_kas16TempBkpt[TRIM_u8NB_TEMP_BKPT] = {-40,0,25,60,105};
+const sint32 Trim_kas32GainBkpt[8][TRIM_u8NB_TEMP_BKPT] = {{33692,33612,33662,33732,33822},
+								  {33692,33612,33662,33732,33822},
+								  {33692,33612,33662,33732,33822},
+								  {33692,33612,33662,33732,33822},
+								  {33692,33612,33662,33732,33822},
+								  {33692,33612,33662,33732,33822},
+								  {33692,33612,33662,33732,33822},
+								  {33692,33612,33662,33732,33822}};
+const sint32 Trim_kas32OfsBkpt[8][TRIM_u8NB_TEMP_BKPT] = {{473234,446474,463199,486614,516719},
+								  {473234,446474,463199,486614,516719},
+								  {473234,446474,463199,486614,516719},
+								  {473234,446474,463199,486614,516719},
+								  {473234,446474,463199,486614,516719},
+								  {473234,446474,463199,486614,516719},
+								  {473234,446474,463199,486614,516719},
+								  {473234,446474,463199,486614,516719}};
 								  
 #define TLE8242_STOP_SEC_CALIB_UNSPECIFIED
 #include "MemMap.h"
\ No newline at end of file
@@ -1,12 +1,20 @@
-#ifndef TRIM_TADA_H
+#ifndef TRIM_DATA_H
 #define TRIM_DATA_H
 
 #include "Std_Types.h"
 
+#define TRIM_u8NB_TEMP_BKPT        5
+
 #define TLE8242_START_SEC_CALIB_UNSPECIFIED
 #include "MemMap.h"
 
 extern const sint32 Flash_trimDataBuf[8][4];
+extern const sint16 Trim_ks16TempHys;
+extern const uint8 Trim_ku8TempFiltShift;
+extern const uint8 Trim_kau8TempModel[8];
+extern const sint16 Trim_kas16TempBkpt[TRIM_u8NB_TEMP_BKPT];
+extern const sint32 Trim_kas32GainBkpt[8][TRIM_u8NB_TEMP_BKPT];
+extern const sint32 Trim_kas32OfsBkpt[8][TRIM_u8NB_TEMP_BKPT];
 #define TLE8242_STOP_SEC_CALIB_UNSPECIFIED
 #include "MemMap.h"
 #endif
\ No newline at end of file
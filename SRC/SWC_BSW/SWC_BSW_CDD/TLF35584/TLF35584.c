@@ -23,6 +23,9 @@
 #include "Std_Limits.h"
 
 #include "SPI.h"
+#if defined(TST_SPISIM_bENA) && (TST_SPISIM_bENA == 1)
+#include "TST_SPISIM.h"
+#endif
 #include "TLF35584.h"
 #include "IOHAL.h"
 #include "Dio.h"
@@ -24,12 +24,23 @@
 
 
 /******************************************************************************/
-/* GLOBAL FUNCTION DEFINITION                                                 */
+/* LOCAL FUNCTION DECLARATION                                                 */
 /******************************************************************************/
 
 #define MATHSRV_START_SEC_CODE
 #include "MemMap.h"
 
+STATIC FUNC(uint16, MATHSRV_CODE) MATHSRV_u16CalcParaSite
+   (uint32 u32SiteIndex,
+   uint32 u32DeltaValueFromSite,
+   uint32 u32Width,
+   P2VAR(MATHSRV_tstrBkptHint, AUTOMATIC, MATHSRV_VAR) pstrHint);
+
+
+/******************************************************************************/
+/* GLOBAL FUNCTION DEFINITION                                                 */
+/******************************************************************************/
+
 /******************************************************************************/
 /* !FuncName    : MATHSRV_u16CalcParaIncAryU8Loc                              */
 /* !Description : Calculate the "Para" value of u8Value with a breakpoint     */
@@ -196,6 +207,273 @@ FUNC(uint16, MATHSRV_CODE) MATHSRV_u16CalcParaIncAryU16Loc
 }
 
 
+/******************************************************************************/
+/* !FuncName    : MATHSRV_u16CalcParaIncAryU8HintLoc                          */
+/* !Description : Same result as MATHSRV_u16CalcParaIncAryU8Loc. The segment  */
+/*                found by the previous call of the call site (pstrHint) and  */
+/*                its neighbours are tested before the binary-search, and the */
+/*                division is replaced by the cached reciprocal of the        */
+/*                segment width.                                              */
+/*                                                                            */
+/* !TraceTo   : VEMS_R_08_02127_001.01                                        */
+/*                                                                            */
+/* !LastAuthor : J. Perochon                                                  */
+/******************************************************************************/
+FUNC(uint16, MATHSRV_CODE) MATHSRV_u16CalcParaIncAryU8HintLoc
+(
+   CONST(uint8, MATHSRV_CONST) kau8BreakpointMap[],
+   uint8 u8Value,
+   uint8 u8BreakpointNumberMinusOne,
+   P2VAR(MATHSRV_tstrBkptHint, AUTOMATIC, MATHSRV_VAR) pstrHint
+)
+{
+   uint32 u32LocalPivot;
+   uint32 u32LocalSiteIndex;
+   uint32 u32LocalSiteValue;
+
+
+   if (u8Value >= kau8BreakpointMap[u8BreakpointNumberMinusOne])
+   {
+      /* !TraceTo : VEMS_R_08_02127_003.01                                          */
+      return( (uint16)( (uint32)u8BreakpointNumberMinusOne << 8) );
+   }
+
+   if (u8Value < kau8BreakpointMap[0])
+   {
+      /* !TraceTo : VEMS_R_08_02127_002.01                                          */
+      return(0);
+   }
+
+   /* !Comment : From here kau8BreakpointMap[0] <= u8Value < last point, the     */
+   /*            site is in [0, u8BreakpointNumberMinusOne - 1]                  */
+   u32LocalSiteIndex = pstrHint->u8Site;
+
+   if (u32LocalSiteIndex >= u8BreakpointNumberMinusOne)
+   {
+      u32LocalSiteIndex = (uint32)u8BreakpointNumberMinusOne - 1;
+   }
+
+   if (u8Value >= kau8BreakpointMap[u32LocalSiteIndex])
+   {
+      if (u8Value >= kau8BreakpointMap[u32LocalSiteIndex + 1])
+      {
+         /* !Comment : Site + 1 is valid since u8Value < last point            */
+         u32LocalSiteIndex++;
+         if (u8Value >= kau8BreakpointMap[u32LocalSiteIndex + 1])
+         {
+            u32LocalSiteIndex = u8BreakpointNumberMinusOne;
+         }
+      }
+   }
+   else
+   {
+      if (  (u32LocalSiteIndex > 0)
+         && (u8Value >= kau8BreakpointMap[u32LocalSiteIndex - 1]))
+      {
+         u32LocalSiteIndex--;
+      }
+      else
+      {
+         u32LocalSiteIndex = u8BreakpointNumberMinusOne;
+      }
+   }
+
+   if (u32LocalSiteIndex == u8BreakpointNumberMinusOne)
+   {
+      /* !Comment : Hint missed, perform a binary-search (Dichotomie)          */
+      u32LocalSiteIndex = 0;
+
+      while (u8BreakpointNumberMinusOne > 2)
+      {
+         u32LocalPivot = u32LocalSiteIndex + (u8BreakpointNumberMinusOne >> 1);
+         if (u8Value < kau8BreakpointMap[u32LocalPivot])
+         {
+            u8BreakpointNumberMinusOne = (uint8)(u32LocalPivot
+                                                 - u32LocalSiteIndex);
+         }
+         else
+         {
+            u8BreakpointNumberMinusOne = (uint8)( (u32LocalSiteIndex
+                                                   + u8BreakpointNumberMinusOne)
+                                                  - u32LocalPivot);
+            u32LocalSiteIndex = u32LocalPivot;
+         }
+      }
+
+      if (u8Value >= kau8BreakpointMap[u32LocalSiteIndex + 1])
+      {
+         u32LocalSiteIndex++;
+      }
+   }
+
+   u32LocalSiteValue = kau8BreakpointMap[u32LocalSiteIndex];
+
+   return(MATHSRV_u16CalcParaSite(u32LocalSiteIndex,
+                                  u8Value - u32LocalSiteValue,
+                                  kau8BreakpointMap[u32LocalSiteIndex + 1]
+                                  - u32LocalSiteValue,
+                                  pstrHint));
+   /* !Deviation: Violation of MISRA Rule 14.7. Reason : Optimisation, this      */
+   /*             function is used a lot of time                                 */
+}
+
+
+/******************************************************************************/
+/* !FuncName    : MATHSRV_u16CalcParaIncAryU16HintLoc                         */
+/* !Description : Same result as MATHSRV_u16CalcParaIncAryU16Loc. The segment */
+/*                found by the previous call of the call site (pstrHint) and  */
+/*                its neighbours are tested before the binary-search, and the */
+/*                division is replaced by the cached reciprocal of the        */
+/*                segment width.                                              */
+/*                                                                            */
+/* !TraceTo   : VEMS_R_08_02127_005.01                                        */
+/*                                                                            */
+/* !LastAuthor : J. Perochon                                                  */
+/******************************************************************************/
+FUNC(uint16, MATHSRV_CODE) MATHSRV_u16CalcParaIncAryU16HintLoc
+(
+   CONST(uint16, MATHSRV_CONST) kau16BreakpointMap[],
+   uint16 u16Value,
+   uint8 u8BreakpointNumberMinusOne,
+   P2VAR(MATHSRV_tstrBkptHint, AUTOMATIC, MATHSRV_VAR) pstrHint
+)
+{
+   uint32 u32LocalPivot;
+   uint32 u32LocalSiteIndex;
+   uint32 u32LocalSiteValue;
+
+
+   if (u16Value >= kau16BreakpointMap[u8BreakpointNumberMinusOne])
+   {
+      /* !TraceTo : VEMS_R_08_02127_007.01                                          */
+      return( (uint16)( (uint32)u8BreakpointNumberMinusOne << 8) );
+   }
+
+   if (u16Value < kau16BreakpointMap[0])
+   {
+      /* !TraceTo : VEMS_R_08_02127_006.01                                          */
+      return(0);
+   }
+
+   /* !Comment : From here kau16BreakpointMap[0] <= u16Value < last point, the   */
+   /*            site is in [0, u8BreakpointNumberMinusOne - 1]                  */
+   u32LocalSiteIndex = pstrHint->u8Site;
+
+   if (u32LocalSiteIndex >= u8BreakpointNumberMinusOne)
+   {
+      u32LocalSiteIndex = (uint32)u8BreakpointNumberMinusOne - 1;
+   }
+
+   if (u16Value >= kau16BreakpointMap[u32LocalSiteIndex])
+   {
+      if (u16Value >= kau16BreakpointMap[u32LocalSiteIndex + 1])
+      {
+         /* !Comment : Site + 1 is valid since u16Value < last point           */
+         u32LocalSiteIndex++;
+         if (u16Value >= kau16BreakpointMap[u32LocalSiteIndex + 1])
+         {
+            u32LocalSiteIndex = u8BreakpointNumberMinusOne;
+         }
+      }
+   }
+   else
+   {
+      if (  (u32LocalSiteIndex > 0)
+         && (u16Value >= kau16BreakpointMap[u32LocalSiteIndex - 1]))
+      {
+         u32LocalSiteIndex--;
+      }
+      else
+      {
+         u32LocalSiteIndex = u8BreakpointNumberMinusOne;
+      }
+   }
+
+   if (u32LocalSiteIndex == u8BreakpointNumberMinusOne)
+   {
+      /* !Comment : Hint missed, perform a binary-search (Dichotomie)          */
+      u32LocalSiteIndex = 0;
+
+      while (u8BreakpointNumberMinusOne > 2)
+      {
+         u32LocalPivot = u32LocalSiteIndex + (u8BreakpointNumberMinusOne >> 1);
+         if (u16Value < kau16BreakpointMap[u32LocalPivot])
+         {
+            u8BreakpointNumberMinusOne = (uint8)(u32LocalPivot
+                                                 - u32LocalSiteIndex);
+         }
+         else
+         {
+            u8BreakpointNumberMinusOne = (uint8)( (u32LocalSiteIndex
+                                                   + u8BreakpointNumberMinusOne)
+                                                  - u32LocalPivot);
+            u32LocalSiteIndex = u32LocalPivot;
+         }
+      }
+
+      if (u16Value >= kau16BreakpointMap[u32LocalSiteIndex + 1])
+      {
+         u32LocalSiteIndex++;
+      }
+   }
+
+   u32LocalSiteValue = kau16BreakpointMap[u32LocalSiteIndex];
+
+   return(MATHSRV_u16CalcParaSite(u32LocalSiteIndex,
+                                  u16Value - u32LocalSiteValue,
+                                  kau16BreakpointMap[u32LocalSiteIndex + 1]
+                                  - u32LocalSiteValue,
+                                  pstrHint));
+   /* !Deviation: Violation of MISRA Rule 14.7. Reason : Optimisation, this      */
+   /*             function is used a lot of time                                 */
+}
+
+
+/******************************************************************************/
+/* LOCAL FUNCTION DEFINITION                                                  */
+/******************************************************************************/
+
+/******************************************************************************/
+/* !FuncName    : MATHSRV_u16CalcParaSite                                     */
+/* !Description : Return (site << 8) + (delta << 8) / width and store the     */
+/*                site in the hint. The reciprocal 2^24 / width is cached in  */
+/*                the hint and computed again only when the width changes     */
+/*                (new segment or axis calibrated online). As delta < width   */
+/*                < 2^16, delta * reciprocal < 2^24 and the estimated         */
+/*                quotient is the exact one or one less, corrected by one     */
+/*                multiplication.                                             */
+/*                                                                            */
+/* !LastAuthor : J. Perochon                                                  */
+/******************************************************************************/
+STATIC FUNC(uint16, MATHSRV_CODE) MATHSRV_u16CalcParaSite
+(
+   uint32 u32SiteIndex,
+   uint32 u32DeltaValueFromSite,
+   uint32 u32Width,
+   P2VAR(MATHSRV_tstrBkptHint, AUTOMATIC, MATHSRV_VAR) pstrHint
+)
+{
+   uint32 u32LocalInterpolation;
+
+
+   if (u32Width != pstrHint->u16Width)
+   {
+      pstrHint->u16Width = (uint16)u32Width;
+      pstrHint->u32Rcp   = 0x01000000UL / u32Width;
+   }
+   pstrHint->u8Site = (uint8)u32SiteIndex;
+
+   u32LocalInterpolation = (u32DeltaValueFromSite * pstrHint->u32Rcp) >> 16;
+   u32DeltaValueFromSite = u32DeltaValueFromSite << 8;
+   if (((u32LocalInterpolation + 1) * u32Width) <= u32DeltaValueFromSite)
+   {
+      u32LocalInterpolation++;
+   }
+
+   return((uint16)((u32SiteIndex << 8) + u32LocalInterpolation));
+}
+
+
 #define MATHSRV_STOP_SEC_CODE
 #include "MemMap.h"
 
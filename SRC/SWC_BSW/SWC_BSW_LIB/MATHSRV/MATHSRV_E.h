@@ -38,6 +38,45 @@ typedef enum
    MATHSRV_FALLING_SCHMITT_TRIGGER
 } MATHSRV_tenuSchmittTriggerType;
 
+/* !Comment : Breakpoint search context of one call site: segment found by    */
+/*            the previous call and reciprocal of its width. A zero           */
+/*            initialised context is valid.                                   */
+typedef struct
+{
+   uint8  u8Site;
+   uint16 u16Width;
+   uint32 u32Rcp;
+} MATHSRV_tstrBkptHint;
+
+/* !Comment : Filter bank of u8ChannelNumber uint16 channels updated in one   */
+/*            pass. The arrays are owned by the caller and indexed by         */
+/*            channel; the median history holds u8MedianWindow samples per    */
+/*            channel, channel after channel (NULL_PTR if no median is used). */
+/*            MATHSRV_vidFilterBankInitU16 clamps u8MedianWindow down to 7, 5 */
+/*            or 3, or sets it to 0 (median disabled) below 3 or without      */
+/*            history.                                                        */
+typedef struct
+{
+   P2VAR(uint32, TYPEDEF, MATHSRV_VAR) pau32AccuracyFilterValue;
+   P2VAR(uint16, TYPEDEF, MATHSRV_VAR) pau16FilteredValue;
+   P2VAR(uint16, TYPEDEF, MATHSRV_VAR) pau16MedianHistory;
+   uint8 u8ChannelNumber;
+   uint8 u8MedianWindow;
+   uint8 u8MedianIndex;
+} MATHSRV_tstrFilterBankU16;
+
+
+/******************************************************************************/
+/* DEFINES                                                                    */
+/******************************************************************************/
+
+/* !Comment : Median windows supported by MATHSRV_vidMedianFilterBankU16 */
+#define MATHSRV_u8MEDIAN_WINDOW_OFF    0
+#define MATHSRV_u8MEDIAN_WINDOW_3      3
+#define MATHSRV_u8MEDIAN_WINDOW_5      5
+#define MATHSRV_u8MEDIAN_WINDOW_7      7
+#define MATHSRV_u8MEDIAN_WINDOW_MAX    MATHSRV_u8MEDIAN_WINDOW_7
+
 
 /******************************************************************************/
 /* MACRO FUNCTIONS                                                            */
@@ -72,6 +111,30 @@ typedef enum
    MATHSRV_u16CalcParaIncAryU16Loc(kau8BreakpointMap, u8Value,      \
                                    (u8BreakpointNumber - 1) )
 
+/******************************************************************************/
+/* !FuncName    : MATHSRV_u16CalcParaIncAryU8Hint                             */
+/* !Description : Macro-function which redirect                               */
+/*                MATHSRV_u16CalcParaIncAryU8Hint to                          */
+/*                MATHSRV_u16CalcParaIncAryU8HintLoc, with the number of      */
+/*                breakpoint instead of this number-1                         */
+/******************************************************************************/
+   #define MATHSRV_u16CalcParaIncAryU8Hint(kau8BreakpointMap, u8Value,  \
+                                           u8BreakpointNumber, pstrHint)\
+   MATHSRV_u16CalcParaIncAryU8HintLoc(kau8BreakpointMap, u8Value,       \
+                                      (u8BreakpointNumber - 1), pstrHint)
+
+/******************************************************************************/
+/* !FuncName    : MATHSRV_u16CalcParaIncAryU16Hint                            */
+/* !Description : Macro-function which redirect                               */
+/*                MATHSRV_u16CalcParaIncAryU16Hint to                         */
+/*                MATHSRV_u16CalcParaIncAryU16HintLoc, with the number of     */
+/*                breakpoint instead of this number-1                         */
+/******************************************************************************/
+   #define MATHSRV_u16CalcParaIncAryU16Hint(kau16BreakpointMap, u16Value, \
+                                            u8BreakpointNumber, pstrHint) \
+   MATHSRV_u16CalcParaIncAryU16HintLoc(kau16BreakpointMap, u16Value,      \
+                                       (u8BreakpointNumber - 1), pstrHint)
+
 /******************************************************************************/
 /* !FuncName    : MATHSRV_udtABS                                              */
 /* !Description : Macro-function which return the absolute value of a         */
@@ -170,6 +233,25 @@ FUNC(uint16, MATHSRV_CODE) MATHSRV_u16Interp2d
    uint16 u16SiteInterpolationYColumn,
    uint8 u8BreakpointNumberYColumn);
 
+FUNC(void, MATHSRV_CODE) MATHSRV_vidInterp1dAryU16
+   (CONST(uint16, MATHSRV_CONST) kau16BreakpointMap[],
+   CONST(uint16, MATHSRV_CONST) kau16Cartography[],
+   uint8 u8BreakpointNumber,
+   CONST(uint16, MATHSRV_VAR) au16Value[],
+   VAR(uint16, MATHSRV_VAR) au16Result[],
+   uint8 u8ValueNumber);
+
+FUNC(void, MATHSRV_CODE) MATHSRV_vidInterp2dAryU16
+   (P2CONST(uint16, AUTOMATIC, MATHSRV_CONST) pkau16Cartography,
+   CONST(uint16, MATHSRV_CONST) kau16BreakpointMapXLine[],
+   uint8 u8BreakpointNumberXLine,
+   CONST(uint16, MATHSRV_CONST) kau16BreakpointMapYColumn[],
+   uint8 u8BreakpointNumberYColumn,
+   CONST(uint16, MATHSRV_VAR) au16ValueXLine[],
+   CONST(uint16, MATHSRV_VAR) au16ValueYColumn[],
+   VAR(uint16, MATHSRV_VAR) au16Result[],
+   uint8 u8ValueNumber);
+
 
 /* !Comment : Computation of Site and interpolation-ratio parameters */
 FUNC(uint16, MATHSRV_CODE) MATHSRV_u16CalcParaIncAryU8Loc
@@ -182,6 +264,18 @@ FUNC(uint16, MATHSRV_CODE) MATHSRV_u16CalcParaIncAryU16Loc
    uint16 u16Value,
    uint8 u8BreakpointNumberMinusOne);
 
+FUNC(uint16, MATHSRV_CODE) MATHSRV_u16CalcParaIncAryU8HintLoc
+   (CONST(uint8, MATHSRV_CONST) kau8BreakpointMap[],
+   uint8 u8Value,
+   uint8 u8BreakpointNumberMinusOne,
+   P2VAR(MATHSRV_tstrBkptHint, AUTOMATIC, MATHSRV_VAR) pstrHint);
+
+FUNC(uint16, MATHSRV_CODE) MATHSRV_u16CalcParaIncAryU16HintLoc
+   (CONST(uint16, MATHSRV_CONST) kau16BreakpointMap[],
+   uint16 u16Value,
+   uint8 u8BreakpointNumberMinusOne,
+   P2VAR(MATHSRV_tstrBkptHint, AUTOMATIC, MATHSRV_VAR) pstrHint);
+
 
 /* !Comment : Filters */
 FUNC(uint16, MATHSRV_CODE) MATHSRV_u16FirstOrderFilterGu8
@@ -236,6 +330,26 @@ FUNC(uint16, MATHSRV_CODE) MATHSRV_u16MedianFilter
    uint16 u16Value2,
    uint16 u16Value3);
 
+FUNC(void, MATHSRV_CODE) MATHSRV_vidFilterBankInitU16
+   (P2VAR(MATHSRV_tstrFilterBankU16, AUTOMATIC, MATHSRV_VAR) pstrBank,
+   CONST(uint16, MATHSRV_VAR) au16InitValue[]);
+
+FUNC(void, MATHSRV_CODE) MATHSRV_vidFirstOrderFilterBankGu16
+   (P2VAR(MATHSRV_tstrFilterBankU16, AUTOMATIC, MATHSRV_VAR) pstrBank,
+   CONST(uint16, MATHSRV_CONST) kau16FilterGain[],
+   CONST(uint16, MATHSRV_VAR) au16MeasuredValue[]);
+
+FUNC(void, MATHSRV_CODE) MATHSRV_vidSlewFilterBankU16
+   (P2VAR(MATHSRV_tstrFilterBankU16, AUTOMATIC, MATHSRV_VAR) pstrBank,
+   CONST(uint16, MATHSRV_VAR) au16MeasuredValue[],
+   CONST(uint16, MATHSRV_CONST) kau16MaxIncrementValue[],
+   CONST(uint16, MATHSRV_CONST) kau16MaxDecrementValue[]);
+
+FUNC(void, MATHSRV_CODE) MATHSRV_vidMedianFilterBankU16
+   (P2VAR(MATHSRV_tstrFilterBankU16, AUTOMATIC, MATHSRV_VAR) pstrBank,
+   CONST(uint16, MATHSRV_VAR) au16MeasuredValue[],
+   VAR(uint16, MATHSRV_VAR) au16Result[]);
+
 
 /* !Comment : General Threshold */
 FUNC(void, MATHSRV_CODE) MATHSRV_vidSchmittTriggerU16
@@ -0,0 +1,338 @@
+/******************************************************************************/
+/* !Layer           : SRV                                                     */
+/* !Component       : MATHSRV                                                 */
+/* !Description     : MATH SERVICES                                           */
+/*                                                                            */
+/* !File            : MATHSRV_FILTER_BANK.c                                   */
+/* !Description     : MATH SERVICES                                           */
+/*                                                                            */
+/* !Reference       : PTS_DOC_5405229                                         */
+/*                                                                            */
+/* Coding language  : C                                                       */
+/*                                                                            */
+/* COPYRIGHT VALEO all rights reserved                                        */
+/******************************************************************************/
+/* Dimension Informations
+ * %PCMS_HEADER_SUBSTITUTION_START:%
+ * The PID has this format: <Product ID>:<Item ID>.<Variant>-<Item Type>;<Revision>
+ * %PID:%
+ * %PCMS_HEADER_SUBSTITUTION_END:%
+ ******************************************************************************/
+
+#include "Std_Types.h"
+#include "MATHSRV.h"
+
+/******************************************************************************/
+/* LOCAL FUNCTION DECLARATION                                                 */
+/******************************************************************************/
+
+#define MATHSRV_START_SEC_CODE
+#include "MemMap.h"
+
+STATIC FUNC(uint16, MATHSRV_CODE) MATHSRV_u16MedianFilterWindow
+   (P2CONST(uint16, AUTOMATIC, MATHSRV_VAR) pku16History,
+   uint8 u8MedianWindow);
+
+
+/******************************************************************************/
+/* GLOBAL FUNCTION DEFINITION                                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/* !FuncName    : MATHSRV_vidFilterBankInitU16                                */
+/* !Description : Initialise all the channels of a filter bank on the given   */
+/*                values: first order accuracy, filtered value and the whole  */
+/*                median history. The median window is clamped down to a      */
+/*                supported one (7, 5 or 3) so the history of the caller is   */
+/*                never overrun; below 3 or without history the median is     */
+/*                disabled (window 0).                                        */
+/*                                                                            */
+/* !Trace_To    :                                                             */
+/*                                                                            */
+/* !LastAuthor  : J. Perochon                                                 */
+/******************************************************************************/
+FUNC(void, MATHSRV_CODE) MATHSRV_vidFilterBankInitU16
+(
+   P2VAR(MATHSRV_tstrFilterBankU16, AUTOMATIC, MATHSRV_VAR) pstrBank,
+   CONST(uint16, MATHSRV_VAR) au16InitValue[]
+)
+{
+   uint8  u8LocalChannel;
+   uint8  u8LocalSample;
+   uint16 u16LocalValue;
+   P2VAR(uint16, AUTOMATIC, MATHSRV_VAR) pu16LocalHistory;
+
+
+   pu16LocalHistory = pstrBank->pau16MedianHistory;
+   if (  (pu16LocalHistory == NULL_PTR)
+      || (pstrBank->u8MedianWindow < MATHSRV_u8MEDIAN_WINDOW_3))
+   {
+      pu16LocalHistory         = NULL_PTR;
+      pstrBank->u8MedianWindow = MATHSRV_u8MEDIAN_WINDOW_OFF;
+   }
+   else if (pstrBank->u8MedianWindow >= MATHSRV_u8MEDIAN_WINDOW_7)
+   {
+      pstrBank->u8MedianWindow = MATHSRV_u8MEDIAN_WINDOW_7;
+   }
+   else if (pstrBank->u8MedianWindow >= MATHSRV_u8MEDIAN_WINDOW_5)
+   {
+      pstrBank->u8MedianWindow = MATHSRV_u8MEDIAN_WINDOW_5;
+   }
+   else
+   {
+      pstrBank->u8MedianWindow = MATHSRV_u8MEDIAN_WINDOW_3;
+   }
+
+   for (u8LocalChannel = 0; u8LocalChannel < pstrBank->u8ChannelNumber; u8LocalChannel++)
+   {
+      u16LocalValue = au16InitValue[u8LocalChannel];
+      pstrBank->pau32AccuracyFilterValue[u8LocalChannel] = (uint32)u16LocalValue << 16;
+      pstrBank->pau16FilteredValue[u8LocalChannel] = u16LocalValue;
+      if (pu16LocalHistory != NULL_PTR)
+      {
+         for (u8LocalSample = 0; u8LocalSample < pstrBank->u8MedianWindow; u8LocalSample++)
+         {
+            *pu16LocalHistory = u16LocalValue;
+            pu16LocalHistory++;
+         }
+      }
+   }
+   pstrBank->u8MedianIndex = 0;
+}
+
+/******************************************************************************/
+/* !FuncName    : MATHSRV_vidFirstOrderFilterBankGu16                         */
+/* !Description : MATHSRV_u16FirstOrderFilterGu16 applied to every channel of */
+/*                the bank in one pass. The outputs are written in            */
+/*                pau16FilteredValue.                                         */
+/*                                                                            */
+/* !Trace_To    : VEMS_R_08_02127_037.01                                      */
+/*                                                                            */
+/* !LastAuthor  : J. Perochon                                                 */
+/******************************************************************************/
+FUNC(void, MATHSRV_CODE) MATHSRV_vidFirstOrderFilterBankGu16
+(
+   P2VAR(MATHSRV_tstrFilterBankU16, AUTOMATIC, MATHSRV_VAR) pstrBank,
+   CONST(uint16, MATHSRV_CONST) kau16FilterGain[],
+   CONST(uint16, MATHSRV_VAR) au16MeasuredValue[]
+)
+{
+   uint8  u8LocalChannel;
+   uint32 u32LocalAccuracyFilterValue;
+   uint32 u32LocalPreviousFilterValue;
+   uint32 u32LocalAccuracyDelta;
+   uint16 u16LocalMeasuredValue;
+   P2VAR(uint32, AUTOMATIC, MATHSRV_VAR) pu32LocalAccuracy;
+   P2VAR(uint16, AUTOMATIC, MATHSRV_VAR) pu16LocalFiltered;
+
+
+   pu32LocalAccuracy = pstrBank->pau32AccuracyFilterValue;
+   pu16LocalFiltered = pstrBank->pau16FilteredValue;
+   for (u8LocalChannel = 0; u8LocalChannel < pstrBank->u8ChannelNumber; u8LocalChannel++)
+   {
+      u32LocalAccuracyFilterValue = pu32LocalAccuracy[u8LocalChannel];
+      u16LocalMeasuredValue = au16MeasuredValue[u8LocalChannel];
+      u32LocalPreviousFilterValue = (u32LocalAccuracyFilterValue + 32767) >> 16;
+
+      if (u16LocalMeasuredValue >= u32LocalPreviousFilterValue)
+      {
+         u32LocalAccuracyDelta = kau16FilterGain[u8LocalChannel]
+                                 * (u16LocalMeasuredValue - u32LocalPreviousFilterValue);
+         u32LocalAccuracyFilterValue = u32LocalAccuracyFilterValue + u32LocalAccuracyDelta;
+      }
+      else
+      {
+         u32LocalAccuracyDelta = kau16FilterGain[u8LocalChannel]
+                                 * (u32LocalPreviousFilterValue - u16LocalMeasuredValue);
+         u32LocalAccuracyFilterValue =
+            (
+               (u32LocalAccuracyDelta < u32LocalAccuracyFilterValue)
+               ? (u32LocalAccuracyFilterValue - u32LocalAccuracyDelta)
+               : 0
+            );
+      }
+
+      pu32LocalAccuracy[u8LocalChannel] = u32LocalAccuracyFilterValue;
+      pu16LocalFiltered[u8LocalChannel] =
+         (uint16)((u32LocalAccuracyFilterValue + 32767) >> 16);
+   }
+}
+
+/******************************************************************************/
+/* !FuncName    : MATHSRV_vidSlewFilterBankU16                                */
+/* !Description : MATHSRV_u16SlewFilter applied to every channel of the bank  */
+/*                in one pass. pau16FilteredValue holds the previous outputs  */
+/*                and receives the new ones.                                  */
+/*                                                                            */
+/* !Trace_To    : VEMS_R_08_02127_043.01                                      */
+/*                                                                            */
+/* !LastAuthor  : J. Perochon                                                 */
+/******************************************************************************/
+FUNC(void, MATHSRV_CODE) MATHSRV_vidSlewFilterBankU16
+(
+   P2VAR(MATHSRV_tstrFilterBankU16, AUTOMATIC, MATHSRV_VAR) pstrBank,
+   CONST(uint16, MATHSRV_VAR) au16MeasuredValue[],
+   CONST(uint16, MATHSRV_CONST) kau16MaxIncrementValue[],
+   CONST(uint16, MATHSRV_CONST) kau16MaxDecrementValue[]
+)
+{
+   uint8  u8LocalChannel;
+   uint16 u16LocalFilteredValue;
+   uint16 u16LocalMeasuredValue;
+   sint32 s32LocalLimitOutputValue;
+   P2VAR(uint16, AUTOMATIC, MATHSRV_VAR) pu16LocalFiltered;
+
+
+   pu16LocalFiltered = pstrBank->pau16FilteredValue;
+   for (u8LocalChannel = 0; u8LocalChannel < pstrBank->u8ChannelNumber; u8LocalChannel++)
+   {
+      u16LocalFilteredValue = pu16LocalFiltered[u8LocalChannel];
+      u16LocalMeasuredValue = au16MeasuredValue[u8LocalChannel];
+
+      if (u16LocalFilteredValue <= u16LocalMeasuredValue)
+      {
+         s32LocalLimitOutputValue = (sint32)u16LocalFilteredValue
+                                    + kau16MaxIncrementValue[u8LocalChannel];
+         if (s32LocalLimitOutputValue <= u16LocalMeasuredValue)
+         {
+            u16LocalMeasuredValue = (uint16)s32LocalLimitOutputValue;
+         }
+      }
+      else
+      {
+         s32LocalLimitOutputValue = (sint32)u16LocalFilteredValue
+                                    - kau16MaxDecrementValue[u8LocalChannel];
+         if (s32LocalLimitOutputValue >= u16LocalMeasuredValue)
+         {
+            u16LocalMeasuredValue = (uint16)s32LocalLimitOutputValue;
+         }
+      }
+      pu16LocalFiltered[u8LocalChannel] = u16LocalMeasuredValue;
+   }
+}
+
+/******************************************************************************/
+/* !FuncName    : MATHSRV_vidMedianFilterBankU16                              */
+/* !Description : Store the new sample of every channel in its median history */
+/*                and return the median of the last u8MedianWindow samples    */
+/*                (3, 5 or 7) of each channel. The bank shall be initialised  */
+/*                by MATHSRV_vidFilterBankInitU16; with the median disabled   */
+/*                the samples are returned unchanged.                         */
+/*                                                                            */
+/* !Trace_To    : VEMS_R_08_02127_036.01                                      */
+/*                                                                            */
+/* !LastAuthor  : J. Perochon                                                 */
+/******************************************************************************/
+FUNC(void, MATHSRV_CODE) MATHSRV_vidMedianFilterBankU16
+(
+   P2VAR(MATHSRV_tstrFilterBankU16, AUTOMATIC, MATHSRV_VAR) pstrBank,
+   CONST(uint16, MATHSRV_VAR) au16MeasuredValue[],
+   VAR(uint16, MATHSRV_VAR) au16Result[]
+)
+{
+   uint8 u8LocalChannel;
+   uint8 u8LocalWindow;
+   uint8 u8LocalIndex;
+   P2VAR(uint16, AUTOMATIC, MATHSRV_VAR) pu16LocalHistory;
+
+
+   u8LocalWindow = pstrBank->u8MedianWindow;
+   u8LocalIndex = pstrBank->u8MedianIndex;
+   pu16LocalHistory = pstrBank->pau16MedianHistory;
+   if (u8LocalWindow == MATHSRV_u8MEDIAN_WINDOW_OFF)
+   {
+      for (u8LocalChannel = 0; u8LocalChannel < pstrBank->u8ChannelNumber; u8LocalChannel++)
+      {
+         au16Result[u8LocalChannel] = au16MeasuredValue[u8LocalChannel];
+      }
+   }
+   else
+   {
+      for (u8LocalChannel = 0; u8LocalChannel < pstrBank->u8ChannelNumber; u8LocalChannel++)
+      {
+         pu16LocalHistory[u8LocalIndex] = au16MeasuredValue[u8LocalChannel];
+         if (u8LocalWindow == MATHSRV_u8MEDIAN_WINDOW_3)
+         {
+            au16Result[u8LocalChannel] = MATHSRV_u16MedianFilter(pu16LocalHistory[0],
+                                                                 pu16LocalHistory[1],
+                                                                 pu16LocalHistory[2]);
+         }
+         else
+         {
+            au16Result[u8LocalChannel] =
+               MATHSRV_u16MedianFilterWindow(pu16LocalHistory, u8LocalWindow);
+         }
+         pu16LocalHistory = &pu16LocalHistory[u8LocalWindow];
+      }
+
+      u8LocalIndex++;
+      if (u8LocalIndex >= u8LocalWindow)
+      {
+         u8LocalIndex = 0;
+      }
+      pstrBank->u8MedianIndex = u8LocalIndex;
+   }
+}
+
+
+/******************************************************************************/
+/* LOCAL FUNCTION DEFINITION                                                  */
+/******************************************************************************/
+
+/******************************************************************************/
+/* !FuncName    : MATHSRV_u16MedianFilterWindow                               */
+/* !Description : Median of a 5 or 7 samples history. The samples are insert  */
+/*                sorted in a local copy, only up to the middle element.      */
+/*                                                                            */
+/* !LastAuthor  : J. Perochon                                                 */
+/******************************************************************************/
+STATIC FUNC(uint16, MATHSRV_CODE) MATHSRV_u16MedianFilterWindow
+(
+   P2CONST(uint16, AUTOMATIC, MATHSRV_VAR) pku16History,
+   uint8 u8MedianWindow
+)
+{
+   uint8  u8LocalSample;
+   uint8  u8LocalMiddle;
+   uint8  u8LocalSorted;
+   uint8  u8LocalPos;
+   uint16 u16LocalValue;
+   uint16 au16LocalSorted[MATHSRV_u8MEDIAN_WINDOW_MAX / 2 + 1];
+
+
+   /* Keep the (middle + 1) smallest samples sorted: the median is the last */
+   u8LocalMiddle = (uint8)(u8MedianWindow / 2);
+   u8LocalSorted = 0;
+   for (u8LocalSample = 0; u8LocalSample < u8MedianWindow; u8LocalSample++)
+   {
+      u16LocalValue = pku16History[u8LocalSample];
+      if (u8LocalSorted <= u8LocalMiddle)
+      {
+         u8LocalPos = u8LocalSorted;
+         u8LocalSorted++;
+      }
+      else
+      {
+         /* Drop the largest kept sample, or the new one if it is larger */
+         u8LocalPos = u8LocalMiddle;
+         if (u16LocalValue > au16LocalSorted[u8LocalMiddle])
+         {
+            u16LocalValue = au16LocalSorted[u8LocalMiddle];
+         }
+      }
+      while ((u8LocalPos > 0) && (au16LocalSorted[u8LocalPos - 1] > u16LocalValue))
+      {
+         au16LocalSorted[u8LocalPos] = au16LocalSorted[u8LocalPos - 1];
+         u8LocalPos--;
+      }
+      au16LocalSorted[u8LocalPos] = u16LocalValue;
+   }
+   return(au16LocalSorted[u8LocalMiddle]);
+}
+
+
+#define MATHSRV_STOP_SEC_CODE
+#include "MemMap.h"
+
+
+/*------------------------------- end of file --------------------------------*/
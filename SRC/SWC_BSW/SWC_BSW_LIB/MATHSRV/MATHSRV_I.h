@@ -24,6 +24,15 @@
 
 #include "Std_Types.h"
 
+/* !Comment : STD_ON : the 32 bit MulDiv services use the native 64 bit       */
+/*            product (MUL.U) and division of the compiler, STD_OFF : the     */
+/*            product and the division are emulated on 32 bit words.          */
+/*            STD_ON changes u32Mul_u32_s32_div_u32/_s32 when the rounded     */
+/*            quotient is 2^32: UINT32_MAX instead of 0 (see TST_MATHSRV).    */
+#ifndef MATHSRV_coMULDIV_NATIVE_64
+#define MATHSRV_coMULDIV_NATIVE_64   STD_OFF
+#endif
+
 /******************************************************************************/
 /* !FuncName    : MATHSRV_udtUX_DIV_UX_RND                                    */
 /* !Description : Calculate the Rounded Off result of Dividing 2 udtNumbers   */
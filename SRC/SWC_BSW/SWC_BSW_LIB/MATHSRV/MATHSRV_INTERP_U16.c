@@ -222,6 +222,110 @@ FUNC(uint16, MATHSRV_CODE) MATHSRV_u16Interp2d
 }
 
 
+/******************************************************************************/
+/* !FuncName    : MATHSRV_vidInterp1dAryU16                                   */
+/* !Description : Interpolate the u8ValueNumber values of au16Value on the    */
+/*                same axis and uint16 map, results in au16Result. Each       */
+/*                result is the one of MATHSRV_u16CalcParaIncAryU16 followed  */
+/*                by MATHSRV_u16Interp1d; the breakpoint search of a value    */
+/*                starts from the segment of the previous one.                */
+/*                                                                            */
+/* !Trace_To    : VEMS_R_08_02127_025.01                                      */
+/*                                                                            */
+/* !LastAuthor  : J. Perochon                                                 */
+/******************************************************************************/
+FUNC(void, MATHSRV_CODE) MATHSRV_vidInterp1dAryU16
+(
+   CONST(uint16, MATHSRV_CONST) kau16BreakpointMap[],
+   CONST(uint16, MATHSRV_CONST) kau16Cartography[],
+   uint8 u8BreakpointNumber,
+   CONST(uint16, MATHSRV_VAR) au16Value[],
+   VAR(uint16, MATHSRV_VAR) au16Result[],
+   uint8 u8ValueNumber
+)
+{
+   uint16               u16LocalSite;
+   uint32               u32LocalIndex;
+   MATHSRV_tstrBkptHint strLocalHint;
+
+
+   strLocalHint.u8Site   = 0;
+   strLocalHint.u16Width = 0;
+   strLocalHint.u32Rcp   = 0;
+
+   for (u32LocalIndex = 0; u32LocalIndex < u8ValueNumber; u32LocalIndex++)
+   {
+      u16LocalSite = MATHSRV_u16CalcParaIncAryU16Hint(kau16BreakpointMap,
+                                                      au16Value[u32LocalIndex],
+                                                      u8BreakpointNumber,
+                                                      &strLocalHint);
+      au16Result[u32LocalIndex] = MATHSRV_u16Interp1d(kau16Cartography,
+                                                      u16LocalSite);
+   }
+}
+
+
+/******************************************************************************/
+/* !FuncName    : MATHSRV_vidInterp2dAryU16                                   */
+/* !Description : Interpolate the u8ValueNumber couples (au16ValueXLine,      */
+/*                au16ValueYColumn) on the same axes and uint16 map, results  */
+/*                in au16Result. Each result is the one of                    */
+/*                MATHSRV_u16CalcParaIncAryU16 on both axes followed by       */
+/*                MATHSRV_u16Interp2d; the breakpoint search of a couple      */
+/*                starts from the segments of the previous one.               */
+/*                                                                            */
+/* !Trace_To    : VEMS_R_08_02127_033.01                                      */
+/*                                                                            */
+/* !LastAuthor  : J. Perochon                                                 */
+/******************************************************************************/
+FUNC(void, MATHSRV_CODE) MATHSRV_vidInterp2dAryU16
+(
+   P2CONST(uint16, AUTOMATIC, MATHSRV_CONST) pkau16Cartography,
+   CONST(uint16, MATHSRV_CONST) kau16BreakpointMapXLine[],
+   uint8 u8BreakpointNumberXLine,
+   CONST(uint16, MATHSRV_CONST) kau16BreakpointMapYColumn[],
+   uint8 u8BreakpointNumberYColumn,
+   CONST(uint16, MATHSRV_VAR) au16ValueXLine[],
+   CONST(uint16, MATHSRV_VAR) au16ValueYColumn[],
+   VAR(uint16, MATHSRV_VAR) au16Result[],
+   uint8 u8ValueNumber
+)
+{
+   uint16               u16LocalSiteXLine;
+   uint16               u16LocalSiteYColumn;
+   uint32               u32LocalIndex;
+   MATHSRV_tstrBkptHint strLocalHintXLine;
+   MATHSRV_tstrBkptHint strLocalHintYColumn;
+
+
+   strLocalHintXLine.u8Site     = 0;
+   strLocalHintXLine.u16Width   = 0;
+   strLocalHintXLine.u32Rcp     = 0;
+   strLocalHintYColumn.u8Site   = 0;
+   strLocalHintYColumn.u16Width = 0;
+   strLocalHintYColumn.u32Rcp   = 0;
+
+   for (u32LocalIndex = 0; u32LocalIndex < u8ValueNumber; u32LocalIndex++)
+   {
+      u16LocalSiteXLine =
+         MATHSRV_u16CalcParaIncAryU16Hint(kau16BreakpointMapXLine,
+                                          au16ValueXLine[u32LocalIndex],
+                                          u8BreakpointNumberXLine,
+                                          &strLocalHintXLine);
+      u16LocalSiteYColumn =
+         MATHSRV_u16CalcParaIncAryU16Hint(kau16BreakpointMapYColumn,
+                                          au16ValueYColumn[u32LocalIndex],
+                                          u8BreakpointNumberYColumn,
+                                          &strLocalHintYColumn);
+      au16Result[u32LocalIndex] =
+         MATHSRV_u16Interp2d(pkau16Cartography,
+                             u16LocalSiteXLine,
+                             u16LocalSiteYColumn,
+                             u8BreakpointNumberYColumn);
+   }
+}
+
+
 #define MATHSRV_STOP_SEC_CODE
 #include "MemMap.h"
 
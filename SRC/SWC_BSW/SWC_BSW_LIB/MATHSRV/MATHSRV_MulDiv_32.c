@@ -28,6 +28,487 @@
 #include "MemMap.h"
 
 
+#if (MATHSRV_coMULDIV_NATIVE_64 == STD_ON)
+
+STATIC FUNC(uint64, MATHSRV_CODE) MATHSRV_u64MulDivRnd
+(
+   uint32 u32Factor1,
+   uint32 u32Factor2,
+   uint32 u32Denominator
+);
+
+STATIC FUNC(sint32, MATHSRV_CODE) MATHSRV_s32SatSign
+(
+   uint64  u64Magnitude,
+   boolean bPositive
+);
+
+
+/******************************************************************************/
+/* !FuncName    : MATHSRV_u64MulDivRnd                                        */
+/* !Description : Return (u32Factor1 * u32Factor2) / u32Denominator rounded   */
+/*                to the nearest (half up), on 64 bits. The product is a      */
+/*                single MUL.U; the 64/32 division is only done when the      */
+/*                product does not fit in 32 bits and the quotient does.      */
+/*                u32Denominator shall not be null.                           */
+/*                                                                            */
+/* !LastAuthor  : M.Mohi                                                      */
+/******************************************************************************/
+STATIC FUNC(uint64, MATHSRV_CODE) MATHSRV_u64MulDivRnd
+(
+   uint32 u32Factor1,
+   uint32 u32Factor2,
+   uint32 u32Denominator
+)
+{
+   uint64 u64LocalProduct;
+   uint64 u64LocalResult;
+
+
+   u64LocalProduct = (uint64)u32Factor1 * (uint64)u32Factor2;
+
+   if ( (u64LocalProduct >> 32) == 0)
+   {
+      u64LocalResult = MATHSRV_udtUX_DIV_UX_RND( (uint32)u64LocalProduct,
+                                                u32Denominator);
+   }
+   else if ( (u64LocalProduct >> 32) >= u32Denominator)
+   {
+      /* !Comment : Quotient greater than 2^32, no division needed           */
+      u64LocalResult = 0x100000000ULL;
+   }
+   else
+   {
+      u64LocalResult = (u64LocalProduct + (u32Denominator / 2))
+                       / u32Denominator;
+   }
+   return(u64LocalResult);
+}
+
+
+/******************************************************************************/
+/* !FuncName    : MATHSRV_u32Mul_u32_u32_div_u32                              */
+/* !Description : Native 64 bit implementation                                */
+/*                                                                            */
+/* !Trace_To    : MFX047                                                      */
+/* !Trace_To    : MFX048                                                      */
+/* !Trace_To    : MFX049                                                      */
+/* !Trace_To    : MFX051                                                      */
+/*                                                                            */
+/* !LastAuthor  : C.Geamblu                                                   */
+/******************************************************************************/
+FUNC(uint32, MATHSRV_CODE)  MATHSRV_u32Mul_u32_u32_div_u32
+(
+   uint32 u32FirstValue,
+   uint32 u32SecondValue,
+   uint32 u32Denominator
+)
+{
+   uint64 u64LocalResult;
+
+
+   if (u32Denominator != 0)
+   {
+      u64LocalResult = MATHSRV_u64MulDivRnd(u32FirstValue, u32SecondValue,
+                                            u32Denominator);
+      u64LocalResult = MATHSRV_udtMIN(u64LocalResult, (uint64)UINT32_MAX);
+   }
+   else
+   {
+      u64LocalResult = UINT32_MAX;
+   }
+   return( (uint32)u64LocalResult);
+}
+
+
+/******************************************************************************/
+/* !FuncName    : MATHSRV_u32Mul_u32_u32_div_s32                              */
+/* !Description : Native 64 bit implementation                                */
+/*                                                                            */
+/* !Trace_To    : MFX047                                                      */
+/* !Trace_To    : MFX048                                                      */
+/* !Trace_To    : MFX049                                                      */
+/* !Trace_To    : MFX051                                                      */
+/*                                                                            */
+/* !LastAuthor  : C.Geamblu                                                   */
+/******************************************************************************/
+FUNC(uint32, MATHSRV_CODE)  MATHSRV_u32Mul_u32_u32_div_s32
+(
+   uint32 u32FirstValue,
+   uint32 u32SecondValue,
+   sint32 s32Denominator
+)
+{
+   uint64 u64LocalResult;
+
+
+   if (s32Denominator > 0)
+   {
+      u64LocalResult = MATHSRV_u64MulDivRnd(u32FirstValue, u32SecondValue,
+                                            (uint32)s32Denominator);
+      u64LocalResult = MATHSRV_udtMIN(u64LocalResult, (uint64)UINT32_MAX);
+   }
+   else if (s32Denominator < 0)
+   {
+      u64LocalResult = UINT32_MIN;
+   }
+   else
+   {
+      u64LocalResult = UINT32_MAX;
+   }
+   return( (uint32)u64LocalResult);
+}
+
+
+/******************************************************************************/
+/* !FuncName    : MATHSRV_u32Mul_u32_s32_div_u32                              */
+/* !Description : Native 64 bit implementation                                */
+/*                                                                            */
+/* !Trace_To    : MFX047                                                      */
+/* !Trace_To    : MFX048                                                      */
+/* !Trace_To    : MFX049                                                      */
+/* !Trace_To    : MFX051                                                      */
+/*                                                                            */
+/* !LastAuthor  : M. Mohi                                                     */
+/******************************************************************************/
+FUNC(uint32, MATHSRV_CODE)  MATHSRV_u32Mul_u32_s32_div_u32
+(
+   uint32 u32FirstValue,
+   sint32 s32SecondValue,
+   uint32 u32Denominator
+)
+{
+   uint64 u64LocalResult;
+
+
+   if (u32Denominator != 0)
+   {
+      if (s32SecondValue > 0)
+      {
+         u64LocalResult = MATHSRV_u64MulDivRnd(u32FirstValue,
+                                               (uint32)s32SecondValue,
+                                               u32Denominator);
+         u64LocalResult = MATHSRV_udtMIN(u64LocalResult, (uint64)UINT32_MAX);
+      }
+      else
+      {
+         u64LocalResult = UINT32_MIN;
+      }
+   }
+   else
+   {
+      if (  (s32SecondValue >= 0)
+         || (u32FirstValue == 0) )
+      {
+         u64LocalResult = UINT32_MAX;
+      }
+      else
+      {
+         u64LocalResult = UINT32_MIN;
+      }
+   }
+   return( (uint32)u64LocalResult);
+}
+
+
+/******************************************************************************/
+/* !FuncName    : MATHSRV_u32Mul_u32_s32_div_s32                              */
+/* !Description : Native 64 bit implementation                                */
+/*                                                                            */
+/* !Trace_To    : MFX047                                                      */
+/* !Trace_To    : MFX048                                                      */
+/* !Trace_To    : MFX049                                                      */
+/* !Trace_To    : MFX051                                                      */
+/*                                                                            */
+/* !LastAuthor  : M. Mohi                                                     */
+/******************************************************************************/
+FUNC(uint32, MATHSRV_CODE)  MATHSRV_u32Mul_u32_s32_div_s32
+(
+   uint32 u32FirstValue,
+   sint32 s32SecondValue,
+   sint32 s32Denominator
+)
+{
+   uint64 u64LocalResult;
+
+
+   if (s32Denominator != 0)
+   {
+      if (  (  (s32SecondValue > 0)
+            && (s32Denominator > 0) )
+         || (  (s32SecondValue < 0)
+            && (s32Denominator < 0) ) )
+      {
+         u64LocalResult =
+            MATHSRV_u64MulDivRnd(u32FirstValue,
+                                 (uint32)MATHSRV_udtABS(s32SecondValue),
+                                 (uint32)MATHSRV_udtABS(s32Denominator));
+         u64LocalResult = MATHSRV_udtMIN(u64LocalResult, (uint64)UINT32_MAX);
+      }
+      else
+      {
+         u64LocalResult = UINT32_MIN;
+      }
+   }
+   else
+   {
+      if (  (s32SecondValue >= 0)
+         || (u32FirstValue == 0) )
+      {
+         u64LocalResult = UINT32_MAX;
+      }
+      else
+      {
+         u64LocalResult = UINT32_MIN;
+      }
+   }
+   return( (uint32)u64LocalResult);
+}
+
+
+/******************************************************************************/
+/* !FuncName    : MATHSRV_s32Mul_s32_s32_div_s32                                */
+/* !Description : Native 64 bit implementation                                */
+/*                                                                            */
+/* !Trace_To    : MFX047                                                      */
+/* !Trace_To    : MFX048                                                      */
+/* !Trace_To    : MFX049                                                      */
+/* !Trace_To    : MFX051                                                      */
+/*                                                                            */
+/* !LastAuthor  : C. Geamblu                                                    */
+/******************************************************************************/
+FUNC(sint32, MATHSRV_CODE)  MATHSRV_s32Mul_s32_s32_div_s32
+(
+   sint32 s32FirstValue,
+   sint32 s32SecondValue,
+   sint32 s32Denominator
+)
+{
+   boolean bLocalPositiveResult;
+   sint32  s32LocalResult;
+   uint64  u64LocalResult;
+
+
+   if (s32Denominator != 0)
+   {
+      bLocalPositiveResult =
+         (boolean)( ( (s32FirstValue < 0) != (s32SecondValue < 0) )
+                    == (s32Denominator < 0) );
+      u64LocalResult =
+         MATHSRV_u64MulDivRnd( (uint32)MATHSRV_udtABS(s32FirstValue),
+                               (uint32)MATHSRV_udtABS(s32SecondValue),
+                               (uint32)MATHSRV_udtABS(s32Denominator));
+      s32LocalResult = MATHSRV_s32SatSign(u64LocalResult, bLocalPositiveResult);
+   }
+   else
+   {
+      if (  (  (s32FirstValue >= 0)
+            && (s32SecondValue >= 0) )
+         || (  (s32FirstValue <= 0)
+            && (s32SecondValue <= 0) ) )
+      {
+         s32LocalResult = SINT32_MAX;
+      }
+      else
+      {
+         s32LocalResult = SINT32_MIN;
+      }
+   }
+   return(s32LocalResult);
+}
+
+
+/******************************************************************************/
+/* !FuncName    : MATHSRV_s32Mul_s32_s32_div_u32                                */
+/* !Description : Native 64 bit implementation                                */
+/*                                                                            */
+/* !Trace_To    : MFX047                                                      */
+/* !Trace_To    : MFX048                                                      */
+/* !Trace_To    : MFX049                                                      */
+/* !Trace_To    : MFX051                                                      */
+/*                                                                            */
+/* !LastAuthor  : C. Geamblu                                                    */
+/******************************************************************************/
+FUNC(sint32, MATHSRV_CODE)  MATHSRV_s32Mul_s32_s32_div_u32
+(
+   sint32 s32FirstValue,
+   sint32 s32SecondValue,
+   uint32 u32Denominator
+)
+{
+   boolean bLocalPositiveResult;
+   sint32  s32LocalResult;
+   uint64  u64LocalResult;
+
+
+   if (  (  (s32FirstValue >= 0)
+         && (s32SecondValue >= 0) )
+      || (  (s32FirstValue <= 0)
+         && (s32SecondValue <= 0) ) )
+   {
+      bLocalPositiveResult = TRUE;
+   }
+   else
+   {
+      bLocalPositiveResult = FALSE;
+   }
+   if (u32Denominator != 0)
+   {
+      u64LocalResult =
+         MATHSRV_u64MulDivRnd( (uint32)MATHSRV_udtABS(s32FirstValue),
+                               (uint32)MATHSRV_udtABS(s32SecondValue),
+                               u32Denominator);
+      s32LocalResult = MATHSRV_s32SatSign(u64LocalResult, bLocalPositiveResult);
+   }
+   else
+   {
+      if (bLocalPositiveResult == TRUE)
+      {
+         s32LocalResult = SINT32_MAX;
+      }
+      else
+      {
+         s32LocalResult = SINT32_MIN;
+      }
+   }
+   return(s32LocalResult);
+}
+
+
+/******************************************************************************/
+/* !FuncName    : MATHSRV_s32Mul_u32_s32_div_s32                                */
+/* !Description : Native 64 bit implementation                                */
+/*                                                                            */
+/* !Trace_To    : MFX047                                                      */
+/* !Trace_To    : MFX048                                                      */
+/* !Trace_To    : MFX049                                                      */
+/* !Trace_To    : MFX051                                                      */
+/*                                                                            */
+/* !LastAuthor  : M. Mohi                                                       */
+/******************************************************************************/
+FUNC(sint32, MATHSRV_CODE)  MATHSRV_s32Mul_u32_s32_div_s32
+(
+   uint32 u32FirstValue,
+   sint32 s32SecondValue,
+   sint32 s32Denominator
+)
+{
+   boolean bLocalPositiveResult;
+   sint32  s32LocalResult;
+   uint64  u64LocalResult;
+
+
+   if (s32Denominator != 0)
+   {
+      bLocalPositiveResult = (boolean)( (s32SecondValue < 0)
+                                        == (s32Denominator < 0) );
+      u64LocalResult =
+         MATHSRV_u64MulDivRnd(u32FirstValue,
+                              (uint32)MATHSRV_udtABS(s32SecondValue),
+                              (uint32)MATHSRV_udtABS(s32Denominator));
+      s32LocalResult = MATHSRV_s32SatSign(u64LocalResult, bLocalPositiveResult);
+   }
+   else
+   {
+      if (  (s32SecondValue >= 0)
+         || (u32FirstValue == 0) )
+      {
+         s32LocalResult = SINT32_MAX;
+      }
+      else
+      {
+         s32LocalResult = SINT32_MIN;
+      }
+   }
+   return(s32LocalResult);
+}
+
+
+/******************************************************************************/
+/* !FuncName    : MATHSRV_s32Mul_u32_s32_div_u32                                */
+/* !Description : Native 64 bit implementation                                */
+/*                                                                            */
+/* !Trace_To    : MFX047                                                      */
+/* !Trace_To    : MFX048                                                      */
+/* !Trace_To    : MFX049                                                      */
+/* !Trace_To    : MFX051                                                      */
+/*                                                                            */
+/* !LastAuthor  : C.Geamblu                                                     */
+/******************************************************************************/
+FUNC(sint32, MATHSRV_CODE)  MATHSRV_s32Mul_u32_s32_div_u32
+(
+   uint32 u32FirstValue,
+   sint32 s32SecondValue,
+   uint32 u32Denominator
+)
+{
+   sint32 s32LocalResult;
+   uint64 u64LocalResult;
+
+
+   if (u32Denominator != 0)
+   {
+      u64LocalResult =
+         MATHSRV_u64MulDivRnd(u32FirstValue,
+                              (uint32)MATHSRV_udtABS(s32SecondValue),
+                              u32Denominator);
+      s32LocalResult = MATHSRV_s32SatSign(u64LocalResult,
+                                          (boolean)(s32SecondValue >= 0) );
+   }
+   else
+   {
+      if (  (s32SecondValue >= 0)
+         || (u32FirstValue == 0) )
+      {
+         s32LocalResult = SINT32_MAX;
+      }
+      else
+      {
+         s32LocalResult = SINT32_MIN;
+      }
+   }
+   return(s32LocalResult);
+}
+
+
+/******************************************************************************/
+/* !FuncName    : MATHSRV_s32SatSign                                          */
+/* !Description : Apply the sign to the magnitude u64Magnitude and saturate   */
+/*                the result to [SINT32_MIN, SINT32_MAX]                      */
+/*                                                                            */
+/* !LastAuthor  : M.Mohi                                                      */
+/******************************************************************************/
+STATIC FUNC(sint32, MATHSRV_CODE) MATHSRV_s32SatSign
+(
+   uint64  u64Magnitude,
+   boolean bPositive
+)
+{
+   sint32 s32LocalResult;
+
+
+   if (bPositive == TRUE)
+   {
+      s32LocalResult = (sint32)MATHSRV_udtMIN(u64Magnitude,
+                                              (uint64)SINT32_MAX);
+   }
+   else
+   {
+      if (u64Magnitude < ( (uint64)SINT32_MAX + 1) )
+      {
+         s32LocalResult = -( (sint32)u64Magnitude);
+      }
+      else
+      {
+         s32LocalResult = SINT32_MIN;
+      }
+   }
+   return(s32LocalResult);
+}
+
+
+#else /* MATHSRV_coMULDIV_NATIVE_64 */
+
 STATIC FUNC(void, MATHSRV_CODE) MATHSRV_vidMul_u32_u32_Res_u64
 (
    uint32 u32Factor1,
@@ -1300,6 +1781,8 @@ STATIC FUNC(void,
    *pu32ResultHigh32 = u32LocalR3 + u32LocalTemp;
 }
 
+#endif /* MATHSRV_coMULDIV_NATIVE_64 */
+
 #define MATHSRV_STOP_SEC_CODE
 #include "MemMap.h"
 
@@ -319,6 +319,20 @@
 */      
 #define CAN_LPDU_RX_CALLOUT                    (STD_OFF)
 
+/* Configuration: CAN_RX_BATCH_MODE
+ - STD_ON  - Receive handler drains pending Rx objects into a batch buffer
+             and notifies CanIf after the message objects are released
+ - STD_OFF - Receive handler notifies CanIf for each extracted frame
+*/
+#define CAN_RX_BATCH_MODE                      (STD_ON)
+
+/* Configuration: CAN_RX_BATCH_BUDGET
+ - Maximum number of frames drained per receive handler call (1..32).
+   Remaining frames are handled by a re-triggered receive interrupt or
+   the next Can_17_MCanP_MainFunction_Read call
+*/
+#define CAN_RX_BATCH_BUDGET                    (8U)
+
 /*******************************************************************************
     Symbolic Name Defintions of CAN Controllers and CAN Hardware Objects
 *******************************************************************************/
@@ -194,7 +194,7 @@ This parameter provides the buffer size to be used based on the number of
 IB Channels configured and their buffer size.
 */
 
-#define SPI_MAXIMUM_IB_BUFFER_SIZE  (272U)
+#define SPI_MAXIMUM_IB_BUFFER_SIZE  (140U)
 /*
 Configuration : SPI_MAXIMUM_EB_CHANNELS(Vendor Specific)
 It is the maximum among the total number of EB channels configured in each
@@ -99,7 +99,7 @@ static const Spi_ChannelConfigType Spi_kChannelConfig0[] =
     /* Data Configuration */
     Spi_DataConfig(32U, /* Data Width */
                    SPI_DATA_MSB_FIRST), /* Transfer Start */
-    (Spi_NumberOfDataType)228U,
+    (Spi_NumberOfDataType)96U,
         /* Buffer Type, SPI_CHANNEL_TYPE */
     (uint8)SPI_IB_BUFFER,
   },
@@ -334,6 +334,15 @@ extern volatile uint32 TestCan_DebugMask04;
 /* Macro to set MSB for Extended messages */
 #define CAN_EXTENDED_MSB_SET            (0x80000000U)
 
+#if (CAN_RX_BATCH_MODE == STD_ON)
+#if (CAN_FD_ENABLE == STD_ON)
+#error CAN_RX_BATCH_MODE supports classic CAN frames only
+#endif
+#if ((CAN_RX_BATCH_BUDGET < 1U) || (CAN_RX_BATCH_BUDGET > 32U))
+#error CAN_RX_BATCH_BUDGET shall be in the range 1..32
+#endif
+#endif /* #if (CAN_RX_BATCH_MODE == STD_ON) */
+
 #if (CAN_FD_ENABLE== STD_ON)
 #define CAN_MOSize                        (3U)
 #define CAN_RXSize                        (64U)
@@ -398,6 +407,24 @@ Mapping for TC27x --> N = 4, i.e., 4 CAN Controllers(Nodes):
 **                      Private Type Definitions                              **
 *******************************************************************************/
 
+#if (CAN_RX_BATCH_MODE == STD_ON)
+/* Frame fetched from the message RAM, waiting for notification to CanIf */
+typedef struct Can_RxBatchFrameType
+{
+  /* Data bytes 0-3 (DATAL) and 4-7 (DATAH), copied as words */
+  uint32 Data[CAN_TWO];
+
+  /* Received message identifier */
+  Can_IdType MessageId;
+
+  /* Hardware receive handle */
+  uint8 Hrh;
+
+  /* Received data length */
+  uint8 MessageDlc;
+
+} Can_RxBatchFrameType;
+#endif /* #if (CAN_RX_BATCH_MODE == STD_ON) */
 
 /*******************************************************************************
 **                      Private Function Declarations                         **
@@ -489,6 +516,22 @@ IFX_LOCAL_INLINE void Can_lRxIsrExtractData(uint8 HwControllerId,
                                         uint8 PndBitPosition);
 #endif
 
+#if (CAN_RX_BATCH_MODE == STD_ON)
+/* Function to copy a received frame from the message object to the batch */
+IFX_LOCAL_INLINE boolean Can_lRxBatchFetch(uint8 HwControllerId,
+                                        uint8 HwObjectId,
+                                        uint8 MsgIndex,
+                                        uint8 PndBitPosition,
+                                        Can_RxBatchFrameType *FramePtr);
+
+/* Function to notify the frames of the batch to CanIf */
+IFX_LOCAL_INLINE void Can_lRxBatchDispatch(uint8 HwControllerId,
+                                        uint8 FrameCnt);
+
+/* Function to clear the receive batch statistics of a controller */
+static void Can_lRxBatchStatClear(uint8 Controller);
+#endif
+
 /* Function to clear a receive message object */
 static void Can_lClearReceivedMsg(uint8 HwControllerId);
 
@@ -813,6 +856,15 @@ object numbers assigned to a CAN controller. */
 /*IFX_MISRA_RULE_08_07_STATUS=Can_TxMsiMask is accessed in Multiple functions*/
 static uint32 Can_TxMsiMask[CAN_NUM_CONTROLLERS_IN_DEVICE][CAN_NUM_MSPND_REGS];
 
+#if (CAN_RX_BATCH_MODE == STD_ON)
+/* Frames drained by the receive handler, waiting for notification */
+static Can_RxBatchFrameType 
+  Can_RxBatchBuffer[CAN_NUM_CONTROLLERS_IN_DEVICE][CAN_RX_BATCH_BUDGET];
+
+/* Receive batch statistics per CAN controller */
+static Can_17_MCanP_RxBatchStatType Can_RxBatchStat[CAN_NUM_CONTROLLER_MAX];
+#endif
+
 
 #define CAN_17_MCANP_STOP_SEC_VAR_32BIT
 /*IFX_MISRA_RULE_19_01_STATUS=File inclusion after pre-processor directive is
@@ -2120,6 +2172,86 @@ void Can_17_MCanP_IsrTransmitHandler(uint8 HwControllerId)
 #endif /* #if (CAN_TX_HARDWARE_OBJECTS_MAX > 0) */
 }
 
+#if (CAN_RX_BATCH_MODE == STD_ON)
+/*******************************************************************************
+** Syntax           : Std_ReturnType Can_17_MCanP_GetRxBatchStat              **
+**                    (                                                       **
+**                      uint8 Controller,                                     **
+**                      Can_17_MCanP_RxBatchStatType* StatPtr                 **
+**                    )                                                       **
+**                                                                            **
+** Service ID       : None                                                    **
+**                                                                            **
+** Sync/Async       : Synchronous                                             **
+**                                                                            **
+** Reentrancy       : Reentrant                                               **
+**                                                                            **
+** Parameters (in)  : Controller - CAN controller                             **
+**                                                                            **
+** Parameters (out) : StatPtr - Copy of the receive batch statistics          **
+**                                                                            **
+** Return value     : E_OK - Statistics copied                                **
+**                    E_NOT_OK - Invalid controller or null pointer           **
+**                                                                            **
+** Description      : Returns the receive batch statistics of a controller.   **
+**                    The controller interrupts are disabled during the copy  **
+**                    to get a consistent snapshot                            **
+**                                                                            **
+*******************************************************************************/
+Std_ReturnType Can_17_MCanP_GetRxBatchStat
+(
+  uint8 Controller,
+  Can_17_MCanP_RxBatchStatType* StatPtr
+)
+{
+  Std_ReturnType RetVal;
+
+  RetVal = E_NOT_OK;
+
+  if ((CAN_DS_UNINIT != Can_17_MCanP_DriverState) &&
+    (Controller < Can_kConfigPtr->CanNumController) &&
+    (NULL_PTR != StatPtr))
+  {
+    Can_17_MCanP_DisableControllerInterrupts(Controller);
+    *StatPtr = Can_RxBatchStat[Controller];
+    Can_17_MCanP_EnableControllerInterrupts(Controller);
+
+    RetVal = E_OK;
+  }
+
+  return (RetVal);
+}
+
+/*******************************************************************************
+** Syntax           : void Can_17_MCanP_ResetRxBatchStat(uint8 Controller)    **
+**                                                                            **
+** Service ID       : None                                                    **
+**                                                                            **
+** Sync/Async       : Synchronous                                             **
+**                                                                            **
+** Reentrancy       : Reentrant                                               **
+**                                                                            **
+** Parameters (in)  : Controller - CAN controller                             **
+**                                                                            **
+** Parameters (out) : None                                                    **
+**                                                                            **
+** Return value     : None                                                    **
+**                                                                            **
+** Description      : Clears the receive batch statistics of a controller     **
+**                                                                            **
+*******************************************************************************/
+void Can_17_MCanP_ResetRxBatchStat(uint8 Controller)
+{
+  if ((CAN_DS_UNINIT != Can_17_MCanP_DriverState) &&
+    (Controller < Can_kConfigPtr->CanNumController))
+  {
+    Can_17_MCanP_DisableControllerInterrupts(Controller);
+    Can_lRxBatchStatClear(Controller);
+    Can_17_MCanP_EnableControllerInterrupts(Controller);
+  }
+}
+#endif /* #if (CAN_RX_BATCH_MODE == STD_ON) */
+
 
 /*******************************************************************************
 ** TRACEABILITY     : [cover parentID=DS_AS_CAN020_CAN272_CAN274]             **
@@ -2257,6 +2389,10 @@ IFX_LOCAL_INLINE void Can_lInitGlobalVar(void)
     Can_17_MCanP_ControllerWakeupStatus[Index] = CAN_ZERO;
 #endif
 
+#if (CAN_RX_BATCH_MODE == STD_ON)
+    /* Clear receive batch statistics */
+    Can_lRxBatchStatClear((uint8)Index);
+#endif
   }
 
 #if (CAN_TX_HARDWARE_OBJECTS_MAX > 0U)
@@ -4367,6 +4503,10 @@ IFX_LOCAL_INLINE Can_ReturnType Can_lWriteMsgObj(uint8 HthIndex,
 **                    - This function is also called by the polling function  **
 **                    Can_17_MCanP_MainFunction_Read for controllers          **
 **                    configured with CanRxProcessing as POLLING              **
+**                    - With CAN_RX_BATCH_MODE, up to CAN_RX_BATCH_BUDGET     **
+**                    frames are copied and released first, then notified    **
+**                    to the upper layer. If frames are left pending, the     **
+**                    receive interrupt of the controller is re-triggered     **
 **                                                                            **
 *******************************************************************************/
 static void Can_lReceiveHandler(uint8 HwControllerId)
@@ -4377,11 +4517,22 @@ static void Can_lReceiveHandler(uint8 HwControllerId)
   uint8 MsgIndex;
   uint8 KerIdx;
   uint8 LoopBreak32;
+#if (CAN_RX_BATCH_MODE == STD_ON)
+  uint32 RxBacklog;
+  uint8 FrameCnt;
+  uint8 Controller;
+#endif
 #if (CAN_DEV_ERROR_DETECT == STD_ON)
   uint8 LoopBreak;
+#if (CAN_RX_BATCH_MODE == STD_OFF)
   Std_ReturnType Status;
+#endif
   LoopBreak = CAN_ZERO;
 #endif
+#if (CAN_RX_BATCH_MODE == STD_ON)
+  FrameCnt = CAN_ZERO;
+  RxBacklog = CAN_ZERO;
+#endif
 
 
   /* Calculate to which kernel, the controller belongs to*/
@@ -4396,6 +4547,9 @@ static void Can_lReceiveHandler(uint8 HwControllerId)
     ((MsgIndex <= Can_kConfigPtr->CanRxLastMspndIdx)
 #if (CAN_DEV_ERROR_DETECT == STD_ON)
     && (LoopBreak == CAN_ZERO)
+#endif
+#if (CAN_RX_BATCH_MODE == STD_ON)
+    && (FrameCnt < CAN_RX_BATCH_BUDGET)
 #endif
     );
   MsgIndex++)
@@ -4413,6 +4567,9 @@ static void Can_lReceiveHandler(uint8 HwControllerId)
       (LoopBreak32 < CAN_THIRTY_TWO)
 #if (CAN_DEV_ERROR_DETECT == STD_ON)
       && (LoopBreak == CAN_ZERO)
+#endif
+#if (CAN_RX_BATCH_MODE == STD_ON)
+      && (FrameCnt < CAN_RX_BATCH_BUDGET)
 #endif
       )
     {
@@ -4441,6 +4598,14 @@ static void Can_lReceiveHandler(uint8 HwControllerId)
       else
 #endif /* #if (CAN_NUM_RX_FIFO_MAX > 0U) */ 
       {
+#if (CAN_RX_BATCH_MODE == STD_ON)
+        /* Copy the frame to the batch and release the message object */
+        if (TRUE == Can_lRxBatchFetch(HwControllerId, HwObjectId, MsgIndex,
+          PndBitPosition, &Can_RxBatchBuffer[HwControllerId][FrameCnt]))
+        {
+          FrameCnt++;
+        }
+#else
         /* Extract the required infomation from the message object */
 #if (CAN_DEV_ERROR_DETECT == STD_OFF)
         Can_lRxIsrExtractData(HwControllerId,
@@ -4453,11 +4618,61 @@ static void Can_lReceiveHandler(uint8 HwControllerId)
           LoopBreak = CAN_ONE;
         }
 #endif
+#endif /* #if (CAN_RX_BATCH_MODE == STD_ON) */
       }
     }
   }
+
+#if (CAN_RX_BATCH_MODE == STD_ON)
+  /* Budget used up: check for frames still pending for this controller */
+  if (FrameCnt >= CAN_RX_BATCH_BUDGET)
+  {
+    for (MsgIndex = CAN_ZERO; 
+      MsgIndex <= Can_kConfigPtr->CanRxLastMspndIdx; MsgIndex++)
+    {
+      RxBacklog |= (CAN_KER[KerIdx]->MSPND[MsgIndex].U & 
+        Can_RxMsiMask[HwControllerId][MsgIndex]);
+    }
+  }
+#endif
+
   /* Restore the MSIMASK value */
   CAN_KER[KerIdx]->MSIMASK.U  = MsiMaskCopy;
+
+#if (CAN_RX_BATCH_MODE == STD_ON)
+  if (FrameCnt > CAN_ZERO)
+  {
+    Controller = Can_NodeIdMap[HwControllerId];
+
+    Can_RxBatchStat[Controller].HandlerCallCnt++;
+    Can_RxBatchStat[Controller].RxFrameCnt += FrameCnt;
+    if (FrameCnt > Can_RxBatchStat[Controller].MaxFramesPerCall)
+    {
+      Can_RxBatchStat[Controller].MaxFramesPerCall = FrameCnt;
+    }
+
+    /* Notify the batch to the upper layer */
+    Can_lRxBatchDispatch(HwControllerId, FrameCnt);
+
+    if (RxBacklog != CAN_ZERO)
+    {
+      Can_RxBatchStat[Controller].BudgetExhaustedCnt++;
+
+      /* Re-trigger the receive service request node of the controller, so
+      that the remaining frames are drained after higher priority work; 
+      polled controllers are served by the next MainFunction_Read call */
+      /*IFX_MISRA_RULE_17_04_STATUS=Pointer arithmetic used due to 
+        PBConfigStructure and is within allowed range.*/
+      if (CAN_POLLING != 
+        Can_kConfigPtr->CanEventHandlingConfigPtr[Controller].CanEventType[1])
+      {
+        CAN_KER[KerIdx]->MITR.U = (unsigned_int)CAN_ONE << 
+          (CAN_NUM_CONTROLLERS_IN_KERNEL[KerIdx] + 
+          CAN_CALC_HWCTRLID(HwControllerId));
+      }
+    }
+  }
+#endif /* #if (CAN_RX_BATCH_MODE == STD_ON) */
 }
 #endif 
 /* #if((CAN_RX_HARDWARE_OBJECTS_MAX > 0U)||(CAN_NUM_RX_FIFO_MAX > 0U)) */
@@ -4774,6 +4989,227 @@ IFX_LOCAL_INLINE void Can_lRxIsrExtractData(uint8 HwControllerId,
 #endif 
 /* #if((CAN_RX_HARDWARE_OBJECTS_MAX > 0U)||(CAN_NUM_RX_FIFO_MAX > 0U)) */
 
+#if (CAN_RX_BATCH_MODE == STD_ON)
+/*******************************************************************************
+** Syntax           : IFX_LOCAL_INLINE boolean Can_lRxBatchFetch              **
+**                    (                                                       **
+**                      uint8 HwControllerId,                                 **
+**                      uint8 HwObjectId,                                     **
+**                      uint8 MsgIndex,                                       **
+**                      uint8 PndBitPosition,                                 **
+**                      Can_RxBatchFrameType *FramePtr                        **
+**                    )                                                       **
+**                                                                            **
+** Service ID       : None                                                    **
+**                                                                            **
+** Sync/Async       : Synchronous                                             **
+**                                                                            **
+** Reentrancy       : Reentrant                                               **
+**                                                                            **
+** Parameters (in)  : HwControllerId - Associated CAN Controller              **
+**                    HwObjectId - Message Object Id                          **
+**                    MsgIndex - MSPND Register Index                         **
+**                    PndBitPosition - Bit Position within MSPND Register     **
+**                                                                            **
+** Parameters (out) : FramePtr - Batch entry receiving the frame              **
+**                                                                            **
+** Return value     : TRUE - Frame copied consistently                        **
+**                    FALSE - Frame dropped (updated during the copy)         **
+**                                                                            **
+** Description      : Copies identifier, DLC and the DATAL/DATAH words of the **
+**                    message object to the batch entry and releases the      **
+**                    message object. The upper layer is not notified here.   **
+**                    A set MSGLST flag is counted and cleared in all builds; **
+**                    with DET enabled it is also reported as CAN_E_DATALOST  **
+**                                                                            **
+*******************************************************************************/
+IFX_LOCAL_INLINE boolean Can_lRxBatchFetch(uint8 HwControllerId,
+                                        uint8 HwObjectId,
+                                        uint8 MsgIndex,
+                                        uint8 PndBitPosition,
+                                        Can_RxBatchFrameType *FramePtr)
+{
+  volatile Ifx_CAN_MO *MoPtr;
+  uint32 TempMoctr;
+  uint8 MessageDlc;
+  uint8 LoopBreak2; /* To avoid infinte loop */
+  uint8 KerIdx;
+  uint8 Controller;
+  boolean RetVal;
+
+  LoopBreak2 = CAN_ZERO;
+  RetVal = TRUE;
+
+  /* Calculate to which kernel, the controller belongs to*/
+  KerIdx = CAN_CALC_KERIDX(HwControllerId);
+  Controller = Can_NodeIdMap[HwControllerId];
+  MoPtr = &CAN_KER[KerIdx]->MO[HwObjectId];
+
+  FramePtr->Hrh = Can_kConfigPtr->CanRxHwObjCntKer[KerIdx] + HwObjectId;
+
+  /* check for message object over-writing */
+  if ((MoPtr->STAT.U & CAN_MOSTAT_MSGLST_CLR) != CAN_ZERO)
+  {
+    /* Clear MSGLST; the latest frame in the message object is still valid */
+    MoPtr->CTR.U = CAN_MOSTAT_MSGLST_CLR;
+    Can_RxBatchStat[Controller].MsgLostCnt++;
+
+#if (CAN_DEV_ERROR_DETECT == STD_ON)
+    /* Report to DET */
+    Det_ReportError(CAN_17_MCANP_MODULE_ID, CAN_17_MCANP_INSTANCE_ID, 
+      CAN_SID_RECEIVEISR, CAN_E_DATALOST);
+#endif
+  }
+
+  do
+  {
+    /* Clear NEWDAT and RXPND */
+    MoPtr->CTR.U = (CAN_MOCTR_NEWDAT_CLR | CAN_MOCTR_RXPND_CLR);
+
+#if (CAN_STANDARD_ID_ONLY == STD_OFF) 
+    /* Check if extended id is received */
+    if (MoPtr->AR.B.IDE == CAN_ONE) 
+    {
+      /* extract message Id and set MSBit */
+      FramePtr->MessageId = (Can_IdType)
+        (MoPtr->AR.B.ID | CAN_EXTENDED_MSB_SET);
+    }
+    else /* Standard frame */
+#endif /* #if (CAN_STANDARD_ID_ONLY == STD_OFF)  */
+    {
+      /* extract message id */
+      FramePtr->MessageId = 
+        (Can_IdType)((uint32)MoPtr->AR.B.ID >> CAN_MOAR_ID_STD_SHIFT);
+    }
+
+    /* Extract DLC */
+    MessageDlc = (uint8)MoPtr->FCR.B.DLC;
+    if (MessageDlc > CAN_EIGHT)
+    {
+      MessageDlc = CAN_EIGHT;
+    }
+    FramePtr->MessageDlc = MessageDlc;
+
+    /* Extract received data bytes as two word accesses */
+    FramePtr->Data[CAN_ZERO] = MoPtr->DATAL.U;
+    FramePtr->Data[CAN_ONE] = MoPtr->DATAH.U;
+
+    LoopBreak2++;
+
+    /* Clear MSPND bit */
+    CAN_KER[KerIdx]->MSPND[MsgIndex].U =
+      ~((unsigned_int)CAN_ONE << PndBitPosition);
+
+    /* If NEWDAT or RXUPD bit is set --> Message object got/getting updated,
+    the frame is copied again */
+    TempMoctr = MoPtr->STAT.U;
+
+  }while((((TempMoctr & CAN_MOCTR_NEWDAT_CLR) != CAN_ZERO) ||
+    ((TempMoctr & CAN_MOCTR_RXUPD_CLR)  != CAN_ZERO)) 
+    &&
+    (LoopBreak2 <= CAN_TWO));
+
+  if (LoopBreak2 > CAN_TWO)
+  {
+    /* Data in the batch entry is inconsistent, the frame is dropped */
+    Can_RxBatchStat[Controller].InconsistentCnt++;
+    RetVal = FALSE;
+  }
+
+  return (RetVal);
+}
+
+/*******************************************************************************
+** Syntax           : IFX_LOCAL_INLINE void Can_lRxBatchDispatch              **
+**                    (                                                       **
+**                      uint8 HwControllerId,                                 **
+**                      uint8 FrameCnt                                        **
+**                    )                                                       **
+**                                                                            **
+** Service ID       : None                                                    **
+**                                                                            **
+** Sync/Async       : Synchronous                                             **
+**                                                                            **
+** Reentrancy       : Reentrant                                               **
+**                                                                            **
+** Parameters (in)  : HwControllerId - Associated CAN Controller              **
+**                    FrameCnt - Number of frames in the batch                **
+**                                                                            **
+** Parameters (out) : None                                                    **
+**                                                                            **
+** Return value     : None                                                    **
+**                                                                            **
+** Description      : Notifies the frames of the batch to the upper layer in  **
+**                    reception order                                         **
+**                                                                            **
+*******************************************************************************/
+IFX_LOCAL_INLINE void Can_lRxBatchDispatch(uint8 HwControllerId,
+                                        uint8 FrameCnt)
+{
+  Can_RxBatchFrameType *FramePtr;
+  uint8 *FrameData;
+  uint8 FrameIdx;
+#if (CAN_LPDU_RX_CALLOUT == STD_ON)
+  boolean RetVal;
+#endif
+
+  for (FrameIdx = CAN_ZERO; FrameIdx < FrameCnt; FrameIdx++)
+  {
+    FramePtr = &Can_RxBatchBuffer[HwControllerId][FrameIdx];
+    /*IFX_MISRA_RULE_11_05_STATUS= The data words are passed byte wise to
+    the upper layer via void pointer */
+    FrameData = (uint8 *)(void *)&FramePtr->Data[CAN_ZERO];
+
+#if (CAN_LPDU_RX_CALLOUT == STD_ON)
+    /* Call receive L-PDU callout function if configured */
+    RetVal = Can_kConfigPtr->Can_LPduRxCalloutFuncPtr(FramePtr->Hrh,
+      FramePtr->MessageId, 
+      FramePtr->MessageDlc, 
+      FrameData);
+
+    /* Notification function CanIf_RxIndication should be called only if the 
+    callout function returns true */
+    if(TRUE == RetVal)
+#endif
+    {
+      /* Call the notification function */
+      CanIf_RxIndication((Can_HwHandleType)(FramePtr->Hrh),
+        FramePtr->MessageId, 
+        FramePtr->MessageDlc, 
+        FrameData);
+    }
+  }
+}
+
+/*******************************************************************************
+** Syntax           : static void Can_lRxBatchStatClear(uint8 Controller)     **
+**                                                                            **
+** Service ID       : None                                                    **
+**                                                                            **
+** Sync/Async       : Synchronous                                             **
+**                                                                            **
+** Reentrancy       : Non-Reentrant                                           **
+**                                                                            **
+** Parameters (in)  : Controller - CAN controller                             **
+**                                                                            **
+** Parameters (out) : None                                                    **
+**                                                                            **
+** Return value     : None                                                    **
+**                                                                            **
+** Description      : Clears the receive batch statistics of a controller     **
+**                                                                            **
+*******************************************************************************/
+static void Can_lRxBatchStatClear(uint8 Controller)
+{
+  Can_RxBatchStat[Controller].RxFrameCnt = (uint32)CAN_ZERO;
+  Can_RxBatchStat[Controller].HandlerCallCnt = (uint32)CAN_ZERO;
+  Can_RxBatchStat[Controller].MaxFramesPerCall = (uint32)CAN_ZERO;
+  Can_RxBatchStat[Controller].BudgetExhaustedCnt = (uint32)CAN_ZERO;
+  Can_RxBatchStat[Controller].MsgLostCnt = (uint32)CAN_ZERO;
+  Can_RxBatchStat[Controller].InconsistentCnt = (uint32)CAN_ZERO;
+}
+#endif /* #if (CAN_RX_BATCH_MODE == STD_ON) */
+
 #if((CAN_RX_HARDWARE_OBJECTS_MAX > 0U)||(CAN_NUM_RX_FIFO_MAX > 0U))
 #if(CAN_WAKEUP_CONFIGURED == STD_ON)
 /*******************************************************************************
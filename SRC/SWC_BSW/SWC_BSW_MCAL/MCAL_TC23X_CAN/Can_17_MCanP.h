@@ -405,6 +405,31 @@ typedef struct Can_17_MCanP_ConfigType
 
 } Can_17_MCanP_ConfigType;
 
+#if (CAN_RX_BATCH_MODE == STD_ON)
+/* Receive batch statistics of a CAN controller */
+typedef struct Can_17_MCanP_RxBatchStatType
+{
+  /* Number of frames notified to CanIf */
+  uint32 RxFrameCnt;
+
+  /* Number of receive handler calls which drained at least one frame */
+  uint32 HandlerCallCnt;
+
+  /* Highest number of frames drained in one receive handler call */
+  uint32 MaxFramesPerCall;
+
+  /* Number of calls stopped by CAN_RX_BATCH_BUDGET with frames pending */
+  uint32 BudgetExhaustedCnt;
+
+  /* Number of frames overwritten in message RAM (MSGLST) */
+  uint32 MsgLostCnt;
+
+  /* Number of frames dropped as the message object was updated during copy */
+  uint32 InconsistentCnt;
+
+} Can_17_MCanP_RxBatchStatType;
+#endif /* #if (CAN_RX_BATCH_MODE == STD_ON) */
+
 
 /*******************************************************************************
 **                      Global Data                                           **
@@ -905,6 +930,57 @@ extern void Can_17_MCanP_IsrReceiveHandler(uint8 HwControllerId);
 *******************************************************************************/
 extern void Can_17_MCanP_IsrTransmitHandler(uint8 HwControllerId);
 
+#if (CAN_RX_BATCH_MODE == STD_ON)
+/*******************************************************************************
+** Syntax           : Std_ReturnType Can_17_MCanP_GetRxBatchStat              **
+**                    (                                                       **
+**                      uint8 Controller,                                     **
+**                      Can_17_MCanP_RxBatchStatType* StatPtr                 **
+**                    )                                                       **
+**                                                                            **
+** Service ID       : None                                                    **
+**                                                                            **
+** Sync/Async       : Synchronous                                             **
+**                                                                            **
+** Reentrancy       : Reentrant                                               **
+**                                                                            **
+** Parameters (in)  : Controller - CAN controller                             **
+**                                                                            **
+** Parameters (out) : StatPtr - Copy of the receive batch statistics          **
+**                                                                            **
+** Return value     : E_OK - Statistics copied                                **
+**                    E_NOT_OK - Invalid controller or null pointer           **
+**                                                                            **
+** Description      : Returns the receive batch statistics of a controller    **
+**                                                                            **
+*******************************************************************************/
+extern Std_ReturnType Can_17_MCanP_GetRxBatchStat
+(
+  uint8 Controller,
+  Can_17_MCanP_RxBatchStatType* StatPtr
+);
+
+/*******************************************************************************
+** Syntax           : void Can_17_MCanP_ResetRxBatchStat(uint8 Controller)    **
+**                                                                            **
+** Service ID       : None                                                    **
+**                                                                            **
+** Sync/Async       : Synchronous                                             **
+**                                                                            **
+** Reentrancy       : Reentrant                                               **
+**                                                                            **
+** Parameters (in)  : Controller - CAN controller                             **
+**                                                                            **
+** Parameters (out) : None                                                    **
+**                                                                            **
+** Return value     : None                                                    **
+**                                                                            **
+** Description      : Clears the receive batch statistics of a controller     **
+**                                                                            **
+*******************************************************************************/
+extern void Can_17_MCanP_ResetRxBatchStat(uint8 Controller);
+#endif /* #if (CAN_RX_BATCH_MODE == STD_ON) */
+
 #define CAN_17_MCANP_STOP_SEC_CODE
 #include "MemMap.h"
 
@@ -23,6 +23,11 @@
 /* 1 / OVC_vidInit                                                                                                    */
 /* 2 / OVC_vidCopy                                                                                                    */
 /* 3 / OVC_u32GetPhysPage                                                                                             */
+/* 4 / OVC_udtReqPageCpy                                                                                              */
+/* 5 / OVC_udtReqPageSwt                                                                                              */
+/* 6 / OVC_vidPageCpyMgr                                                                                              */
+/* 7 / OVC_vidPageSwtTaskBnd                                                                                          */
+/* 8 / OVC_vidLockPageSwt                                                                                             */
 /************************************************ </AUTO_FILE_HEADER> *************************************************/
 /* PVCS Information                                                                                                   */
 /* $Archive::   P:/VE_S97/LOG/60_ComponentArchive/Archives/COMP_SWC_BSW_MCAL_MPC5676/adc_api.h_v                     $*/
@@ -72,6 +77,34 @@ Ifx_OVC * const OVC_akpstModule[] =
 #define OVC_STOP_SEC_CONST_UNSPECIFIED
 #include "OVC_MemMap.h"
 
+#define OVC_START_SEC_VAR_UNSPECIFIED
+#include "OVC_MemMap.h"
+/* !Comment: Active (redirected) and inactive (tool side) page of each block */
+uint32 OVC_au32ActPage[OVC_u8NB_BLK];
+uint32 OVC_au32InactPage[OVC_u8NB_BLK];
+
+/* !Comment: Tool command, consumed by OVC_vidPageCpyMgr                     */
+uint8  OVC_u8PageCmd;
+uint8  OVC_u8PageCmdBlkIdx;
+
+/* !Comment: Background copy and page switch measurements (STM ticks)        */
+uint8  OVC_u8PageCpySt;
+uint32 OVC_u32PageCpyTi;
+uint32 OVC_u32PageCpyCallTiMax;
+uint32 OVC_u32PageSwtLat;
+uint32 OVC_u32PageSwtLatMax;
+uint32 OVC_u32PageSwtCnt;
+
+static uint8   OVC_u8CpyBlkIdx;
+static uint32  OVC_u32CpyOfs;
+static uint32  OVC_u32CpyStrtTi;
+static boolean OVC_abSwtReq[OVC_u8NB_BLK];
+static boolean OVC_abCpyCplt[OVC_u8NB_BLK];
+static uint32  OVC_au32SwtReqTi[OVC_u8NB_BLK];
+static boolean OVC_bPageSwtLock;
+#define OVC_STOP_SEC_VAR_UNSPECIFIED
+#include "OVC_MemMap.h"
+
 /**********************************************************************************************************************/
 /* FUNCTIONS                                                                                                          */
 /**********************************************************************************************************************/
@@ -110,10 +143,33 @@ void OVC_vidInit(void)
    MODULE_SCU.OVCCON.U        = 0;
    IfxScuWdt_setSafetyEndinit(u16LocPwd);
 
+   OVC_u8PageCmd           = OVC_u8PAGE_CMD_NONE;
+   OVC_u8PageCmdBlkIdx     = 0;
+   OVC_u8PageCpySt         = OVC_u8CPY_IDLE;
+   OVC_u32PageCpyTi        = 0;
+   OVC_u32PageCpyCallTiMax = 0;
+   OVC_u32PageSwtLat       = 0;
+   OVC_u32PageSwtLatMax    = 0;
+   OVC_u32PageSwtCnt       = 0;
+   OVC_u8CpyBlkIdx         = 0;
+   OVC_u32CpyOfs           = 0;
+   OVC_bPageSwtLock        = FALSE;
+
    for (u32LocBlkIdx = 0; u32LocBlkIdx < sizeof(OVC_akstCfg) / (OVC_u8NB_CFG * sizeof(OVC_tstBlk)); u32LocBlkIdx++)
    {
       //>>Wdg_vidRefreshWatchdog();
       pudtBlk = &OVC_akstCfg[OVC_u8GET_CFG_IDX()][u32LocBlkIdx];
+      OVC_au32ActPage[u32LocBlkIdx]   = (uint32)pudtBlk->pu32Dest;
+      OVC_au32InactPage[u32LocBlkIdx] = (uint32)pudtBlk->pu32Shdw;
+      OVC_abSwtReq[u32LocBlkIdx]      = FALSE;
+      OVC_abCpyCplt[u32LocBlkIdx]     = FALSE;
+      if (  (((uint32)pudtBlk->pu32Shdw >> 24) == OVC_u32ADDR_EMEM_MSB)
+         && (SCU_CHIPID.B.EEA != 0x01u))
+      {
+         /* !Comment: No EMEM on this device (production TC23x): no shadow page, */
+         /*           the block runs single-page and copy/swap are refused       */
+         OVC_au32InactPage[u32LocBlkIdx] = 0;
+      }
       if (  (((uint32)pudtBlk->pu32Src >> 24) == OVC_u32ADDR_CACHED_FLASH_MSB)
          || (((uint32)pudtBlk->pu32Src >> 24) == OVC_u32ADDR_NONCACHED_FLASH_MSB))
       {
@@ -245,7 +301,7 @@ uint32 OVC_u32GetPhysPage(uint32 * pu32LogAddr)
       u32Start = (uint32)OVC_akstCfg[OVC_u8GET_CFG_IDX()][u32LocBlkIdx].pu32Src;
       if ((u32Start <= u32LogAd) && ((u32Start + OVC_akstCfg[OVC_u8GET_CFG_IDX()][u32LocBlkIdx].s32Size) > u32LogAd))
       {
-         return((uint32)OVC_akstCfg[OVC_u8GET_CFG_IDX()][u32LocBlkIdx].pu32Dest);
+         return(OVC_au32ActPage[u32LocBlkIdx]);
       }
    }
    return((uint32)pu32LogAddr);
@@ -294,7 +350,7 @@ uint32 OVC_u32GetPhysAddr(uint8 * pu8LogAddr)
          {
             if ((pstBlk->bEna == TRUE) && ((u32Osel & (1u << u32LocBlkIdx)) != 0) && ((pstBlk->u8Cores & u32CoreIdMsk) != 0))
             {
-               return((u32LogAd & (pstBlk->s32Size - 1)) | (uint32)(pstBlk->pu32Dest));
+               return((u32LogAd & (pstBlk->s32Size - 1)) | OVC_au32ActPage[u32LocBlkIdx]);
             }
             else
             {
@@ -306,6 +362,238 @@ uint32 OVC_u32GetPhysAddr(uint8 * pu8LogAddr)
    }
    return((uint32)pu8LogAddr);
 }
+
+/*********************************************** <AUTO_FUNCTION_HEADER> ***********************************************/
+/*                                                                                                                    */
+/* !FuncName    : OVC_udtReqPageCpy                                                                                   */
+/*                                                                                                                    */
+/* !Description : Requests the background copy of the active page of one block into its inactive page, so that the   */
+/*                tool can prepare the next data set from the current one                                            */
+/* !Number      : 4                                                                                                   */
+/* !Reference   : NONE                                                                                                */
+/*                                                                                                                    */
+/* !Trace_To    : NONE                                                                                                */
+/*                                                                                                                    */
+/********************************************** </AUTO_FUNCTION_HEADER> ***********************************************/
+/* !Trigger  : Runnable                                                                                               */
+/*                                                                                                                    */
+/* !LastAuthor  :  E. Moas                                                                                            */
+/********************************************* <AUTO_FUNCTION_PROTOTYPE> **********************************************/
+Std_ReturnType OVC_udtReqPageCpy(uint8 u8BlkIdx)
+{
+   if (  (u8BlkIdx >= OVC_u8NB_BLK)
+      || (OVC_u8PageCpySt == OVC_u8CPY_BUSY)
+      || (OVC_au32InactPage[u8BlkIdx] == 0)
+      || (OVC_abSwtReq[u8BlkIdx] == TRUE))
+   {
+      return(E_NOT_OK);
+   }
+   OVC_u8CpyBlkIdx  = u8BlkIdx;
+   OVC_u32CpyOfs    = 0;
+   OVC_abCpyCplt[u8BlkIdx] = FALSE;
+   OVC_u32CpyStrtTi = OVC_u32GET_TIMEOUT_START();
+   OVC_u8PageCpySt  = OVC_u8CPY_BUSY;
+   return(E_OK);
+}
+
+/*********************************************** <AUTO_FUNCTION_HEADER> ***********************************************/
+/*                                                                                                                    */
+/* !FuncName    : OVC_udtReqPageSwt                                                                                   */
+/*                                                                                                                    */
+/* !Description : Requests the swap of the active and inactive pages of one block. The swap itself is applied at the  */
+/*                next task boundary by OVC_vidPageSwtTaskBnd. Refused until a copy into the inactive page of this    */
+/*                block has completed since the last swap                                                             */
+/* !Number      : 5                                                                                                   */
+/* !Reference   : NONE                                                                                                */
+/*                                                                                                                    */
+/* !Trace_To    : NONE                                                                                                */
+/*                                                                                                                    */
+/********************************************** </AUTO_FUNCTION_HEADER> ***********************************************/
+/* !Trigger  : Runnable                                                                                               */
+/*                                                                                                                    */
+/* !LastAuthor  :  E. Moas                                                                                            */
+/********************************************* <AUTO_FUNCTION_PROTOTYPE> **********************************************/
+Std_ReturnType OVC_udtReqPageSwt(uint8 u8BlkIdx)
+{
+   if (  (u8BlkIdx >= OVC_u8NB_BLK)
+      || (OVC_bPageSwtLock == TRUE)
+      || (OVC_u8PageCpySt == OVC_u8CPY_BUSY)
+      || (OVC_au32InactPage[u8BlkIdx] == 0)
+      || (OVC_abCpyCplt[u8BlkIdx] == FALSE))
+   {
+      return(E_NOT_OK);
+   }
+   OVC_au32SwtReqTi[u8BlkIdx] = OVC_u32GET_TIMEOUT_START();
+   OVC_abSwtReq[u8BlkIdx]     = TRUE;
+   return(E_OK);
+}
+
+/*********************************************** <AUTO_FUNCTION_HEADER> ***********************************************/
+/*                                                                                                                    */
+/* !FuncName    : OVC_vidPageCpyMgr                                                                                   */
+/*                                                                                                                    */
+/* !Description : Handles the tool commands and copies the pending page by chunks of OVC_u32CPY_CHUNK_SIZE bytes.     */
+/*                A new chunk is only started if it still fits in OVC_u32CPY_BUDGET_US, based on the duration of the  */
+/*                previous one                                                                                        */
+/* !Number      : 6                                                                                                   */
+/* !Reference   : NONE                                                                                                */
+/*                                                                                                                    */
+/* !Trace_To    : NONE                                                                                                */
+/*                                                                                                                    */
+/********************************************** </AUTO_FUNCTION_HEADER> ***********************************************/
+/* !Trigger  : TASK_TIME_10MS                                                                                         */
+/*                                                                                                                    */
+/* !LastAuthor  :  E. Moas                                                                                            */
+/********************************************* <AUTO_FUNCTION_PROTOTYPE> **********************************************/
+void OVC_vidPageCpyMgr(void)
+{
+   uint32 u32LocStrtTi;
+   uint32 u32LocChkStrtTi;
+   uint32 u32LocChkTi;
+   uint32 u32LocCallTi;
+   uint32 u32LocSize;
+   uint32 u32LocLen;
+
+
+   if (OVC_u8PageCmd == OVC_u8PAGE_CMD_CPY)
+   {
+      (void)OVC_udtReqPageCpy(OVC_u8PageCmdBlkIdx);
+   }
+   else if (OVC_u8PageCmd == OVC_u8PAGE_CMD_SWT)
+   {
+      (void)OVC_udtReqPageSwt(OVC_u8PageCmdBlkIdx);
+   }
+   OVC_u8PageCmd = OVC_u8PAGE_CMD_NONE;
+
+   if (OVC_u8PageCpySt == OVC_u8CPY_BUSY)
+   {
+      u32LocSize   = (uint32)OVC_akstCfg[OVC_u8GET_CFG_IDX()][OVC_u8CpyBlkIdx].s32Size;
+      u32LocStrtTi = OVC_u32GET_TIMEOUT_START();
+      do
+      {
+         u32LocLen = u32LocSize - OVC_u32CpyOfs;
+         if (u32LocLen > OVC_u32CPY_CHUNK_SIZE)
+         {
+            u32LocLen = OVC_u32CPY_CHUNK_SIZE;
+         }
+         u32LocChkStrtTi = OVC_u32GET_TIMEOUT_START();
+         OVC_vidCopy((uint32 *)(OVC_au32ActPage[OVC_u8CpyBlkIdx] + OVC_u32CpyOfs),
+                     (uint32 *)(OVC_au32InactPage[OVC_u8CpyBlkIdx] + OVC_u32CpyOfs),
+                     (sint32)u32LocLen);
+         OVC_u32CpyOfs += u32LocLen;
+         u32LocChkTi  = OVC_u32GET_TIMEOUT_START() - u32LocChkStrtTi;
+         u32LocCallTi = OVC_u32GET_TIMEOUT_START() - u32LocStrtTi;
+      } while (  (OVC_u32CpyOfs < u32LocSize)
+              && ((u32LocCallTi + u32LocChkTi) <= (OVC_u32SYSTEM_CLOCK_MHZ * OVC_u32CPY_BUDGET_US)));
+
+      if (u32LocCallTi > OVC_u32PageCpyCallTiMax)
+      {
+         OVC_u32PageCpyCallTiMax = u32LocCallTi;
+      }
+      if (OVC_u32CpyOfs >= u32LocSize)
+      {
+         OVC_u32PageCpyTi = OVC_u32GET_TIMEOUT_START() - OVC_u32CpyStrtTi;
+         OVC_u8PageCpySt  = OVC_u8CPY_DONE;
+         OVC_abCpyCplt[OVC_u8CpyBlkIdx] = TRUE;
+      }
+   }
+}
+
+/*********************************************** <AUTO_FUNCTION_HEADER> ***********************************************/
+/*                                                                                                                    */
+/* !FuncName    : OVC_vidPageSwtTaskBnd                                                                               */
+/*                                                                                                                    */
+/* !Description : Applies the pending page swaps. Each swap is one write of the RABR register of the block followed  */
+/*                by a data cache invalidation, so tasks read either the old or the new page, never a mix of both.   */
+/*                Swaps requested before a lock are held until OVC_vidLockPageSwt(FALSE)                             */
+/* !Number      : 7                                                                                                   */
+/* !Reference   : NONE                                                                                                */
+/*                                                                                                                    */
+/* !Trace_To    : NONE                                                                                                */
+/*                                                                                                                    */
+/********************************************** </AUTO_FUNCTION_HEADER> ***********************************************/
+/* !Trigger  : TASK_TIME_10MS (task start)                                                                            */
+/*                                                                                                                    */
+/* !LastAuthor  :  E. Moas                                                                                            */
+/********************************************* <AUTO_FUNCTION_PROTOTYPE> **********************************************/
+void OVC_vidPageSwtTaskBnd(void)
+{
+   uint32             u32LocBlkIdx;
+   uint32             u32LocPage;
+   uint32             u32LocLat;
+   const OVC_tstBlk * pudtBlk;
+   Ifx_OVC_BLK_RABR   stLocRabr;
+   uint16             u16LocPwd;
+
+
+   if (OVC_bPageSwtLock == TRUE)
+   {
+      return;
+   }
+   for (u32LocBlkIdx = 0; u32LocBlkIdx < OVC_u8NB_BLK; u32LocBlkIdx++)
+   {
+      if (OVC_abSwtReq[u32LocBlkIdx] == TRUE)
+      {
+         pudtBlk    = &OVC_akstCfg[OVC_u8GET_CFG_IDX()][u32LocBlkIdx];
+         u32LocPage = OVC_au32InactPage[u32LocBlkIdx];
+
+         stLocRabr.U       = 0;
+         stLocRabr.B.OBASE = ((u32LocPage & 0x003FFFFFu) >> 5);
+         stLocRabr.B.OMEM  = OVC_u8GET_MEM(u32LocPage);
+         stLocRabr.B.OVEN  = pudtBlk->bEna;
+
+         u16LocPwd = IfxScuWdt_getSafetyWatchdogPassword();
+         IfxScuWdt_clearSafetyEndinit(u16LocPwd);
+         if ((pudtBlk->u8Cores & OVC_u8CORE_0) != 0)
+         {
+            MODULE_OVC0.BLK[u32LocBlkIdx].RABR.U = stLocRabr.U;
+         }
+         __dsync();
+         MODULE_SCU.OVCCON.U = OVC_u32OVCCON_DCINVAL_INVLD | (uint32)pudtBlk->u8Cores;
+         __dsync();
+         IfxScuWdt_setSafetyEndinit(u16LocPwd);
+
+         OVC_au32InactPage[u32LocBlkIdx] = OVC_au32ActPage[u32LocBlkIdx];
+         OVC_au32ActPage[u32LocBlkIdx]   = u32LocPage;
+         OVC_abSwtReq[u32LocBlkIdx]      = FALSE;
+         /* !Comment: The new inactive page is the old active one: copy again */
+         OVC_abCpyCplt[u32LocBlkIdx]     = FALSE;
+         if (OVC_u8PageCpySt == OVC_u8CPY_DONE)
+         {
+            OVC_u8PageCpySt = OVC_u8CPY_IDLE;
+         }
+
+         u32LocLat = OVC_u32GET_TIMEOUT_START() - OVC_au32SwtReqTi[u32LocBlkIdx];
+         OVC_u32PageSwtLat = u32LocLat;
+         if (u32LocLat > OVC_u32PageSwtLatMax)
+         {
+            OVC_u32PageSwtLatMax = u32LocLat;
+         }
+         OVC_u32PageSwtCnt++;
+      }
+   }
+}
+
+/*********************************************** <AUTO_FUNCTION_HEADER> ***********************************************/
+/*                                                                                                                    */
+/* !FuncName    : OVC_vidLockPageSwt                                                                                  */
+/*                                                                                                                    */
+/* !Description : Locks or unlocks the page swaps. While locked, new swap requests are refused and pending ones are   */
+/*                not applied, so the active page stays the one read by a running calibration store                  */
+/* !Number      : 8                                                                                                   */
+/* !Reference   : NONE                                                                                                */
+/*                                                                                                                    */
+/* !Trace_To    : NONE                                                                                                */
+/*                                                                                                                    */
+/********************************************** </AUTO_FUNCTION_HEADER> ***********************************************/
+/* !Trigger  : Runnable                                                                                               */
+/*                                                                                                                    */
+/* !LastAuthor  :  E. Moas                                                                                            */
+/********************************************* <AUTO_FUNCTION_PROTOTYPE> **********************************************/
+void OVC_vidLockPageSwt(boolean bLock)
+{
+   OVC_bPageSwtLock = bLock;
+}
 #define OVC_STOP_SEC_CODE
 #include "OVC_MemMap.h"
 
@@ -92,6 +92,22 @@
 #define _SOFTWARE_DEVAID_
 
 #define OVC_u8NB_CFG 3
+#define OVC_u8NB_BLK 1
+
+/* !Comment: Background page copy granularity (bytes) and time budget of one  */
+/*           OVC_vidPageCpyMgr call (us)                                      */
+#define OVC_u32CPY_CHUNK_SIZE 256u
+#define OVC_u32CPY_BUDGET_US  200u
+
+/* !Comment: Page commands written by the calibration tool in OVC_u8PageCmd   */
+#define OVC_u8PAGE_CMD_NONE 0u
+#define OVC_u8PAGE_CMD_CPY  1u
+#define OVC_u8PAGE_CMD_SWT  2u
+
+/* !Comment: States of the background copy of the inactive page              */
+#define OVC_u8CPY_IDLE 0u
+#define OVC_u8CPY_BUSY 1u
+#define OVC_u8CPY_DONE 2u
 
 /**********************************************************************************************************************/
 /* TYPEDEF                                                                                                            */
@@ -100,6 +116,7 @@ typedef struct
 {
 	uint32 *           pu32Src;
 	uint32 *           pu32Dest;
+	uint32 *           pu32Shdw;
 	sint32             s32Size;
 	boolean            bEna;
 	uint8              u8Cores;
@@ -163,11 +180,28 @@ typedef struct
 #include "OVC_MemMap.h"
 
 extern const uint8 OVC_aku8GetMemId[16];
-extern const OVC_tstBlk OVC_akstCfg[OVC_u8NB_CFG][1];
+extern const OVC_tstBlk OVC_akstCfg[OVC_u8NB_CFG][OVC_u8NB_BLK];
 
 #define OVC_STOP_SEC_CONST_UNSPECIFIED
 #include "OVC_MemMap.h"
 
+#define OVC_START_SEC_VAR_UNSPECIFIED
+#include "OVC_MemMap.h"
+
+extern uint32 OVC_au32ActPage[OVC_u8NB_BLK];
+extern uint32 OVC_au32InactPage[OVC_u8NB_BLK];
+extern uint8  OVC_u8PageCmd;
+extern uint8  OVC_u8PageCmdBlkIdx;
+extern uint8  OVC_u8PageCpySt;
+extern uint32 OVC_u32PageCpyTi;
+extern uint32 OVC_u32PageCpyCallTiMax;
+extern uint32 OVC_u32PageSwtLat;
+extern uint32 OVC_u32PageSwtLatMax;
+extern uint32 OVC_u32PageSwtCnt;
+
+#define OVC_STOP_SEC_VAR_UNSPECIFIED
+#include "OVC_MemMap.h"
+
 
 /**********************************************************************************************************************/
 /* FUNCTIONS                                                                                                          */
@@ -179,6 +213,11 @@ extern const OVC_tstBlk OVC_akstCfg[OVC_u8NB_CFG][1];
 extern void OVC_vidCopy(uint32 * pu32Src, uint32 * pu32Dest, sint32 s32Size);
 extern void OVC_vidInit(void);
 extern uint32 OVC_u32GetPhysPage(uint32 * pu32LogAddr);
+extern Std_ReturnType OVC_udtReqPageCpy(uint8 u8BlkIdx);
+extern Std_ReturnType OVC_udtReqPageSwt(uint8 u8BlkIdx);
+extern void OVC_vidPageCpyMgr(void);
+extern void OVC_vidPageSwtTaskBnd(void);
+extern void OVC_vidLockPageSwt(boolean bLock);
 
 #define OVC_STOP_SEC_CODE
 #include "OVC_MemMap.h"
@@ -55,12 +55,13 @@ const uint8 OVC_aku8GetMemId[16] =
 	255
 };
 
-const OVC_tstBlk OVC_akstCfg[OVC_u8NB_CFG][1] =
+const OVC_tstBlk OVC_akstCfg[OVC_u8NB_CFG][OVC_u8NB_BLK] =
 {
 	/* No calibration */
    {
 		{
 			(uint32 *)0,
+		   (uint32 *)0,
 		   (uint32 *)0,
 			0,
 			FALSE,
@@ -73,17 +74,19 @@ const OVC_tstBlk OVC_akstCfg[OVC_u8NB_CFG][1] =
 		{
 			(uint32 *)DEVHAL_u32CALIB_START_ADDRESS,
 		   (uint32 *)DEVHAL_OVERLAY_RAM_START_ADDRESS,
+		   (uint32 *)DEVHAL_OVERLAY_SHDW_RAM_START_ADDRESS,
 			(DEVHAL_u32CALIB_END_ADDRESS - DEVHAL_u32CALIB_START_ADDRESS),
 			TRUE,
 			OVC_u8CORE_0,
 			TRUE		
 		}
 	},
-	/* Devaid in RAM */
+	/* Devaid in RAM. The EMEM shadow page is dropped at init on parts without EMEM */
 	{
 		{
 			(uint32 *)DEVHAL_u32CALIB_START_ADDRESS,
          (uint32 *)DEVHAL_OVERLAY_INT_RAM_START_ADDRESS,
+		   (uint32 *)DEVHAL_OVERLAY_RAM_START_ADDRESS,
 			(DEVHAL_u32CALIB_END_ADDRESS - DEVHAL_u32CALIB_START_ADDRESS),
 			TRUE,
 			OVC_u8CORE_0,
@@ -77,6 +77,26 @@
 
     #define M3_VADC_u16READ_VALUE(u8Channel) (VADC_au16ConvRes[u8Channel])
 
+/* !Comment: Minimum and maximum raw samples of the last 10 ms window */
+#define VADC_u16READ_MIN(snChannel)  (VADC_au16ConvResMin[VADC_u8##snChannel##_RES_IDX])
+#define VADC_u16READ_MAX(snChannel)  (VADC_au16ConvResMax[VADC_u8##snChannel##_RES_IDX])
+
+/* !Comment: (group << 4) | result register of a channel, for the oversampling table */
+#define VADC_u8GET_REG_IDX(snChannel) \
+   VADC_u8GET_REG_IDX_M1(VADC_sn##snChannel##_CH)
+
+   #define VADC_u8GET_REG_IDX_M1(snChannel) \
+      VADC_u8GET_REG_IDX_M2(snChannel)
+
+   #define VADC_u8GET_REG_IDX_M2(snChannel) \
+      VADC_u8GET_REG_IDX_M3(VADC_sn##snChannel##_CH)
+
+   #define VADC_u8GET_REG_IDX_M3(snChannel) \
+      VADC_u8GET_REG_IDX_M4(snChannel)
+
+   #define VADC_u8GET_REG_IDX_M4(snChannel) \
+      (VADC_u8##snChannel##_IDX)
+
 /**********************************************************************************************************************/
 /* FUNCTIONS DECLARATION                                                                                              */
 /**********************************************************************************************************************/
@@ -85,6 +105,8 @@
 
 void VADC_vidInit(void);
 void VADC_vidEna(void);
+void VADC_vidIsrStatUpdate(uint8 u8GrpIdx, uint32 u32TimeStamp);
+void VADC_vidIsrStatReset(void);
 
 #define VADC_STOP_SEC_CODE
 #include "VADC_MemMap.h"
@@ -25,6 +25,8 @@
 /* 3 / ISR_GRP_1_END_OF_CONV                                                                                          */
 /* 4 / ISR_GRP_2_END_OF_CONV                                                                                          */
 /* 5 / ISR_GRP_3_END_OF_CONV                                                                                          */
+/* 6 / VADC_vidIsrStatUpdate                                                                                          */
+/* 7 / VADC_vidIsrStatReset                                                                                           */
 /************************************************ </AUTO_FILE_HEADER> *************************************************/
 /* PVCS Information                                                                                                   */
 /* $Archive::   P:/VE_S97/LOG/60_ComponentArchive/Archives/COMP_SWC_BSW_MCAL_MPC5676/adc_api.h_v                     $*/
@@ -236,4 +238,118 @@ void VADC_vidInit(void)
    Mcal_SetENDINIT();
 }
 
+
+/*********************************************** <AUTO_FUNCTION_HEADER> ***********************************************/
+/*                                                                                                                    */
+/* !FuncName    : VADC_vidIsrStatUpdate                                                                               */
+/*                                                                                                                    */
+/* !Description : Updates the end of conversion statistics of a group: ISR period min/max/mean, trigger to ISR        */
+/*                latency min/max/histogram and missed conversions. Performs the pending reset request first.         */
+/* !Number      : 6                                                                                                   */
+/* !Reference   : NONE                                                                                                */
+/*                                                                                                                    */
+/* !Trace_To    : NONE                                                                                                */
+/*                                                                                                                    */
+/********************************************** </AUTO_FUNCTION_HEADER> ***********************************************/
+/* !Trigger  : End of conversion ISR of the group                                                                     */
+/*                                                                                                                    */
+/* !LastAuthor  :  E. Moas                                                                                            */
+/********************************************* <AUTO_FUNCTION_PROTOTYPE> **********************************************/
+void VADC_vidIsrStatUpdate(uint8 u8GrpIdx, uint32 u32TimeStamp)
+{
+   uint32                      u32LocIdx;
+   uint32                      u32LocCnt;
+   uint32                      u32LocLat;
+   uint32                      u32LocPrd;
+   VADC_tstrIsrStat          * pstrLocStat;
+   const VADC_tstrIsrStatCfg * pkstrLocCfg;
+
+
+   if (VADC_bIsrStatRstReq != FALSE)
+   {
+      for (u32LocIdx = 0; u32LocIdx < VADC_u8ISR_STAT_NB_GRP; u32LocIdx++)
+      {
+         pstrLocStat                = &VADC_astrIsrStat[u32LocIdx];
+         pstrLocStat->u32NbIsr      = 0;
+         pstrLocStat->u32NbMissed   = 0;
+         pstrLocStat->u32PrdMin     = 0xFFFFFFFFu;
+         pstrLocStat->u32PrdMax     = 0;
+         pstrLocStat->u32PrdMean    = 0;
+         pstrLocStat->u32PrdMeanAcc = 0;
+         pstrLocStat->u32LatMin     = 0xFFFFFFFFu;
+         pstrLocStat->u32LatMax     = 0;
+         for (u32LocCnt = 0; u32LocCnt < VADC_u8ISR_STAT_NB_BIN; u32LocCnt++)
+         {
+            pstrLocStat->au32LatHist[u32LocCnt] = 0;
+         }
+      }
+      VADC_bIsrStatRstReq = FALSE;
+   }
+
+   pkstrLocCfg = &VADC_kastrIsrStatCfg[u8GrpIdx];
+   pstrLocStat = &VADC_astrIsrStat[u8GrpIdx];
+   if (pkstrLocCfg->pkstTrigCnt != NULL_PTR)
+   {
+      /* Trigger to ISR latency: position in the triggering PWM period */
+      u32LocCnt = pkstrLocCfg->pkstTrigCnt->U;
+      if (u32LocCnt >= pkstrLocCfg->u32TrigCnt)
+      {
+         u32LocLat = u32LocCnt - pkstrLocCfg->u32TrigCnt;
+      }
+      else
+      {
+         u32LocLat = (u32LocCnt + pkstrLocCfg->u32TrigPrd) - pkstrLocCfg->u32TrigCnt;
+      }
+      pstrLocStat->u32LatMin = MATHSRV_udtMIN(pstrLocStat->u32LatMin, u32LocLat);
+      pstrLocStat->u32LatMax = MATHSRV_udtMAX(pstrLocStat->u32LatMax, u32LocLat);
+      u32LocIdx = MATHSRV_udtMIN(u32LocLat >> VADC_u8ISR_STAT_BIN_SHIFT, VADC_u8ISR_STAT_NB_BIN - 1u);
+      if (pstrLocStat->au32LatHist[u32LocIdx] < 0xFFFFFFFFu)
+      {
+         pstrLocStat->au32LatHist[u32LocIdx]++;
+      }
+
+      /* Period, not defined on the first ISR after a reset */
+      if (pstrLocStat->u32NbIsr == 0)
+      {
+         pstrLocStat->u32PrdMeanAcc = pkstrLocCfg->u32NomPrd << 4;
+      }
+      else
+      {
+         u32LocPrd = u32TimeStamp - pstrLocStat->u32LastTimeStamp;
+         pstrLocStat->u32PrdMin     = MATHSRV_udtMIN(pstrLocStat->u32PrdMin, u32LocPrd);
+         pstrLocStat->u32PrdMax     = MATHSRV_udtMAX(pstrLocStat->u32PrdMax, u32LocPrd);
+         pstrLocStat->u32PrdMeanAcc = (pstrLocStat->u32PrdMeanAcc - (pstrLocStat->u32PrdMeanAcc >> 4)) + u32LocPrd;
+         if (u32LocPrd > (pkstrLocCfg->u32NomPrd + (pkstrLocCfg->u32NomPrd / 2u)))
+         {
+            pstrLocStat->u32NbMissed += ((u32LocPrd + (pkstrLocCfg->u32NomPrd / 2u)) / pkstrLocCfg->u32NomPrd) - 1u;
+         }
+      }
+      pstrLocStat->u32PrdMean       = pstrLocStat->u32PrdMeanAcc >> 4;
+      pstrLocStat->u32LastTimeStamp = u32TimeStamp;
+      pstrLocStat->u32NbIsr++;
+   }
+}
+
+
+/*********************************************** <AUTO_FUNCTION_HEADER> ***********************************************/
+/*                                                                                                                    */
+/* !FuncName    : VADC_vidIsrStatReset                                                                                */
+/*                                                                                                                    */
+/* !Description : Requests the reset of the end of conversion statistics, done by the next ISR. The request flag      */
+/*                VADC_bIsrStatRstReq can also be set over CCP.                                                       */
+/* !Number      : 7                                                                                                   */
+/* !Reference   : NONE                                                                                                */
+/*                                                                                                                    */
+/* !Trace_To    : NONE                                                                                                */
+/*                                                                                                                    */
+/********************************************** </AUTO_FUNCTION_HEADER> ***********************************************/
+/* !Trigger  : Application                                                                                            */
+/*                                                                                                                    */
+/* !LastAuthor  :  E. Moas                                                                                            */
+/********************************************* <AUTO_FUNCTION_PROTOTYPE> **********************************************/
+void VADC_vidIsrStatReset(void)
+{
+   VADC_bIsrStatRstReq = TRUE;
+}
+
 /*---------------------------------------------------- end of file ---------------------------------------------------*/
@@ -31,7 +31,9 @@
 #include "Mcal.h"
 #include "Dio.h"
 #include "EVP.h"
+#include "Evp_api.h"
 #include "Os_api.h"
+#include "MATHSRV.h"
 #include "VADC.h"
 #include "VADC_Cfg.h"
 #include "VADC_L.h"
@@ -50,6 +52,9 @@
    | (VADC_u32GxQINR0_ENSI_##snIt##_MSK) \
    | (VADC_u32GxQINR0_RF_##snRefill##_MSK) \
    | (VADC_u8##snCh##_IDX))
+
+#define VADC_OVS_CH_CFG(snChannel, snMode, u16Gain) \
+   { VADC_u8##snChannel##_RES_IDX, VADC_u8GET_REG_IDX(snChannel), VADC_u8OVS_##snMode, (u16Gain) }
   
 
 /**********************************************************************************************************************/
@@ -320,6 +325,43 @@ const uint16 VADC_kau16MinThrdGrp[VADC_u8GROUP_NB_MAX] =
 {
    200, 200
 };
+
+/* Channels copied at each end of conversion of group 0 and reduced every 10 ms */
+const VADC_tstrOvsChannel VADC_kastrOvsChannel[VADC_u8OVS_NB_CH] =
+{
+   VADC_OVS_CH_CFG(AN_DIAG_SOL_SW_2,   LAST,   0),
+   VADC_OVS_CH_CFG(AN_DIAG_SOL_SW_1,   LAST,   0),
+   VADC_OVS_CH_CFG(AN_TOSS,            LAST,   0),
+   VADC_OVS_CH_CFG(AN_C4_SPD_SNS,      LAST,   0),
+   VADC_OVS_CH_CFG(AN_RESERVED_TEMP_1, LAST,   0),
+   VADC_OVS_CH_CFG(AN_PRI_OIL_TEMP,    DECIM,  16384),
+   VADC_OVS_CH_CFG(AN_TMP_PCB,         DECIM,  16384),
+   VADC_OVS_CH_CFG(AN_G4_SPD_SNS,      LAST,   0),
+   VADC_OVS_CH_CFG(AN_P5V_INTERNAL,    LAST,   0),
+   VADC_OVS_CH_CFG(AN_P5V_SNS_SUP_1,   LAST,   0),
+   VADC_OVS_CH_CFG(AN_VCC_3V3_SUP,     LAST,   0),
+   VADC_OVS_CH_CFG(AN_P9V_SNS_SUP,     LAST,   0),
+   VADC_OVS_CH_CFG(AN_VBAT_P_SW_SUP,   LAST,   0),
+   VADC_OVS_CH_CFG(AN_T30_BATT,        LAST,   0),
+   VADC_OVS_CH_CFG(AN_T15_IGN,         LAST,   0),
+   VADC_OVS_CH_CFG(AN_RESERVED_1,      LAST,   0),
+   VADC_OVS_CH_CFG(AN_RESERVED_2,      LAST,   0),
+   VADC_OVS_CH_CFG(AN_PRI_OIL_PRES,    MEAN,   0)
+};
+
+/* Group 0 queue is triggered at the start of the EVP group 0 period */
+const VADC_tstrIsrStatCfg VADC_kastrIsrStatCfg[VADC_u8ISR_STAT_NB_GRP] =
+{
+   {
+      &(EVP_pstGET_CH_PTR(GRP_0)->CN0),
+      0u,
+      EVP_u32ADC_TRIG_0_PERIOD,
+      (EVP_u32ADC_TRIG_0_PERIOD * VADC_u32CFG_TIMEOUT_TMR_CLK_MHZ) / EVP_u16CLOCK_MHZ
+   },
+   {NULL_PTR, 0u, 0u, 0u},
+   {NULL_PTR, 0u, 0u, 0u},
+   {NULL_PTR, 0u, 0u, 0u}
+};
     
 #define VADC_STOP_SEC_CONST_UNSPECIFIED
 #include "VADC_MemMap.h"
@@ -331,10 +373,22 @@ const uint16 VADC_kau16MinThrdGrp[VADC_u8GROUP_NB_MAX] =
 #include "VADC_MemMap.h"
 
 uint16 VADC_au16ConvRes[VADC_u8NB_CONV_RES];
+uint16 VADC_au16ConvResMin[VADC_u8NB_CONV_RES];
+uint16 VADC_au16ConvResMax[VADC_u8NB_CONV_RES];
+uint8  VADC_au8ConvResNbSample[VADC_u8NB_CONV_RES];
 uint16 SWTST_au16AdcRes[30];
 sint32 VADC_as32IsrDelay[4][3];
 uint32 VADC_au32IsrPeriod[4];
 uint32 VADC_au32IsrTimeStamp[4];
+VADC_tstrIsrStat VADC_astrIsrStat[VADC_u8ISR_STAT_NB_GRP];
+boolean VADC_bIsrStatRstReq;
+
+/* Window accumulators: the ISR fills VADC_astrOvsAcc[VADC_u8OvsAccIdx], the 10 ms task */
+/* switches the index and reduces the other one                                         */
+static VADC_tstrOvsAcc VADC_astrOvsAcc[2];
+static uint8   VADC_u8OvsAccIdx;
+static uint32  VADC_au32OvsDecimFil[VADC_u8OVS_NB_CH];
+static boolean VADC_abOvsDecimInit[VADC_u8OVS_NB_CH];
 
 #define VADC_STOP_SEC_VAR_UNSPECIFIED
 #include "VADC_MemMap.h"
@@ -346,11 +400,15 @@ uint32 VADC_au32IsrTimeStamp[4];
 #define VADC_START_SEC_CODE
 #include "VADC_MemMap.h"
 
+static uint16 VADC_u16OvsMedian(uint16 * pu16Window, uint32 u32NbSample);
+
 void VADC_vidEna(void)
 {
    MODULE_GTM.ADCTRIG0OUT0.U  = 0x0000;
    MODULE_GTM.ADCTRIG1OUT0.U  = 0x00000021;
 
+   VADC_vidIsrStatReset();
+
    //INTBSL_vidENA_IT(ISR_GRP_0_END_OF_CONV);
    Os_Enable_ISR_GRP_0_END_OF_CONV();
 }
@@ -373,24 +431,203 @@ void VADC_vidEna(void)
 /********************************************* <AUTO_FUNCTION_PROTOTYPE> **********************************************/
 void VADC_vidUpdate10ms(void)
 {
-   VADC_au16ConvRes[VADC_u8AN_DIAG_SOL_SW_2_RES_IDX]                          = VADC_u16GET_VALUE(AN_DIAG_SOL_SW_2);
-   VADC_au16ConvRes[VADC_u8AN_DIAG_SOL_SW_1_RES_IDX]                = VADC_u16GET_VALUE(AN_DIAG_SOL_SW_1);
-   VADC_au16ConvRes[VADC_u8AN_TOSS_RES_IDX]                         = VADC_u16GET_VALUE(AN_TOSS);
-   VADC_au16ConvRes[VADC_u8AN_C4_SPD_SNS_RES_IDX]                     = VADC_u16GET_VALUE(AN_C4_SPD_SNS);
-   VADC_au16ConvRes[VADC_u8AN_RESERVED_TEMP_1_RES_IDX]                       = VADC_u16GET_VALUE(AN_RESERVED_TEMP_1);
-   VADC_au16ConvRes[VADC_u8AN_PRI_OIL_TEMP_RES_IDX]                         = VADC_u16GET_VALUE(AN_PRI_OIL_TEMP);
-   VADC_au16ConvRes[VADC_u8AN_TMP_PCB_RES_IDX]                         = VADC_u16GET_VALUE(AN_TMP_PCB);
-   VADC_au16ConvRes[VADC_u8AN_G4_SPD_SNS_RES_IDX]                     = VADC_u16GET_VALUE(AN_G4_SPD_SNS);
-   VADC_au16ConvRes[VADC_u8AN_P5V_INTERNAL_RES_IDX]                     = VADC_u16GET_VALUE(AN_P5V_INTERNAL);
-   VADC_au16ConvRes[VADC_u8AN_P5V_SNS_SUP_1_RES_IDX]                = VADC_u16GET_VALUE(AN_P5V_SNS_SUP_1);
-   VADC_au16ConvRes[VADC_u8AN_VCC_3V3_SUP_RES_IDX]                    = VADC_u16GET_VALUE(AN_VCC_3V3_SUP);
-   VADC_au16ConvRes[VADC_u8AN_P9V_SNS_SUP_RES_IDX]           = VADC_u16GET_VALUE(AN_P9V_SNS_SUP);
-   VADC_au16ConvRes[VADC_u8AN_VBAT_P_SW_SUP_RES_IDX]           = VADC_u16GET_VALUE(AN_VBAT_P_SW_SUP);
-   VADC_au16ConvRes[VADC_u8AN_T30_BATT_RES_IDX]           = VADC_u16GET_VALUE(AN_T30_BATT);
-   VADC_au16ConvRes[VADC_u8AN_T15_IGN_RES_IDX]     = VADC_u16GET_VALUE(AN_T15_IGN);
-   VADC_au16ConvRes[VADC_u8AN_RESERVED_1_RES_IDX]     = VADC_u16GET_VALUE(AN_RESERVED_1);
-   VADC_au16ConvRes[VADC_u8AN_RESERVED_2_RES_IDX]     = VADC_u16GET_VALUE(AN_RESERVED_2);
-   VADC_au16ConvRes[VADC_u8AN_PRI_OIL_PRES_RES_IDX]     = VADC_u16GET_VALUE(AN_PRI_OIL_PRES);
+   uint32   u32LocCh;
+   uint32   u32LocBlk;
+   uint32   u32LocNbSample;
+   uint16   u16LocMin;
+   uint16   u16LocMax;
+   uint16   u16LocValue;
+   uint16   au16LocWindow[VADC_u8OVS_DEPTH];
+   const VADC_tstrOvsChannel * pkstrLocCh;
+   VADC_tstrOvsAcc           * pstrLocAcc;
+
+
+   /* Only the index is switched under lock: the ISR accumulates the next window in the */
+   /* other buffer while this one is reduced                                            */
+   SuspendAllInterrupts();
+   pstrLocAcc       = &VADC_astrOvsAcc[VADC_u8OvsAccIdx];
+   VADC_u8OvsAccIdx = (uint8)(VADC_u8OvsAccIdx ^ 1u);
+   ResumeAllInterrupts();
+
+   u32LocNbSample = pstrLocAcc->u16NbSample;
+   for (u32LocCh = 0; u32LocCh < VADC_u8OVS_NB_CH; u32LocCh++)
+   {
+      pkstrLocCh = &VADC_kastrOvsChannel[u32LocCh];
+
+      if (u32LocNbSample == 0)
+      {
+         /* No end of conversion since the last call: direct register read */
+         u16LocValue = VADC_u16GET_VALUE_M6(pkstrLocCh->u8RegIdx);
+         u16LocMin   = u16LocValue;
+         u16LocMax   = u16LocValue;
+      }
+      else
+      {
+         u16LocMin = pstrLocAcc->au16Min[u32LocCh];
+         u16LocMax = pstrLocAcc->au16Max[u32LocCh];
+
+         switch (pkstrLocCh->u8OvsMode)
+         {
+            case VADC_u8OVS_MEAN:
+               u16LocValue = (uint16)((pstrLocAcc->au32Sum[u32LocCh] + (u32LocNbSample / 2u)) / u32LocNbSample);
+               break;
+
+            case VADC_u8OVS_MEDIAN:
+               if (pstrLocAcc->u8NbBlk == 0)
+               {
+                  /* Window shorter than one block: mean of its samples */
+                  u16LocValue = (uint16)((pstrLocAcc->au32Sum[u32LocCh] + (u32LocNbSample / 2u)) / u32LocNbSample);
+               }
+               else
+               {
+                  for (u32LocBlk = 0; u32LocBlk < pstrLocAcc->u8NbBlk; u32LocBlk++)
+                  {
+                     au16LocWindow[u32LocBlk] = pstrLocAcc->au16BlkMean[u32LocBlk][u32LocCh];
+                  }
+                  u16LocValue = VADC_u16OvsMedian(au16LocWindow, pstrLocAcc->u8NbBlk);
+               }
+               break;
+
+            case VADC_u8OVS_DECIM:
+               u16LocValue = (uint16)((pstrLocAcc->au32Sum[u32LocCh] + (u32LocNbSample / 2u)) / u32LocNbSample);
+               if (VADC_abOvsDecimInit[u32LocCh] == FALSE)
+               {
+                  VADC_au32OvsDecimFil[u32LocCh] = (uint32)u16LocValue << 16;
+                  VADC_abOvsDecimInit[u32LocCh]  = TRUE;
+               }
+               u16LocValue = MATHSRV_u16FirstOrderFilterGu16(pkstrLocCh->u16DecimGain,
+                                                             &VADC_au32OvsDecimFil[u32LocCh],
+                                                             u16LocValue);
+               break;
+
+            default:
+               u16LocValue = pstrLocAcc->au16Last[u32LocCh];
+               break;
+         }
+      }
+
+      VADC_au16ConvRes[pkstrLocCh->u8ResIdx]        = u16LocValue;
+      VADC_au16ConvResMin[pkstrLocCh->u8ResIdx]     = u16LocMin;
+      VADC_au16ConvResMax[pkstrLocCh->u8ResIdx]     = u16LocMax;
+      VADC_au8ConvResNbSample[pkstrLocCh->u8ResIdx] = (uint8)MATHSRV_udtMIN(u32LocNbSample, 255u);
+   }
+
+   /* Buffer free for the window after the next one */
+   pstrLocAcc->u16NbSample = 0;
+   pstrLocAcc->u8NbBlk     = 0;
+}
+
+
+/*********************************************** <AUTO_FUNCTION_HEADER> ***********************************************/
+/*                                                                                                                    */
+/* !FuncName    : VADC_vidSampleConvRes                                                                               */
+/*                                                                                                                    */
+/* !Description : Accumulate the results of the oversampled channels in the current window: sum, min, max, last     */
+/*                sample and block means                                                                              */
+/* !Number      : 6                                                                                                   */
+/* !Reference   : NONE                                                                                                */
+/*                                                                                                                    */
+/* !Trace_To    : NONE                                                                                                */
+/*                                                                                                                    */
+/********************************************** </AUTO_FUNCTION_HEADER> ***********************************************/
+/* !Trigger  : ISR_GRP_0_END_OF_CONV                                                                                  */
+/*                                                                                                                    */
+/* !LastAuthor  :  E. Moas                                                                                            */
+/********************************************* <AUTO_FUNCTION_PROTOTYPE> **********************************************/
+void VADC_vidSampleConvRes(void)
+{
+   uint32            u32LocCh;
+   uint16            u16LocValue;
+   VADC_tstrOvsAcc * pstrLocAcc;
+
+
+   pstrLocAcc = &VADC_astrOvsAcc[VADC_u8OvsAccIdx];
+   if (pstrLocAcc->u16NbSample == 0xFFFFu)
+   {
+      /* 10 ms task not run for 2.6 s: window kept as is */
+      return;
+   }
+
+   if (pstrLocAcc->u16NbSample == 0)
+   {
+      for (u32LocCh = 0; u32LocCh < VADC_u8OVS_NB_CH; u32LocCh++)
+      {
+         u16LocValue = VADC_u16GET_VALUE_M6(VADC_kastrOvsChannel[u32LocCh].u8RegIdx);
+         pstrLocAcc->au32Sum[u32LocCh]    = u16LocValue;
+         pstrLocAcc->au32BlkSum[u32LocCh] = u16LocValue;
+         pstrLocAcc->au16Min[u32LocCh]    = u16LocValue;
+         pstrLocAcc->au16Max[u32LocCh]    = u16LocValue;
+         pstrLocAcc->au16Last[u32LocCh]   = u16LocValue;
+      }
+   }
+   else
+   {
+      for (u32LocCh = 0; u32LocCh < VADC_u8OVS_NB_CH; u32LocCh++)
+      {
+         u16LocValue = VADC_u16GET_VALUE_M6(VADC_kastrOvsChannel[u32LocCh].u8RegIdx);
+         pstrLocAcc->au32Sum[u32LocCh]    += u16LocValue;
+         pstrLocAcc->au32BlkSum[u32LocCh] += u16LocValue;
+         pstrLocAcc->au16Min[u32LocCh]     = (uint16)MATHSRV_udtMIN(pstrLocAcc->au16Min[u32LocCh], u16LocValue);
+         pstrLocAcc->au16Max[u32LocCh]     = (uint16)MATHSRV_udtMAX(pstrLocAcc->au16Max[u32LocCh], u16LocValue);
+         pstrLocAcc->au16Last[u32LocCh]    = u16LocValue;
+      }
+   }
+   pstrLocAcc->u16NbSample++;
+
+   if ((pstrLocAcc->u16NbSample & ((1u << VADC_u8OVS_BLK_SHIFT) - 1u)) == 0)
+   {
+      /* End of block: its mean is kept for the median, extra blocks of a late task are dropped */
+      for (u32LocCh = 0; u32LocCh < VADC_u8OVS_NB_CH; u32LocCh++)
+      {
+         if (pstrLocAcc->u8NbBlk < VADC_u8OVS_DEPTH)
+         {
+            pstrLocAcc->au16BlkMean[pstrLocAcc->u8NbBlk][u32LocCh] =
+               (uint16)(pstrLocAcc->au32BlkSum[u32LocCh] >> VADC_u8OVS_BLK_SHIFT);
+         }
+         pstrLocAcc->au32BlkSum[u32LocCh] = 0;
+      }
+      if (pstrLocAcc->u8NbBlk < VADC_u8OVS_DEPTH)
+      {
+         pstrLocAcc->u8NbBlk++;
+      }
+   }
+}
+
+
+/*********************************************** <AUTO_FUNCTION_HEADER> ***********************************************/
+/*                                                                                                                    */
+/* !FuncName    : VADC_u16OvsMedian                                                                                   */
+/*                                                                                                                    */
+/* !Description : Median of the block means of one window (upper median for an even number), sorts the window         */
+/* !Number      : 7                                                                                                   */
+/* !Reference   : NONE                                                                                                */
+/*                                                                                                                    */
+/* !Trace_To    : NONE                                                                                                */
+/*                                                                                                                    */
+/********************************************** </AUTO_FUNCTION_HEADER> ***********************************************/
+/* !Trigger  : VADC_vidUpdate10ms                                                                                     */
+/*                                                                                                                    */
+/* !LastAuthor  :  E. Moas                                                                                            */
+/********************************************* <AUTO_FUNCTION_PROTOTYPE> **********************************************/
+static uint16 VADC_u16OvsMedian(uint16 * pu16Window, uint32 u32NbSample)
+{
+   uint32 u32LocSample;
+   uint32 u32LocPos;
+   uint16 u16LocValue;
+
+
+   for (u32LocSample = 1; u32LocSample < u32NbSample; u32LocSample++)
+   {
+      u16LocValue = pu16Window[u32LocSample];
+      u32LocPos   = u32LocSample;
+      while ((u32LocPos > 0) && (pu16Window[u32LocPos - 1u] > u16LocValue))
+      {
+         pu16Window[u32LocPos] = pu16Window[u32LocPos - 1u];
+         u32LocPos--;
+      }
+      pu16Window[u32LocPos] = u16LocValue;
+   }
+   return (pu16Window[u32NbSample / 2u]);
 }
 
 #define VADC_STOP_SEC_CODE
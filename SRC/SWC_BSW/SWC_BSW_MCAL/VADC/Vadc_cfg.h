@@ -31,6 +31,7 @@
 #define VADC_CFG_H
 
 #include "Std_Types.h"
+#include "IfxGtm_regdef.h"
 #include "VADC_L.h"
 
 /**********************************************************************************************************************/
@@ -106,6 +107,28 @@
 
 #define VADC_u32CFG_GLOBEVNP (0) /* Not used */
 
+/* Oversampling: number of channels sampled at each end of conversion of group 0. Every */
+/* sample of the 10 ms window (about 250 at 40 us) is accumulated, and the mean of each */
+/* block of (1 << VADC_u8OVS_BLK_SHIFT) samples is kept for the median, up to           */
+/* VADC_u8OVS_DEPTH blocks per window                                                   */
+#define VADC_u8OVS_NB_CH                                   18
+#define VADC_u8OVS_BLK_SHIFT                               5
+#define VADC_u8OVS_DEPTH                                   8
+
+/* Oversampling reduction modes: latest sample, mean of the window, median of the block */
+/* means of the window, first order filter of the window mean                           */
+#define VADC_u8OVS_LAST                                    0
+#define VADC_u8OVS_MEAN                                    1
+#define VADC_u8OVS_MEDIAN                                  2
+#define VADC_u8OVS_DECIM                                   3
+
+/* End of conversion ISR statistics: groups, trigger to ISR latency histogram bins */
+/* and bin width (1 << VADC_u8ISR_STAT_BIN_SHIFT GTM ticks)                         */
+#define VADC_u8ISR_STAT_NB_GRP                             4
+#define VADC_u8ISR_STAT_GRP_0_IDX                          0
+#define VADC_u8ISR_STAT_NB_BIN                             16
+#define VADC_u8ISR_STAT_BIN_SHIFT                          6
+
 /**********************************************************************************************************************/
 /* TYPES DEFINITION                                                                                                   */
 /**********************************************************************************************************************/
@@ -120,6 +143,52 @@ typedef struct
 }
 VADC_tstrGroupSources;
 
+typedef struct
+{
+   uint8          u8ResIdx;      /* Index in VADC_au16ConvRes                      */
+   uint8          u8RegIdx;      /* (group << 4) | result register                 */
+   uint8          u8OvsMode;     /* VADC_u8OVS_xxx                                 */
+   uint16         u16DecimGain;  /* VADC_u8OVS_DECIM gain on the mean, /65536      */
+}
+VADC_tstrOvsChannel;
+
+typedef struct
+{
+   uint32 au32Sum[VADC_u8OVS_NB_CH];                       /* Sum of the samples of the window                  */
+   uint32 au32BlkSum[VADC_u8OVS_NB_CH];                    /* Sum of the samples of the current block           */
+   uint16 au16Min[VADC_u8OVS_NB_CH];
+   uint16 au16Max[VADC_u8OVS_NB_CH];
+   uint16 au16Last[VADC_u8OVS_NB_CH];
+   uint16 au16BlkMean[VADC_u8OVS_DEPTH][VADC_u8OVS_NB_CH]; /* Means of the complete blocks of the window        */
+   uint16 u16NbSample;                                     /* Saturated, accumulation stops at the saturation   */
+   uint8  u8NbBlk;
+}
+VADC_tstrOvsAcc;
+
+typedef struct
+{
+   const volatile Ifx_GTM_TOM_CH_CN0 * pkstTrigCnt;  /* Counter of the PWM triggering the group, NULL_PTR if unused */
+   uint32                              u32TrigCnt;   /* Counter value of the trigger, GTM ticks                     */
+   uint32                              u32TrigPrd;   /* PWM period, GTM ticks                                       */
+   uint32                              u32NomPrd;    /* Nominal ISR period, STM ticks                               */
+}
+VADC_tstrIsrStatCfg;
+
+typedef struct
+{
+   uint32 u32NbIsr;
+   uint32 u32NbMissed;                                /* Conversions without ISR (period > 1.5 nominal)    */
+   uint32 u32LastTimeStamp;
+   uint32 u32PrdMin;                                  /* STM ticks                                          */
+   uint32 u32PrdMax;
+   uint32 u32PrdMean;
+   uint32 u32PrdMeanAcc;                              /* 16 x u32PrdMean                                    */
+   uint32 u32LatMin;                                  /* Trigger to ISR, GTM ticks                          */
+   uint32 u32LatMax;
+   uint32 au32LatHist[VADC_u8ISR_STAT_NB_BIN];        /* Saturated counters, last bin collects the overflow */
+}
+VADC_tstrIsrStat;
+
 
 /**********************************************************************************************************************/
 /* CONSTANTS DECLARATION                                                                                              */
@@ -146,6 +215,8 @@ extern const uint16 VADC_ku16MaxThrdGlobal;
 extern const uint16 VADC_ku16MinThrdGlobal;
 extern const uint16 VADC_kau16MaxThrdGrp[VADC_u8GROUP_NB_MAX];
 extern const uint16 VADC_kau16MinThrdGrp[VADC_u8GROUP_NB_MAX];
+extern const VADC_tstrOvsChannel VADC_kastrOvsChannel[VADC_u8OVS_NB_CH];
+extern const VADC_tstrIsrStatCfg VADC_kastrIsrStatCfg[VADC_u8ISR_STAT_NB_GRP];
 
 #define VADC_STOP_SEC_CONST_UNSPECIFIED
 #include "VADC_MemMap.h"
@@ -158,8 +229,13 @@ extern const uint16 VADC_kau16MinThrdGrp[VADC_u8GROUP_NB_MAX];
 #include "VADC_MemMap.h"
 
 extern uint16 VADC_au16ConvRes[VADC_u8NB_CONV_RES];
+extern uint16 VADC_au16ConvResMin[VADC_u8NB_CONV_RES];
+extern uint16 VADC_au16ConvResMax[VADC_u8NB_CONV_RES];
+extern uint8  VADC_au8ConvResNbSample[VADC_u8NB_CONV_RES];
 extern uint32 VADC_au32IsrPeriod[4];
 extern uint32 VADC_au32IsrTimeStamp[4];
+extern VADC_tstrIsrStat VADC_astrIsrStat[VADC_u8ISR_STAT_NB_GRP];
+extern boolean VADC_bIsrStatRstReq;
 
 #define VADC_STOP_SEC_VAR_UNSPECIFIED
 #include "VADC_MemMap.h"
@@ -172,6 +248,7 @@ extern uint32 VADC_au32IsrTimeStamp[4];
 #include "VADC_MemMap.h"
 
 extern void VADC_vidUpdate10ms(void);
+extern void VADC_vidSampleConvRes(void);
 
 #define VADC_STOP_SEC_CODE
 #include "VADC_MemMap.h"
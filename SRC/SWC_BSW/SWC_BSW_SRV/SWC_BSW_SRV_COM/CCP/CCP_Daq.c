@@ -83,6 +83,12 @@
    #error CCP_coDAQ_ELM_SIZE_MAX_32_BITS not defined
 #endif
 
+#if (  (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD)                                                                           \
+    && (CCP_coDAQ_LIST_ID_EQ_EVT_ID != CCP_coACVD)                                                                      \
+    && (CCP_u8DAQ_NO_LISTS > 32))
+   #error Event channel masks of started DAQ lists are limited to 32 DAQ lists
+#endif
+
 /**********************************************************************************************************************/
 /* GLOBAL FUNCTION DEFINITION                                                                                         */
 /**********************************************************************************************************************/
@@ -107,6 +113,9 @@
    {
       uint8_least                                            u8LocalListIdx;
       P2VAR(CCP_tstrDaqListDynCfg, AUTOMATIC, CCP_APPL_DATA) pstrLocalDaqListDynCfg;
+# if (CCP_coDAQ_LIST_ID_EQ_EVT_ID != CCP_coACVD)
+      uint8_least                                            u8LocalEveChn;
+# endif
 
 
       CCP_strDaqListSeldElm.u8ElmIdx = CCP_u8DAQ_NO_ELMS_PER_ODT;
@@ -129,6 +138,13 @@
          pstrLocalDaqListDynCfg->u16Ctr           = 0;
          pstrLocalDaqListDynCfg->u16Pslr          = 0;
       }
+
+# if (CCP_coDAQ_LIST_ID_EQ_EVT_ID != CCP_coACVD)
+      for (u8LocalEveChn = 0; u8LocalEveChn < CCP_u8DAQ_NO_EVE_CHNS; u8LocalEveChn++)
+      {
+         CCP_au32DaqEveChnListMsk[u8LocalEveChn] = 0;
+      }
+# endif
    }
 #endif /* CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD */
 
@@ -677,6 +693,9 @@
       /*            before it is cleared by the "SetEvent" function                                                   */
       pstrLocalDaqListDynCfg->vu8Mod = CCP_u8DAQ_MOD_STOP;
       pstrLocalDaqListDynCfg->vu8CfgChgdCtr++;
+# if (CCP_coDAQ_LIST_ID_EQ_EVT_ID != CCP_coACVD)
+      CCP_au32DaqEveChnListMsk[pstrLocalDaqListDynCfg->u8EveChn] &= ~CCP_u32DAQ_LIST_MSK(u8ListIdx);
+# endif
       if (  (u8LocalPrevMod == CCP_u8DAQ_MOD_STRT)
          && (CCP_u8DaqNoStrtdList > 0))
       {
@@ -722,6 +741,16 @@
 
       pstrLocalDaqListDynCfg->vu8Mod = (uint8)u8Mod;
       pstrLocalDaqListDynCfg->vu8CfgChgdCtr++;
+# if (CCP_coDAQ_LIST_ID_EQ_EVT_ID != CCP_coACVD)
+      if (u8Mod == CCP_u8DAQ_MOD_STRT)
+      {
+         CCP_au32DaqEveChnListMsk[pstrLocalDaqListDynCfg->u8EveChn] |= CCP_u32DAQ_LIST_MSK(u8ListIdx);
+      }
+      else
+      {
+         CCP_au32DaqEveChnListMsk[pstrLocalDaqListDynCfg->u8EveChn] &= ~CCP_u32DAQ_LIST_MSK(u8ListIdx);
+      }
+# endif
       if (  (u8Mod == CCP_u8DAQ_MOD_STRT)
          && (u8LocalPrevMod != CCP_u8DAQ_MOD_STRT)
          && (CCP_u8DaqNoStrtdList < CCP_u8DAQ_NO_LISTS))
@@ -758,29 +787,41 @@
       uint16_least                                           u16LocalCtr;
       uint8                                                  u8LocalFirstPid;
       uint8                                                  u8LocalOdtLstIdx;
+# if (CCP_coDAQ_LIST_ID_EQ_EVT_ID != CCP_coACVD)
+      uint32                                                 u32LocalListMsk;
+# endif
 
 
+      /* !Comment : No DAQ list started => nothing else to do                                                         */
       if (CCP_u8DaqNoStrtdList > 0)
       {
 # if (CCP_coDAQ_LIST_ID_EQ_EVT_ID == CCP_coACVD)
          for (u8LocalListIdx = u8EveChn; u8LocalListIdx < CCP_u8DAQ_NO_LISTS; u8LocalListIdx = CCP_u8DAQ_NO_LISTS)
          {
 # else
-         for (u8LocalListIdx = 0; u8LocalListIdx < CCP_u8DAQ_NO_LISTS; u8LocalListIdx++)
+         if (u8EveChn < CCP_u8DAQ_NO_EVE_CHNS)
          {
-# endif
-            pstrLocalDaqListDynCfg = &CCP_astrDaqListDynCfg[u8LocalListIdx];
+            u32LocalListMsk = CCP_au32DaqEveChnListMsk[u8EveChn];
+         }
+         else
+         {
+            u32LocalListMsk = 0;
+         }
 
-            if (pstrLocalDaqListDynCfg->vu8Mod != CCP_u8DAQ_MOD_STRT)
+         /* !Comment : Only the started DAQ lists bound to the event channel are visited, by increasing index         */
+         for (u8LocalListIdx = 0; u32LocalListMsk != 0; u8LocalListIdx++, u32LocalListMsk >>= 1)
+         {
+            if ((u32LocalListMsk & 1) == 0)
             {
                continue;
             }
-# if (CCP_coDAQ_LIST_ID_EQ_EVT_ID != CCP_coACVD)
-            if (pstrLocalDaqListDynCfg->u8EveChn != u8EveChn)
+# endif
+            pstrLocalDaqListDynCfg = &CCP_astrDaqListDynCfg[u8LocalListIdx];
+
+            if (pstrLocalDaqListDynCfg->vu8Mod != CCP_u8DAQ_MOD_STRT)
             {
                continue;
             }
-# endif
 
             /* !Comment : Check update in the daq list dynamic configuration                                          */
             u8LocalCfgChgdCtr = pstrLocalDaqListDynCfg->vu8CfgChgdCtr;
@@ -990,7 +1031,9 @@
       uint8_least                                            u8LocalPrevMod;
 
 
-      if (u8ListIdx < CCP_u8DAQ_NO_LISTS)
+      /* !Comment: the resumed data may be corrupt, the event channel indexes CCP_au32DaqEveChnListMsk              */
+      if (  (u8ListIdx < CCP_u8DAQ_NO_LISTS)
+         && (u8EveChn < CCP_u8DAQ_NO_EVE_CHNS))
       {
          pstrLocalDaqListDynCfg = &CCP_astrDaqListDynCfg[u8ListIdx];
 
@@ -999,7 +1042,12 @@
          pstrLocalDaqListDynCfg->vu8Mod      = u8Mod;
          pstrLocalDaqListDynCfg->u8OdtLstIdx = u8OdtLstIdx;
 # if (CCP_coDAQ_LIST_ID_EQ_EVT_ID != CCP_coACVD)
+         CCP_au32DaqEveChnListMsk[pstrLocalDaqListDynCfg->u8EveChn] &= ~CCP_u32DAQ_LIST_MSK(u8ListIdx);
          pstrLocalDaqListDynCfg->u8EveChn    = u8EveChn;
+         if (u8Mod == CCP_u8DAQ_MOD_STRT)
+         {
+            CCP_au32DaqEveChnListMsk[u8EveChn] |= CCP_u32DAQ_LIST_MSK(u8ListIdx);
+         }
 # endif
          pstrLocalDaqListDynCfg->u16Pslr     = u16Pslr;
 
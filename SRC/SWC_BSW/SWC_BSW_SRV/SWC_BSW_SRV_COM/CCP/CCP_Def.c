@@ -81,6 +81,10 @@ VAR(CCP_tstrMta, CCP_VAR) CCP_astrMta[CCP_u8NO_MTA];
    VAR(uint8, CCP_VAR) CCP_u8DaqNoStrtdList;
 
    VAR(CCP_tstrDaqListDynCfg, CCP_VAR) CCP_astrDaqListDynCfg[CCP_u8DAQ_NO_LISTS];
+
+# if (CCP_coDAQ_LIST_ID_EQ_EVT_ID != CCP_coACVD)
+   VAR(uint32, CCP_VAR) CCP_au32DaqEveChnListMsk[CCP_u8DAQ_NO_EVE_CHNS];
+# endif
 #endif
 
 #define CCP_STOP_SEC_VAR_UNSPECIFIED
@@ -236,6 +236,9 @@
 #define CCP_u8DAQ_MOD_STRT       0x01
 #define CCP_u8DAQ_MOD_SYNCD_STRT 0x02
 
+/* !MComment: Bit of a DAQ list in the event channel masks of started DAQ lists                                       */
+#define CCP_u32DAQ_LIST_MSK(u8ListIdx) ((uint32)1 << (u8ListIdx))
+
 /* !MComment: Format of DAQ list CAN identifier                                                                       */
 #define CCP_udtDAQ_CAN_ID_IS_EXTD 0x80000000UL
 #define CCP_udtDAQ_CAN_ID_MASK    0x7FFFFFFFUL
@@ -288,6 +291,11 @@ extern VAR(CCP_tstrMta, CCP_VAR) CCP_astrMta[CCP_u8NO_MTA];
    extern VAR(uint8, CCP_VAR) CCP_u8DaqNoStrtdList;
 
    extern VAR(CCP_tstrDaqListDynCfg, CCP_VAR) CCP_astrDaqListDynCfg[CCP_u8DAQ_NO_LISTS];
+
+# if (CCP_coDAQ_LIST_ID_EQ_EVT_ID != CCP_coACVD)
+   /* !Comment: Started DAQ lists bound to each event channel (bit n = DAQ list n)                                    */
+   extern VAR(uint32, CCP_VAR) CCP_au32DaqEveChnListMsk[CCP_u8DAQ_NO_EVE_CHNS];
+# endif
 #endif
 
 #define CCP_STOP_SEC_VAR_UNSPECIFIED
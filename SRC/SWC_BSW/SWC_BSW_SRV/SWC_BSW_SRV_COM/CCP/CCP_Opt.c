@@ -385,7 +385,7 @@
 /* !LastAuthor  :  R. Danioux                                                                                         */
 /********************************************* <AUTO_FUNCTION_PROTOTYPE> **********************************************/
 /* !Comment : status of the service                                                                                   */
-/* !Range   : CCP_udtCMD_STS_NO_ERR, CCP_udtCMD_STS_PRM_OUT_OF_RNG                                                    */
+/* !Range   : CCP_udtCMD_STS_NO_ERR, CCP_udtCMD_STS_PRM_OUT_OF_RNG, status of CCP_udtUsrNtfyCalStoreSttChgd          */
 #if (CCP_coOPT_SRV_SSN_STS == CCP_coACVD)
    FUNC(CCP_tudtCmdSts, CCP_CODE) CCP_udtSetSsnSts(void)
    {
@@ -395,6 +395,9 @@
              && (CCP_coDAQ_RESU_FEATURE == CCP_coACVD)) )
       boolean bLocalStt;
       #endif
+      #if (CCP_coCAL_STORE_FEATURE == CCP_coACVD)
+      CCP_tudtCmdSts udtLocalCmdSts;
+      #endif
 
 
       u8LocalSsnSts = CCP_uniBuf.uniCmd.strSetSsnSts.u8SsnSts;
@@ -405,7 +408,11 @@
             if (((u8LocalSsnSts ^ CCP_u8SsnSts) & CCP_u8STORE_REQ)!= 0)
             {
                bLocalStt = (((u8LocalSsnSts & CCP_u8STORE_REQ) != 0) ? TRUE : FALSE);
-               CCP_vidUsrNtfyCalStoreSttChgd(bLocalStt);
+               udtLocalCmdSts = CCP_udtUsrNtfyCalStoreSttChgd(bLocalStt);
+               if (udtLocalCmdSts != CCP_udtCMD_STS_NO_ERR)
+               {
+                  return(udtLocalCmdSts);
+               }
             }
          #endif
 
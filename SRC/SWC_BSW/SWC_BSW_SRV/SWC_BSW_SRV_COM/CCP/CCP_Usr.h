@@ -252,7 +252,9 @@ FUNC(CCP_tudtCmdSts, CCP_USR_CODE) CCP_udtUsrWrMem
       /****************************************************************************************************************/
       /* !Description: Request to store calibration                                                                   */
       /****************************************************************************************************************/
-      FUNC(void, CCP_USR_CODE) CCP_vidUsrNtfyCalStoreSttChgd
+      /* !Comment: Status of the request, the session status is not updated if it is not CCP_udtCMD_STS_NO_ERR          */
+      /* !Range  : CCP_udtCMD_STS_NO_ERR, CCP_udtCMD_STS_CMD_PROCESSOR_BUSY, CCP_udtCMD_STS_FCN_NOT_AVL                   */
+      FUNC(CCP_tudtCmdSts, CCP_USR_CODE) CCP_udtUsrNtfyCalStoreSttChgd
       (
          /* !Comment: State of Calibration Store bit (TRUE: request to store calibrations)                            */
          boolean bCalStoreStt
@@ -33,6 +33,7 @@
 #include "CCPUSR.h"
 #include "CCPUSR_Cfg.h"
 #include "CCPUSR_Daq.h"
+#include "CCPUSR_Xcp.h"
 #include "DEVHAL.h"
 #include "IfxScu_reg.h"
 #include "Ovc.h"
@@ -51,6 +52,12 @@
 /* !Comment: Checksum size */
 #define CCPUSR_u8CKS_SIZE 2
 
+/* !Comment: Bytes added by one CCP_udtUsrBldCksSts call (asynchronous checksum)                                      */
+#define CCPUSR_u32CKS_BYTES_PER_CALL 4096UL
+
+/* !Comment: Words added in the 16-bit lanes of the accumulator before folding (2 * 255 * 128 < 65536)                */
+#define CCPUSR_u32CKS_WORDS_PER_FOLD 128UL
+
 #define CCPUSR_DFLT_CALIB_PAGE_RAM_ADDR (CCPUSR_DFLT_CALIB_PAGE_ADDR + CCPUSR_START_ADDRESS_OF_CALIBRATION_IN_RAM \
                                          - CCPUSR_START_ADDRESS_OF_CALIBRATION_IN_ROM)
 
@@ -63,6 +70,18 @@
 uint8 CCPUSR_enuCalStoreStatus;
 uint32 CCPUSR_u32ActivePageAddr;
 
+#if (CCP_coOPT_SRV_CKS_ASYNC_RESP == CCP_coACVD)
+/* !Comment: Last checksum job: block size, duration (STM ticks) and number of CCP_udtUsrBldCksSts calls             */
+uint32 CCPUSR_u32CksBlkSize;
+uint32 CCPUSR_u32CksTi;
+uint32 CCPUSR_u32CksCallCnt;
+
+static uint32 CCPUSR_u32CksAdr;
+static uint32 CCPUSR_u32CksRmng;
+static uint32 CCPUSR_u32CksSum;
+static uint32 CCPUSR_u32CksStrtTi;
+#endif /* (CCP_coOPT_SRV_CKS_ASYNC_RESP == CCP_coACVD) */
+
 #define CCP_STOP_SEC_VAR_UNSPECIFIED
 #include "Ccp_MemMap.h"
 
@@ -133,6 +152,64 @@ static CCP_tudtCmdSts CCPUSR_udtMemoryControlReadRight
    return (udtlocalStatus);
 }
 
+#if (CCP_coOPT_SRV_CKS == CCP_coACVD)
+/**********************************************************************************************************************/
+/* !FuncName    : CCPUSR_u32CksAdd                                                                                    */
+/* !Description : Returns the sum of the bytes of a memory range. Aligned words are added two bytes at a time in the  */
+/*                16-bit lanes of one accumulator, which is folded every CCPUSR_u32CKS_WORDS_PER_FOLD words           */
+/**********************************************************************************************************************/
+static uint32 CCPUSR_u32CksAdd
+(
+   uint32 u32Adr,
+   uint32 u32Len
+)
+{
+   uint32                                    u32LocalSum;
+   uint32                                    u32LocalLanes;
+   uint32                                    u32LocalWord;
+   uint32                                    u32LocalNbWords;
+   uint32                                    u32LocalFold;
+   P2CONST(uint8, AUTOMATIC, CCP_APPL_DATA)  pu8LocalData;
+   P2CONST(uint32, AUTOMATIC, CCP_APPL_DATA) pu32LocalData;
+
+
+   u32LocalSum  = 0;
+   pu8LocalData = (P2CONST(uint8, AUTOMATIC, CCP_APPL_DATA))u32Adr;
+   while ((u32Len > 0) && (((uint32)pu8LocalData & 3u) != 0))
+   {
+      u32LocalSum += *pu8LocalData;
+      pu8LocalData++;
+      u32Len--;
+   }
+
+   pu32LocalData   = (P2CONST(uint32, AUTOMATIC, CCP_APPL_DATA))pu8LocalData;
+   u32LocalNbWords = u32Len >> 2;
+   while (u32LocalNbWords > 0)
+   {
+      u32LocalFold = (u32LocalNbWords > CCPUSR_u32CKS_WORDS_PER_FOLD) ? CCPUSR_u32CKS_WORDS_PER_FOLD : u32LocalNbWords;
+      u32LocalNbWords -= u32LocalFold;
+      u32LocalLanes    = 0;
+      do
+      {
+         u32LocalWord   = *pu32LocalData;
+         u32LocalLanes += (u32LocalWord & 0x00FF00FFu) + ((u32LocalWord >> 8) & 0x00FF00FFu);
+         pu32LocalData++;
+      } while (--u32LocalFold > 0);
+      u32LocalSum += (u32LocalLanes & 0xFFFFu) + (u32LocalLanes >> 16);
+   }
+
+   pu8LocalData = (P2CONST(uint8, AUTOMATIC, CCP_APPL_DATA))pu32LocalData;
+   u32Len      &= 3u;
+   while (u32Len > 0)
+   {
+      u32LocalSum += *pu8LocalData;
+      pu8LocalData++;
+      u32Len--;
+   }
+   return (u32LocalSum);
+}
+#endif /* (CCP_coOPT_SRV_CKS == CCP_coACVD) */
+
 #define CCP_STOP_SEC_CODE
 #include "Ccp_MemMap.h"
 
@@ -151,6 +228,9 @@ FUNC(void, CCP_USR_CODE) CCP_vidUsrIni(void)
 #if (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD)
    CCPUSR_vidDaqListIni();
 #endif /* (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD) */
+#if (CCPUSR_coXCP == CCP_coACVD)
+   CCPUSR_vidXcpIni();
+#endif
    CCPUSR_enuCalStoreStatus = CCPUSR_CAL_STORE_INIT;
    //CCPUSR_u32ActivePageAddr = OVC_u32GetPhysPage((uint32 *)CCPUSR_DFLT_CALIB_PAGE_ADDR);
    CCPUSR_u32ActivePageAddr = (uint32 *)CCPUSR_DFLT_CALIB_PAGE_ADDR;
@@ -336,7 +416,9 @@ FUNC(CCP_tudtCmdSts, CCP_USR_CODE) CCP_udtUsrWrMem
       /****************************************************************************************************************/
       /* !Description: Request to store calibration                                                                   */
       /****************************************************************************************************************/
-      FUNC(void, CCP_USR_CODE) CCP_vidUsrNtfyCalStoreSttChgd
+      /* !Comment: Status of the request                                                                              */
+      /* !Range  : CCP_udtCMD_STS_NO_ERR, CCP_udtCMD_STS_CMD_PROCESSOR_BUSY, CCP_udtCMD_STS_FCN_NOT_AVL                   */
+      FUNC(CCP_tudtCmdSts, CCP_USR_CODE) CCP_udtUsrNtfyCalStoreSttChgd
       (
          /* !Comment: State of Calibration Store bit (TRUE: request to store calibrations)                            */
          boolean bCalStoreStt
@@ -344,12 +426,21 @@ FUNC(CCP_tudtCmdSts, CCP_USR_CODE) CCP_udtUsrWrMem
       {
          if (bCalStoreStt == TRUE)
          {
+            if (DEVHAL_bCheckEmulCard() != TRUE)
+            {
+               return(CCP_udtCMD_STS_FCN_NOT_AVL);
+            }
+            if (DEVHAL_bIsCalibStoreBusy() == TRUE)
+            {
+               return(CCP_udtCMD_STS_CMD_PROCESSOR_BUSY);
+            }
             CCPUSR_enuCalStoreStatus = CCPUSR_CAL_STORE_REQUESTED;
          }
          else
          {
             CCPUSR_enuCalStoreStatus = CCPUSR_CAL_STORE_INIT;
          }
+         return(CCP_udtCMD_STS_NO_ERR);
       }
    #endif /* (CCP_coCAL_STORE_FEATURE == CCP_coACVD) */
 
@@ -481,23 +572,27 @@ FUNC(CCP_tudtCmdSts, CCP_USR_CODE) CCP_udtUsrWrMem
       uint8                                          au8CksData[4]
    )
    {
-      uint32                                  u32LocalIdx;
-      P2VAR(uint8, AUTOMATIC, CCP_APPL_DATA)  pu8Data;
-      uint16                                  u16LocalChecksum;
+   #if (CCP_coOPT_SRV_CKS_ASYNC_RESP == CCP_coACVD)
+      COMPILER_UNUSED_PARAMETER(pu8CksSize);
+      COMPILER_UNUSED_PARAMETER(au8CksData);
+
+      /* !Comment: Checksum is built by slices in CCP_udtUsrBldCksSts                                                 */
+      CCPUSR_u32CksAdr     = pkstrMta->u32Adr;
+      CCPUSR_u32CksRmng    = u32BlkSize;
+      CCPUSR_u32CksSum     = 0;
+      CCPUSR_u32CksStrtTi  = CCPUSR_u32GET_TIME_STAMP();
+      CCPUSR_u32CksBlkSize = u32BlkSize;
+      CCPUSR_u32CksCallCnt = 0;
+      return (CCP_udtCMD_STS_RESP_PND);
+   #else
       P2VAR(uint16, AUTOMATIC, CCP_APPL_DATA) pu16Cks;
 
 
-      u16LocalChecksum = 0;
-      pu8Data          = (P2VAR(uint8, AUTOMATIC, CCP_APPL_DATA))pkstrMta->u32Adr;
-      for (u32LocalIdx = 0; u32LocalIdx < u32BlkSize; u32LocalIdx++)
-      {
-         u16LocalChecksum += *pu8Data;
-         pu8Data++;
-      }
       pu16Cks     = (P2VAR(uint16, AUTOMATIC, CCP_APPL_DATA))&au8CksData[0];
-      *pu16Cks    = u16LocalChecksum;
+      *pu16Cks    = (uint16)CCPUSR_u32CksAdd(pkstrMta->u32Adr, u32BlkSize);
       *pu8CksSize = CCPUSR_u8CKS_SIZE;
       return (CCP_udtCMD_STS_NO_ERR);
+   #endif
    }
 #endif /* (CCP_coOPT_SRV_CKS == CCP_coACVD) */
 
@@ -518,7 +613,26 @@ FUNC(CCP_tudtCmdSts, CCP_USR_CODE) CCP_udtUsrWrMem
       uint8                                  au8CksData[4]
    )
    {
-      #error Not implemented
+      uint32                                  u32LocalLen;
+      P2VAR(uint16, AUTOMATIC, CCP_APPL_DATA) pu16Cks;
+
+
+      u32LocalLen = (CCPUSR_u32CksRmng > CCPUSR_u32CKS_BYTES_PER_CALL) ? CCPUSR_u32CKS_BYTES_PER_CALL
+                                                                        : CCPUSR_u32CksRmng;
+      CCPUSR_u32CksSum  += CCPUSR_u32CksAdd(CCPUSR_u32CksAdr, u32LocalLen);
+      CCPUSR_u32CksAdr  += u32LocalLen;
+      CCPUSR_u32CksRmng -= u32LocalLen;
+      CCPUSR_u32CksCallCnt++;
+      if (CCPUSR_u32CksRmng > 0)
+      {
+         return (CCP_udtCMD_STS_RESP_PND);
+      }
+
+      CCPUSR_u32CksTi = CCPUSR_u32GET_TIME_STAMP() - CCPUSR_u32CksStrtTi;
+      pu16Cks         = (P2VAR(uint16, AUTOMATIC, CCP_APPL_DATA))&au8CksData[0];
+      *pu16Cks        = (uint16)CCPUSR_u32CksSum;
+      *pu8CksSize     = CCPUSR_u8CKS_SIZE;
+      return (CCP_udtCMD_STS_NO_ERR);
    }
 #endif /* (CCP_coOPT_SRV_CKS_ASYNC_RESP == CCP_coACVD) */
 
@@ -635,9 +749,39 @@ FUNC(void, CCP_USR_CODE) CCP_vidMainFunction(void)
       {
          if (DEVHAL_udtCheckEngineState() == E_OK)
          {
-            CCPUSR_enuCalStoreStatus = CCPUSR_CAL_STORE_CONDITION_OK;
-            DEVHAL_vidCopyCalibrationInFlash();
+            /* !Comment: Flash is programmed in background by                 */
+            /*           DEVHAL_vidCalibStoreMainFunction                     */
+            if (DEVHAL_udtStrtCalibStore() == E_OK)
+            {
+               CCPUSR_enuCalStoreStatus = CCPUSR_CAL_STORE_CONDITION_OK;
+            }
+            else
+            {
+               /* !Comment: Store bit cleared, the tool sees the request is   */
+               /*           dropped and may request it again                  */
+               CCPUSR_enuCalStoreStatus = CCPUSR_CAL_STORE_FAILED;
+               #if (CCP_coOPT_SRV_SSN_STS == CCP_coACVD)
+               CCP_u8SsnSts &= (uint8)(~CCP_u8STORE_REQ);
+               #endif
+            }
+         }
+      }
+      else if (  (CCPUSR_enuCalStoreStatus == CCPUSR_CAL_STORE_CONDITION_OK)
+              && (DEVHAL_bIsCalibStoreBusy() != TRUE))
+      {
+         /* !Comment: Job ended without reset: nothing to store (DONE), or    */
+         /*           failed or cancelled. Report it and clear the store bit  */
+         if (DEVHAL_u8GetCalibStoreStt() == DEVHAL_u8CALIB_STORE_DONE)
+         {
+            CCPUSR_enuCalStoreStatus = CCPUSR_CAL_STORE_SUCCESS;
+         }
+         else
+         {
+            CCPUSR_enuCalStoreStatus = CCPUSR_CAL_STORE_FAILED;
          }
+         #if (CCP_coOPT_SRV_SSN_STS == CCP_coACVD)
+         CCP_u8SsnSts &= (uint8)(~CCP_u8STORE_REQ);
+         #endif
       }
    }
 }
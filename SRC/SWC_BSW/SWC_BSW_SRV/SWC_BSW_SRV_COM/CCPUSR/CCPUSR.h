@@ -42,6 +42,8 @@
 #define CCPUSR_CAL_STORE_REQUESTED		 2U
 #define CCPUSR_CAL_STORE_WAIT_CONDITION 4U
 #define CCPUSR_CAL_STORE_CONDITION_OK	 8U
+#define CCPUSR_CAL_STORE_FAILED         16U
+#define CCPUSR_CAL_STORE_SUCCESS        32U
 
 
 /**********************************************************************************************************************/
@@ -53,6 +55,12 @@
 
 extern uint8 CCPUSR_enuCalStoreStatus;
 
+#if (CCP_coOPT_SRV_CKS_ASYNC_RESP == CCP_coACVD)
+extern uint32 CCPUSR_u32CksBlkSize;
+extern uint32 CCPUSR_u32CksTi;
+extern uint32 CCPUSR_u32CksCallCnt;
+#endif /* (CCP_coOPT_SRV_CKS_ASYNC_RESP == CCP_coACVD) */
+
 #define CCP_STOP_SEC_VAR_UNSPECIFIED
 #include "Ccp_MemMap.h"
 
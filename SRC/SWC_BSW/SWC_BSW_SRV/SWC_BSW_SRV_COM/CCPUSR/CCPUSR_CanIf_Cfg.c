@@ -34,6 +34,7 @@
 #include "Ccpusr_CanIf_Cfg.h"
 #include "CCPUSR.h"
 #include "CCPUSR_Cfg.h"
+#include "CCPUSR_Xcp.h"
 
 
 /**********************************************************************************************************************/
@@ -115,7 +116,12 @@ void CCPUSR_vidSendDaqMessage(uint8 u8DaqId, const uint8 aku8Data[8])
 /**********************************************************************************************************************/
 void CCPUSR_vidDaqListTxConf(PduIdType CanTxPduId)
 {
-   CCP_vidDaqListTxMgr((uint8)CanTxPduId);
+#if (CCPUSR_coXCP == CCP_coACVD)
+   if (CCPUSR_bXcpDaqTxConf((uint8)CanTxPduId) == FALSE)
+#endif
+   {
+      CCP_vidDaqListTxMgr((uint8)CanTxPduId);
+   }
 }
 
 /**********************************************************************************************************************/
@@ -142,6 +148,13 @@ STATIC void CCPUSR_vidRxIndication_CRO(PduIdType RxPduId, PduInfoType *PduInfoPt
 
    COMPILER_UNUSED_PARAMETER(RxPduId);
 
+#if (CCPUSR_coXCP == CCP_coACVD)
+   /* XCP commands share the CRO frame: they are identified by their first byte */
+   if (CCPUSR_bXcpRxInd(PduInfoPtr->SduDataPtr) == TRUE)
+   {
+      return;
+   }
+#endif
    /* Store received data */
    for (u8LocCounter = 0; u8LocCounter < 8; u8LocCounter++)
    {
@@ -169,6 +182,9 @@ void CCP_UsrRxInd_CRO(PduIdType RxPduId, PduInfoType *PduInfoPtr)
 STATIC void CCPUSR_vidTxConfirmation_DTO(PduIdType CanTxPduId)
 {
    COMPILER_UNUSED_PARAMETER(CanTxPduId);
+#if (CCPUSR_coXCP == CCP_coACVD)
+   CCPUSR_vidXcpTxConf();
+#endif
    if (CCPUSR_enuCalStoreStatus == CCPUSR_CAL_STORE_REQUESTED)
    {
       CCPUSR_enuCalStoreStatus = CCPUSR_CAL_STORE_WAIT_CONDITION;
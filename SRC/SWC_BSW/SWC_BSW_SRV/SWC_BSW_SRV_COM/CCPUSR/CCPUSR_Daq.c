@@ -61,6 +61,9 @@
 #define CCPUSR_U16_SIZE 2
 #define CCPUSR_U32_SIZE 4
 
+/* !Comment: Number of ODTs of all the DAQ lists */
+#define CCPUSR_u16DAQ_NO_ODTS (CCP_u16DAQ_NO_ELMS / CCP_u8DAQ_NO_ELMS_PER_ODT)
+
 
 /**********************************************************************************************************************/
 /* TYPES                                                                                                              */
@@ -88,6 +91,14 @@ CCPUSR_tstrDaqListData;
       /*           (guaranted by caller)                                                                              */
       uint8 u8ListIdx
    );
+
+   static FUNC(void, CCP_USR_CODE) CCPUSR_vidDaqOdtRngUpd
+   (
+      /* !Comment: Absolute ODT index                                                                                 */
+      /* !Range:   0..(CCPUSR_u16DAQ_NO_ODTS-1)                                                                       */
+      /*           (guaranted by caller)                                                                              */
+      uint16_least u16OdtIdx
+   );
 #endif /* (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD) */
 
 #define CCP_STOP_SEC_CODE
@@ -110,6 +121,16 @@ static P2VAR(uint8, AUTOMATIC, CCP_APPL_DATA) CCPUSR_apu8DaqListElmAdr[CCP_u16DA
 
 static CCPUSR_tstrDaqListData CCPUSR_astrDaqListData[CCP_u8DAQ_NO_LISTS];
 
+static CCPUSR_tstrDaqOdtRng CCPUSR_astrDaqOdtRng[CCPUSR_u16DAQ_NO_ODTS];
+
+#if (CCPUSR_coDAQ_SMPL_COST_MEAS == CCP_coACVD)
+   /* !Comment: Sampling cost accumulated over the current cycle of each DAQ list (STM0 ticks)                         */
+   static uint32 CCPUSR_au32DaqSmplCostAcc[CCP_u8DAQ_NO_LISTS];
+
+   VAR(uint32, CCP_VAR) CCPUSR_au32DaqSmplCost[CCP_u8DAQ_NO_LISTS];
+   VAR(uint32, CCP_VAR) CCPUSR_au32DaqSmplCostMax[CCP_u8DAQ_NO_LISTS];
+#endif
+
 static uint8 CCPUSR_u8DaqListInvalidData = 0;
 
 /* !Comment: Priority used to define which daqlist is authorized to transmit its ODTs.                                */
@@ -132,12 +153,23 @@ static volatile uint8 CCPUSR_vu8DaqListPrio = UINT8_MAX;
    /*******************************************************************************************************************/
    FUNC(void, CCP_USR_CODE) CCPUSR_vidDaqListIni(void)
    {
-      uint8 u8LocalListIdx;
+      uint8        u8LocalListIdx;
+      uint16_least u16LocalOdtIdx;
 
 
       for (u8LocalListIdx = 0; u8LocalListIdx < CCP_u8DAQ_NO_LISTS; u8LocalListIdx++)
       {
          CCPUSR_astrDaqListData[u8LocalListIdx].u8OdtToTxIdx = UINT8_MAX;
+         #if (CCPUSR_coDAQ_SMPL_COST_MEAS == CCP_coACVD)
+            CCPUSR_au32DaqSmplCostAcc[u8LocalListIdx] = 0;
+            CCPUSR_au32DaqSmplCost[u8LocalListIdx]    = 0;
+            CCPUSR_au32DaqSmplCostMax[u8LocalListIdx] = 0;
+         #endif
+      }
+
+      for (u16LocalOdtIdx = 0; u16LocalOdtIdx < CCPUSR_u16DAQ_NO_ODTS; u16LocalOdtIdx++)
+      {
+         CCPUSR_astrDaqOdtRng[u16LocalOdtIdx].u8NrOfRng = 0;
       }
    }
 
@@ -204,6 +236,13 @@ static volatile uint8 CCPUSR_vu8DaqListPrio = UINT8_MAX;
             CCPUSR_au8DaqListElmVal[u16LocalElmIdx] = 0;
          #endif
       }
+
+      for (u16LocalElmIdx = (u16LocalFirstElmIdx / CCP_u8DAQ_NO_ELMS_PER_ODT);
+           u16LocalElmIdx <= (u16LocalLastElmIdx / CCP_u8DAQ_NO_ELMS_PER_ODT);
+           u16LocalElmIdx++)
+      {
+         CCPUSR_astrDaqOdtRng[u16LocalElmIdx].u8NrOfRng = 0;
+      }
    }
 
    /*******************************************************************************************************************/
@@ -293,6 +332,8 @@ static volatile uint8 CCPUSR_vu8DaqListPrio = UINT8_MAX;
          }
          pu8LocalElmSize[u8ElmIdx] = u8ElmSize;
       #endif /* (CCP_coDAQ_ELM_SIZE_MAX == CCP_coDAQ_ELM_SIZE_MAX_8_BITS) */
+
+      CCPUSR_vidDaqOdtRngUpd(u16LocalFirstElmIdx / CCP_u8DAQ_NO_ELMS_PER_ODT);
       return (CCP_udtCMD_STS_NO_ERR);
    }
 
@@ -319,11 +360,13 @@ static volatile uint8 CCPUSR_vu8DaqListPrio = UINT8_MAX;
       P2VAR(CCPUSR_tstrDaqListData, AUTOMATIC, CCP_APPL_DATA)                    pstrLocalDaqListData;
       /* !Range: 0..((254*7)-1)                                                                                       */
       uint16_least                                                               u16LocalFirstElmIdx;
-      /* !Range: 0..((254*7)-1)                                                                                       */
       #if (CCP_coDAQ_FILL_WHOLE_LIST == CCP_coACVD)
-         P2VAR(P2VAR(uint8, AUTOMATIC, CCP_APPL_DATA), AUTOMATIC, CCP_APPL_DATA) ppu8LocalElmAdr;
          P2VAR(uint8, AUTOMATIC, CCP_APPL_DATA)                                  pu8LocalBufDst;
          uint8_least                                                             u8LocalOdtIdx;
+         #if (CCPUSR_coDAQ_SMPL_COST_MEAS == CCP_coACVD)
+            uint32                                                               u32LocalSmplStrtTi;
+            uint32                                                               u32LocalSmplCost;
+         #endif
       #endif
 
 
@@ -343,35 +386,28 @@ static volatile uint8 CCPUSR_vu8DaqListPrio = UINT8_MAX;
       pstrLocalDaqListData->u16ElmToTxIdx = (uint16)u16LocalFirstElmIdx;
 
       #if (CCP_coDAQ_FILL_WHOLE_LIST == CCP_coACVD)
-         pu8LocalBufDst  = &CCPUSR_au8DaqListElmVal[u16LocalFirstElmIdx];
-         ppu8LocalElmAdr = &CCPUSR_apu8DaqListElmAdr[u16LocalFirstElmIdx];
+         pu8LocalBufDst = &CCPUSR_au8DaqListElmVal[u16LocalFirstElmIdx];
 
+         #if (CCPUSR_coDAQ_SMPL_COST_MEAS == CCP_coACVD)
+            u32LocalSmplStrtTi = CCPUSR_u32GET_TIME_STAMP();
+         #endif
          for (u8LocalOdtIdx = 0; u8LocalOdtIdx <= u8OdtLstIdx; u8LocalOdtIdx++)
          {
             CCPUSR_vidCRIT_SECT_ENTER();
-            *pu8LocalBufDst = *(*ppu8LocalElmAdr);
-            pu8LocalBufDst++;
-            ppu8LocalElmAdr++;
-            *pu8LocalBufDst = *(*ppu8LocalElmAdr);
-            pu8LocalBufDst++;
-            ppu8LocalElmAdr++;
-            *pu8LocalBufDst = *(*ppu8LocalElmAdr);
-            pu8LocalBufDst++;
-            ppu8LocalElmAdr++;
-            *pu8LocalBufDst = *(*ppu8LocalElmAdr);
-            pu8LocalBufDst++;
-            ppu8LocalElmAdr++;
-            *pu8LocalBufDst = *(*ppu8LocalElmAdr);
-            pu8LocalBufDst++;
-            ppu8LocalElmAdr++;
-            *pu8LocalBufDst = *(*ppu8LocalElmAdr);
-            pu8LocalBufDst++;
-            ppu8LocalElmAdr++;
-            *pu8LocalBufDst = *(*ppu8LocalElmAdr);
-            pu8LocalBufDst++;
-            ppu8LocalElmAdr++;
+            CCPUSR_vidDaqRngSmpl(&CCPUSR_astrDaqOdtRng[(uint16_least)u8FirstPid + u8LocalOdtIdx], pu8LocalBufDst);
             CCPUSR_vidCRIT_SECT_EXIT();
+            pu8LocalBufDst += CCP_u8DAQ_NO_ELMS_PER_ODT;
          }
+         #if (CCPUSR_coDAQ_SMPL_COST_MEAS == CCP_coACVD)
+            u32LocalSmplCost                  = CCPUSR_u32GET_TIME_STAMP() - u32LocalSmplStrtTi;
+            CCPUSR_au32DaqSmplCost[u8ListIdx] = u32LocalSmplCost;
+            if (u32LocalSmplCost > CCPUSR_au32DaqSmplCostMax[u8ListIdx])
+            {
+               CCPUSR_au32DaqSmplCostMax[u8ListIdx] = u32LocalSmplCost;
+            }
+         #endif
+      #elif (CCPUSR_coDAQ_SMPL_COST_MEAS == CCP_coACVD)
+         CCPUSR_au32DaqSmplCostAcc[u8ListIdx] = 0;
       #endif
    }
 
@@ -395,8 +431,9 @@ static volatile uint8 CCPUSR_vu8DaqListPrio = UINT8_MAX;
       P2VAR(uint8, AUTOMATIC, CCP_APPL_DATA)                                     pu8LocalBufDst;
       #if (CCP_coDAQ_FILL_WHOLE_LIST == CCP_coACVD)
          P2VAR(uint8, AUTOMATIC, CCP_APPL_DATA)                                  pu8LocalBufSrc;
-      #else
-         P2VAR(P2VAR(uint8, AUTOMATIC, CCP_APPL_DATA), AUTOMATIC, CCP_APPL_DATA) ppu8LocalElmAdr;
+      #elif (CCPUSR_coDAQ_SMPL_COST_MEAS == CCP_coACVD)
+         uint32                                                                  u32LocalSmplStrtTi;
+         uint32                                                                  u32LocalSmplCost;
       #endif
 
       u8LocalListPrio = CCPUSR_vu8DaqListPrio;
@@ -437,29 +474,19 @@ static volatile uint8 CCPUSR_vu8DaqListPrio = UINT8_MAX;
          pu8LocalBufSrc++;
          *pu8LocalBufDst = *pu8LocalBufSrc;
       #else
-         ppu8LocalElmAdr = &CCPUSR_apu8DaqListElmAdr[u16LocalFirstElmIdx];
+         /* Bytes which are not configured are transmitted as 0 */
+         uniLocalDaqBuf.au32Data[0] = 0;
+         uniLocalDaqBuf.au32Data[1] = 0;
 
+         #if (CCPUSR_coDAQ_SMPL_COST_MEAS == CCP_coACVD)
+            u32LocalSmplStrtTi = CCPUSR_u32GET_TIME_STAMP();
+         #endif
          CCPUSR_vidCRIT_SECT_ENTER();
-         *pu8LocalBufDst = *(*ppu8LocalElmAdr);
-         pu8LocalBufDst++;
-         ppu8LocalElmAdr++;
-         *pu8LocalBufDst = *(*ppu8LocalElmAdr);
-         pu8LocalBufDst++;
-         ppu8LocalElmAdr++;
-         *pu8LocalBufDst = *(*ppu8LocalElmAdr);
-         pu8LocalBufDst++;
-         ppu8LocalElmAdr++;
-         *pu8LocalBufDst = *(*ppu8LocalElmAdr);
-         pu8LocalBufDst++;
-         ppu8LocalElmAdr++;
-         *pu8LocalBufDst = *(*ppu8LocalElmAdr);
-         pu8LocalBufDst++;
-         ppu8LocalElmAdr++;
-         *pu8LocalBufDst = *(*ppu8LocalElmAdr);
-         pu8LocalBufDst++;
-         ppu8LocalElmAdr++;
-         *pu8LocalBufDst = *(*ppu8LocalElmAdr);
+         CCPUSR_vidDaqRngSmpl(&CCPUSR_astrDaqOdtRng[u16LocalFirstElmIdx / CCP_u8DAQ_NO_ELMS_PER_ODT], pu8LocalBufDst);
          CCPUSR_vidCRIT_SECT_EXIT();
+         #if (CCPUSR_coDAQ_SMPL_COST_MEAS == CCP_coACVD)
+            CCPUSR_au32DaqSmplCostAcc[u8ListIdx] += CCPUSR_u32GET_TIME_STAMP() - u32LocalSmplStrtTi;
+         #endif
       #endif
       }
 
@@ -468,6 +495,16 @@ static volatile uint8 CCPUSR_vu8DaqListPrio = UINT8_MAX;
 
       if (pstrLocalDaqListData->u8OdtToTxIdx > pstrLocalDaqListData->u8OdtLstIdx)
       {
+         #if (  (CCP_coDAQ_FILL_WHOLE_LIST != CCP_coACVD)                                                              \
+             && (CCPUSR_coDAQ_SMPL_COST_MEAS == CCP_coACVD))
+            u32LocalSmplCost                     = CCPUSR_au32DaqSmplCostAcc[u8ListIdx];
+            CCPUSR_au32DaqSmplCostAcc[u8ListIdx] = 0;
+            CCPUSR_au32DaqSmplCost[u8ListIdx]    = u32LocalSmplCost;
+            if (u32LocalSmplCost > CCPUSR_au32DaqSmplCostMax[u8ListIdx])
+            {
+               CCPUSR_au32DaqSmplCostMax[u8ListIdx] = u32LocalSmplCost;
+            }
+         #endif
          CCPUSR_vidDaqListSrchNextActvDaqList(u8ListIdx);
          return(TRUE);
       }
@@ -523,6 +560,150 @@ static volatile uint8 CCPUSR_vu8DaqListPrio = UINT8_MAX;
       }
    }
 
+   /*******************************************************************************************************************/
+   /* !Description: Compile the element addresses of an ODT into contiguous address ranges                            */
+   /*******************************************************************************************************************/
+   /* !Comment: The ranges are compiled aside and published in one copy inside the critical section, so that a DAQ    */
+   /*           sampling never sees a mix of the old and new ranges of the ODT.                                       */
+   static FUNC(void, CCP_USR_CODE) CCPUSR_vidDaqOdtRngUpd
+   (
+      /* !Comment: Absolute ODT index                                                                                 */
+      /* !Range:   0..(CCPUSR_u16DAQ_NO_ODTS-1)                                                                       */
+      /*           (guaranted by caller)                                                                              */
+      uint16_least u16OdtIdx
+   )
+   {
+      P2VAR(P2VAR(uint8, AUTOMATIC, CCP_APPL_DATA), AUTOMATIC, CCP_APPL_DATA) ppu8LocalElmAdr;
+      P2VAR(uint8, AUTOMATIC, CCP_APPL_DATA)                                  pu8LocalAdr;
+      uint8_least                                                             u8LocalElmIdx;
+      CCPUSR_tstrDaqOdtRng                                                    strLocalOdtRng;
+
+
+      ppu8LocalElmAdr          = &CCPUSR_apu8DaqListElmAdr[u16OdtIdx * CCP_u8DAQ_NO_ELMS_PER_ODT];
+      strLocalOdtRng.u8NrOfRng = 0;
+
+      for (u8LocalElmIdx = 0; u8LocalElmIdx < CCP_u8DAQ_NO_ELMS_PER_ODT; u8LocalElmIdx++)
+      {
+         pu8LocalAdr = ppu8LocalElmAdr[u8LocalElmIdx];
+         if (pu8LocalAdr != &CCPUSR_u8DaqListInvalidData)
+         {
+            CCPUSR_vidDaqRngAdd(&strLocalOdtRng, pu8LocalAdr, (uint8)u8LocalElmIdx, CCPUSR_U8_SIZE);
+         }
+      }
+
+      CCPUSR_vidCRIT_SECT_ENTER();
+      CCPUSR_astrDaqOdtRng[u16OdtIdx] = strLocalOdtRng;
+      CCPUSR_vidCRIT_SECT_EXIT();
+   }
+
+   /*******************************************************************************************************************/
+   /* !Description: Append a source address range to the compiled ranges of an ODT                                   */
+   /*******************************************************************************************************************/
+   /* !Comment: Ranges are appended in increasing ODT offset order. A range adjacent both in memory and in the ODT to  */
+   /*           the last one extends it.                                                                              */
+   FUNC(void, CCP_USR_CODE) CCPUSR_vidDaqRngAdd
+   (
+      /* !Comment: Compiled ranges of the ODT                                                                         */
+      P2VAR(CCPUSR_tstrDaqOdtRng, AUTOMATIC, CCP_APPL_DATA) pstrOdtRng,
+      /* !Comment: Source address of the range                                                                        */
+      P2VAR(uint8, AUTOMATIC, CCP_APPL_DATA)                pu8Src,
+      /* !Comment: Offset of the range within the ODT                                                                 */
+      /* !Range:   0..(CCP_u8DAQ_NO_ELMS_PER_ODT-1)                                                                   */
+      /*           (guaranted by caller)                                                                              */
+      uint8                                                 u8DstOfs,
+      /* !Comment: Number of bytes of the range                                                                       */
+      /* !Range:   1..(CCP_u8DAQ_NO_ELMS_PER_ODT-u8DstOfs)                                                            */
+      /*           (guaranted by caller)                                                                              */
+      uint8                                                 u8Len
+   )
+   {
+      P2VAR(CCPUSR_tstrDaqRng, AUTOMATIC, CCP_APPL_DATA) pstrLocalRng;
+
+
+      pstrLocalRng = &pstrOdtRng->astrRng[pstrOdtRng->u8NrOfRng];
+      if (  (pstrOdtRng->u8NrOfRng > 0)
+         && ((pstrLocalRng[-1].pu8Src + pstrLocalRng[-1].u8Len) == pu8Src)
+         && ((pstrLocalRng[-1].u8DstOfs + pstrLocalRng[-1].u8Len) == u8DstOfs))
+      {
+         pstrLocalRng[-1].u8Len += u8Len;
+      }
+      else
+      {
+         pstrLocalRng->pu8Src   = pu8Src;
+         pstrLocalRng->u8DstOfs = u8DstOfs;
+         pstrLocalRng->u8Len    = u8Len;
+         pstrOdtRng->u8NrOfRng++;
+      }
+   }
+
+   /*******************************************************************************************************************/
+   /* !Description: Sample the address ranges of an ODT, using the widest aligned accesses                            */
+   /*******************************************************************************************************************/
+   /* !Comment: Words and half-words are read with a single access (consistent sampling of 16/32-bit variables) and   */
+   /*           stored byte per byte in little endian order, as the destination is not aligned.                       */
+   FUNC(void, CCP_USR_CODE) CCPUSR_vidDaqRngSmpl
+   (
+      /* !Comment: Compiled ranges of the ODT                                                                         */
+      P2CONST(CCPUSR_tstrDaqOdtRng, AUTOMATIC, CCP_APPL_DATA) pkstrOdtRng,
+      /* !Comment: Destination of the CCP_u8DAQ_NO_ELMS_PER_ODT sampled bytes                                         */
+      P2VAR(uint8, AUTOMATIC, CCP_APPL_DATA)                  pu8Dst
+   )
+   {
+      P2CONST(CCPUSR_tstrDaqRng, AUTOMATIC, CCP_APPL_DATA) pkstrLocalRng;
+      P2CONST(uint8, AUTOMATIC, CCP_APPL_DATA)             pku8LocalSrc;
+      P2VAR(uint8, AUTOMATIC, CCP_APPL_DATA)               pu8LocalDst;
+      uint8_least                                          u8LocalNrOfRng;
+      uint8_least                                          u8LocalLen;
+      uint32                                               u32LocalVal;
+
+
+      pkstrLocalRng  = &pkstrOdtRng->astrRng[0];
+      u8LocalNrOfRng = pkstrOdtRng->u8NrOfRng;
+
+      while (u8LocalNrOfRng > 0)
+      {
+         pku8LocalSrc = pkstrLocalRng->pu8Src;
+         pu8LocalDst  = &pu8Dst[pkstrLocalRng->u8DstOfs];
+         u8LocalLen   = pkstrLocalRng->u8Len;
+
+         while (u8LocalLen > 0)
+         {
+            if (  (u8LocalLen >= CCPUSR_U32_SIZE)
+               && ((((uint32)pku8LocalSrc) & (CCPUSR_U32_SIZE - 1)) == 0))
+            {
+               u32LocalVal    = *((P2CONST(uint32, AUTOMATIC, CCP_APPL_DATA))pku8LocalSrc);
+               pu8LocalDst[0] = (uint8)u32LocalVal;
+               pu8LocalDst[1] = (uint8)(u32LocalVal >> 8);
+               pu8LocalDst[2] = (uint8)(u32LocalVal >> 16);
+               pu8LocalDst[3] = (uint8)(u32LocalVal >> 24);
+               pku8LocalSrc  += CCPUSR_U32_SIZE;
+               pu8LocalDst   += CCPUSR_U32_SIZE;
+               u8LocalLen    -= CCPUSR_U32_SIZE;
+            }
+            else if (  (u8LocalLen >= CCPUSR_U16_SIZE)
+                    && ((((uint32)pku8LocalSrc) & (CCPUSR_U16_SIZE - 1)) == 0))
+            {
+               u32LocalVal    = *((P2CONST(uint16, AUTOMATIC, CCP_APPL_DATA))pku8LocalSrc);
+               pu8LocalDst[0] = (uint8)u32LocalVal;
+               pu8LocalDst[1] = (uint8)(u32LocalVal >> 8);
+               pku8LocalSrc  += CCPUSR_U16_SIZE;
+               pu8LocalDst   += CCPUSR_U16_SIZE;
+               u8LocalLen    -= CCPUSR_U16_SIZE;
+            }
+            else
+            {
+               *pu8LocalDst = *pku8LocalSrc;
+               pku8LocalSrc++;
+               pu8LocalDst++;
+               u8LocalLen--;
+            }
+         }
+
+         pkstrLocalRng++;
+         u8LocalNrOfRng--;
+      }
+   }
+
    /*******************************************************************************************************************/
    /* !Description: Signal an overrun of the DAQ list                                                                 */
    /*******************************************************************************************************************/
@@ -31,6 +31,52 @@
 #ifndef CCPUSR_DAQ_H
 #define CCPUSR_DAQ_H
 
+#include "CCPUSR_Daq_Cfg.h"
+
+/**********************************************************************************************************************/
+/* TYPES                                                                                                              */
+/**********************************************************************************************************************/
+#if (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD)
+   /* !Comment: Contiguous source address range sampled into an ODT                                                   */
+   typedef struct
+   {
+      P2VAR(uint8, AUTOMATIC, CCP_APPL_DATA) pu8Src;
+      /* !Comment: Offset of the range within the ODT                                                                 */
+      /* !Range:   0..(CCP_u8DAQ_NO_ELMS_PER_ODT-1)                                                                   */
+      uint8                                  u8DstOfs;
+      /* !Comment: Number of bytes of the range                                                                       */
+      /* !Range:   1..CCP_u8DAQ_NO_ELMS_PER_ODT                                                                       */
+      uint8                                  u8Len;
+   }
+   CCPUSR_tstrDaqRng;
+
+   /* !Comment: ODT configuration compiled into contiguous address ranges, shared by the CCP and XCP DAQ lists         */
+   typedef struct
+   {
+      /* !Range:   0..CCP_u8DAQ_NO_ELMS_PER_ODT                                                                       */
+      uint8             u8NrOfRng;
+      CCPUSR_tstrDaqRng astrRng[CCP_u8DAQ_NO_ELMS_PER_ODT];
+   }
+   CCPUSR_tstrDaqOdtRng;
+#endif /* (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD) */
+
+/**********************************************************************************************************************/
+/* DATA DECLARATION                                                                                                   */
+/**********************************************************************************************************************/
+#if (  (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD)                                                                           \
+    && (CCPUSR_coDAQ_SMPL_COST_MEAS == CCP_coACVD))
+   #define CCP_START_SEC_VAR_UNSPECIFIED
+   #include "Ccp_MemMap.h"
+
+   /* !Comment: Sampling cost of the last complete cycle of each DAQ list (STM0 ticks, 0.01us)                        */
+   extern VAR(uint32, CCP_VAR) CCPUSR_au32DaqSmplCost[CCP_u8DAQ_NO_LISTS];
+   /* !Comment: Maximum sampling cost of a complete cycle of each DAQ list since initialisation (STM0 ticks, 0.01us)  */
+   extern VAR(uint32, CCP_VAR) CCPUSR_au32DaqSmplCostMax[CCP_u8DAQ_NO_LISTS];
+
+   #define CCP_STOP_SEC_VAR_UNSPECIFIED
+   #include "Ccp_MemMap.h"
+#endif
+
 /**********************************************************************************************************************/
 /* FUNCTIONS DECLARATION                                                                                              */
 /**********************************************************************************************************************/
@@ -39,6 +85,20 @@
 
 #if (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD)
    FUNC(void, CCP_USR_CODE) CCPUSR_vidDaqListIni(void);
+
+   FUNC(void, CCP_USR_CODE) CCPUSR_vidDaqRngAdd
+   (
+      P2VAR(CCPUSR_tstrDaqOdtRng, AUTOMATIC, CCP_APPL_DATA) pstrOdtRng,
+      P2VAR(uint8, AUTOMATIC, CCP_APPL_DATA)                pu8Src,
+      uint8                                                 u8DstOfs,
+      uint8                                                 u8Len
+   );
+
+   FUNC(void, CCP_USR_CODE) CCPUSR_vidDaqRngSmpl
+   (
+      P2CONST(CCPUSR_tstrDaqOdtRng, AUTOMATIC, CCP_APPL_DATA) pkstrOdtRng,
+      P2VAR(uint8, AUTOMATIC, CCP_APPL_DATA)                  pu8Dst
+   );
 #endif /* (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD) */
 
 #define CCP_STOP_SEC_CODE
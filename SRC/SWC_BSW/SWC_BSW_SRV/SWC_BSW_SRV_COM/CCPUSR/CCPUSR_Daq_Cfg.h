@@ -31,11 +31,24 @@
 #ifndef CCPUSR_DAQ_CFG_H
 #define CCPUSR_DAQ_CFG_H
 
+/**********************************************************************************************************************/
+/* DEFINES                                                                                                            */
+/**********************************************************************************************************************/
+/* !Comment: Measurement of the DAQ list sampling cost (CCP_coACVD / CCP_coDEACVD)                                    */
+#define CCPUSR_coDAQ_SMPL_COST_MEAS CCP_coACVD
+
+#include "IfxStm_reg.h"
+#include "Os_api.h"
+
 /**********************************************************************************************************************/
 /* MACRO FUNCTIONS                                                                                                    */
 /**********************************************************************************************************************/
-#define CCPUSR_vidCRIT_SECT_ENTER()
-#define CCPUSR_vidCRIT_SECT_EXIT()
+/* !Comment: Protects the sampling of an ODT against the update of its ranges by a command (CAN Rx context)         */
+#define CCPUSR_vidCRIT_SECT_ENTER() SuspendAllInterrupts()
+#define CCPUSR_vidCRIT_SECT_EXIT()  ResumeAllInterrupts()
+
+/* !Comment: Free running STM0 time base (100 MHz) used for the sampling cost and checksum time measurements         */
+#define CCPUSR_u32GET_TIME_STAMP() ((uint32)MODULE_STM0.TIM0.U)
 
 #endif /* CCPUSR_DAQ_CFG_H */
 
@@ -0,0 +1,1159 @@
+/************************************************* <AUTO_FILE_HEADER> *************************************************/
+/*                                                                                                                    */
+/* !Layer           : SRVL                                                                                            */
+/*                                                                                                                    */
+/* !Component       : CCP                                                                                             */
+/*                                                                                                                    */
+/* !Module          : CCPUSR                                                                                          */
+/* !Description     : XCP on CAN slave sharing the CCP CanIf PDUs and DAQ sampling                                    */
+/*                                                                                                                    */
+/* !File            : CCPUSR_Xcp.c                                                                                    */
+/*                                                                                                                    */
+/* !Target          : All                                                                                             */
+/*                                                                                                                    */
+/* !Vendor          : Valeo                                                                                           */
+/*                                                                                                                    */
+/* Coding language  : C                                                                                               */
+/*                                                                                                                    */
+/* COPYRIGHT 2009 VALEO                                                                                               */
+/* all rights reserved                                                                                                */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+/************************************************ </AUTO_FILE_HEADER> *************************************************/
+/* PVCS Information                                                                                                   */
+/* $Archive::   P:/VE_S97/LOG/60_ComponentArchive/Archives/COMP_SWC_BSW_MCAL_MPC5676/Mcal.c_v                        $*/
+/* $Revision::   1.7                                                                                                 $*/
+/* $Author::   vbecquet                               $$Date::   14 Jun 2012 13:43:52                                $*/
+/**********************************************************************************************************************/
+
+
+#include "Std_Types.h"
+#include "Ccp.h"
+#include "Ccp_L.h"
+#include "CCP_Usr.h"
+#include "CCPUSR.h"
+#include "CCPUSR_Cfg.h"
+#include "CCPUSR_CanIf_Cfg.h"
+#include "CCPUSR_Daq.h"
+#include "CCPUSR_Daq_Cfg.h"
+#include "CCPUSR_Xcp.h"
+#include "CCPUSR_Xcp_Cfg.h"
+
+#if (CCPUSR_coXCP == CCP_coACVD)
+
+/**********************************************************************************************************************/
+/* Check the configuration                                                                                            */
+/**********************************************************************************************************************/
+#if (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD)
+   #if (CCPUSR_u8XCP_DAQ_NO_LISTS > CCP_u8DAQ_NO_LISTS)
+      #error CCPUSR_u8XCP_DAQ_NO_LISTS exceeds the number of CCP DAQ list PDUs
+   #endif
+   #if (CCPUSR_u8XCP_DAQ_NO_ODTS > 0xC0)
+      #error CCPUSR_u8XCP_DAQ_NO_ODTS exceeds the PID range of the DAQ packets
+   #endif
+   #if (((0x10000UL << CCPUSR_u8XCP_TS_SHIFT) / 100UL) <= CCPUSR_u32XCP_EVE_PERIOD_MAX_US)
+      #error The 16-bit DAQ timestamp wraps within the period of the slowest DAQ event
+   #endif
+#endif
+
+
+/**********************************************************************************************************************/
+/* DEFINES                                                                                                            */
+/**********************************************************************************************************************/
+/* !Comment: Commands (the first byte of a CRO frame is an XCP command when >= CCPUSR_u8XCP_CMD_MIN)                  */
+#define CCPUSR_u8XCP_CMD_MIN                  0xC0
+#define CCPUSR_u8XCP_CMD_CNCT                 0xFF
+#define CCPUSR_u8XCP_CMD_DCNCT                0xFE
+#define CCPUSR_u8XCP_CMD_GET_STS              0xFD
+#define CCPUSR_u8XCP_CMD_SYNCH                0xFC
+#define CCPUSR_u8XCP_CMD_GET_COMM_MOD_INFO    0xFB
+#define CCPUSR_u8XCP_CMD_SET_MTA              0xF6
+#define CCPUSR_u8XCP_CMD_UPLD                 0xF5
+#define CCPUSR_u8XCP_CMD_SHO_UPLD             0xF4
+#define CCPUSR_u8XCP_CMD_DNLD                 0xF0
+#define CCPUSR_u8XCP_CMD_DNLD_NEXT            0xEF
+#define CCPUSR_u8XCP_CMD_DNLD_MAX             0xEE
+#define CCPUSR_u8XCP_CMD_SET_DAQ_PTR          0xE2
+#define CCPUSR_u8XCP_CMD_WR_DAQ               0xE1
+#define CCPUSR_u8XCP_CMD_SET_DAQ_LIST_MOD     0xE0
+#define CCPUSR_u8XCP_CMD_GET_DAQ_LIST_MOD     0xDF
+#define CCPUSR_u8XCP_CMD_STRT_STOP_DAQ_LIST   0xDE
+#define CCPUSR_u8XCP_CMD_STRT_STOP_SYNCH      0xDD
+#define CCPUSR_u8XCP_CMD_GET_DAQ_CLK          0xDC
+#define CCPUSR_u8XCP_CMD_GET_DAQ_PROC_INFO    0xDA
+#define CCPUSR_u8XCP_CMD_GET_DAQ_RESOL_INFO   0xD9
+#define CCPUSR_u8XCP_CMD_FREE_DAQ             0xD6
+#define CCPUSR_u8XCP_CMD_ALLOC_DAQ            0xD5
+#define CCPUSR_u8XCP_CMD_ALLOC_ODT            0xD4
+#define CCPUSR_u8XCP_CMD_ALLOC_ODT_ENTRY      0xD3
+
+/* !Comment: Packet identifiers of the responses                                                                      */
+#define CCPUSR_u8XCP_PID_RES                  0xFF
+#define CCPUSR_u8XCP_PID_ERR                  0xFE
+
+/* !Comment: Command status. Values other than OK and NO_RESP are the error codes of the negative response            */
+#define CCPUSR_u8XCP_STS_OK                   0xFF
+#define CCPUSR_u8XCP_STS_NO_RESP              0xFE
+#define CCPUSR_u8XCP_ERR_CMD_SYNCH            0x00
+#define CCPUSR_u8XCP_ERR_CMD_BUSY             0x10
+#define CCPUSR_u8XCP_ERR_DAQ_ACTV             0x11
+#define CCPUSR_u8XCP_ERR_CMD_UNKNOWN          0x20
+#define CCPUSR_u8XCP_ERR_CMD_SYNTAX           0x21
+#define CCPUSR_u8XCP_ERR_OUT_OF_RNG           0x22
+#define CCPUSR_u8XCP_ERR_ACS_DENIED           0x24
+#define CCPUSR_u8XCP_ERR_MOD_NOT_VALID        0x27
+#define CCPUSR_u8XCP_ERR_SEQ                  0x29
+#define CCPUSR_u8XCP_ERR_DAQ_CFG              0x2A
+#define CCPUSR_u8XCP_ERR_MEM_OVF              0x30
+
+/* !Comment: CONNECT response: CAL_PG and DAQ resources, Intel byte order, byte granularity, slave block mode         */
+#if (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD)
+   #define CCPUSR_u8XCP_RSRC                  0x05
+#else
+   #define CCPUSR_u8XCP_RSRC                  0x01
+#endif
+#define CCPUSR_u8XCP_COMM_MOD_BASIC           0xC0
+#define CCPUSR_u8XCP_COMM_MOD_OPT             0x01
+#define CCPUSR_u8XCP_PROT_VER                 0x01
+#define CCPUSR_u8XCP_TRSP_VER                 0x01
+#define CCPUSR_u8XCP_DRV_VER                  0x10
+
+/* !Comment: Frame layout: packet identifier followed by up to 7 bytes                                                */
+#define CCPUSR_u8XCP_FRM_SIZE                 8
+#define CCPUSR_u8XCP_UPLD_PER_FRM             7
+#define CCPUSR_u8XCP_DNLD_PER_FRM             6
+#define CCPUSR_u8XCP_DNLD_MAX_PER_FRM         7
+
+/* !Comment: DAQ list mode bits                                                                                       */
+#define CCPUSR_u8XCP_DAQ_MOD_SELD             0x01
+#define CCPUSR_u8XCP_DAQ_MOD_TS               0x10
+#define CCPUSR_u8XCP_DAQ_MOD_RUNNING          0x40
+#define CCPUSR_u8XCP_SSN_STS_DAQ_RUNNING      0x40
+
+/* !Comment: DAQ processor: dynamic configuration, prescaler and timestamp supported, absolute ODT number as PID       */
+#define CCPUSR_u8XCP_DAQ_PROPS                0x13
+#define CCPUSR_u8XCP_DAQ_KEY                  0x00
+/* !Comment: DAQ timestamp: 2 bytes, unit 10ns, (1 << CCPUSR_u8XCP_TS_SHIFT) units per tick                          */
+#define CCPUSR_u8XCP_TS_MOD                   0x12
+#define CCPUSR_u8XCP_TS_SIZE                  2
+#define CCPUSR_u16XCP_TS_TICKS                ((uint16)(1U << CCPUSR_u8XCP_TS_SHIFT))
+/* !Comment: STM0 ticks per microsecond (100MHz), for the upload throughput                                           */
+#define CCPUSR_u32XCP_STM_TICKS_PER_US        100UL
+#define CCPUSR_u8XCP_ODT_ENTRY_SIZE_MAX       CCP_u8DAQ_NO_ELMS_PER_ODT
+
+
+/**********************************************************************************************************************/
+/* TYPES                                                                                                              */
+/**********************************************************************************************************************/
+#if (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD)
+   typedef struct
+   {
+      /* !Comment: Index of the first ODT in the ODT pool, which is also its PID                                      */
+      uint8 u8FirstOdt;
+      /* !Range:   0..CCPUSR_u8XCP_DAQ_NO_ODTS                                                                        */
+      uint8 u8NrOfOdt;
+      uint8 u8Mod;
+      uint8 u8EvtChn;
+      /* !Range:   1..255                                                                                             */
+      uint8 u8Prsc;
+      uint8 u8PrscCnt;
+      /* !Comment: Relative index of the ODT being transmitted (u8NrOfOdt when the list is idle)                      */
+      volatile uint8 vu8OdtToTxIdx;
+      uint8 u8Prio;
+   }
+   CCPUSR_tstrXcpDaqList;
+
+   typedef struct
+   {
+      CCPUSR_tstrDaqOdtRng strRng;
+      /* !Comment: Number of allocated / written ODT entries                                                          */
+      uint8                u8NrOfEntry;
+      uint8                u8NrOfWrEntry;
+      /* !Comment: Number of data bytes configured in the ODT                                                         */
+      uint8                u8Size;
+   }
+   CCPUSR_tstrXcpOdt;
+#endif /* (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD) */
+
+
+/**********************************************************************************************************************/
+/* DATA DEFINITION                                                                                                    */
+/**********************************************************************************************************************/
+#define CCP_START_SEC_VAR_UNSPECIFIED
+#include "Ccp_MemMap.h"
+
+VAR(uint32, CCP_VAR) CCPUSR_u32XcpUpldByteCnt;
+VAR(uint32, CCP_VAR) CCPUSR_u32XcpUpldTi;
+VAR(uint32, CCP_VAR) CCPUSR_u32XcpUpldThrput;
+VAR(uint32, CCP_VAR) CCPUSR_u32XcpDaqOvrnCnt;
+
+static boolean     CCPUSR_bXcpCnctd;
+static CCP_tstrMta CCPUSR_strXcpMta;
+
+/* !Comment: Slave block upload: data are read at once so that the whole block is consistent                          */
+static uint8          CCPUSR_au8XcpUpldBuf[UINT8_MAX];
+static uint8          CCPUSR_u8XcpUpldIdx;
+static volatile uint8 CCPUSR_vu8XcpUpldRmng;
+static uint32         CCPUSR_u32XcpUpldStrtTi;
+
+/* !Comment: Master block download: number of bytes still expected by DOWNLOAD_NEXT                                  */
+static uint8 CCPUSR_u8XcpDnldRmng;
+
+#if (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD)
+   static CCPUSR_tstrXcpDaqList CCPUSR_astrXcpDaqList[CCPUSR_u8XCP_DAQ_NO_LISTS];
+   static CCPUSR_tstrXcpOdt     CCPUSR_astrXcpOdt[CCPUSR_u8XCP_DAQ_NO_ODTS];
+   static uint8                 CCPUSR_au8XcpOdtBuf[CCPUSR_u8XCP_DAQ_NO_ODTS][CCPUSR_u8XCP_FRM_SIZE];
+   /* !Comment: Number of allocated DAQ lists and ODTs                                                                */
+   static uint8                 CCPUSR_u8XcpNrOfDaqList;
+   static uint8                 CCPUSR_u8XcpNrOfOdt;
+   /* !Comment: DAQ pointer set by SET_DAQ_PTR and incremented by WRITE_DAQ                                           */
+   static uint8                 CCPUSR_u8XcpDaqPtrList;
+   static uint8                 CCPUSR_u8XcpDaqPtrOdt;
+   static uint8                 CCPUSR_u8XcpDaqPtrEntry;
+#endif
+
+#define CCP_STOP_SEC_VAR_UNSPECIFIED
+#include "Ccp_MemMap.h"
+
+
+/**********************************************************************************************************************/
+/* INTERNAL FUNCTIONS DEFINITION                                                                                      */
+/**********************************************************************************************************************/
+#define CCP_START_SEC_CODE
+#include "Ccp_MemMap.h"
+
+/**********************************************************************************************************************/
+/* !Description: Read a 16-bit value in the slave byte order (Intel)                                                  */
+/**********************************************************************************************************************/
+static FUNC(uint16, CCP_USR_CODE) CCPUSR_u16XcpGetU16
+(
+   P2CONST(uint8, AUTOMATIC, CCP_APPL_DATA) pku8Data
+)
+{
+   return ((uint16)((uint16)pku8Data[0] | ((uint16)pku8Data[1] << 8)));
+}
+
+/**********************************************************************************************************************/
+/* !Description: Read a 32-bit value in the slave byte order (Intel)                                                  */
+/**********************************************************************************************************************/
+static FUNC(uint32, CCP_USR_CODE) CCPUSR_u32XcpGetU32
+(
+   P2CONST(uint8, AUTOMATIC, CCP_APPL_DATA) pku8Data
+)
+{
+   return (  (uint32)pku8Data[0]
+          | ((uint32)pku8Data[1] << 8)
+          | ((uint32)pku8Data[2] << 16)
+          | ((uint32)pku8Data[3] << 24));
+}
+
+/**********************************************************************************************************************/
+/* !Description: Send the next frame of a slave block upload                                                          */
+/**********************************************************************************************************************/
+static FUNC(void, CCP_USR_CODE) CCPUSR_vidXcpUpldTxFrm(void)
+{
+   uint8       au8LocalResp[CCPUSR_u8XCP_FRM_SIZE];
+   uint8_least u8LocalIdx;
+   uint8_least u8LocalLen;
+
+
+   au8LocalResp[0] = CCPUSR_u8XCP_PID_RES;
+   u8LocalLen      = CCPUSR_vu8XcpUpldRmng;
+   if (u8LocalLen > CCPUSR_u8XCP_UPLD_PER_FRM)
+   {
+      u8LocalLen = CCPUSR_u8XCP_UPLD_PER_FRM;
+   }
+   for (u8LocalIdx = 1; u8LocalIdx < CCPUSR_u8XCP_FRM_SIZE; u8LocalIdx++)
+   {
+      if (u8LocalIdx <= u8LocalLen)
+      {
+         au8LocalResp[u8LocalIdx] = CCPUSR_au8XcpUpldBuf[CCPUSR_u8XcpUpldIdx];
+         CCPUSR_u8XcpUpldIdx++;
+      }
+      else
+      {
+         au8LocalResp[u8LocalIdx] = 0;
+      }
+   }
+   CCPUSR_vu8XcpUpldRmng = (uint8)(CCPUSR_vu8XcpUpldRmng - u8LocalLen);
+   CCP_vidUsrTxCmdResp(au8LocalResp);
+}
+
+/**********************************************************************************************************************/
+/* !Description: UPLOAD and SHORT_UPLOAD: read the block and send its first frame, the next ones being sent on the    */
+/*               transmit confirmations                                                                               */
+/**********************************************************************************************************************/
+static FUNC(uint8, CCP_USR_CODE) CCPUSR_u8XcpUpld
+(
+   uint8 u8Len
+)
+{
+   if (u8Len == 0)
+   {
+      return (CCPUSR_u8XCP_ERR_OUT_OF_RNG);
+   }
+   if (CCP_udtUsrReadMem(CCP_u8USR_SRV_UPLD, &CCPUSR_strXcpMta, CCPUSR_au8XcpUpldBuf, u8Len) != CCP_udtCMD_STS_NO_ERR)
+   {
+      return (CCPUSR_u8XCP_ERR_ACS_DENIED);
+   }
+   CCPUSR_strXcpMta.u32Adr  += u8Len;
+   CCPUSR_u32XcpUpldByteCnt += u8Len;
+
+   CCPUSR_u8XcpUpldIdx   = 0;
+   CCPUSR_vu8XcpUpldRmng = u8Len;
+   CCPUSR_vidXcpUpldTxFrm();
+   return (CCPUSR_u8XCP_STS_NO_RESP);
+}
+
+/**********************************************************************************************************************/
+/* !Description: Write data at the MTA, which is post-incremented                                                     */
+/**********************************************************************************************************************/
+static FUNC(uint8, CCP_USR_CODE) CCPUSR_u8XcpWrMem
+(
+   P2CONST(uint8, AUTOMATIC, CCP_APPL_DATA) pku8Data,
+   uint8                                    u8Len
+)
+{
+   if (CCP_udtUsrWrMem(CCP_u8USR_SRV_DNLD, &CCPUSR_strXcpMta, pku8Data, u8Len) != CCP_udtCMD_STS_NO_ERR)
+   {
+      CCPUSR_u8XcpDnldRmng = 0;
+      return (CCPUSR_u8XCP_ERR_ACS_DENIED);
+   }
+   CCPUSR_strXcpMta.u32Adr += u8Len;
+   return (CCPUSR_u8XCP_STS_OK);
+}
+
+/**********************************************************************************************************************/
+/* !Description: DOWNLOAD and DOWNLOAD_NEXT (master block mode)                                                       */
+/**********************************************************************************************************************/
+static FUNC(uint8, CCP_USR_CODE) CCPUSR_u8XcpDnld
+(
+   P2CONST(uint8, AUTOMATIC, CCP_APPL_DATA) pku8Cmd
+)
+{
+   uint8 u8LocalLen;
+   uint8 u8LocalSts;
+
+
+   if (pku8Cmd[0] == CCPUSR_u8XCP_CMD_DNLD)
+   {
+      if (pku8Cmd[1] == 0)
+      {
+         return (CCPUSR_u8XCP_ERR_OUT_OF_RNG);
+      }
+      CCPUSR_u8XcpDnldRmng = pku8Cmd[1];
+   }
+   else if (  (CCPUSR_u8XcpDnldRmng == 0)
+           || (pku8Cmd[1] != CCPUSR_u8XcpDnldRmng))
+   {
+      CCPUSR_u8XcpDnldRmng = 0;
+      return (CCPUSR_u8XCP_ERR_SEQ);
+   }
+   else
+   {
+      /* Expected DOWNLOAD_NEXT */
+   }
+
+   u8LocalLen = CCPUSR_u8XcpDnldRmng;
+   if (u8LocalLen > CCPUSR_u8XCP_DNLD_PER_FRM)
+   {
+      u8LocalLen = CCPUSR_u8XCP_DNLD_PER_FRM;
+   }
+   u8LocalSts = CCPUSR_u8XcpWrMem(&pku8Cmd[2], u8LocalLen);
+   if (u8LocalSts == CCPUSR_u8XCP_STS_OK)
+   {
+      CCPUSR_u8XcpDnldRmng = (uint8)(CCPUSR_u8XcpDnldRmng - u8LocalLen);
+      if (CCPUSR_u8XcpDnldRmng != 0)
+      {
+         /* The block is acknowledged by the response to its last frame only */
+         u8LocalSts = CCPUSR_u8XCP_STS_NO_RESP;
+      }
+   }
+   return (u8LocalSts);
+}
+
+#if (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD)
+   /*******************************************************************************************************************/
+   /* !Description: Stop a DAQ list                                                                                   */
+   /*******************************************************************************************************************/
+   static FUNC(void, CCP_USR_CODE) CCPUSR_vidXcpDaqListStop
+   (
+      P2VAR(CCPUSR_tstrXcpDaqList, AUTOMATIC, CCP_APPL_DATA) pstrDaqList
+   )
+   {
+      pstrDaqList->u8Mod &= (uint8)~(CCPUSR_u8XCP_DAQ_MOD_RUNNING | CCPUSR_u8XCP_DAQ_MOD_SELD);
+      pstrDaqList->vu8OdtToTxIdx = pstrDaqList->u8NrOfOdt;
+   }
+
+   /*******************************************************************************************************************/
+   /* !Description: FREE_DAQ: stop and release all the DAQ lists                                                      */
+   /*******************************************************************************************************************/
+   static FUNC(void, CCP_USR_CODE) CCPUSR_vidXcpFreeDaq(void)
+   {
+      uint8_least u8LocalListIdx;
+
+
+      for (u8LocalListIdx = 0; u8LocalListIdx < CCPUSR_u8XCP_DAQ_NO_LISTS; u8LocalListIdx++)
+      {
+         CCPUSR_vidXcpDaqListStop(&CCPUSR_astrXcpDaqList[u8LocalListIdx]);
+      }
+      CCPUSR_u8XcpNrOfDaqList = 0;
+      CCPUSR_u8XcpNrOfOdt     = 0;
+      CCPUSR_u8XcpDaqPtrList  = UINT8_MAX;
+   }
+
+   /*******************************************************************************************************************/
+   /* !Description: Number of data bytes available in an ODT (the first ODT carries the timestamp)                   */
+   /*******************************************************************************************************************/
+   static FUNC(uint8, CCP_USR_CODE) CCPUSR_u8XcpOdtSizeMax
+   (
+      uint8 u8Mod,
+      uint8 u8OdtIdx
+   )
+   {
+      if (  (u8OdtIdx == 0)
+         && ((u8Mod & CCPUSR_u8XCP_DAQ_MOD_TS) != 0))
+      {
+         return (CCP_u8DAQ_NO_ELMS_PER_ODT - CCPUSR_u8XCP_TS_SIZE);
+      }
+      return (CCP_u8DAQ_NO_ELMS_PER_ODT);
+   }
+
+   /*******************************************************************************************************************/
+   /* !Description: Dynamic DAQ list allocation (FREE_DAQ, ALLOC_DAQ, ALLOC_ODT, ALLOC_ODT_ENTRY)                     */
+   /*******************************************************************************************************************/
+   /* !Comment: ODTs are allocated from a single pool in the order of the ALLOC_ODT commands, the ODT entries are     */
+   /*           compiled into the address ranges of the ODT when written.                                             */
+   static FUNC(uint8, CCP_USR_CODE) CCPUSR_u8XcpAllocDaq
+   (
+      P2CONST(uint8, AUTOMATIC, CCP_APPL_DATA) pku8Cmd
+   )
+   {
+      P2VAR(CCPUSR_tstrXcpDaqList, AUTOMATIC, CCP_APPL_DATA) pstrLocalDaqList;
+      P2VAR(CCPUSR_tstrXcpOdt, AUTOMATIC, CCP_APPL_DATA)     pstrLocalOdt;
+      uint16                                                 u16LocalVal;
+      uint8_least                                            u8LocalIdx;
+
+
+      if (pku8Cmd[0] == CCPUSR_u8XCP_CMD_FREE_DAQ)
+      {
+         CCPUSR_vidXcpFreeDaq();
+         return (CCPUSR_u8XCP_STS_OK);
+      }
+
+      u16LocalVal = CCPUSR_u16XcpGetU16(&pku8Cmd[2]);
+      if (pku8Cmd[0] == CCPUSR_u8XCP_CMD_ALLOC_DAQ)
+      {
+         if (CCPUSR_u8XcpNrOfDaqList != 0)
+         {
+            return (CCPUSR_u8XCP_ERR_SEQ);
+         }
+         if (u16LocalVal > CCPUSR_u8XCP_DAQ_NO_LISTS)
+         {
+            return (CCPUSR_u8XCP_ERR_MEM_OVF);
+         }
+         for (u8LocalIdx = 0; u8LocalIdx < u16LocalVal; u8LocalIdx++)
+         {
+            pstrLocalDaqList                = &CCPUSR_astrXcpDaqList[u8LocalIdx];
+            pstrLocalDaqList->u8FirstOdt    = 0;
+            pstrLocalDaqList->u8NrOfOdt     = 0;
+            pstrLocalDaqList->u8Mod         = 0;
+            pstrLocalDaqList->u8EvtChn      = 0;
+            pstrLocalDaqList->u8Prsc        = 1;
+            pstrLocalDaqList->u8PrscCnt     = 0;
+            pstrLocalDaqList->vu8OdtToTxIdx = 0;
+            pstrLocalDaqList->u8Prio        = 0;
+         }
+         CCPUSR_u8XcpNrOfDaqList = (uint8)u16LocalVal;
+         return (CCPUSR_u8XCP_STS_OK);
+      }
+
+      if (u16LocalVal >= CCPUSR_u8XcpNrOfDaqList)
+      {
+         return (CCPUSR_u8XCP_ERR_OUT_OF_RNG);
+      }
+      pstrLocalDaqList = &CCPUSR_astrXcpDaqList[u16LocalVal];
+
+      if (pku8Cmd[0] == CCPUSR_u8XCP_CMD_ALLOC_ODT)
+      {
+         if (pstrLocalDaqList->u8NrOfOdt != 0)
+         {
+            return (CCPUSR_u8XCP_ERR_SEQ);
+         }
+         if ((CCPUSR_u8XcpNrOfOdt + pku8Cmd[4]) > CCPUSR_u8XCP_DAQ_NO_ODTS)
+         {
+            return (CCPUSR_u8XCP_ERR_MEM_OVF);
+         }
+         pstrLocalDaqList->u8FirstOdt    = CCPUSR_u8XcpNrOfOdt;
+         pstrLocalDaqList->u8NrOfOdt     = pku8Cmd[4];
+         pstrLocalDaqList->vu8OdtToTxIdx = pku8Cmd[4];
+         for (u8LocalIdx = 0; u8LocalIdx < pku8Cmd[4]; u8LocalIdx++)
+         {
+            pstrLocalOdt                   = &CCPUSR_astrXcpOdt[CCPUSR_u8XcpNrOfOdt + u8LocalIdx];
+            pstrLocalOdt->strRng.u8NrOfRng = 0;
+            pstrLocalOdt->u8NrOfEntry      = 0;
+            pstrLocalOdt->u8NrOfWrEntry    = 0;
+            pstrLocalOdt->u8Size           = 0;
+         }
+         CCPUSR_u8XcpNrOfOdt = (uint8)(CCPUSR_u8XcpNrOfOdt + pku8Cmd[4]);
+         return (CCPUSR_u8XCP_STS_OK);
+      }
+
+      /* ALLOC_ODT_ENTRY: an entry holds one byte at least */
+      if (pku8Cmd[4] >= pstrLocalDaqList->u8NrOfOdt)
+      {
+         return (CCPUSR_u8XCP_ERR_OUT_OF_RNG);
+      }
+      if (pku8Cmd[5] > CCP_u8DAQ_NO_ELMS_PER_ODT)
+      {
+         return (CCPUSR_u8XCP_ERR_MEM_OVF);
+      }
+      CCPUSR_astrXcpOdt[pstrLocalDaqList->u8FirstOdt + pku8Cmd[4]].u8NrOfEntry = pku8Cmd[5];
+      return (CCPUSR_u8XCP_STS_OK);
+   }
+
+   /*******************************************************************************************************************/
+   /* !Description: SET_DAQ_PTR and WRITE_DAQ                                                                         */
+   /*******************************************************************************************************************/
+   /* !Comment: Entries shall be written in increasing order from entry 0 of the ODT, as they are appended to its     */
+   /*           address ranges.                                                                                       */
+   static FUNC(uint8, CCP_USR_CODE) CCPUSR_u8XcpWrDaq
+   (
+      P2CONST(uint8, AUTOMATIC, CCP_APPL_DATA) pku8Cmd
+   )
+   {
+      P2VAR(CCPUSR_tstrXcpDaqList, AUTOMATIC, CCP_APPL_DATA) pstrLocalDaqList;
+      P2VAR(CCPUSR_tstrXcpOdt, AUTOMATIC, CCP_APPL_DATA)     pstrLocalOdt;
+      CCPUSR_tstrDaqOdtRng                                   strLocalRng;
+      uint16                                                 u16LocalListIdx;
+      uint8                                                  u8LocalSize;
+
+
+      if (pku8Cmd[0] == CCPUSR_u8XCP_CMD_SET_DAQ_PTR)
+      {
+         u16LocalListIdx = CCPUSR_u16XcpGetU16(&pku8Cmd[2]);
+         CCPUSR_u8XcpDaqPtrList = UINT8_MAX;
+         if (u16LocalListIdx >= CCPUSR_u8XcpNrOfDaqList)
+         {
+            return (CCPUSR_u8XCP_ERR_OUT_OF_RNG);
+         }
+         pstrLocalDaqList = &CCPUSR_astrXcpDaqList[u16LocalListIdx];
+         if (  (pku8Cmd[4] >= pstrLocalDaqList->u8NrOfOdt)
+            || (pku8Cmd[5] >= CCPUSR_astrXcpOdt[pstrLocalDaqList->u8FirstOdt + pku8Cmd[4]].u8NrOfEntry))
+         {
+            return (CCPUSR_u8XCP_ERR_OUT_OF_RNG);
+         }
+         if ((pstrLocalDaqList->u8Mod & CCPUSR_u8XCP_DAQ_MOD_RUNNING) != 0)
+         {
+            return (CCPUSR_u8XCP_ERR_DAQ_ACTV);
+         }
+         CCPUSR_u8XcpDaqPtrList  = (uint8)u16LocalListIdx;
+         CCPUSR_u8XcpDaqPtrOdt   = pku8Cmd[4];
+         CCPUSR_u8XcpDaqPtrEntry = pku8Cmd[5];
+         return (CCPUSR_u8XCP_STS_OK);
+      }
+
+      if (CCPUSR_u8XcpDaqPtrList == UINT8_MAX)
+      {
+         return (CCPUSR_u8XCP_ERR_SEQ);
+      }
+      pstrLocalDaqList = &CCPUSR_astrXcpDaqList[CCPUSR_u8XcpDaqPtrList];
+      pstrLocalOdt     = &CCPUSR_astrXcpOdt[pstrLocalDaqList->u8FirstOdt + CCPUSR_u8XcpDaqPtrOdt];
+      u8LocalSize      = pku8Cmd[2];
+
+      /* Bit offset (0xFF: no bit stimulation) and address extension are not supported */
+      if (  (pku8Cmd[1] != UINT8_MAX)
+         || (CCPUSR_u8XcpDaqPtrEntry >= pstrLocalOdt->u8NrOfEntry)
+         || (u8LocalSize == 0))
+      {
+         return (CCPUSR_u8XCP_ERR_OUT_OF_RNG);
+      }
+      if ((pstrLocalDaqList->u8Mod & CCPUSR_u8XCP_DAQ_MOD_RUNNING) != 0)
+      {
+         return (CCPUSR_u8XCP_ERR_DAQ_ACTV);
+      }
+      if (CCPUSR_u8XcpDaqPtrEntry == 0)
+      {
+         pstrLocalOdt->u8NrOfWrEntry = 0;
+         pstrLocalOdt->u8Size        = 0;
+      }
+      if (CCPUSR_u8XcpDaqPtrEntry != pstrLocalOdt->u8NrOfWrEntry)
+      {
+         return (CCPUSR_u8XCP_ERR_SEQ);
+      }
+      if (  (pstrLocalOdt->u8Size + u8LocalSize)
+         > CCPUSR_u8XcpOdtSizeMax(pstrLocalDaqList->u8Mod, CCPUSR_u8XcpDaqPtrOdt))
+      {
+         return (CCPUSR_u8XCP_ERR_DAQ_CFG);
+      }
+
+      /* The ranges are built in a local copy and published at once: they are sampled in task context */
+      strLocalRng = pstrLocalOdt->strRng;
+      if (CCPUSR_u8XcpDaqPtrEntry == 0)
+      {
+         strLocalRng.u8NrOfRng = 0;
+      }
+      CCPUSR_vidDaqRngAdd(&strLocalRng,
+                          (P2VAR(uint8, AUTOMATIC, CCP_APPL_DATA))CCPUSR_u32XcpGetU32(&pku8Cmd[4]),
+                          pstrLocalOdt->u8Size,
+                          u8LocalSize);
+      CCPUSR_vidCRIT_SECT_ENTER();
+      pstrLocalOdt->strRng = strLocalRng;
+      CCPUSR_vidCRIT_SECT_EXIT();
+      pstrLocalOdt->u8Size = (uint8)(pstrLocalOdt->u8Size + u8LocalSize);
+      pstrLocalOdt->u8NrOfWrEntry++;
+      CCPUSR_u8XcpDaqPtrEntry++;
+      return (CCPUSR_u8XCP_STS_OK);
+   }
+
+   /*******************************************************************************************************************/
+   /* !Description: SET_DAQ_LIST_MODE, GET_DAQ_LIST_MODE, START_STOP_DAQ_LIST                                        */
+   /*******************************************************************************************************************/
+   static FUNC(uint8, CCP_USR_CODE) CCPUSR_u8XcpDaqListMod
+   (
+      P2CONST(uint8, AUTOMATIC, CCP_APPL_DATA) pku8Cmd,
+      P2VAR(uint8, AUTOMATIC, CCP_APPL_DATA)   pu8Resp
+   )
+   {
+      P2VAR(CCPUSR_tstrXcpDaqList, AUTOMATIC, CCP_APPL_DATA) pstrLocalDaqList;
+      uint16                                                 u16LocalListIdx;
+      uint16                                                 u16LocalEvtChn;
+
+
+      u16LocalListIdx = CCPUSR_u16XcpGetU16(&pku8Cmd[2]);
+      if (u16LocalListIdx >= CCPUSR_u8XcpNrOfDaqList)
+      {
+         return (CCPUSR_u8XCP_ERR_OUT_OF_RNG);
+      }
+      pstrLocalDaqList = &CCPUSR_astrXcpDaqList[u16LocalListIdx];
+
+      switch (pku8Cmd[0])
+      {
+         case CCPUSR_u8XCP_CMD_SET_DAQ_LIST_MOD:
+            u16LocalEvtChn = CCPUSR_u16XcpGetU16(&pku8Cmd[4]);
+            if ((pstrLocalDaqList->u8Mod & CCPUSR_u8XCP_DAQ_MOD_RUNNING) != 0)
+            {
+               return (CCPUSR_u8XCP_ERR_DAQ_ACTV);
+            }
+            /* Only the timestamp may be selected: no STIM, no PID_OFF */
+            if ((pku8Cmd[1] & (uint8)~CCPUSR_u8XCP_DAQ_MOD_TS) != 0)
+            {
+               return (CCPUSR_u8XCP_ERR_MOD_NOT_VALID);
+            }
+            if (  (u16LocalEvtChn >= CCP_u8DAQ_NO_EVE_CHNS)
+               || (pku8Cmd[6] == 0))
+            {
+               return (CCPUSR_u8XCP_ERR_OUT_OF_RNG);
+            }
+            if (  (pstrLocalDaqList->u8NrOfOdt != 0)
+               && (CCPUSR_astrXcpOdt[pstrLocalDaqList->u8FirstOdt].u8Size > CCPUSR_u8XcpOdtSizeMax(pku8Cmd[1], 0)))
+            {
+               return (CCPUSR_u8XCP_ERR_DAQ_CFG);
+            }
+            pstrLocalDaqList->u8Mod    = (uint8)( (pstrLocalDaqList->u8Mod & CCPUSR_u8XCP_DAQ_MOD_SELD)
+                                                | pku8Cmd[1]);
+            pstrLocalDaqList->u8EvtChn = (uint8)u16LocalEvtChn;
+            pstrLocalDaqList->u8Prsc   = pku8Cmd[6];
+            pstrLocalDaqList->u8Prio   = pku8Cmd[7];
+            break;
+
+         case CCPUSR_u8XCP_CMD_GET_DAQ_LIST_MOD:
+            pu8Resp[1] = pstrLocalDaqList->u8Mod;
+            pu8Resp[4] = pstrLocalDaqList->u8EvtChn;
+            pu8Resp[6] = pstrLocalDaqList->u8Prsc;
+            pu8Resp[7] = pstrLocalDaqList->u8Prio;
+            break;
+
+         default: /* START_STOP_DAQ_LIST */
+            if (pku8Cmd[1] == 0)
+            {
+               CCPUSR_vidXcpDaqListStop(pstrLocalDaqList);
+            }
+            else if (pku8Cmd[1] <= 2)
+            {
+               if (pstrLocalDaqList->u8NrOfOdt == 0)
+               {
+                  return (CCPUSR_u8XCP_ERR_DAQ_CFG);
+               }
+               pstrLocalDaqList->u8Mod |= CCPUSR_u8XCP_DAQ_MOD_SELD;
+               if (pku8Cmd[1] == 1)
+               {
+                  pstrLocalDaqList->u8PrscCnt = 0;
+                  pstrLocalDaqList->u8Mod     = (uint8)( (pstrLocalDaqList->u8Mod & (uint8)~CCPUSR_u8XCP_DAQ_MOD_SELD)
+                                                       | CCPUSR_u8XCP_DAQ_MOD_RUNNING);
+               }
+            }
+            else
+            {
+               return (CCPUSR_u8XCP_ERR_MOD_NOT_VALID);
+            }
+            pu8Resp[1] = pstrLocalDaqList->u8FirstOdt;
+            break;
+      }
+      return (CCPUSR_u8XCP_STS_OK);
+   }
+
+   /*******************************************************************************************************************/
+   /* !Description: START_STOP_SYNCH                                                                                  */
+   /*******************************************************************************************************************/
+   static FUNC(uint8, CCP_USR_CODE) CCPUSR_u8XcpStrtStopSynch
+   (
+      uint8 u8Mod
+   )
+   {
+      P2VAR(CCPUSR_tstrXcpDaqList, AUTOMATIC, CCP_APPL_DATA) pstrLocalDaqList;
+      uint8_least                                            u8LocalListIdx;
+
+
+      if (u8Mod > 2)
+      {
+         return (CCPUSR_u8XCP_ERR_MOD_NOT_VALID);
+      }
+      for (u8LocalListIdx = 0; u8LocalListIdx < CCPUSR_u8XcpNrOfDaqList; u8LocalListIdx++)
+      {
+         pstrLocalDaqList = &CCPUSR_astrXcpDaqList[u8LocalListIdx];
+         if (  (u8Mod == 0)
+            || (  (u8Mod == 2)
+               && ((pstrLocalDaqList->u8Mod & CCPUSR_u8XCP_DAQ_MOD_SELD) != 0)))
+         {
+            CCPUSR_vidXcpDaqListStop(pstrLocalDaqList);
+         }
+         else if ((pstrLocalDaqList->u8Mod & CCPUSR_u8XCP_DAQ_MOD_SELD) != 0)
+         {
+            pstrLocalDaqList->u8PrscCnt = 0;
+            pstrLocalDaqList->u8Mod     = (uint8)( (pstrLocalDaqList->u8Mod & (uint8)~CCPUSR_u8XCP_DAQ_MOD_SELD)
+                                                 | CCPUSR_u8XCP_DAQ_MOD_RUNNING);
+         }
+         else
+         {
+            /* DAQ list not selected */
+         }
+      }
+      return (CCPUSR_u8XCP_STS_OK);
+   }
+
+   /*******************************************************************************************************************/
+   /* !Description: Session status bit of the running DAQ lists                                                       */
+   /*******************************************************************************************************************/
+   static FUNC(uint8, CCP_USR_CODE) CCPUSR_u8XcpDaqSsnSts(void)
+   {
+      uint8_least u8LocalListIdx;
+
+
+      for (u8LocalListIdx = 0; u8LocalListIdx < CCPUSR_u8XcpNrOfDaqList; u8LocalListIdx++)
+      {
+         if ((CCPUSR_astrXcpDaqList[u8LocalListIdx].u8Mod & CCPUSR_u8XCP_DAQ_MOD_RUNNING) != 0)
+         {
+            return (CCPUSR_u8XCP_SSN_STS_DAQ_RUNNING);
+         }
+      }
+      return (0);
+   }
+
+   /*******************************************************************************************************************/
+   /* !Description: DAQ timestamp                                                                                     */
+   /*******************************************************************************************************************/
+   static FUNC(uint16, CCP_USR_CODE) CCPUSR_u16XcpGetTs(void)
+   {
+      return ((uint16)(CCPUSR_u32GET_TIME_STAMP() >> CCPUSR_u8XCP_TS_SHIFT));
+   }
+#endif /* (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD) */
+
+/**********************************************************************************************************************/
+/* !Description: Execute an XCP command and fill its positive response                                                */
+/**********************************************************************************************************************/
+static FUNC(uint8, CCP_USR_CODE) CCPUSR_u8XcpCmd
+(
+   P2CONST(uint8, AUTOMATIC, CCP_APPL_DATA) pku8Cmd,
+   P2VAR(uint8, AUTOMATIC, CCP_APPL_DATA)   pu8Resp
+)
+{
+   uint8 u8LocalSts;
+   #if (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD)
+      uint16 u16LocalTs;
+   #endif
+
+
+   u8LocalSts = CCPUSR_u8XCP_STS_OK;
+   switch (pku8Cmd[0])
+   {
+      case CCPUSR_u8XCP_CMD_CNCT:
+         /* Only one master at a time: CCP and XCP sessions are exclusive, also while CCP is temporarily disconnected */
+         if ((CCP_udtGetState() & CCP_udtSTT_CNCTD) != 0)
+         {
+            u8LocalSts = CCPUSR_u8XCP_ERR_CMD_BUSY;
+         }
+         else
+         {
+            CCPUSR_bXcpCnctd = TRUE;
+            pu8Resp[1] = CCPUSR_u8XCP_RSRC;
+            pu8Resp[2] = CCPUSR_u8XCP_COMM_MOD_BASIC;
+            pu8Resp[3] = CCPUSR_u8XCP_FRM_SIZE;
+            pu8Resp[4] = CCPUSR_u8XCP_FRM_SIZE;
+            pu8Resp[6] = CCPUSR_u8XCP_PROT_VER;
+            pu8Resp[7] = CCPUSR_u8XCP_TRSP_VER;
+         }
+         break;
+
+      case CCPUSR_u8XCP_CMD_DCNCT:
+         #if (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD)
+            CCPUSR_vidXcpFreeDaq();
+         #endif
+         CCPUSR_bXcpCnctd = FALSE;
+         break;
+
+      case CCPUSR_u8XCP_CMD_GET_STS:
+         #if (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD)
+            pu8Resp[1] = CCPUSR_u8XcpDaqSsnSts();
+         #endif
+         break;
+
+      case CCPUSR_u8XCP_CMD_SYNCH:
+         u8LocalSts = CCPUSR_u8XCP_ERR_CMD_SYNCH;
+         break;
+
+      case CCPUSR_u8XCP_CMD_GET_COMM_MOD_INFO:
+         pu8Resp[2] = CCPUSR_u8XCP_COMM_MOD_OPT;
+         pu8Resp[4] = CCPUSR_u8XCP_MAX_BS;
+         pu8Resp[5] = CCPUSR_u8XCP_MIN_ST;
+         pu8Resp[7] = CCPUSR_u8XCP_DRV_VER;
+         break;
+
+      case CCPUSR_u8XCP_CMD_SET_MTA:
+         CCPUSR_strXcpMta.u8Extn = pku8Cmd[3];
+         CCPUSR_strXcpMta.u32Adr = CCPUSR_u32XcpGetU32(&pku8Cmd[4]);
+         break;
+
+      case CCPUSR_u8XCP_CMD_UPLD:
+         CCPUSR_u32XcpUpldStrtTi = CCPUSR_u32GET_TIME_STAMP();
+         u8LocalSts = CCPUSR_u8XcpUpld(pku8Cmd[1]);
+         break;
+
+      case CCPUSR_u8XCP_CMD_SHO_UPLD:
+         if (pku8Cmd[1] > CCPUSR_u8XCP_UPLD_PER_FRM)
+         {
+            u8LocalSts = CCPUSR_u8XCP_ERR_OUT_OF_RNG;
+         }
+         else
+         {
+            CCPUSR_strXcpMta.u8Extn = pku8Cmd[3];
+            CCPUSR_strXcpMta.u32Adr = CCPUSR_u32XcpGetU32(&pku8Cmd[4]);
+            CCPUSR_u32XcpUpldStrtTi = CCPUSR_u32GET_TIME_STAMP();
+            u8LocalSts = CCPUSR_u8XcpUpld(pku8Cmd[1]);
+         }
+         break;
+
+      case CCPUSR_u8XCP_CMD_DNLD:
+      case CCPUSR_u8XCP_CMD_DNLD_NEXT:
+         u8LocalSts = CCPUSR_u8XcpDnld(pku8Cmd);
+         break;
+
+      case CCPUSR_u8XCP_CMD_DNLD_MAX:
+         u8LocalSts = CCPUSR_u8XcpWrMem(&pku8Cmd[1], CCPUSR_u8XCP_DNLD_MAX_PER_FRM);
+         break;
+
+      #if (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD)
+         case CCPUSR_u8XCP_CMD_FREE_DAQ:
+         case CCPUSR_u8XCP_CMD_ALLOC_DAQ:
+         case CCPUSR_u8XCP_CMD_ALLOC_ODT:
+         case CCPUSR_u8XCP_CMD_ALLOC_ODT_ENTRY:
+            u8LocalSts = CCPUSR_u8XcpAllocDaq(pku8Cmd);
+            break;
+
+         case CCPUSR_u8XCP_CMD_SET_DAQ_PTR:
+         case CCPUSR_u8XCP_CMD_WR_DAQ:
+            u8LocalSts = CCPUSR_u8XcpWrDaq(pku8Cmd);
+            break;
+
+         case CCPUSR_u8XCP_CMD_SET_DAQ_LIST_MOD:
+         case CCPUSR_u8XCP_CMD_GET_DAQ_LIST_MOD:
+         case CCPUSR_u8XCP_CMD_STRT_STOP_DAQ_LIST:
+            u8LocalSts = CCPUSR_u8XcpDaqListMod(pku8Cmd, pu8Resp);
+            break;
+
+         case CCPUSR_u8XCP_CMD_STRT_STOP_SYNCH:
+            u8LocalSts = CCPUSR_u8XcpStrtStopSynch(pku8Cmd[1]);
+            break;
+
+         case CCPUSR_u8XCP_CMD_GET_DAQ_CLK:
+            u16LocalTs = CCPUSR_u16XcpGetTs();
+            pu8Resp[4] = (uint8)u16LocalTs;
+            pu8Resp[5] = (uint8)(u16LocalTs >> 8);
+            break;
+
+         case CCPUSR_u8XCP_CMD_GET_DAQ_PROC_INFO:
+            pu8Resp[1] = CCPUSR_u8XCP_DAQ_PROPS;
+            pu8Resp[2] = CCPUSR_u8XCP_DAQ_NO_LISTS;
+            pu8Resp[4] = CCP_u8DAQ_NO_EVE_CHNS;
+            pu8Resp[7] = CCPUSR_u8XCP_DAQ_KEY;
+            break;
+
+         case CCPUSR_u8XCP_CMD_GET_DAQ_RESOL_INFO:
+            pu8Resp[1] = 1;
+            pu8Resp[2] = CCPUSR_u8XCP_ODT_ENTRY_SIZE_MAX;
+            pu8Resp[3] = 1;
+            pu8Resp[5] = CCPUSR_u8XCP_TS_MOD;
+            pu8Resp[6] = (uint8)CCPUSR_u16XCP_TS_TICKS;
+            pu8Resp[7] = (uint8)(CCPUSR_u16XCP_TS_TICKS >> 8);
+            break;
+      #endif /* (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD) */
+
+      default:
+         u8LocalSts = CCPUSR_u8XCP_ERR_CMD_UNKNOWN;
+         break;
+   }
+   return (u8LocalSts);
+}
+
+#define CCP_STOP_SEC_CODE
+#include "Ccp_MemMap.h"
+
+
+/**********************************************************************************************************************/
+/* FUNCTIONS DEFINITION                                                                                               */
+/**********************************************************************************************************************/
+#define CCP_START_SEC_CODE
+#include "Ccp_MemMap.h"
+
+/**********************************************************************************************************************/
+/* !Description: XCP slave initialisation                                                                             */
+/**********************************************************************************************************************/
+FUNC(void, CCP_USR_CODE) CCPUSR_vidXcpIni(void)
+{
+   CCPUSR_bXcpCnctd         = FALSE;
+   CCPUSR_strXcpMta.u32Adr  = 0;
+   CCPUSR_strXcpMta.u8Extn  = 0;
+   CCPUSR_vu8XcpUpldRmng    = 0;
+   CCPUSR_u8XcpUpldIdx      = 0;
+   CCPUSR_u8XcpDnldRmng     = 0;
+   CCPUSR_u32XcpUpldByteCnt = 0;
+   CCPUSR_u32XcpUpldTi      = 0;
+   CCPUSR_u32XcpUpldThrput  = 0;
+   CCPUSR_u32XcpDaqOvrnCnt  = 0;
+   #if (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD)
+      CCPUSR_vidXcpFreeDaq();
+   #endif
+}
+
+/**********************************************************************************************************************/
+/* !Description: Called on CRO frame reception, before CCP                                                            */
+/**********************************************************************************************************************/
+/* !Comment: The frame has been processed by XCP (TRUE) or shall be processed by CCP (FALSE). While an XCP session is */
+/*           open, CCP commands are ignored.                                                                          */
+FUNC(boolean, CCP_USR_CODE) CCPUSR_bXcpRxInd
+(
+   /* !Comment: The 8 bytes of the CRO frame                                                                          */
+   P2CONST(uint8, AUTOMATIC, CCP_APPL_DATA) pku8Data
+)
+{
+   uint8       au8LocalResp[CCPUSR_u8XCP_FRM_SIZE];
+   uint8_least u8LocalIdx;
+   uint8       u8LocalSts;
+
+
+   if (pku8Data[0] < CCPUSR_u8XCP_CMD_MIN)
+   {
+      return (CCPUSR_bXcpCnctd);
+   }
+   /* A disconnected slave only answers to CONNECT */
+   if (  (CCPUSR_bXcpCnctd == FALSE)
+      && (pku8Data[0] != CCPUSR_u8XCP_CMD_CNCT))
+   {
+      return (TRUE);
+   }
+
+   /* Any command other than DOWNLOAD_NEXT ends a master block, any command ends a slave block */
+   if (pku8Data[0] != CCPUSR_u8XCP_CMD_DNLD_NEXT)
+   {
+      CCPUSR_u8XcpDnldRmng = 0;
+   }
+   CCPUSR_vu8XcpUpldRmng = 0;
+   CCPUSR_u8XcpUpldIdx   = 0;
+
+   au8LocalResp[0] = CCPUSR_u8XCP_PID_RES;
+   for (u8LocalIdx = 1; u8LocalIdx < CCPUSR_u8XCP_FRM_SIZE; u8LocalIdx++)
+   {
+      au8LocalResp[u8LocalIdx] = 0;
+   }
+
+   u8LocalSts = CCPUSR_u8XcpCmd(pku8Data, au8LocalResp);
+   if (u8LocalSts != CCPUSR_u8XCP_STS_NO_RESP)
+   {
+      if (u8LocalSts != CCPUSR_u8XCP_STS_OK)
+      {
+         au8LocalResp[0] = CCPUSR_u8XCP_PID_ERR;
+         au8LocalResp[1] = u8LocalSts;
+         for (u8LocalIdx = 2; u8LocalIdx < CCPUSR_u8XCP_FRM_SIZE; u8LocalIdx++)
+         {
+            au8LocalResp[u8LocalIdx] = 0;
+         }
+      }
+      CCP_vidUsrTxCmdResp(au8LocalResp);
+   }
+   return (TRUE);
+}
+
+/**********************************************************************************************************************/
+/* !Description: Called on DTO frame transmit confirmation: continue the slave block upload                          */
+/**********************************************************************************************************************/
+FUNC(void, CCP_USR_CODE) CCPUSR_vidXcpTxConf(void)
+{
+   uint32 u32LocalTi;
+
+
+   if (CCPUSR_vu8XcpUpldRmng != 0)
+   {
+      CCPUSR_vidXcpUpldTxFrm();
+   }
+   else if (CCPUSR_u8XcpUpldIdx != 0)
+   {
+      /* Last frame of the block confirmed: 1 STM0 tick = 0.01us */
+      u32LocalTi          = CCPUSR_u32GET_TIME_STAMP() - CCPUSR_u32XcpUpldStrtTi;
+      CCPUSR_u32XcpUpldTi = u32LocalTi;
+      u32LocalTi         /= CCPUSR_u32XCP_STM_TICKS_PER_US;
+      if (u32LocalTi != 0)
+      {
+         CCPUSR_u32XcpUpldThrput = ((uint32)CCPUSR_u8XcpUpldIdx * 1000000UL) / u32LocalTi;
+      }
+      CCPUSR_u8XcpUpldIdx = 0;
+   }
+   else
+   {
+      /* No upload in progress */
+   }
+}
+
+#if (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD)
+   /*******************************************************************************************************************/
+   /* !Description: Called on DAQ frame transmit confirmation: send the next ODT of the XCP DAQ list                  */
+   /*******************************************************************************************************************/
+   /* !Comment: The confirmation concerns a running XCP DAQ list with a transmission in progress (TRUE) or not, e.g.  */
+   /*           a CCP DAQ list (FALSE)                                                                                */
+   FUNC(boolean, CCP_USR_CODE) CCPUSR_bXcpDaqTxConf
+   (
+      /* !Comment: DAQ list index                                                                                     */
+      /* !Range:   0..(CCP_u8DAQ_NO_LISTS-1)                                                                          */
+      uint8 u8ListIdx
+   )
+   {
+      P2VAR(CCPUSR_tstrXcpDaqList, AUTOMATIC, CCP_APPL_DATA) pstrLocalDaqList;
+      uint8                                                  u8LocalOdtIdx;
+
+
+      if (  (CCPUSR_bXcpCnctd == FALSE)
+         || (u8ListIdx >= CCPUSR_u8XcpNrOfDaqList))
+      {
+         return (FALSE);
+      }
+      pstrLocalDaqList = &CCPUSR_astrXcpDaqList[u8ListIdx];
+      u8LocalOdtIdx    = pstrLocalDaqList->vu8OdtToTxIdx;
+      if (  ((pstrLocalDaqList->u8Mod & CCPUSR_u8XCP_DAQ_MOD_RUNNING) == 0)
+         || (u8LocalOdtIdx >= pstrLocalDaqList->u8NrOfOdt))
+      {
+         return (FALSE);
+      }
+      u8LocalOdtIdx++;
+      pstrLocalDaqList->vu8OdtToTxIdx = u8LocalOdtIdx;
+      if (u8LocalOdtIdx < pstrLocalDaqList->u8NrOfOdt)
+      {
+         CCPUSR_vidSendDaqMessage(u8ListIdx,
+                                  CCPUSR_au8XcpOdtBuf[pstrLocalDaqList->u8FirstOdt + u8LocalOdtIdx]);
+      }
+      return (TRUE);
+   }
+
+   /*******************************************************************************************************************/
+   /* !Description: Sample and send the XCP DAQ lists of an event channel                                             */
+   /*******************************************************************************************************************/
+   /* !Comment: All the ODTs of a DAQ list are sampled at the event (consistency at DAQ list level) and transmitted   */
+   /*           one by one on the transmit confirmations. A cycle is skipped if the previous one is still in progress. */
+   /*           The list state is checked again and sampled under the critical section, as commands (CAN Rx context) */
+   /*           may stop or reconfigure it meanwhile.                                                                 */
+   FUNC(void, CCP_USR_CODE) CCPUSR_vidXcpDaqEvt
+   (
+      /* !Comment: Event channel                                                                                      */
+      /* !Range:   0..(CCP_u8DAQ_NO_EVE_CHNS-1)                                                                       */
+      uint8 u8EvtChn
+   )
+   {
+      P2VAR(CCPUSR_tstrXcpDaqList, AUTOMATIC, CCP_APPL_DATA) pstrLocalDaqList;
+      P2VAR(uint8, AUTOMATIC, CCP_APPL_DATA)                 pu8LocalBuf;
+      uint8_least                                            u8LocalListIdx;
+      uint8_least                                            u8LocalOdtIdx;
+      uint8_least                                            u8LocalIdx;
+      uint8_least                                            u8LocalOfs;
+      uint16                                                 u16LocalTs;
+      boolean                                                bLocalSend;
+
+
+      if (CCPUSR_bXcpCnctd == FALSE)
+      {
+         return;
+      }
+      u16LocalTs = CCPUSR_u16XcpGetTs();
+
+      for (u8LocalListIdx = 0; u8LocalListIdx < CCPUSR_u8XcpNrOfDaqList; u8LocalListIdx++)
+      {
+         pstrLocalDaqList = &CCPUSR_astrXcpDaqList[u8LocalListIdx];
+         if (  ((pstrLocalDaqList->u8Mod & CCPUSR_u8XCP_DAQ_MOD_RUNNING) == 0)
+            || (pstrLocalDaqList->u8EvtChn != u8EvtChn))
+         {
+            continue;
+         }
+         pstrLocalDaqList->u8PrscCnt++;
+         if (pstrLocalDaqList->u8PrscCnt < pstrLocalDaqList->u8Prsc)
+         {
+            continue;
+         }
+         pstrLocalDaqList->u8PrscCnt = 0;
+
+         bLocalSend = FALSE;
+         CCPUSR_vidCRIT_SECT_ENTER();
+         if ((pstrLocalDaqList->u8Mod & CCPUSR_u8XCP_DAQ_MOD_RUNNING) == 0)
+         {
+            /* Stopped since the check above */
+         }
+         else if (pstrLocalDaqList->vu8OdtToTxIdx < pstrLocalDaqList->u8NrOfOdt)
+         {
+            CCPUSR_u32XcpDaqOvrnCnt++;
+         }
+         else
+         {
+            for (u8LocalOdtIdx = 0; u8LocalOdtIdx < pstrLocalDaqList->u8NrOfOdt; u8LocalOdtIdx++)
+            {
+               pu8LocalBuf    = CCPUSR_au8XcpOdtBuf[pstrLocalDaqList->u8FirstOdt + u8LocalOdtIdx];
+               pu8LocalBuf[0] = (uint8)(pstrLocalDaqList->u8FirstOdt + u8LocalOdtIdx);
+               u8LocalOfs     = 1;
+               if (  (u8LocalOdtIdx == 0)
+                  && ((pstrLocalDaqList->u8Mod & CCPUSR_u8XCP_DAQ_MOD_TS) != 0))
+               {
+                  pu8LocalBuf[1] = (uint8)u16LocalTs;
+                  pu8LocalBuf[2] = (uint8)(u16LocalTs >> 8);
+                  u8LocalOfs     = 1 + CCPUSR_u8XCP_TS_SIZE;
+               }
+               for (u8LocalIdx = u8LocalOfs; u8LocalIdx < CCPUSR_u8XCP_FRM_SIZE; u8LocalIdx++)
+               {
+                  pu8LocalBuf[u8LocalIdx] = 0;
+               }
+               CCPUSR_vidDaqRngSmpl(&CCPUSR_astrXcpOdt[pstrLocalDaqList->u8FirstOdt + u8LocalOdtIdx].strRng,
+                                    &pu8LocalBuf[u8LocalOfs]);
+            }
+            pstrLocalDaqList->vu8OdtToTxIdx = 0;
+            bLocalSend = TRUE;
+         }
+         CCPUSR_vidCRIT_SECT_EXIT();
+
+         if (bLocalSend == TRUE)
+         {
+            CCPUSR_vidSendDaqMessage((uint8)u8LocalListIdx, CCPUSR_au8XcpOdtBuf[pstrLocalDaqList->u8FirstOdt]);
+         }
+      }
+   }
+#endif /* (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD) */
+
+#define CCP_STOP_SEC_CODE
+#include "Ccp_MemMap.h"
+
+#endif /* (CCPUSR_coXCP == CCP_coACVD) */
+
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
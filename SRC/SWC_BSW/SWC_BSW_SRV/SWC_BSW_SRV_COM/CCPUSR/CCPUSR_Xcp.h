@@ -0,0 +1,92 @@
+/************************************************* <AUTO_FILE_HEADER> *************************************************/
+/*                                                                                                                    */
+/* !Layer           : SRVL                                                                                            */
+/*                                                                                                                    */
+/* !Component       : CCP                                                                                             */
+/*                                                                                                                    */
+/* !Module          : CCPUSR                                                                                          */
+/* !Description     : XCP on CAN slave declaration                                                                    */
+/*                                                                                                                    */
+/* !File            : CCPUSR_Xcp.h                                                                                    */
+/*                                                                                                                    */
+/* !Scope           : Public                                                                                          */
+/*                                                                                                                    */
+/* !Target          : All                                                                                             */
+/*                                                                                                                    */
+/* !Vendor          : Valeo                                                                                           */
+/*                                                                                                                    */
+/* Coding language  : C                                                                                               */
+/*                                                                                                                    */
+/* COPYRIGHT 2009 VALEO                                                                                               */
+/* all rights reserved                                                                                                */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+/************************************************ </AUTO_FILE_HEADER> *************************************************/
+/* PVCS Information                                                                                                   */
+/* $Archive::   P:/VE_S97/LOG/60_ComponentArchive/Archives/COMP_SWC_BSW_MCAL_MPC5676/Mcal.c_v                        $*/
+/* $Revision::   1.7                                                                                                 $*/
+/* $Author::   vbecquet                               $$Date::   14 Jun 2012 13:43:52                                $*/
+/**********************************************************************************************************************/
+
+
+#ifndef CCPUSR_XCP_H
+#define CCPUSR_XCP_H
+
+#include "Std_Types.h"
+#include "CCPUSR_Xcp_Cfg.h"
+
+/**********************************************************************************************************************/
+/* DATA DECLARATION                                                                                                   */
+/**********************************************************************************************************************/
+#if (CCPUSR_coXCP == CCP_coACVD)
+   #define CCP_START_SEC_VAR_UNSPECIFIED
+   #include "Ccp_MemMap.h"
+
+   /* !Comment: Number of bytes read by UPLOAD and SHORT_UPLOAD since initialisation                                 */
+   extern VAR(uint32, CCP_VAR) CCPUSR_u32XcpUpldByteCnt;
+   /* !Comment: Duration of the last UPLOAD, from the command to the confirmation of its last frame (STM0 ticks)      */
+   extern VAR(uint32, CCP_VAR) CCPUSR_u32XcpUpldTi;
+   /* !Comment: Throughput of the last UPLOAD (byte/s)                                                               */
+   extern VAR(uint32, CCP_VAR) CCPUSR_u32XcpUpldThrput;
+   /* !Comment: Number of DAQ list cycles skipped because the previous cycle was still being transmitted              */
+   extern VAR(uint32, CCP_VAR) CCPUSR_u32XcpDaqOvrnCnt;
+
+   #define CCP_STOP_SEC_VAR_UNSPECIFIED
+   #include "Ccp_MemMap.h"
+#endif /* (CCPUSR_coXCP == CCP_coACVD) */
+
+/**********************************************************************************************************************/
+/* FUNCTIONS DECLARATION                                                                                              */
+/**********************************************************************************************************************/
+#define CCP_START_SEC_CODE
+#include "Ccp_MemMap.h"
+
+#if (CCPUSR_coXCP == CCP_coACVD)
+   FUNC(void, CCP_USR_CODE) CCPUSR_vidXcpIni(void);
+
+   FUNC(boolean, CCP_USR_CODE) CCPUSR_bXcpRxInd
+   (
+      P2CONST(uint8, AUTOMATIC, CCP_APPL_DATA) pku8Data
+   );
+
+   FUNC(void, CCP_USR_CODE) CCPUSR_vidXcpTxConf(void);
+
+   #if (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD)
+      FUNC(boolean, CCP_USR_CODE) CCPUSR_bXcpDaqTxConf
+      (
+         uint8 u8ListIdx
+      );
+
+      FUNC(void, CCP_USR_CODE) CCPUSR_vidXcpDaqEvt
+      (
+         uint8 u8EvtChn
+      );
+   #endif /* (CCP_coOPT_SRV_DAQ_LIST == CCP_coACVD) */
+#endif /* (CCPUSR_coXCP == CCP_coACVD) */
+
+#define CCP_STOP_SEC_CODE
+#include "Ccp_MemMap.h"
+
+#endif /* CCPUSR_XCP_H */
+
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
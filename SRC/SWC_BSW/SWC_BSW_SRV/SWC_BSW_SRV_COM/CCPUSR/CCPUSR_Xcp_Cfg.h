@@ -0,0 +1,60 @@
+/************************************************* <AUTO_FILE_HEADER> *************************************************/
+/*                                                                                                                    */
+/* !Layer           : SRVL                                                                                            */
+/*                                                                                                                    */
+/* !Component       : CCP                                                                                             */
+/*                                                                                                                    */
+/* !Module          : CCPUSR                                                                                          */
+/* !Description     : XCP on CAN slave configuration                                                                  */
+/*                                                                                                                    */
+/* !File            : CCPUSR_Xcp_Cfg.h                                                                                */
+/*                                                                                                                    */
+/* !Scope           : Public                                                                                          */
+/*                                                                                                                    */
+/* !Target          : All                                                                                             */
+/*                                                                                                                    */
+/* !Vendor          : Valeo                                                                                           */
+/*                                                                                                                    */
+/* Coding language  : C                                                                                               */
+/*                                                                                                                    */
+/* COPYRIGHT 2009 VALEO                                                                                               */
+/* all rights reserved                                                                                                */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+/************************************************ </AUTO_FILE_HEADER> *************************************************/
+/* PVCS Information                                                                                                   */
+/* $Archive::   P:/VE_S97/LOG/60_ComponentArchive/Archives/COMP_SWC_BSW_MCAL_MPC5676/Mcal.c_v                        $*/
+/* $Revision::   1.7                                                                                                 $*/
+/* $Author::   vbecquet                               $$Date::   14 Jun 2012 13:43:52                                $*/
+/**********************************************************************************************************************/
+
+
+#ifndef CCPUSR_XCP_CFG_H
+#define CCPUSR_XCP_CFG_H
+
+/**********************************************************************************************************************/
+/* DEFINES                                                                                                            */
+/**********************************************************************************************************************/
+/* !Comment: XCP slave on the CCP CanIf PDUs (CCP_coACVD / CCP_coDEACVD)                                              */
+#define CCPUSR_coXCP CCP_coACVD
+
+/* !Comment: Maximum number of frames of a master block download (255 bytes by DOWNLOAD/DOWNLOAD_NEXT of 6 bytes)     */
+#define CCPUSR_u8XCP_MAX_BS 43
+/* !Comment: Minimum separation time between the frames of a master block download (100us)                           */
+#define CCPUSR_u8XCP_MIN_ST 0
+
+/* !Comment: Number of dynamic DAQ lists. Each XCP DAQ list is transmitted on the CanIf PDU of the same CCP DAQ list  */
+#define CCPUSR_u8XCP_DAQ_NO_LISTS CCP_u8DAQ_NO_LISTS
+/* !Comment: Number of ODTs shared by all the dynamic DAQ lists (absolute ODT numbers are used as PIDs: max 0xC0)     */
+#define CCPUSR_u8XCP_DAQ_NO_ODTS 32
+
+/* !Comment: DAQ timestamp = STM0.TIM0 >> CCPUSR_u8XCP_TS_SHIFT. A power of two keeps the 16-bit timestamp            */
+/*           continuous when TIM0 wraps. With STM0 at 100MHz, 1 timestamp tick = 256 x 10ns = 2.56us and the          */
+/*           timestamp wraps every 167.8ms, more than the period of the slowest DAQ event                             */
+#define CCPUSR_u8XCP_TS_SHIFT 8
+/* !Comment: Period of the slowest DAQ event (BSW_100msPostCall)                                                      */
+#define CCPUSR_u32XCP_EVE_PERIOD_MAX_US 100000UL
+
+#endif /* CCPUSR_XCP_CFG_H */
+
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
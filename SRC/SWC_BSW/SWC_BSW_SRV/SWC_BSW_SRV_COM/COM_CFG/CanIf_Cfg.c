@@ -268,6 +268,12 @@ VAR( uint8, CANIF_VAR )
 VAR( uint8, CANIF_VAR ) CanIf_RxBuffer[1U];
 #endif /* CANIF_READRXPDU_NOTIF_STATUS_API == STD_ON */
 
+#if( ( CANIF_PUBLIC_TX_BUFFERING == STD_ON ) && ( CANIF_TX_PRIO_BITMAP == STD_ON ) )
+/** \brief Priority slot of each Tx buffer within its HTH */
+VAR( uint8, CANIF_VAR )
+  CanIf_TxPrioSlot[21U];
+#endif /* ( CANIF_PUBLIC_TX_BUFFERING == STD_ON ) && ... */
+
 #define CANIF_STOP_SEC_VAR_NO_INIT_8
 #include <MemMap.h>
 
@@ -303,6 +309,18 @@ VAR( CanIf_LPduIndexType, CANIF_VAR )
   CanIf_DynamicTxLPduCanIds[1U];
 #endif /* CANIF_SETDYNAMICTXID_API == STD_ON */
 
+#if( ( CANIF_PUBLIC_TX_BUFFERING == STD_ON ) && ( CANIF_TX_PRIO_BITMAP == STD_ON ) )
+/** \brief Bitmap of the occupied priority slots of each HTH */
+VAR( uint32, CANIF_VAR )
+  CanIf_TxPrioBitmap[21U];
+#endif /* ( CANIF_PUBLIC_TX_BUFFERING == STD_ON ) && ... */
+
+#if( ( CANIF_PUBLIC_TX_BUFFERING == STD_ON ) && ( CANIF_TX_BUFFER_STATISTICS == STD_ON ) )
+/** \brief Time stamp of the last enqueue of each Tx buffer */
+VAR( uint32, CANIF_VAR )
+  CanIf_TxBufferTimeStamp[21U];
+#endif /* ( CANIF_PUBLIC_TX_BUFFERING == STD_ON ) && ... */
+
 #define CANIF_STOP_SEC_VAR_NO_INIT_32
 #include <MemMap.h>
 
@@ -319,6 +337,12 @@ VAR( CanIf_TxBufferType, CANIF_VAR )
   CanIf_TxBuffer[21U];
 #endif /* CANIF_PUBLIC_TX_BUFFERING */
 
+#if( ( CANIF_PUBLIC_TX_BUFFERING == STD_ON ) && ( CANIF_TX_BUFFER_STATISTICS == STD_ON ) )
+/** \brief Tx buffer statistics of each HTH */
+VAR( CanIf_TxBufferStatisticsType, CANIF_VAR )
+  CanIf_TxBufferStatistics[21U];
+#endif /* ( CANIF_PUBLIC_TX_BUFFERING == STD_ON ) && ... */
+
 #define CANIF_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
 #include <MemMap.h>
 
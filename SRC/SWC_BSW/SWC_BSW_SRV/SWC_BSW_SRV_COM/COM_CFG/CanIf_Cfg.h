@@ -33,6 +33,7 @@
 #include <TSAutosar.h>          /* EB specific standard types */
 #include <Std_Types.h>          /* Autosar standard types */
 #include <Comstack_Types.h>     /* Autosar standard types */
+#include <IfxStm_reg.h>         /* STM time base for Tx buffer statistics */
 
 
 /* It is required by AUTOSAR include the headerfile that contains the post-build/link-time symbolic IDs here */
@@ -185,6 +186,37 @@
  */
 #define CANIF_PUBLIC_TX_BUFFERING   STD_ON
 
+/** \brief Tx priority bitmap switch
+ **
+ ** This constant defines whether the pending Tx requests of an HTH are kept
+ ** in a priority bitmap (constant time insertion and selection of the lowest
+ ** CAN ID) instead of a sorted list.
+ ** STD_ON    Priority bitmap is used
+ ** STD_OFF   Sorted list is used
+ **
+ ** The bitmap requires static Tx CAN IDs and at most
+ ** CANIF_TX_PRIO_MAX_SLOTS (32) buffered Tx L-PDUs per HTH; CanIf_Init()
+ ** reports CANIF_E_TX_PRIO_SLOTS to the DET otherwise.
+ */
+#define CANIF_TX_PRIO_BITMAP   STD_ON
+
+/** \brief Tx buffer statistics switch
+ **
+ ** This constant defines whether occupancy and residence time statistics
+ ** of the Tx buffers are recorded per HTH.
+ ** STD_ON    Statistics are recorded and CanIf_GetTxBufferStatistics() is
+ **           provided
+ ** STD_OFF   No statistics
+ */
+#define CANIF_TX_BUFFER_STATISTICS   STD_ON
+
+/** \brief Macro for reading the Tx buffer residence time base
+ **
+ ** This macro shall return a free running 32 bit timer value which is used
+ ** to measure how long a Tx request stays in the Tx buffer (STM0 ticks).
+ */
+#define CANIF_TX_BUFFER_GET_TIMESTAMP()   ((uint32)MODULE_STM0.TIM0.U)
+
 /** \brief DLC check switch
  **
  ** This constant defines whether the DLC check is used or not.
@@ -541,6 +541,36 @@
 #define DBG_CANIF_SENDNEXTTXREQUEST_EXIT(a)
 #endif
 
+#ifndef DBG_CANIF_INITTXPRIOSLOTS_ENTRY
+/** \brief Entry point of function CanIf_InitTxPrioSlots() */
+#define DBG_CANIF_INITTXPRIOSLOTS_ENTRY()
+#endif
+
+#ifndef DBG_CANIF_INITTXPRIOSLOTS_EXIT
+/** \brief Exit point of function CanIf_InitTxPrioSlots() */
+#define DBG_CANIF_INITTXPRIOSLOTS_EXIT()
+#endif
+
+#ifndef DBG_CANIF_GETTXBUFFERSTATISTICS_ENTRY
+/** \brief Entry point of function CanIf_GetTxBufferStatistics() */
+#define DBG_CANIF_GETTXBUFFERSTATISTICS_ENTRY(a,b)
+#endif
+
+#ifndef DBG_CANIF_GETTXBUFFERSTATISTICS_EXIT
+/** \brief Exit point of function CanIf_GetTxBufferStatistics() */
+#define DBG_CANIF_GETTXBUFFERSTATISTICS_EXIT(a,b,c)
+#endif
+
+#ifndef DBG_CANIF_RESETTXBUFFERSTATISTICS_ENTRY
+/** \brief Entry point of function CanIf_ResetTxBufferStatistics() */
+#define DBG_CANIF_RESETTXBUFFERSTATISTICS_ENTRY(a)
+#endif
+
+#ifndef DBG_CANIF_RESETTXBUFFERSTATISTICS_EXIT
+/** \brief Exit point of function CanIf_ResetTxBufferStatistics() */
+#define DBG_CANIF_RESETTXBUFFERSTATISTICS_EXIT(a)
+#endif
+
 #ifndef DBG_CANIF_CLEARHTHTXREQUESTS_ENTRY
 /** \brief Entry point of function CanIf_ClearHthTxRequests() */
 #define DBG_CANIF_CLEARHTHTXREQUESTS_ENTRY(a)
@@ -362,6 +362,42 @@
   CANIF_TRANSLATE_TX_CAN_ID( CanIf_TxPduConfigPtr[(CanTxPduId)].canId );
 #endif /* CANIF_SETDYNAMICTXID_API */
 
+
+
+#if( CANIF_TX_PRIO_BITMAP == STD_ON )
+
+#if( CANIF_SETDYNAMICTXID_API == STD_ON )
+#error CANIF_TX_PRIO_BITMAP requires static Tx CAN IDs (CANIF_SETDYNAMICTXID_API == STD_OFF)
+#endif /* CANIF_SETDYNAMICTXID_API == STD_ON */
+
+/** \brief Maximum number of buffered Tx L-PDUs per HTH
+ **
+ ** This is the number of priority slots available in one pending Tx request
+ ** bitmap.
+ */
+#define CANIF_TX_PRIO_MAX_SLOTS  32U
+
+/** \brief Get highest priority slot of a pending Tx request bitmap
+ **
+ ** This macro returns the index of the least significant bit set in
+ ** \p Bitmap, i.e. the slot of the pending request with the lowest CAN ID.
+ ** The lowest set bit is isolated and mapped to its index by a de Bruijn
+ ** sequence, which takes constant time.
+ **
+ ** Precondition:
+ ** - \p Bitmap must not be zero.
+ **
+ ** \param[in] Bitmap Pending Tx request bitmap of an HTH
+ **
+ ** \return Slot index, range: 0..CANIF_TX_PRIO_MAX_SLOTS-1
+ */
+#define CANIF_TX_PRIO_GET_FIRST_SLOT( Bitmap ) \
+  ( CanIf_TxPrioDeBruijnTbl[ \
+      (uint32)( ( (uint32)(Bitmap) & ( 0UL - (uint32)(Bitmap) ) ) \
+                * 0x077CB531UL ) >> 27U ] )
+
+#endif /* CANIF_TX_PRIO_BITMAP == STD_ON */
+
 #endif /* CANIF_PUBLIC_TX_BUFFERING == STD_ON */
 
 
@@ -672,6 +708,23 @@ STATIC FUNC( void, CANIF_CODE ) CanIf_SendNextTxRequest
 STATIC FUNC( void, CANIF_CODE ) CanIf_ClearHthTxRequests
   ( CONST( Can_HwHandleType, AUTOMATIC ) CanHth );
 
+
+
+#if( CANIF_TX_PRIO_BITMAP == STD_ON )
+/** \brief Initialize Tx priority slots
+ **
+ ** This function assigns each Tx buffer the rank of its Tx L-PDU's CAN ID
+ ** among all buffered Tx L-PDUs of the same HTH. The rank is used as bit
+ ** position in the HTH's pending Tx request bitmap so that the pending
+ ** request with the lowest CAN ID is always found at the lowest set bit.
+ **
+ ** Precondition:
+ ** - The configuration pointers must already be set by CanIf_Init()
+ ** - At most CANIF_TX_PRIO_MAX_SLOTS buffered Tx L-PDUs per HTH
+ */
+STATIC FUNC( void, CANIF_CODE ) CanIf_InitTxPrioSlots( void );
+#endif /* CANIF_TX_PRIO_BITMAP == STD_ON */
+
 #endif /* CANIF_PUBLIC_TX_BUFFERING == STD_ON */
 
 /** \brief Setting of internal PDU mode when Rx Offline mode is requested
@@ -832,6 +885,25 @@ STATIC FUNC( void, CANIF_CODE ) CanIf_SendTxConfirmation
 
 /*==================[internal constants]=====================================*/
 
+#if( ( CANIF_PUBLIC_TX_BUFFERING == STD_ON ) && ( CANIF_TX_PRIO_BITMAP == STD_ON ) )
+
+#define CANIF_START_SEC_CONST_UNSPECIFIED
+/* Deviation MISRA-1 */
+#include <MemMap.h>
+
+/** \brief Bit index lookup table for the de Bruijn sequence 0x077CB531 */
+STATIC CONST( uint8, CANIF_APPL_CONST ) CanIf_TxPrioDeBruijnTbl[32U] =
+{
+   0U,  1U, 28U,  2U, 29U, 14U, 24U,  3U, 30U, 22U, 20U, 15U, 25U, 17U,  4U,  8U,
+  31U, 27U, 13U, 23U, 21U, 19U, 16U,  7U, 26U, 12U, 18U,  6U, 11U,  5U, 10U,  9U
+};
+
+#define CANIF_STOP_SEC_CONST_UNSPECIFIED
+/* Deviation MISRA-1 */
+#include <MemMap.h>
+
+#endif /* ( CANIF_PUBLIC_TX_BUFFERING == STD_ON ) && ... */
+
 /*==================[external data]==========================================*/
 
 #define CANIF_START_SEC_VAR_NO_INIT_UNSPECIFIED
@@ -1156,6 +1228,17 @@ FUNC( void, CANIF_CODE ) CanIf_Init
       for( i = 0U; i < CanIf_DriverConfigPtr->nrOfHths; i++ )
       {
         CanIf_NrOfPendingTxRequests[i] = 0U;
+#if( CANIF_TX_PRIO_BITMAP == STD_ON )
+        CanIf_TxPrioBitmap[i] = 0UL;
+#endif /* CANIF_TX_PRIO_BITMAP == STD_ON */
+#if( CANIF_TX_BUFFER_STATISTICS == STD_ON )
+        CanIf_TxBufferStatistics[i].sumResidenceTime = 0UL;
+        CanIf_TxBufferStatistics[i].maxResidenceTime = 0UL;
+        CanIf_TxBufferStatistics[i].nrOfEnqueued = 0UL;
+        CanIf_TxBufferStatistics[i].nrOfDequeued = 0UL;
+        CanIf_TxBufferStatistics[i].nrOfReplaced = 0U;
+        CanIf_TxBufferStatistics[i].maxOccupancy = 0U;
+#endif /* CANIF_TX_BUFFER_STATISTICS == STD_ON */
       }
 #endif /* CANIF_PUBLIC_TX_BUFFERING == STD_ON */
 
@@ -1174,6 +1257,11 @@ FUNC( void, CANIF_CODE ) CanIf_Init
         CanIf_TxBuffer[i].length = CANIF_INVALID_DLC;
       }
 
+#if( CANIF_TX_PRIO_BITMAP == STD_ON )
+      /* rank buffered Tx L-PDUs by CAN ID within their HTH */
+      CanIf_InitTxPrioSlots();
+#endif /* CANIF_TX_PRIO_BITMAP == STD_ON */
+
 #endif /* CANIF_PUBLIC_TX_BUFFERING == STD_ON */
 
       /* --- controller and pdu modes --- */
@@ -2845,6 +2933,100 @@ FUNC( CanIf_NotifStatusType, CANIF_CODE ) CanIf_GetTxConfirmationState
 }
 #endif /* CANIF_PUBLIC_TXCONFIRM_POLLING_SUPPORT == STD_ON */
 
+#if( ( CANIF_PUBLIC_TX_BUFFERING == STD_ON ) && \
+     ( CANIF_TX_BUFFER_STATISTICS == STD_ON ) )
+FUNC( Std_ReturnType, CANIF_CODE ) CanIf_GetTxBufferStatistics
+  (
+    Can_HwHandleType HthIdx,
+    P2VAR( CanIf_TxBufferStatisticsType, AUTOMATIC, CANIF_APPL_DATA ) StatisticsPtr
+  )
+{
+  VAR( Std_ReturnType, AUTOMATIC ) RetVal = E_NOT_OK;   /* return value */
+
+  DBG_CANIF_GETTXBUFFERSTATISTICS_ENTRY(HthIdx,StatisticsPtr);
+
+  if( CanIf_State == CANIF_UNINITIALIZED )
+  {
+#if( CANIF_DEV_ERROR_DETECT == STD_ON )
+    /* report DET error */
+    CANIF_DET_REPORT_ERROR( CANIF_MODULE_ID,
+                            CANIF_INSTANCE_ID,
+                            CANIF_SID_GETTXBUFFERSTATISTICS,
+                            CANIF_E_UNINIT
+                          );
+#endif /* CANIF_DEV_ERROR_DETECT == STD_ON */
+  }
+  else if( StatisticsPtr == NULL_PTR )
+  {
+#if( CANIF_DEV_ERROR_DETECT == STD_ON )
+    /* report DET error */
+    CANIF_DET_REPORT_ERROR( CANIF_MODULE_ID,
+                            CANIF_INSTANCE_ID,
+                            CANIF_SID_GETTXBUFFERSTATISTICS,
+                            CANIF_E_PARAM_POINTER
+                          );
+#endif /* CANIF_DEV_ERROR_DETECT == STD_ON */
+  }
+  else if( HthIdx >= CanIf_DriverConfigPtr->nrOfHths )
+  {
+    /* invalid HTH index: return E_NOT_OK */
+  }
+  else
+  {
+    /* copy a consistent snapshot of the statistics */
+    SchM_Enter_CanIf_SCHM_CANIF_EXCLUSIVE_AREA_0();
+    *StatisticsPtr = CanIf_TxBufferStatistics[HthIdx];
+    SchM_Exit_CanIf_SCHM_CANIF_EXCLUSIVE_AREA_0();
+
+    RetVal = E_OK;
+  }
+
+  DBG_CANIF_GETTXBUFFERSTATISTICS_EXIT(RetVal,HthIdx,StatisticsPtr);
+  return RetVal;
+}
+
+
+
+FUNC( void, CANIF_CODE ) CanIf_ResetTxBufferStatistics
+  (
+    Can_HwHandleType HthIdx
+  )
+{
+  DBG_CANIF_RESETTXBUFFERSTATISTICS_ENTRY(HthIdx);
+
+  if( CanIf_State == CANIF_UNINITIALIZED )
+  {
+#if( CANIF_DEV_ERROR_DETECT == STD_ON )
+    /* report DET error */
+    CANIF_DET_REPORT_ERROR( CANIF_MODULE_ID,
+                            CANIF_INSTANCE_ID,
+                            CANIF_SID_RESETTXBUFFERSTATISTICS,
+                            CANIF_E_UNINIT
+                          );
+#endif /* CANIF_DEV_ERROR_DETECT == STD_ON */
+  }
+  else if( HthIdx < CanIf_DriverConfigPtr->nrOfHths )
+  {
+    SchM_Enter_CanIf_SCHM_CANIF_EXCLUSIVE_AREA_0();
+    CanIf_TxBufferStatistics[HthIdx].sumResidenceTime = 0UL;
+    CanIf_TxBufferStatistics[HthIdx].maxResidenceTime = 0UL;
+    CanIf_TxBufferStatistics[HthIdx].nrOfEnqueued = 0UL;
+    CanIf_TxBufferStatistics[HthIdx].nrOfDequeued = 0UL;
+    CanIf_TxBufferStatistics[HthIdx].nrOfReplaced = 0U;
+    /* restart the high-water mark at the current occupancy */
+    CanIf_TxBufferStatistics[HthIdx].maxOccupancy =
+      (uint16)CanIf_NrOfPendingTxRequests[HthIdx];
+    SchM_Exit_CanIf_SCHM_CANIF_EXCLUSIVE_AREA_0();
+  }
+  else
+  {
+    /* invalid HTH index: nothing to reset */
+  }
+
+  DBG_CANIF_RESETTXBUFFERSTATISTICS_EXIT(HthIdx);
+}
+#endif /* ( CANIF_PUBLIC_TX_BUFFERING == STD_ON ) && ... */
+
 #if (CANIF_PUBLIC_PN_SUPPORT == STD_ON) && ( CANIF_TRCV_SUPPORT == STD_ON)
 FUNC( Std_ReturnType, CANIF_CODE ) CanIf_ClearTrcvWufFlag
   (
@@ -4150,6 +4332,13 @@ STATIC FUNC( Std_ReturnType, CANIF_CODE ) CanIf_BufferMessage
           (CanIf_LPduIndexType)CanTxPduId
         );
     }
+#if( CANIF_TX_BUFFER_STATISTICS == STD_ON )
+    else
+    {
+      /* an older pending request of this L-PDU was overwritten */
+      (CanIf_TxBufferStatistics[CanHthIdx].nrOfReplaced)++;
+    }
+#endif /* CANIF_TX_BUFFER_STATISTICS == STD_ON */
 
     /* function successful */
     RetVal = E_OK;
@@ -4920,7 +5109,11 @@ STATIC FUNC( void, CANIF_CODE ) CanIf_FreeControllerTxBuffers
   )
 {
   VAR( Can_HwHandleType, AUTOMATIC ) i;     /* loop variable */
+#if( CANIF_TX_PRIO_BITMAP == STD_ON )
+  VAR( uint32, AUTOMATIC ) Bitmap;          /* pending Tx request bitmap */
+#else /* CANIF_TX_PRIO_BITMAP == STD_ON */
   VAR( CanIf_LPduIndexType, AUTOMATIC ) j;  /* loop variable */
+#endif /* CANIF_TX_PRIO_BITMAP == STD_ON */
   VAR( PduIdType, AUTOMATIC ) TxPduId;      /* Tx L-PDU ID */
   P2CONST( CanIf_HthConfigType, AUTOMATIC, CANIF_APPL_CONST )
     HthConfigPtr = &CANIF_CFG_GET_HTH_CFG(0U); /* HTH array */
@@ -4941,6 +5134,17 @@ STATIC FUNC( void, CANIF_CODE ) CanIf_FreeControllerTxBuffers
       {
         /* There are pending transmit requests */
 
+#if( CANIF_TX_PRIO_BITMAP == STD_ON )
+        /* for all occupied priority slots ... */
+        for( Bitmap = CanIf_TxPrioBitmap[i];
+             Bitmap != 0UL;
+             Bitmap &= ( Bitmap - 1UL ) )
+        {
+          CanIf_TxBufferIndexType BufIdx; /* Tx buffer index */
+
+          TxPduId = CanIf_PendingTxBuffers[(HthConfigPtr[i]).firstIndex +
+                                           CANIF_TX_PRIO_GET_FIRST_SLOT( Bitmap )];
+#else /* CANIF_TX_PRIO_BITMAP == STD_ON */
         /* for all pending Tx requests ... */
         for( j = (HthConfigPtr[i]).firstIndex +
                  CanIf_NrOfPendingTxRequests[i];
@@ -4952,6 +5156,7 @@ STATIC FUNC( void, CANIF_CODE ) CanIf_FreeControllerTxBuffers
           /* j is used as "index+1" because it might be an unsigned
              variable and otherwise an underflow could happen */
           TxPduId = CanIf_PendingTxBuffers[j-1U];
+#endif /* CANIF_TX_PRIO_BITMAP == STD_ON */
 
           BufIdx = CANIF_GET_TX_BUFFER_INDEX( TxPduId );
           /* CHECK: NOPARSE */
@@ -4969,6 +5174,9 @@ STATIC FUNC( void, CANIF_CODE ) CanIf_FreeControllerTxBuffers
 
         /* correct number of pending Tx requests */
         CanIf_NrOfPendingTxRequests[i] = 0U;
+#if( CANIF_TX_PRIO_BITMAP == STD_ON )
+        CanIf_TxPrioBitmap[i] = 0UL;
+#endif /* CANIF_TX_PRIO_BITMAP == STD_ON */
       }
       /* else : no pending Tx requests */
     }
@@ -4990,19 +5198,32 @@ STATIC FUNC( void, CANIF_CODE ) CanIf_AddPendingTxRequest
     CONST( CanIf_LPduIndexType, AUTOMATIC ) CanTxPduId
   )
 {
+#if( CANIF_TX_PRIO_BITMAP == STD_ON )
+  VAR( uint8, AUTOMATIC ) Slot;       /* priority slot of new msg. */
+#else /* CANIF_TX_PRIO_BITMAP == STD_ON */
   VAR( uint32, AUTOMATIC ) NewCanId;  /* CAN ID of new msg. */
   VAR( uint32, AUTOMATIC ) CmpCanId;  /* CAN ID for comparisson */
 
   VAR( CanIf_LPduIndexType, AUTOMATIC ) CurIdx;   /* current index */
+#endif /* CANIF_TX_PRIO_BITMAP == STD_ON */
   VAR( CanIf_LPduIndexType, AUTOMATIC ) FirstIdx; /* first index for hth */
 
   DBG_CANIF_ADDPENDINGTXREQUEST_ENTRY(CanHthIdx,CanTxPduId);
 
   FirstIdx = CANIF_CFG_GET_HTH_CFG(CanHthIdx).firstIndex;
-  CurIdx = FirstIdx + CanIf_NrOfPendingTxRequests[CanHthIdx];
 
   /* --- add new message to list --------------------------------------- */
 
+#if( CANIF_TX_PRIO_BITMAP == STD_ON )
+  /* each buffered L-PDU owns a fixed slot ranked by its CAN ID, so the
+     request is stored without moving any other pending request */
+  Slot = CanIf_TxPrioSlot[CANIF_GET_TX_BUFFER_INDEX( CanTxPduId )];
+
+  CanIf_PendingTxBuffers[FirstIdx + Slot] = CanTxPduId;
+  CanIf_TxPrioBitmap[CanHthIdx] |= (uint32)( 1UL << Slot );
+#else /* CANIF_TX_PRIO_BITMAP == STD_ON */
+  CurIdx = FirstIdx + CanIf_NrOfPendingTxRequests[CanHthIdx];
+
   /* sort list with new element */
   /* NOTE
      A kind of insertion sort is used because in each case all messages
@@ -5037,10 +5258,26 @@ STATIC FUNC( void, CANIF_CODE ) CanIf_AddPendingTxRequest
     }
   }
 
-  /* write Tx L-PDU ID and increase number of pending messages */
+  /* write Tx L-PDU ID */
   CanIf_PendingTxBuffers[CurIdx] = CanTxPduId;
+#endif /* CANIF_TX_PRIO_BITMAP == STD_ON */
+
+  /* increase number of pending messages */
   (CanIf_NrOfPendingTxRequests[CanHthIdx])++;
 
+#if( CANIF_TX_BUFFER_STATISTICS == STD_ON )
+  /* remember enqueue time and update occupancy statistics */
+  CanIf_TxBufferTimeStamp[CANIF_GET_TX_BUFFER_INDEX( CanTxPduId )] =
+    CANIF_TX_BUFFER_GET_TIMESTAMP();
+  (CanIf_TxBufferStatistics[CanHthIdx].nrOfEnqueued)++;
+  if( CanIf_NrOfPendingTxRequests[CanHthIdx] >
+      CanIf_TxBufferStatistics[CanHthIdx].maxOccupancy )
+  {
+    CanIf_TxBufferStatistics[CanHthIdx].maxOccupancy =
+      (uint16)CanIf_NrOfPendingTxRequests[CanHthIdx];
+  }
+#endif /* CANIF_TX_BUFFER_STATISTICS == STD_ON */
+
   DBG_CANIF_ADDPENDINGTXREQUEST_EXIT(CanHthIdx,CanTxPduId);
 }
 
@@ -5075,6 +5312,10 @@ STATIC FUNC( void, CANIF_CODE ) CanIf_SendNextTxRequest
     CanIf_TxBufferIndexType BufferIdx = CANIF_INVALID_TX_BUFFER_INDEX;
     /* CAN PDU */
     Can_PduType CanPduInfo;
+#if( CANIF_TX_PRIO_BITMAP == STD_ON )
+    /* priority slot of the pending request */
+    uint32 SlotMask = 0UL;
+#endif /* CANIF_TX_PRIO_BITMAP == STD_ON */
 
     /* enter critical section */
     SchM_Enter_CanIf_SCHM_CANIF_EXCLUSIVE_AREA_0();
@@ -5085,7 +5326,14 @@ STATIC FUNC( void, CANIF_CODE ) CanIf_SendNextTxRequest
     if( PendNr > 0U )
     {
       /* get pending Tx L-PDU ID and associated buffer index*/
+#if( CANIF_TX_PRIO_BITMAP == STD_ON )
+      CONST( uint8, AUTOMATIC ) Slot =
+        CANIF_TX_PRIO_GET_FIRST_SLOT( CanIf_TxPrioBitmap[CanHthIdx] );
+      CanIf_LPduIndexType CanTxPduId = CanIf_PendingTxBuffers[StartIdx+Slot];
+      SlotMask = (uint32)( 1UL << Slot );
+#else /* CANIF_TX_PRIO_BITMAP == STD_ON */
       CanIf_LPduIndexType CanTxPduId = CanIf_PendingTxBuffers[(StartIdx+PendNr)-1U];
+#endif /* CANIF_TX_PRIO_BITMAP == STD_ON */
       BufferIdx = CANIF_GET_TX_BUFFER_INDEX( CanTxPduId );
 
       /* CHECK: NOPARSE */
@@ -5096,6 +5344,9 @@ STATIC FUNC( void, CANIF_CODE ) CanIf_SendNextTxRequest
         /* there is no Tx buffer assigned to this L-PDU or the buffer is empty
            -> internal ERROR
            -> remove L-PDU from the list */
+#if( CANIF_TX_PRIO_BITMAP == STD_ON )
+        CanIf_TxPrioBitmap[CanHthIdx] &= ~SlotMask;
+#endif /* CANIF_TX_PRIO_BITMAP == STD_ON */
         (CanIf_NrOfPendingTxRequests[CanHthIdx])--;
       }
       else
@@ -5126,11 +5377,36 @@ STATIC FUNC( void, CANIF_CODE ) CanIf_SendNextTxRequest
         /* enter critical section */
         SchM_Enter_CanIf_SCHM_CANIF_EXCLUSIVE_AREA_0();
 
-        /* either message was successfully transmitted or message is erroneous
-           -> remove message from buffer */
-        CANIF_INVALIDATE_TX_BUFFER( BufferIdx );
-        /* decrease number of pending Tx requests */
-        (CanIf_NrOfPendingTxRequests[CanHthIdx])--;
+#if( CANIF_TX_PRIO_BITMAP == STD_ON )
+        /* the queue may have been cleared (e.g. bus-off) while the driver
+           was called: only remove the request if its slot is still used */
+        if( ( CanIf_TxPrioBitmap[CanHthIdx] & SlotMask ) != 0UL )
+#endif /* CANIF_TX_PRIO_BITMAP == STD_ON */
+        {
+#if( CANIF_TX_BUFFER_STATISTICS == STD_ON )
+          if( CanRetVal == CAN_OK )
+          {
+            CONST( uint32, AUTOMATIC ) ResidenceTime =
+              CANIF_TX_BUFFER_GET_TIMESTAMP() - CanIf_TxBufferTimeStamp[BufferIdx];
+
+            (CanIf_TxBufferStatistics[CanHthIdx].nrOfDequeued)++;
+            CanIf_TxBufferStatistics[CanHthIdx].sumResidenceTime += ResidenceTime;
+            if( ResidenceTime > CanIf_TxBufferStatistics[CanHthIdx].maxResidenceTime )
+            {
+              CanIf_TxBufferStatistics[CanHthIdx].maxResidenceTime = ResidenceTime;
+            }
+          }
+#endif /* CANIF_TX_BUFFER_STATISTICS == STD_ON */
+
+          /* either message was successfully transmitted or message is erroneous
+             -> remove message from buffer */
+          CANIF_INVALIDATE_TX_BUFFER( BufferIdx );
+#if( CANIF_TX_PRIO_BITMAP == STD_ON )
+          CanIf_TxPrioBitmap[CanHthIdx] &= ~SlotMask;
+#endif /* CANIF_TX_PRIO_BITMAP == STD_ON */
+          /* decrease number of pending Tx requests */
+          (CanIf_NrOfPendingTxRequests[CanHthIdx])--;
+        }
 
         /* leave critical section */
         SchM_Exit_CanIf_SCHM_CANIF_EXCLUSIVE_AREA_0();
@@ -5152,10 +5428,14 @@ STATIC FUNC( void, CANIF_CODE ) CanIf_ClearHthTxRequests
   VAR( PduIdType, AUTOMATIC ) CanTxPduId;   /* CAN Tx L-PDU ID */
   VAR( CanIf_LPduIndexType, AUTOMATIC ) StartIdx;
                                             /* first pending request index */
+#if( CANIF_TX_PRIO_BITMAP == STD_ON )
+  VAR( uint32, AUTOMATIC ) Bitmap;          /* pending Tx request bitmap */
+#else /* CANIF_TX_PRIO_BITMAP == STD_ON */
   VAR( CanIf_LPduIndexType, AUTOMATIC ) PendNr;
+                                            /* number of pending requests */
+#endif /* CANIF_TX_PRIO_BITMAP == STD_ON */
 
   DBG_CANIF_CLEARHTHTXREQUESTS_ENTRY(CanHth);
-                                            /* number of pending requests */
 
   /* enter critical section */
   SchM_Enter_CanIf_SCHM_CANIF_EXCLUSIVE_AREA_0();
@@ -5163,6 +5443,42 @@ STATIC FUNC( void, CANIF_CODE ) CanIf_ClearHthTxRequests
   /* initialize variables */
   CanHthIdx = (Can_HwHandleType) CANIF_GET_HTH_INDEX(CanHth);
 
+#if( CANIF_TX_PRIO_BITMAP == STD_ON )
+  /* read start index and occupied priority slots */
+  StartIdx = CANIF_CFG_GET_HTH_CFG(CanHthIdx).firstIndex;
+  Bitmap = CanIf_TxPrioBitmap[CanHthIdx];
+
+  while( Bitmap != 0UL )
+  {
+    /* there is at least one message pending for transmission */
+
+    CanIf_TxBufferIndexType BufferIdx;  /* index of Tx buffer */
+
+    /* get pending Tx L-PDU ID and associated buffer index */
+    CanTxPduId = CanIf_PendingTxBuffers[StartIdx + CANIF_TX_PRIO_GET_FIRST_SLOT( Bitmap )];
+    BufferIdx = CANIF_GET_TX_BUFFER_INDEX( CanTxPduId );
+
+    /* release buffer if it is used */
+    /* CHECK: NOPARSE */
+    if(    ( BufferIdx == CANIF_INVALID_TX_BUFFER_INDEX )
+        || ( CANIF_TX_BUFFER_IS_EMPTY( BufferIdx ) == TRUE )
+      )
+    {
+      ;
+    }
+    else
+    /* CHECK: PARSE */
+    {
+      CANIF_INVALIDATE_TX_BUFFER( BufferIdx );
+    }
+
+    /* release priority slot */
+    Bitmap &= ( Bitmap - 1UL );
+  }
+
+  CanIf_TxPrioBitmap[CanHthIdx] = 0UL;
+  CanIf_NrOfPendingTxRequests[CanHthIdx] = 0U;
+#else /* CANIF_TX_PRIO_BITMAP == STD_ON */
   /* read start index and number of pending requests */
   StartIdx = CANIF_CFG_GET_HTH_CFG(CanHthIdx).firstIndex;
   PendNr = CanIf_NrOfPendingTxRequests[CanHthIdx];
@@ -5198,6 +5514,7 @@ STATIC FUNC( void, CANIF_CODE ) CanIf_ClearHthTxRequests
     /* read current number of pending requests */
     PendNr = CanIf_NrOfPendingTxRequests[CanHthIdx];
   }
+#endif /* CANIF_TX_PRIO_BITMAP == STD_ON */
 
   /* leave critical section */
   SchM_Exit_CanIf_SCHM_CANIF_EXCLUSIVE_AREA_0();
@@ -5205,6 +5522,76 @@ STATIC FUNC( void, CANIF_CODE ) CanIf_ClearHthTxRequests
   DBG_CANIF_CLEARHTHTXREQUESTS_EXIT(CanHth);
 }
 
+
+
+#if( CANIF_TX_PRIO_BITMAP == STD_ON )
+/** \brief Initialize Tx priority slots */
+STATIC FUNC( void, CANIF_CODE ) CanIf_InitTxPrioSlots( void )
+{
+  VAR( CanIf_LPduIndexType, AUTOMATIC ) i;  /* loop variable */
+  VAR( CanIf_LPduIndexType, AUTOMATIC ) j;  /* loop variable */
+
+  DBG_CANIF_INITTXPRIOSLOTS_ENTRY();
+
+  for( i = 0U; i < CanIf_ConfigPtr->nrOfTxLPdus; i++ )
+  {
+    CONST( CanIf_TxBufferIndexType, AUTOMATIC ) BufIdx =
+      CANIF_GET_TX_BUFFER_INDEX( i );
+
+    if( BufIdx != CANIF_INVALID_TX_BUFFER_INDEX )
+    {
+      VAR( uint32, AUTOMATIC ) CanId;     /* compare value of L-PDU i */
+      VAR( uint32, AUTOMATIC ) CmpCanId;  /* compare value of L-PDU j */
+      VAR( uint8, AUTOMATIC ) Rank = 0U;  /* priority slot of L-PDU i */
+
+      CanId = (uint32)CANIF_GET_BUFFERED_CAN_ID( i );
+      CanId = CANIF_CONVERT_ID_FOR_COMPARISON( CanId );
+
+      /* count buffered L-PDUs of the same HTH with higher priority; equal
+         CAN IDs are ranked by L-PDU index so that each slot is unique */
+      for( j = 0U; j < CanIf_ConfigPtr->nrOfTxLPdus; j++ )
+      {
+        if(    ( j != i )
+            && ( CANIF_GET_TX_BUFFER_INDEX( j ) != CANIF_INVALID_TX_BUFFER_INDEX )
+            && ( CanIf_TxPduConfigPtr[j].hth == CanIf_TxPduConfigPtr[i].hth )
+          )
+        {
+          CmpCanId = (uint32)CANIF_GET_BUFFERED_CAN_ID( j );
+          CmpCanId = CANIF_CONVERT_ID_FOR_COMPARISON( CmpCanId );
+
+          if(    ( ( CmpCanId < CanId ) || ( ( CmpCanId == CanId ) && ( j < i ) ) )
+              && ( Rank < CANIF_TX_PRIO_MAX_SLOTS )
+            )
+          {
+            Rank++;
+          }
+        }
+      }
+
+      /* the slot is a bit index of the 32 bit pending request bitmap */
+      if( Rank >= CANIF_TX_PRIO_MAX_SLOTS )
+      {
+#if( CANIF_DEV_ERROR_DETECT == STD_ON )
+        CANIF_DET_REPORT_ERROR( CANIF_MODULE_ID,
+                                CANIF_INSTANCE_ID,
+                                CANIF_SID_INIT,
+                                CANIF_E_TX_PRIO_SLOTS
+                              );
+#endif /* CANIF_DEV_ERROR_DETECT == STD_ON */
+
+        /* keep the shift defined; the L-PDUs of the lowest priority then
+           share the last slot and replace each other */
+        Rank = (uint8)( CANIF_TX_PRIO_MAX_SLOTS - 1U );
+      }
+
+      CanIf_TxPrioSlot[BufIdx] = Rank;
+    }
+  }
+
+  DBG_CANIF_INITTXPRIOSLOTS_EXIT();
+}
+#endif /* CANIF_TX_PRIO_BITMAP == STD_ON */
+
 #endif /* CANIF_PUBLIC_TX_BUFFERING == STD_ON */
 
 
@@ -141,6 +141,12 @@
 /** \brief CanIf_CheckTrcvWakeFlagIndication() service ID */
 #define CANIF_SID_CHECKTRCVWAKEFLAGIND      0x21U
 
+/** \brief CanIf_GetTxBufferStatistics() service ID */
+#define CANIF_SID_GETTXBUFFERSTATISTICS     0x80U
+
+/** \brief CanIf_ResetTxBufferStatistics() service ID */
+#define CANIF_SID_RESETTXBUFFERSTATISTICS   0x81U
+
 /*------------------[Development error codes]--------------------------------*/
 
 /** \brief CANIF_E_PARAM_CANID */
@@ -790,6 +796,54 @@ extern FUNC( CanIf_NotifStatusType, CANIF_CODE ) CanIf_GetTxConfirmationState
   );
 #endif /* CANIF_PUBLIC_TXCONFIRM_POLLING_SUPPORT == STD_ON */
 
+#if( ( CANIF_PUBLIC_TX_BUFFERING == STD_ON ) && \
+     ( CANIF_TX_BUFFER_STATISTICS == STD_ON ) )
+/** \brief Read Tx buffer statistics of an HTH
+ **
+ ** This function copies the Tx buffer occupancy and residence time
+ ** statistics of the HTH with the CanIf internal index \p HthIdx to
+ ** \p StatisticsPtr.
+ **
+ ** Preconditions:
+ ** - The CAN interface must already be initialized by CanIf_Init()
+ **
+ ** \param[in] HthIdx CanIf internal HTH index, range: 0..Number of HTHs-1
+ ** \param[out] StatisticsPtr Destination of the statistics
+ **
+ ** \return Result of operation
+ ** \retval E_OK      Statistics have been copied
+ ** \retval E_NOT_OK  Module uninitialized or invalid parameter
+ **
+ ** \ServiceID{0x80}
+ ** \Reentrancy{Reentrant}
+ ** \Synchronicity{Synchronous}
+ */
+extern FUNC( Std_ReturnType, CANIF_CODE ) CanIf_GetTxBufferStatistics
+  (
+    Can_HwHandleType HthIdx,
+    P2VAR( CanIf_TxBufferStatisticsType, AUTOMATIC, CANIF_APPL_DATA ) StatisticsPtr
+  );
+
+/** \brief Reset Tx buffer statistics of an HTH
+ **
+ ** This function clears the Tx buffer statistics of the HTH with the CanIf
+ ** internal index \p HthIdx. Pending Tx requests are not affected.
+ **
+ ** Preconditions:
+ ** - The CAN interface must already be initialized by CanIf_Init()
+ **
+ ** \param[in] HthIdx CanIf internal HTH index, range: 0..Number of HTHs-1
+ **
+ ** \ServiceID{0x81}
+ ** \Reentrancy{Reentrant}
+ ** \Synchronicity{Synchronous}
+ */
+extern FUNC( void, CANIF_CODE ) CanIf_ResetTxBufferStatistics
+  (
+    Can_HwHandleType HthIdx
+  );
+#endif /* ( CANIF_PUBLIC_TX_BUFFERING == STD_ON ) && ... */
+
 #if ((CANIF_PUBLIC_PN_SUPPORT == STD_ON) && (CANIF_TRCV_SUPPORT == STD_ON ))
 /** \brief Clear WUF flag of the designated CAN transceiver
  **
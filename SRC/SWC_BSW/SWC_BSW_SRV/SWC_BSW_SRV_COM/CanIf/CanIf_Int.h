@@ -110,6 +110,9 @@
 #define CANIF_E_INVALID_DLC                 61U
 
 #define CANIF_E_NOT_SLEEP                   71U
+
+/** \brief More than CANIF_TX_PRIO_MAX_SLOTS buffered Tx L-PDUs in one HTH */
+#define CANIF_E_TX_PRIO_SLOTS               72U
   /* --- partial networking ---------------------------------------------- */
 
 /** \brief Block the Tx PDU by the partial networking filter */
@@ -553,6 +556,18 @@ extern VAR( uint8, CANIF_VAR ) CanIf_RxBuffer[];
 
 #endif /* CANIF_READRXPDU_NOTIF_STATUS_API == STD_ON */
 
+#if( ( CANIF_PUBLIC_TX_BUFFERING == STD_ON ) && ( CANIF_TX_PRIO_BITMAP == STD_ON ) )
+/** \brief Priority slots of the Tx buffers
+ **
+ ** This array contains for each Tx buffer the rank of its Tx L-PDU's CAN ID
+ ** among the buffered Tx L-PDUs of the same HTH (0 = highest priority). It
+ ** is calculated by CanIf_Init().
+ */
+/* Deviation MISRA-1 */
+extern VAR( uint8, CANIF_VAR )
+  CanIf_TxPrioSlot[];
+#endif /* ( CANIF_PUBLIC_TX_BUFFERING == STD_ON ) && ... */
+
 /* Deviation MISRA-1 */
 extern VAR( CanIf_ControllerModeType, CANIF_VAR )
   CanIf_CanControllerMode[];
@@ -627,6 +642,29 @@ extern VAR( CanIf_LPduIndexType, CANIF_VAR )
   CanIf_DynamicTxLPduCanIds[];
 #endif /* CANIF_SETDYNAMICTXID_API == STD_ON */
 
+#if( ( CANIF_PUBLIC_TX_BUFFERING == STD_ON ) && ( CANIF_TX_PRIO_BITMAP == STD_ON ) )
+/** \brief Pending Tx request bitmaps
+ **
+ ** This array contains for each HTH a bitmap of occupied priority slots. Bit
+ ** n set means that the pending request of slot n is stored in
+ ** CanIf_PendingTxBuffers[firstIndex + n].
+ */
+/* Deviation MISRA-1 */
+extern VAR( uint32, CANIF_VAR )
+  CanIf_TxPrioBitmap[];
+#endif /* ( CANIF_PUBLIC_TX_BUFFERING == STD_ON ) && ... */
+
+#if( ( CANIF_PUBLIC_TX_BUFFERING == STD_ON ) && ( CANIF_TX_BUFFER_STATISTICS == STD_ON ) )
+/** \brief Tx buffer enqueue time stamps
+ **
+ ** This array contains for each Tx buffer the time at which its pending
+ ** request was added to the queue.
+ */
+/* Deviation MISRA-1 */
+extern VAR( uint32, CANIF_VAR )
+  CanIf_TxBufferTimeStamp[];
+#endif /* ( CANIF_PUBLIC_TX_BUFFERING == STD_ON ) && ... */
+
 #define CANIF_STOP_SEC_VAR_NO_INIT_32
 #include <MemMap.h>
 
@@ -661,6 +699,17 @@ extern VAR( CanIf_TxBufferType, CANIF_VAR )
 
 #endif /* CANIF_PUBLIC_TX_BUFFERING */
 
+#if( ( CANIF_PUBLIC_TX_BUFFERING == STD_ON ) && ( CANIF_TX_BUFFER_STATISTICS == STD_ON ) )
+/** \brief Tx buffer statistics
+ **
+ ** This array contains the occupancy and residence time statistics of the
+ ** Tx buffers of each HTH.
+ */
+/* Deviation MISRA-1 */
+extern VAR( CanIf_TxBufferStatisticsType, CANIF_VAR )
+  CanIf_TxBufferStatistics[];
+#endif /* ( CANIF_PUBLIC_TX_BUFFERING == STD_ON ) && ... */
+
 #define CANIF_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
 #include <MemMap.h>
 
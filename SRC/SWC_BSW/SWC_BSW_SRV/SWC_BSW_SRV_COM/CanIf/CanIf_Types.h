@@ -252,6 +252,25 @@ typedef struct
   uint8 data[CANIF_MAXIMUM_CAN_DLC];    /**< data */
 } CanIf_TxBufferType;
 
+#if( ( CANIF_PUBLIC_TX_BUFFERING == STD_ON ) && \
+     ( CANIF_TX_BUFFER_STATISTICS == STD_ON ) )
+/** \brief Type for Tx buffer statistics
+ **
+ ** This type holds the occupancy and residence time statistics of the Tx
+ ** buffers of one HTH. Residence times are given in ticks of
+ ** CANIF_TX_BUFFER_GET_TIMESTAMP().
+ */
+typedef struct
+{
+  uint32 sumResidenceTime;  /**< sum of residence times of dequeued requests */
+  uint32 maxResidenceTime;  /**< longest residence time of a request */
+  uint32 nrOfEnqueued;      /**< number of requests added to the queue */
+  uint32 nrOfDequeued;      /**< number of requests passed to the CAN driver */
+  uint16 nrOfReplaced;      /**< number of pending requests overwritten */
+  uint16 maxOccupancy;      /**< highest number of pending requests */
+} CanIf_TxBufferStatisticsType;
+#endif /* ( CANIF_PUBLIC_TX_BUFFERING == STD_ON ) && ... */
+
 
 
 
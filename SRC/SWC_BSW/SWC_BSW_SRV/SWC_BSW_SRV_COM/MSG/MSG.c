@@ -39,10 +39,13 @@
 #include "CanTp.h"
 #include "Com.h"
 #include "BSW.h"
+#include "IfxStm_reg.h"
 
 /******************************************************************************/
 /* DEFINES                                                                    */
 /******************************************************************************/
+/* Free running STM0 time base (100 MHz) for Rx acknowledge time stamps       */
+#define MSG_u32GET_TIME_STAMP()   ((uint32)MODULE_STM0.TIM0.U)
 
 /******************************************************************************/
 /* DATA DEFINITION                                                            */
@@ -97,6 +100,12 @@ void MSG_vidInit(void)
    BSW_u32CbkRxAckCnt_SGECM3 = 0;
    BSW_u32CbkRxAckCnt_SGIP1 = 0;
 
+   BSW_u32CbkRxAckTs_SGABS1 = 0;
+   BSW_u32CbkRxAckTs_SGABS2 = 0;
+   BSW_u32CbkRxAckTs_SGECM1 = 0;
+   BSW_u32CbkRxAckTs_SGECM2 = 0;
+   BSW_u32CbkRxAckTs_SGESC1 = 0;
+
 
 /*----------------------------------------------------------------------------*/
 /* COM MSG TCU Rx frames Timeout Init                                      */
@@ -276,6 +285,7 @@ FUNC(void, COM_APPL_CODE) BSW_vidCbkRxTOut_SGAmbAirTemp_641R(void)
 FUNC(void, COM_APPL_CODE) BSW_vidCbkRxAck_SGWhlSpdFrntLeRaw_529R(void)
 {
    BSW_bCbkRxTOutFlag_SGABS1 = FALSE;
+   BSW_u32CbkRxAckTs_SGABS1 = MSG_u32GET_TIME_STAMP();
    BSW_u32CbkRxAckCnt_SGABS1++;
 }
 /******************************************************************************/
@@ -292,6 +302,7 @@ FUNC(void, COM_APPL_CODE) BSW_vidCbkRxAck_SGWhlSpdFrntLeRaw_529R(void)
 FUNC(void, COM_APPL_CODE) BSW_vidCbkRxAck_SGAbsCtrlActv_545R(void)
 {
    BSW_bCbkRxTOutFlag_SGABS2 = FALSE;
+   BSW_u32CbkRxAckTs_SGABS2 = MSG_u32GET_TIME_STAMP();
    BSW_u32CbkRxAckCnt_SGABS2++;
 }
 /******************************************************************************/
@@ -308,6 +319,7 @@ FUNC(void, COM_APPL_CODE) BSW_vidCbkRxAck_SGAbsCtrlActv_545R(void)
 FUNC(void, COM_APPL_CODE) BSW_vidCbkRxAck_SGAccrPedlRat_273R(void)
 {
    BSW_bCbkRxTOutFlag_SGECM1 = FALSE;
+   BSW_u32CbkRxAckTs_SGECM1 = MSG_u32GET_TIME_STAMP();
    BSW_u32CbkRxAckCnt_SGECM1++;
 }
 /******************************************************************************/
@@ -324,6 +336,7 @@ FUNC(void, COM_APPL_CODE) BSW_vidCbkRxAck_SGAccrPedlRat_273R(void)
 FUNC(void, COM_APPL_CODE) BSW_vidCbkRxAck_SGCrsCtrlCtrlActv_289R(void)
 {
    BSW_bCbkRxTOutFlag_SGECM2 = FALSE;
+   BSW_u32CbkRxAckTs_SGECM2 = MSG_u32GET_TIME_STAMP();
    BSW_u32CbkRxAckCnt_SGECM2++;
 }
 /******************************************************************************/
@@ -340,6 +353,7 @@ FUNC(void, COM_APPL_CODE) BSW_vidCbkRxAck_SGCrsCtrlCtrlActv_289R(void)
 FUNC(void, COM_APPL_CODE) BSW_vidCbkRxAck_SGAlgt_561R(void)
 {
    BSW_bCbkRxTOutFlag_SGESC1 = FALSE;
+   BSW_u32CbkRxAckTs_SGESC1 = MSG_u32GET_TIME_STAMP();
    BSW_u32CbkRxAckCnt_SGESC1++;
 }
 /******************************************************************************/
@@ -31,6 +31,8 @@
 /* DAQ.4 / SPY_vidDaqListStopd                                                */
 /* DAQ.5 / SPY_vidWrBuf                                                       */
 /* DAQ.6 / SPY_vidStopDataAcq                                                 */
+/* DAQ.7 / SPY_vidCmpWrSmpl                                                   */
+/* DAQ.8 / SPY_u8CmpChkTrig                                                   */
 /******************************************************************************/
 
 #include "spy.h"
@@ -49,6 +51,23 @@
 #include "Os.h"
 #include "micro.h"
 
+#include "BSW.h"
+#include "Dem.h"
+#include "IfxStm_reg.h"
+
+#if ((SPY_CMP_RING_SIZE & (SPY_CMP_RING_SIZE - 1)) != 0)
+   #error SPY_CMP_RING_SIZE shall be a power of 2
+#endif
+#if ((SPY_CMP_KEY_TBL_SIZE & (SPY_CMP_KEY_TBL_SIZE - 1)) != 0)
+   #error SPY_CMP_KEY_TBL_SIZE shall be a power of 2
+#endif
+#if ((SPY_CMP_KEY_TBL_SIZE * SPY_CMP_KEY_DIST) < SPY_CMP_RING_SIZE)
+   #error The key samples table shall cover the compressed ring
+#endif
+#if ((SPY_CMP_POST_EVENT_SIZE + SPY_CMP_KEY_DIST + (4 * SPY_NB_SGN)) > SPY_CMP_RING_SIZE)
+   #error The post trigger data shall leave pre-trigger context in the compressed ring
+#endif
+
 
 
 /**********************************************************************************************************************/
@@ -66,6 +85,12 @@ typedef enum
 }
 SPY_tenuStt;
 
+/* States of the compressed recorder (SPY_u8CmpStt) */
+#define SPY_u8CMP_STT_OFF        0
+#define SPY_u8CMP_STT_RECORDING  1
+#define SPY_u8CMP_STT_POST_TRIG  2
+#define SPY_u8CMP_STT_FROZEN     3
+
 
 /**********************************************************************************************************************/
 /* DEFINES DEFINITION                                                                                                 */
@@ -73,6 +98,21 @@ SPY_tenuStt;
 #define SPY_u16NR_OF_SMPLS      SPY_MAX_QTY_DATA
 #define SPY_u16NR_OF_RMNG_SMPLS SPY_MAX_QTY_DATA_POST_EVENT
 
+/* Compressed samples: sequence of tokens covering the SPY_u16CmpSmplLen     */
+/* bytes of the sample, each byte compared with the previous sample          */
+/*   0x00..0x7F : (n + 1) unchanged bytes                                    */
+/*   0x80..0xFF : (n - 0x7F) changed bytes, whose values follow the token    */
+/* Key samples are compared with a sample of zeros.                          */
+#define SPY_u8CMP_TOK_LIT        0x80
+#define SPY_u8CMP_TOK_LEN_MAX    128
+#define SPY_u32CMP_RING_MSK      (SPY_CMP_RING_SIZE - 1)
+#define SPY_u32CMP_KEY_TBL_MSK   (SPY_CMP_KEY_TBL_SIZE - 1)
+/* Worst case size of a compressed sample                                    */
+#define SPY_u32CMP_SMPL_MAX      (2 * SPY_NB_SGN)
+
+/* Free running STM0 time base (100 MHz) for the encoding cost measurement   */
+#define SPY_u32GET_TIME_STAMP()  ((uint32)MODULE_STM0.TIM0.U)
+
 
 /**********************************************************************************************************************/
 /* VARIABLES DEFINITION                                                                                               */
@@ -82,9 +122,27 @@ SPY_tenuStt;
    uint8       SPY_au8Smpls[SPY_MAX_QTY_DATA][SPY_NB_SGN];
    uint8 **    SPY_ppu8DaqListElmAdr;
    SPY_tenuStt SPY_enuStt;    
+   static uint8   SPY_au8CmpPrvSmpl[SPY_NB_SGN];
+   static uint8   SPY_au8CmpCurSmpl[SPY_NB_SGN];
+   static uint8   SPY_u8TrigLvlPrv;
+   static boolean SPY_bCmpManTrigReq;
 #define SPY_STOP_SEC_VAR_UNSPECIFIED
 #include "MemMap.h"
 
+/* Compressed ring, read by the tool (CCP upload) while recording continues: */
+/* byte n of the stream is at SPY_au8CmpRing[n & SPY_u32CMP_RING_MSK] and    */
+/* SPY_u32CmpWrCnt is the number of bytes written since the start. Key      */
+/* sample k starts at byte SPY_au32CmpKeyPos[k & (SPY_CMP_KEY_TBL_SIZE-1)]   */
+/* and is the sample SPY_au32CmpKeySmpl[k & (SPY_CMP_KEY_TBL_SIZE-1)], with  */
+/* k < SPY_u32CmpKeyCnt.                                                     */
+#define SPY_START_SEC_SPY_BUFFER
+#include "MemMap.h"
+   uint8       SPY_au8CmpRing[SPY_CMP_RING_SIZE];
+   uint32      SPY_au32CmpKeyPos[SPY_CMP_KEY_TBL_SIZE];
+   uint32      SPY_au32CmpKeySmpl[SPY_CMP_KEY_TBL_SIZE];
+#define SPY_STOP_SEC_SPY_BUFFER
+#include "MemMap.h"
+
 
 /**********************************************************************************************************************/
 /* FUNCTIONS DEFINITION                                                                                               */
@@ -92,6 +150,9 @@ SPY_tenuStt;
 #define SPY_START_SEC_CODE
 #include "MemMap.h"
 
+static void  SPY_vidCmpWrSmpl(const uint8 *pku8Smpl, uint16 u16Len);
+static uint8 SPY_u8CmpChkTrig(const uint8 *pku8Smpl, uint16 u16Len);
+
 /*********************************************** <AUTO_FUNCTION_HEADER> ***********************************************/
 /*                                                                                                                    */
 /* !FuncName    : SPY_vidInit                                                                                         */
@@ -115,6 +176,13 @@ void SPY_vidInit(void)
    SPY_u16RmngSmplIdx        = SPY_u16NR_OF_RMNG_SMPLS;
    SPY_bBufFull              = FALSE;
    SPY_enuStt                = SPY_enuSTT_INIT;
+
+   SPY_u8CmpStt              = SPY_u8CMP_STT_OFF;
+   SPY_u8TrigSrc             = 0;
+   SPY_u8TrigLvlPrv          = 0;
+   SPY_bCmpManTrigReq        = FALSE;
+   SPY_bCmpRearmReq          = FALSE;
+   SPY_u32CmpEncTiMax        = 0;
 }
 
 /*********************************************** <AUTO_FUNCTION_HEADER> ***********************************************/
@@ -251,16 +319,45 @@ void SPY_vidWrBuf(void)
    uint16_least u16LocRmngSmplIdx;
    uint16_least u16LocNrOfElms;
    uint8      * pu8Dest;
+   uint8      * pu8Smpl;
    uint8     ** ppu8Src;
+   boolean      bLocBufFull;
+   boolean      bLocCmpActv;
 
 
    u16LocSmplIdx  = SPY_u16SmplIdx;
    u16LocNrOfElms = SPY_u16NrOfElmsToTx;
+   bLocBufFull    = SPY_bBufFull;
+   bLocCmpActv    = FALSE;
+   if (  (SPY_bCmpOnC != FALSE)
+      && (u16LocNrOfElms != 0)
+      && (u16LocNrOfElms <= SPY_NB_SGN)
+      )
+   {
+      bLocCmpActv = TRUE;
+   }
+   else
+   {
+      SPY_u8CmpStt = SPY_u8CMP_STT_OFF;
+   }
+
    if (  (u16LocNrOfElms != 0)
-      && (SPY_bBufFull == FALSE)
+      && (  (bLocBufFull == FALSE)
+         || (bLocCmpActv == TRUE)
+         )
       )
    {
-      pu8Dest    = &SPY_au8Smpls[u16LocSmplIdx][0];
+      /* The sample is stored in the raw ring if it is not full, otherwise */
+      /* in a scratch buffer for the compressed recorder only              */
+      if (bLocBufFull == FALSE)
+      {
+         pu8Dest = &SPY_au8Smpls[u16LocSmplIdx][0];
+      }
+      else
+      {
+         pu8Dest = &SPY_au8CmpCurSmpl[0];
+      }
+      pu8Smpl    = pu8Dest;
       ppu8Src    = &SPY_ppu8DaqListElmAdr[0];
       u16LocIdx  = (u16LocNrOfElms + 7) >> 3;
 
@@ -277,6 +374,16 @@ void SPY_vidWrBuf(void)
                       } while(--u16LocIdx > 0);
       }
 
+      if (bLocCmpActv == TRUE)
+      {
+         SPY_vidCmpWrSmpl(pu8Smpl, (uint16)u16LocNrOfElms);
+      }
+   }
+
+   if (  (u16LocNrOfElms != 0)
+      && (bLocBufFull == FALSE)
+      )
+   {
       u16LocSmplIdx++;
       if (u16LocSmplIdx >= SPY_u16NR_OF_SMPLS)
       {
@@ -327,6 +434,242 @@ void SPY_vidStopDataAcq(void)
       SPY_u16RmngSmplIdx = 0;
       SPY_enuStt         = SPY_enuSTT_STARTED;
    }
+   SPY_bCmpManTrigReq = TRUE;
+}
+
+/*********************************************** <AUTO_FUNCTION_HEADER> ***********************************************/
+/*                                                                                                                    */
+/* !FuncName    : SPY_vidCmpWrSmpl                                                                                    */
+/*                                                                                                                    */
+/* !Description : Delta / run-length encodes a sample into the compressed ring and manages the triggers               */
+/* !Number      : 7                                                                                                   */
+/* !Reference   : NONE                                                                                                */
+/*                                                                                                                    */
+/* !Trace_To    : NONE                                                                                                */
+/*                                                                                                                    */
+/********************************************** </AUTO_FUNCTION_HEADER> ***********************************************/
+/* !LastAuthor  :                                                                                                     */
+/********************************************* <AUTO_FUNCTION_PROTOTYPE> **********************************************/
+static void SPY_vidCmpWrSmpl(const uint8 *pku8Smpl, uint16 u16Len)
+{
+   uint32       u32LocStrtTi;
+   uint32       u32LocEncTi;
+   uint32       u32LocWrCnt;
+   uint32       u32LocSmplPos;
+   uint32       u32LocKeyCnt;
+   uint32       u32LocRatio;
+   uint16_least u16LocIdx;
+   uint16_least u16LocRunStrt;
+   uint16_least u16LocRunLen;
+   uint8        u8LocTrigSrc;
+   boolean      bLocKey;
+
+
+   u32LocStrtTi = SPY_u32GET_TIME_STAMP();
+
+   /* (Re)start of the recording */
+   if (  (SPY_u8CmpStt == SPY_u8CMP_STT_OFF)
+      || (SPY_u16CmpSmplLen != u16Len)
+      || (  (SPY_u8CmpStt == SPY_u8CMP_STT_FROZEN)
+         && (SPY_bCmpRearmReq != FALSE)
+         )
+      )
+   {
+      SPY_bCmpRearmReq   = FALSE;
+      SPY_bCmpManTrigReq = FALSE;
+      SPY_u8TrigSrc      = 0;
+      SPY_u16CmpSmplLen  = u16Len;
+      SPY_u32CmpWrCnt    = 0;
+      SPY_u32CmpKeyCnt   = 0;
+      SPY_u32CmpTrigPos  = 0;
+      SPY_u32CmpTrigKeyPos = 0;
+      SPY_u32CmpSmplCnt  = 0;
+      SPY_u32CmpRawBytes = 0;
+      SPY_u32CmpEncBytes = 0;
+      SPY_u16CmpRatio    = 0;
+      SPY_u8CmpStt       = SPY_u8CMP_STT_RECORDING;
+   }
+   if (SPY_u8CmpStt == SPY_u8CMP_STT_FROZEN)
+   {
+      return;
+   }
+
+   u32LocWrCnt   = SPY_u32CmpWrCnt;
+   u32LocSmplPos = u32LocWrCnt;
+   u32LocKeyCnt  = SPY_u32CmpKeyCnt;
+   bLocKey       = FALSE;
+   if (  (u32LocKeyCnt == 0)
+      || ((u32LocWrCnt - SPY_au32CmpKeyPos[(u32LocKeyCnt - 1) & SPY_u32CMP_KEY_TBL_MSK]) >= SPY_CMP_KEY_DIST)
+      )
+   {
+      bLocKey = TRUE;
+      for (u16LocIdx = 0; u16LocIdx < u16Len; u16LocIdx++)
+      {
+         SPY_au8CmpPrvSmpl[u16LocIdx] = 0;
+      }
+   }
+
+   /* Encoding */
+   u16LocIdx = 0;
+   while (u16LocIdx < u16Len)
+   {
+      u16LocRunStrt = u16LocIdx;
+      u16LocRunLen  = 0;
+      if (pku8Smpl[u16LocIdx] == SPY_au8CmpPrvSmpl[u16LocIdx])
+      {
+         do
+         {
+            u16LocIdx++;
+            u16LocRunLen++;
+         }
+         while (  (u16LocIdx < u16Len)
+               && (u16LocRunLen < SPY_u8CMP_TOK_LEN_MAX)
+               && (pku8Smpl[u16LocIdx] == SPY_au8CmpPrvSmpl[u16LocIdx])
+               );
+         SPY_au8CmpRing[u32LocWrCnt & SPY_u32CMP_RING_MSK] = (uint8)(u16LocRunLen - 1);
+         u32LocWrCnt++;
+      }
+      else
+      {
+         do
+         {
+            SPY_au8CmpPrvSmpl[u16LocIdx] = pku8Smpl[u16LocIdx];
+            u16LocIdx++;
+            u16LocRunLen++;
+         }
+         while (  (u16LocIdx < u16Len)
+               && (u16LocRunLen < SPY_u8CMP_TOK_LEN_MAX)
+               && (pku8Smpl[u16LocIdx] != SPY_au8CmpPrvSmpl[u16LocIdx])
+               );
+         SPY_au8CmpRing[u32LocWrCnt & SPY_u32CMP_RING_MSK] = (uint8)(SPY_u8CMP_TOK_LIT | (u16LocRunLen - 1));
+         u32LocWrCnt++;
+         for (; u16LocRunStrt < u16LocIdx; u16LocRunStrt++)
+         {
+            SPY_au8CmpRing[u32LocWrCnt & SPY_u32CMP_RING_MSK] = pku8Smpl[u16LocRunStrt];
+            u32LocWrCnt++;
+         }
+      }
+   }
+
+   /* Publication: data first, then the positions read by the tool */
+   if (bLocKey == TRUE)
+   {
+      SPY_au32CmpKeyPos[u32LocKeyCnt & SPY_u32CMP_KEY_TBL_MSK]  = u32LocSmplPos;
+      SPY_au32CmpKeySmpl[u32LocKeyCnt & SPY_u32CMP_KEY_TBL_MSK] = SPY_u32CmpSmplCnt;
+      SPY_u32CmpKeyCnt = u32LocKeyCnt + 1;
+   }
+   SPY_u32CmpWrCnt = u32LocWrCnt;
+   SPY_u32CmpSmplCnt++;
+
+   SPY_u32CmpRawBytes += u16Len;
+   SPY_u32CmpEncBytes += u32LocWrCnt - u32LocSmplPos;
+   if (  (bLocKey == TRUE)
+      && (SPY_u32CmpEncBytes >= 100)
+      )
+   {
+      /* Compression ratio in 1/100 */
+      u32LocRatio = SPY_u32CmpRawBytes / (SPY_u32CmpEncBytes / 100);
+      if (u32LocRatio > 0xFFFF)
+      {
+         u32LocRatio = 0xFFFF;
+      }
+      SPY_u16CmpRatio = (uint16)u32LocRatio;
+   }
+
+   /* Triggers */
+   if (SPY_u8CmpStt == SPY_u8CMP_STT_RECORDING)
+   {
+      u8LocTrigSrc = SPY_u8CmpChkTrig(pku8Smpl, u16Len);
+      if (u8LocTrigSrc != 0)
+      {
+         SPY_u8TrigSrc      = u8LocTrigSrc;
+         SPY_u32CmpTrigPos  = u32LocSmplPos;
+         SPY_u32CmpTrigSmpl = SPY_u32CmpSmplCnt - 1;
+         /* The trigger sample is decoded from the last key sample written before it (key count >= 1 here) */
+         SPY_u32CmpTrigKeyPos = SPY_au32CmpKeyPos[(SPY_u32CmpKeyCnt - 1) & SPY_u32CMP_KEY_TBL_MSK];
+         SPY_u8CmpStt       = SPY_u8CMP_STT_POST_TRIG;
+      }
+   }
+   else
+   {
+      /* Freezes once the post trigger bytes are written, or before the key sample the trigger sample is decoded */
+      /* from is overwritten                                                                                      */
+      if (  ((u32LocWrCnt - SPY_u32CmpTrigPos) >= SPY_CMP_POST_EVENT_SIZE)
+         || ((u32LocWrCnt - SPY_u32CmpTrigKeyPos) > (SPY_CMP_RING_SIZE - SPY_u32CMP_SMPL_MAX))
+         )
+      {
+         SPY_u8CmpStt = SPY_u8CMP_STT_FROZEN;
+      }
+   }
+
+   u32LocEncTi     = SPY_u32GET_TIME_STAMP() - u32LocStrtTi;
+   SPY_u32CmpEncTi = u32LocEncTi;
+   if (u32LocEncTi > SPY_u32CmpEncTiMax)
+   {
+      SPY_u32CmpEncTiMax = u32LocEncTi;
+   }
+}
+
+/*********************************************** <AUTO_FUNCTION_HEADER> ***********************************************/
+/*                                                                                                                    */
+/* !FuncName    : SPY_u8CmpChkTrig                                                                                    */
+/*                                                                                                                    */
+/* !Description : Evaluates the armed triggers of the compressed recorder, returns the triggers which have just      */
+/*                become active                                                                                       */
+/* !Number      : 8                                                                                                   */
+/* !Reference   : NONE                                                                                                */
+/*                                                                                                                    */
+/* !Trace_To    : NONE                                                                                                */
+/*                                                                                                                    */
+/********************************************** </AUTO_FUNCTION_HEADER> ***********************************************/
+/* !LastAuthor  :                                                                                                     */
+/********************************************* <AUTO_FUNCTION_PROTOTYPE> **********************************************/
+static uint8 SPY_u8CmpChkTrig(const uint8 *pku8Smpl, uint16 u16Len)
+{
+   uint8   u8LocArmMsk;
+   uint8   u8LocLvl;
+   uint8   u8LocEdge;
+   boolean bLocDtcFaild;
+
+
+   u8LocArmMsk = SPY_u8TrigArmMskC;
+   u8LocLvl    = 0;
+
+   if (  ((u8LocArmMsk & SPY_TRIG_SMPL_THD) != 0)
+      && (SPY_u8TrigSmplIdxC < u16Len)
+      && (pku8Smpl[SPY_u8TrigSmplIdxC] > SPY_u8TrigSmplThdC)
+      )
+   {
+      u8LocLvl |= SPY_TRIG_SMPL_THD;
+   }
+
+   if (  ((u8LocArmMsk & SPY_TRIG_CAN_TOUT) != 0)
+      && (SPY_TRIG_CAN_TOUT_FLG != FALSE)
+      )
+   {
+      u8LocLvl |= SPY_TRIG_CAN_TOUT;
+   }
+
+   if ((u8LocArmMsk & SPY_TRIG_DTC) != 0)
+   {
+      if (  (Dem_GetEventFailed(SPY_TRIG_DTC_EVT_ID, &bLocDtcFaild) == E_OK)
+         && (bLocDtcFaild != FALSE)
+         )
+      {
+         u8LocLvl |= SPY_TRIG_DTC;
+      }
+   }
+
+   /* Only rising edges trigger, so that a permanent condition does not re-trigger after re-arming */
+   u8LocEdge        = (uint8)(u8LocLvl & (uint8)(~SPY_u8TrigLvlPrv));
+   SPY_u8TrigLvlPrv = u8LocLvl;
+
+   if (SPY_bCmpManTrigReq != FALSE)
+   {
+      SPY_bCmpManTrigReq = FALSE;
+      u8LocEdge         |= SPY_TRIG_MANUAL;
+   }
+   return(u8LocEdge);
 }
 
 #define SPY_STOP_SEC_CODE
@@ -39,6 +39,15 @@
 #define DEVHAL_u8ENG_STATE_IN_PROGRESS       2U
 #define DEVHAL_u8ENG_STATE_AUTHORISED        1U
 
+/* !MComment: DEVHAL_u8CalibStoreStt available values                         */
+#define DEVHAL_u8CALIB_STORE_IDLE            0U
+#define DEVHAL_u8CALIB_STORE_ERASE           1U
+#define DEVHAL_u8CALIB_STORE_PROG            2U
+#define DEVHAL_u8CALIB_STORE_DONE            3U
+#define DEVHAL_u8CALIB_STORE_FAILED          4U
+#define DEVHAL_u8CALIB_STORE_CANCELLED       5U
+#define DEVHAL_u8CALIB_STORE_CHK             6U
+
 /******************************************************************************/
 /* MACROS                                                                     */
 /******************************************************************************/
@@ -74,6 +83,11 @@ void    DEVHAL_vidCopyCalibrationInFlash(void);
 void    DEVHAL_vidEraseCalibrationInFlash(void);
 void    DEVHAL_vidCopyFromRamToFlash(void);
 boolean DEVHAL_bIsErasing(void);
+boolean DEVHAL_bIsCalibStoreBusy(void);
+uint8   DEVHAL_u8GetCalibStoreStt(void);
+Std_ReturnType DEVHAL_udtStrtCalibStore(void);
+void    DEVHAL_vidCancelCalibStore(void);
+void    DEVHAL_vidCalibStoreMainFunction(void);
 
 #define DEVHAL_STOP_SEC_CODE
 #include "DEVHAL_MemMap.h"
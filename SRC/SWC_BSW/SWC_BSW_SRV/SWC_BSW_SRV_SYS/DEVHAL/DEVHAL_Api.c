@@ -40,6 +40,15 @@
 #include "FlsLoader_Local.h"
 #include "Os_api.h"
 #include "RSTSRV.h"
+#include "Crc.h"
+#include "Ovc.h"
+
+#if ((DEVHAL_u32SIZE_OF_CALIB % DEVHAL_u32CALIB_STORE_PAGE_SIZE) != 0)
+   #error "Calibration area shall be a multiple of DEVHAL_u32CALIB_STORE_PAGE_SIZE"
+#endif
+
+/* !Comment: Number of logical sector groups (PS0 to PS3) erased by the job   */
+#define DEVHAL_u8CALIB_STORE_NB_SECT_GRP 4U
 
 #define DEVHAL_START_SEC_CODE
 #include "DEVHAL_MemMap.h"
@@ -301,6 +310,262 @@ boolean DEVHAL_bIsErasing(void)
    return (DEVHAL_bIsFlsLoaderErasing);
 }
 
+/******************************************************************************/
+/* !FuncName    : DEVHAL_bIsCalibStoreBusy                                    */
+/* !Description : return TRUE while a calibration store job is running        */
+/*                                                                            */
+/* !LastAuthor  : K. Rungasamy                                                */
+/******************************************************************************/
+boolean DEVHAL_bIsCalibStoreBusy(void)
+{
+   if (  (DEVHAL_u8CalibStoreStt == DEVHAL_u8CALIB_STORE_CHK)
+      || (DEVHAL_u8CalibStoreStt == DEVHAL_u8CALIB_STORE_ERASE)
+      || (DEVHAL_u8CalibStoreStt == DEVHAL_u8CALIB_STORE_PROG))
+   {
+      return (TRUE);
+   }
+   return (FALSE);
+}
+
+/******************************************************************************/
+/* !FuncName    : DEVHAL_u8GetCalibStoreStt                                   */
+/* !Description : Returns the state of the calibration store job              */
+/*                                                                            */
+/* !LastAuthor  : K. Rungasamy                                                */
+/******************************************************************************/
+uint8 DEVHAL_u8GetCalibStoreStt(void)
+{
+   return (DEVHAL_u8CalibStoreStt);
+}
+
+/******************************************************************************/
+/* !FuncName    : DEVHAL_udtStrtCalibStore                                    */
+/* !Description : Starts the background store of the active calibration page  */
+/*                in flash. The job is run by DEVHAL_vidCalibStoreMainFunction*/
+/*                and page swaps are locked until it ends                     */
+/*                                                                            */
+/* !LastAuthor  : K. Rungasamy                                                */
+/******************************************************************************/
+Std_ReturnType DEVHAL_udtStrtCalibStore(void)
+{
+   if (  (DEVHAL_bCheckEmulCard() != TRUE)
+      || (DEVHAL_bIsCalibStoreBusy() == TRUE))
+   {
+      return(E_NOT_OK);
+   }
+   /* !Comment: Lock before reading the active page, a swap already requested */
+   /*           is then held until the end of the job                         */
+   OVC_vidLockPageSwt(TRUE);
+   DEVHAL_u32CalibStoreSrcAddr  = OVC_u32GetPhysPage((uint32 *)DEVHAL_u32CALIB_START_ADDRESS);
+   DEVHAL_u32CalibStoreOfs      = 0;
+   DEVHAL_u32CalibStoreErrAddr  = 0;
+   DEVHAL_u8CalibStoreSectIdx   = 0;
+   DEVHAL_u8CalibStoreEraseRetry = 0;
+   DEVHAL_u8CalibStoreProgress  = 0;
+   DEVHAL_bCalibStoreCancelReq  = FALSE;
+   DEVHAL_bIsFlsLoaderCopied    = FALSE;
+   DEVHAL_u8CalibStoreStt       = DEVHAL_u8CALIB_STORE_CHK;
+   return(E_OK);
+}
+
+/******************************************************************************/
+/* !FuncName    : DEVHAL_vidCancelCalibStore                                  */
+/* !Description : Requests the cancellation of the calibration store job. The */
+/*                job stops before its next erase or page write; the flash    */
+/*                calibration is then incomplete until a new store is done    */
+/*                                                                            */
+/* !LastAuthor  : K. Rungasamy                                                */
+/******************************************************************************/
+void DEVHAL_vidCancelCalibStore(void)
+{
+   if (DEVHAL_bIsCalibStoreBusy() == TRUE)
+   {
+      DEVHAL_bCalibStoreCancelReq = TRUE;
+   }
+}
+
+/******************************************************************************/
+/* !FuncName    : DEVHAL_vidCalibStoreEscalate                                */
+/* !Description : Called when the job fails after the erase has started: the  */
+/*                calibration flash is blank or partly programmed, so it is   */
+/*                rewritten by the blocking erase/program, then the ECU is    */
+/*                reset                                                       */
+/*                                                                            */
+/* !LastAuthor  : K. Rungasamy                                                */
+/******************************************************************************/
+static void DEVHAL_vidCalibStoreEscalate(void)
+{
+#if (DEVHAL_coCALIB_STORE_EMUL == STD_OFF)
+   DEVHAL_vidCopyCalibrationInFlash();
+#endif
+}
+
+/******************************************************************************/
+/* !FuncName    : DEVHAL_vidCalibStoreMainFunction                            */
+/* !Description : Runs one step of the calibration store job:                 */
+/*                - check of up to DEVHAL_u32CALIB_STORE_PAGES_PER_CALL pages */
+/*                  against the flash; the erase is skipped if none differs,  */
+/*                - erase of one logical sector group. A logical sector is    */
+/*                  the smallest erase unit and the PFLASH bank cannot be     */
+/*                  read while it is busy, so this step blocks for the whole  */
+/*                  sector erase,                                             */
+/*                - programming of up to DEVHAL_u32CALIB_STORE_PAGES_PER_CALL */
+/*                  pages, each one checked by CRC before the next one.      */
+/*                The ECU is reset at the end of a successful store so that   */
+/*                it restarts on the stored calibration                       */
+/*                                                                            */
+/* !LastAuthor  : K. Rungasamy                                                */
+/******************************************************************************/
+void DEVHAL_vidCalibStoreMainFunction(void)
+{
+   uint32 u32LocalPageIdx;
+   uint32 u32LocalSrc;
+   uint32 u32LocalDest;
+   uint32 u32LocalSectAddr;
+   uint32 u32LocalNbSect;
+   Std_ReturnType udtLocalRetValue;
+
+
+   u32LocalSectAddr = 0;
+   if (DEVHAL_bIsCalibStoreBusy() != TRUE)
+   {
+      return;
+   }
+
+   if (DEVHAL_bCalibStoreCancelReq == TRUE)
+   {
+      DEVHAL_bCalibStoreCancelReq = FALSE;
+      DEVHAL_bIsFlsLoaderErasing  = FALSE;
+      DEVHAL_u8CalibStoreStt      = DEVHAL_u8CALIB_STORE_CANCELLED;
+      OVC_vidLockPageSwt(FALSE);
+      return;
+   }
+
+   if (DEVHAL_u8CalibStoreStt == DEVHAL_u8CALIB_STORE_CHK)
+   {
+      for (u32LocalPageIdx = 0;
+           (u32LocalPageIdx < DEVHAL_u32CALIB_STORE_PAGES_PER_CALL)
+           && (DEVHAL_u32CalibStoreOfs < DEVHAL_u32SIZE_OF_CALIB);
+           u32LocalPageIdx++)
+      {
+         u32LocalSrc  = DEVHAL_u32CalibStoreSrcAddr + DEVHAL_u32CalibStoreOfs;
+         u32LocalDest = DEVHAL_u32CALIB_START_ADDRESS + DEVHAL_u32CalibStoreOfs;
+         if (  Crc_CalculateCRC32((const uint8 *)u32LocalSrc, DEVHAL_u32CALIB_STORE_PAGE_SIZE, 0, TRUE)
+            != DEVHAL_u32CalibStoreFlsCrc(u32LocalDest))
+         {
+            DEVHAL_u32CalibStoreOfs    = 0;
+            DEVHAL_bIsFlsLoaderErasing = TRUE;
+            DEVHAL_u8CalibStoreStt     = DEVHAL_u8CALIB_STORE_ERASE;
+            return;
+         }
+         DEVHAL_u32CalibStoreOfs += DEVHAL_u32CALIB_STORE_PAGE_SIZE;
+      }
+      if (DEVHAL_u32CalibStoreOfs >= DEVHAL_u32SIZE_OF_CALIB)
+      {
+         /* !Comment: Flash already holds the active page, nothing to store  */
+         DEVHAL_u8CalibStoreProgress = 100U;
+         DEVHAL_bIsFlsLoaderCopied   = TRUE;
+         DEVHAL_u8CalibStoreStt      = DEVHAL_u8CALIB_STORE_DONE;
+         OVC_vidLockPageSwt(FALSE);
+      }
+   }
+   else if (DEVHAL_u8CalibStoreStt == DEVHAL_u8CALIB_STORE_ERASE)
+   {
+      u32LocalNbSect = 0;
+      while (  (u32LocalNbSect == 0)
+            && (DEVHAL_u8CalibStoreSectIdx < DEVHAL_u8CALIB_STORE_NB_SECT_GRP))
+      {
+         switch (DEVHAL_u8CalibStoreSectIdx)
+         {
+            case 0:
+               u32LocalSectAddr = DEVHAL_u32CALIB_START_ADDR_PS0;
+               u32LocalNbSect   = DEVHAL_u32NUM_OF_LOGICAL_SECT_PS0;
+               break;
+            case 1:
+               u32LocalSectAddr = DEVHAL_u32CALIB_START_ADDR_PS1;
+               u32LocalNbSect   = DEVHAL_u32NUM_OF_LOGICAL_SECT_PS1;
+               break;
+            case 2:
+               u32LocalSectAddr = DEVHAL_u32CALIB_START_ADDR_PS2;
+               u32LocalNbSect   = DEVHAL_u32NUM_OF_LOGICAL_SECT_PS2;
+               break;
+            default:
+               u32LocalSectAddr = DEVHAL_u32CALIB_START_ADDR_PS3;
+               u32LocalNbSect   = DEVHAL_u32NUM_OF_LOGICAL_SECT_PS3;
+               break;
+         }
+         DEVHAL_u8CalibStoreSectIdx++;
+      }
+
+      if (u32LocalNbSect != 0)
+      {
+         udtLocalRetValue = DEVHAL_udtCalibStoreErase(u32LocalSectAddr, u32LocalNbSect);
+         if (udtLocalRetValue != E_OK)
+         {
+            DEVHAL_u32CalibStoreErrAddr = u32LocalSectAddr;
+            if (DEVHAL_u8CalibStoreEraseRetry < DEVHAL_u8CALIB_STORE_ERASE_RETRY)
+            {
+               /* !Comment: Erase the same sector group again on next call   */
+               DEVHAL_u8CalibStoreEraseRetry++;
+               DEVHAL_u8CalibStoreSectIdx--;
+               return;
+            }
+            DEVHAL_bIsFlsLoaderErasing  = FALSE;
+            DEVHAL_u8CalibStoreStt      = DEVHAL_u8CALIB_STORE_FAILED;
+            OVC_vidLockPageSwt(FALSE);
+            DEVHAL_vidCalibStoreEscalate();
+            return;
+         }
+         DEVHAL_u8CalibStoreEraseRetry = 0;
+      }
+      if (DEVHAL_u8CalibStoreSectIdx >= DEVHAL_u8CALIB_STORE_NB_SECT_GRP)
+      {
+         DEVHAL_bIsFlsLoaderErasing = FALSE;
+         DEVHAL_u8CalibStoreStt     = DEVHAL_u8CALIB_STORE_PROG;
+      }
+   }
+   else
+   {
+      for (u32LocalPageIdx = 0;
+           (u32LocalPageIdx < DEVHAL_u32CALIB_STORE_PAGES_PER_CALL)
+           && (DEVHAL_u32CalibStoreOfs < DEVHAL_u32SIZE_OF_CALIB);
+           u32LocalPageIdx++)
+      {
+         u32LocalSrc  = DEVHAL_u32CalibStoreSrcAddr + DEVHAL_u32CalibStoreOfs;
+         u32LocalDest = DEVHAL_u32CALIB_START_ADDRESS + DEVHAL_u32CalibStoreOfs;
+
+         udtLocalRetValue = DEVHAL_udtCalibStoreWrPage(u32LocalSrc, u32LocalDest);
+         if (  (udtLocalRetValue == E_OK)
+            && (  Crc_CalculateCRC32((const uint8 *)u32LocalSrc, DEVHAL_u32CALIB_STORE_PAGE_SIZE, 0, TRUE)
+               != DEVHAL_u32CalibStoreFlsCrc(u32LocalDest)))
+         {
+            udtLocalRetValue = E_NOT_OK;
+         }
+         if (udtLocalRetValue != E_OK)
+         {
+            DEVHAL_u32CalibStoreErrAddr = u32LocalDest;
+            DEVHAL_u8CalibStoreStt      = DEVHAL_u8CALIB_STORE_FAILED;
+            OVC_vidLockPageSwt(FALSE);
+            DEVHAL_vidCalibStoreEscalate();
+            return;
+         }
+         DEVHAL_u32CalibStoreOfs += DEVHAL_u32CALIB_STORE_PAGE_SIZE;
+      }
+
+      DEVHAL_u8CalibStoreProgress =
+         (uint8)((DEVHAL_u32CalibStoreOfs * 100U) / DEVHAL_u32SIZE_OF_CALIB);
+      if (DEVHAL_u32CalibStoreOfs >= DEVHAL_u32SIZE_OF_CALIB)
+      {
+         DEVHAL_bIsFlsLoaderCopied = TRUE;
+         DEVHAL_u8CalibStoreStt    = DEVHAL_u8CALIB_STORE_DONE;
+         OVC_vidLockPageSwt(FALSE);
+#if (DEVHAL_coCALIB_STORE_EMUL == STD_OFF)
+         RSTSRV_vidPerformReset(RSTSRV_udtHARDWARE_RESET);
+#endif
+      }
+   }
+}
+
 #define DEVHAL_STOP_SEC_CODE
 #include "DEVHAL_MemMap.h"
 
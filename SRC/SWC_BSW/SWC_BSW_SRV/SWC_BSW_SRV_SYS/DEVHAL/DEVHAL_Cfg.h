@@ -63,6 +63,25 @@
 
 #define DEVHAL_OVERLAY_INT_RAM_START_ADDRESS 0x70000000UL
 
+/* !Comment: Second (inactive) calibration page used for page switching       */
+#define DEVHAL_OVERLAY_SHDW_RAM_START_ADDRESS 0xBF010000UL
+
+
+/******************************************************************************/
+/* !Comment: Calibration store job                                            */
+/*           Bytes programmed by one FlsLoader_Write (multiple of 256 for     */
+/*           PFLASH) and number of pages handled by one main function call    */
+/******************************************************************************/
+#define DEVHAL_u32CALIB_STORE_PAGE_SIZE      256UL
+#define DEVHAL_u32CALIB_STORE_PAGES_PER_CALL 4UL
+
+/* !Comment: STD_ON: the job erases and programs a RAM image of the           */
+/*           calibration area instead of the PFLASH                           */
+#define DEVHAL_coCALIB_STORE_EMUL            STD_OFF
+
+/* !Comment: Erase retries of one sector group before the job escalates to   */
+/*           the blocking erase/program and reset                             */
+#define DEVHAL_u8CALIB_STORE_ERASE_RETRY     3U
 
 /* Start adress of EMEM */
 #define DEVHAL_u32EMEM_START_ADDR         DEVHAL_OVERLAY_RAM_START_ADDRESS
@@ -36,6 +36,7 @@ boolean DEVHAL_bIsFlsLoaderErasing;
 boolean DEVHAL_bIsFlsLoaderErased;
 boolean DEVHAL_bIsFlsLoaderCopied;
 boolean DEVHAL_bIsInitialized;
+boolean DEVHAL_bCalibStoreCancelReq;
 
 #define DEVHAL_STOP_SEC_VAR_CLEARED_BOOLEAN
 #include "DEVHAL_MemMap.h"
@@ -44,10 +45,24 @@ boolean DEVHAL_bIsInitialized;
 #include "DEVHAL_MemMap.h"
 
 uint8 DEVHAL_u8CheckEngineState;
+uint8 DEVHAL_u8CalibStoreStt;
+uint8 DEVHAL_u8CalibStoreProgress;
+uint8 DEVHAL_u8CalibStoreSectIdx;
+uint8 DEVHAL_u8CalibStoreEraseRetry;
 
 #define DEVHAL_STOP_SEC_VAR_CLEARED_8BIT
 #include "DEVHAL_MemMap.h"
 
+#define DEVHAL_START_SEC_VAR_UNSPECIFIED
+#include "DEVHAL_MemMap.h"
+
+uint32 DEVHAL_u32CalibStoreSrcAddr;
+uint32 DEVHAL_u32CalibStoreOfs;
+uint32 DEVHAL_u32CalibStoreErrAddr;
+
+#define DEVHAL_STOP_SEC_VAR_UNSPECIFIED
+#include "DEVHAL_MemMap.h"
+
 #define DEVHAL_START_SEC_VAR_INIT_UNSPECIFIED
 #include "DEVHAL_MemMap.h"
 
@@ -37,6 +37,7 @@ extern boolean DEVHAL_bIsFlsLoaderErasing;
 extern boolean DEVHAL_bIsFlsLoaderErased;
 extern boolean DEVHAL_bIsFlsLoaderCopied;
 extern boolean DEVHAL_bIsInitialized;
+extern boolean DEVHAL_bCalibStoreCancelReq;
 
 #define DEVHAL_STOP_SEC_VAR_CLEARED_BOOLEAN
 #include "DEVHAL_MemMap.h"
@@ -45,10 +46,24 @@ extern boolean DEVHAL_bIsInitialized;
 #include "DEVHAL_MemMap.h"
 
 extern uint8 DEVHAL_u8CheckEngineState;
+extern uint8 DEVHAL_u8CalibStoreStt;
+extern uint8 DEVHAL_u8CalibStoreProgress;
+extern uint8 DEVHAL_u8CalibStoreSectIdx;
+extern uint8 DEVHAL_u8CalibStoreEraseRetry;
 
 #define DEVHAL_STOP_SEC_VAR_CLEARED_8BIT
 #include "DEVHAL_MemMap.h"
 
+#define DEVHAL_START_SEC_VAR_UNSPECIFIED
+#include "DEVHAL_MemMap.h"
+
+extern uint32 DEVHAL_u32CalibStoreSrcAddr;
+extern uint32 DEVHAL_u32CalibStoreOfs;
+extern uint32 DEVHAL_u32CalibStoreErrAddr;
+
+#define DEVHAL_STOP_SEC_VAR_UNSPECIFIED
+#include "DEVHAL_MemMap.h"
+
 #define DEVHAL_START_SEC_VAR_INIT_UNSPECIFIED
 #include "DEVHAL_MemMap.h"
 
@@ -24,9 +24,27 @@
 #include "DEVHAL.h"
 #include "DEVHAL_I.h"
 #include "DEVHAL_Def.h"
+#include "DEVHAL_FlsLoader.h"
+#include "IfxScu_reg.h"
+#include "IfxScuWdt.h"
+#include "Mcal.h"
+#include "Mcu.h"
+#include "Crc.h"
+#include "Os_api.h"
 
 /*#define NB_BYTES     0x200*/
 
+#if (DEVHAL_coCALIB_STORE_EMUL == STD_ON)
+#define DEVHAL_START_SEC_VAR_UNSPECIFIED
+#include "DEVHAL_MemMap.h"
+
+/* !Comment: RAM image standing for the calibration area of the PFLASH        */
+static uint8 DEVHAL_au8CalibEmulFls[DEVHAL_u32SIZE_OF_CALIB];
+
+#define DEVHAL_STOP_SEC_VAR_UNSPECIFIED
+#include "DEVHAL_MemMap.h"
+#endif /* (DEVHAL_coCALIB_STORE_EMUL == STD_ON) */
+
 #define DEVHAL_START_SEC_CODE
 #include "DEVHAL_MemMap.h"
 
@@ -151,6 +169,141 @@ void DEVHAL_vidCopyCalib(uint32 u32SrcStartAddress, uint32 u32DestStartAddress,
    }
 }
 
+/******************************************************************************/
+/* !FuncName    : DEVHAL_udtCalibStoreErase                                   */
+/* !Description : Erases logical sectors for the calibration store job.       */
+/*                The erase cannot be interrupted and may outlast the         */
+/*                watchdog period, so only the software reset is enabled      */
+/*                during it, as done by DEVHAL_vidCopyCalibrationInFlash.     */
+/*                In emulation, clears the RAM image from u32StartAddress to  */
+/*                the end of the calibration area                             */
+/*                                                                            */
+/* !LastAuthor  : K. Rungasamy                                                */
+/******************************************************************************/
+Std_ReturnType DEVHAL_udtCalibStoreErase(uint32 u32StartAddress, uint32 u32NbSectors)
+{
+#if (DEVHAL_coCALIB_STORE_EMUL == STD_ON)
+   uint32 u32LocalIdx;
+
+
+   COMPILER_UNUSED_PARAMETER(u32NbSectors);
+   if (  (u32StartAddress < DEVHAL_u32CALIB_START_ADDRESS)
+      || (u32StartAddress >= DEVHAL_u32CALIB_END_ADDRESS))
+   {
+      return(E_NOT_OK);
+   }
+   for (u32LocalIdx = u32StartAddress - DEVHAL_u32CALIB_START_ADDRESS;
+        u32LocalIdx < DEVHAL_u32SIZE_OF_CALIB;
+        u32LocalIdx++)
+   {
+      DEVHAL_au8CalibEmulFls[u32LocalIdx] = 0;
+   }
+   return(E_OK);
+#else
+   uint32 u32LocalRstCon;
+
+
+   u32LocalRstCon = SCU_RSTCON.U;
+   Mcal_ResetSafetyENDINIT_Timed(MCU_SAFETY_ENDINT_TIMEOUT);
+   SCU_RSTCON.U = (uint32)MCU_SW_RESET_CONFIG;
+   Mcal_SetSafetyENDINIT_Timed();
+
+   DEVHAL_vidEraseCalib(u32StartAddress, u32NbSectors);
+
+   Mcal_ResetSafetyENDINIT_Timed(MCU_SAFETY_ENDINT_TIMEOUT);
+   SCU_RSTCON.U = u32LocalRstCon;
+   Mcal_SetSafetyENDINIT_Timed();
+   return((DEVHAL_bIsFlsLoaderErased == TRUE) ? E_OK : E_NOT_OK);
+#endif
+}
+
+/******************************************************************************/
+/* !FuncName    : DEVHAL_udtCalibStoreWrPage                                  */
+/* !Description : Programs one page of DEVHAL_u32CALIB_STORE_PAGE_SIZE bytes  */
+/*                for the calibration store job                               */
+/*                                                                            */
+/* !LastAuthor  : K. Rungasamy                                                */
+/******************************************************************************/
+Std_ReturnType DEVHAL_udtCalibStoreWrPage(uint32 u32SrcAddress, uint32 u32DestAddress)
+{
+#if (DEVHAL_coCALIB_STORE_EMUL == STD_ON)
+   uint32 u32LocalIdx;
+   uint8 *pu8LocalDest;
+   const uint8 *pu8LocalSrc;
+
+
+   if (  (u32DestAddress < DEVHAL_u32CALIB_START_ADDRESS)
+      || ((u32DestAddress + DEVHAL_u32CALIB_STORE_PAGE_SIZE) > DEVHAL_u32CALIB_END_ADDRESS))
+   {
+      return(E_NOT_OK);
+   }
+   pu8LocalDest = &DEVHAL_au8CalibEmulFls[u32DestAddress - DEVHAL_u32CALIB_START_ADDRESS];
+   pu8LocalSrc  = (const uint8 *)u32SrcAddress;
+   for (u32LocalIdx = 0; u32LocalIdx < DEVHAL_u32CALIB_STORE_PAGE_SIZE; u32LocalIdx++)
+   {
+      /* !Comment: Programming can only set bits of an erased cell            */
+      pu8LocalDest[u32LocalIdx] |= pu8LocalSrc[u32LocalIdx];
+   }
+   return(E_OK);
+#else
+   FlsLoader_ReturnType retval;
+
+
+   if (DEVHAL_bIsFlsLoaderInitialized != TRUE)
+   {
+      return(E_NOT_OK);
+   }
+   retval = FlsLoader_Write((FlsLoader_AddressType)u32DestAddress,
+                            (FlsLoader_LengthType)DEVHAL_u32CALIB_STORE_PAGE_SIZE,
+                            (const uint8 *)u32SrcAddress);
+   return((retval == FLSLOADER_E_OK) ? E_OK : E_NOT_OK);
+#endif
+}
+
+/******************************************************************************/
+/* !FuncName    : DEVHAL_u32CalibStoreFlsCrc                                  */
+/* !Description : Returns the CRC32 of one programmed page. Reads of the      */
+/*                calibration area are redirected by the overlay, so it is    */
+/*                disabled during the computation, under interrupt lock       */
+/*                                                                            */
+/* !LastAuthor  : K. Rungasamy                                                */
+/******************************************************************************/
+uint32 DEVHAL_u32CalibStoreFlsCrc(uint32 u32Address)
+{
+   uint32 u32LocalCrc;
+#if (DEVHAL_coCALIB_STORE_EMUL == STD_ON)
+
+
+   u32LocalCrc = Crc_CalculateCRC32(&DEVHAL_au8CalibEmulFls[u32Address - DEVHAL_u32CALIB_START_ADDRESS],
+                                    DEVHAL_u32CALIB_STORE_PAGE_SIZE,
+                                    0,
+                                    TRUE);
+#else
+   uint32 u32LocalOvcEna;
+   uint16 u16LocalPassword;
+
+
+   SuspendAllInterrupts();
+   u32LocalOvcEna = SCU_OVCENABLE.U;
+   u16LocalPassword = IfxScuWdt_getSafetyWatchdogPassword();
+   IfxScuWdt_clearSafetyEndinit(u16LocalPassword);
+   SCU_OVCENABLE.U = 0x0u;
+   IfxScuWdt_setSafetyEndinit(u16LocalPassword);
+
+   u32LocalCrc = Crc_CalculateCRC32((const uint8 *)u32Address,
+                                    DEVHAL_u32CALIB_STORE_PAGE_SIZE,
+                                    0,
+                                    TRUE);
+
+   u16LocalPassword = IfxScuWdt_getSafetyWatchdogPassword();
+   IfxScuWdt_clearSafetyEndinit(u16LocalPassword);
+   SCU_OVCENABLE.U = u32LocalOvcEna;
+   IfxScuWdt_setSafetyEndinit(u16LocalPassword);
+   ResumeAllInterrupts();
+#endif
+   return(u32LocalCrc);
+}
+
 #define DEVHAL_STOP_SEC_CODE
 #include "DEVHAL_MemMap.h"
 
@@ -34,6 +34,9 @@
 void DEVHAL_vidInitFlsLoader(void);
 void DEVHAL_vidEraseCalib(uint32 u32StartAddress, uint32 u32NbSectors);
 void DEVHAL_vidCopyCalib(uint32 u32SrcStartAddress, uint32 u32DestStartAddress, uint32 u32NbOfBytes);
+Std_ReturnType DEVHAL_udtCalibStoreErase(uint32 u32StartAddress, uint32 u32NbSectors);
+Std_ReturnType DEVHAL_udtCalibStoreWrPage(uint32 u32SrcAddress, uint32 u32DestAddress);
+uint32 DEVHAL_u32CalibStoreFlsCrc(uint32 u32Address);
 
 #define DEVHAL_STOP_SEC_CODE
 #include "DEVHAL_MemMap.h"
@@ -52,6 +52,33 @@
 #define SPY_MAX_QTY_DATA              (SPY_MAX_QTY_DATA_POST_EVENT + SPY_MAX_QTY_DATA_PRE_EVENT)
 #define SPY_NB_SGN                    SPY_MAX_ODT * 7      
 
+/*------------------------------------------------------------------------*/
+/* Compressed recorder                                                    */
+/*------------------------------------------------------------------------*/
+/* Size in bytes of the compressed ring (power of 2, in section SPY_BUFF, */
+/* mapped in dsram0 by LinkerDef.ld which bounds the section to 9 KB).    */
+/* A 42 byte sample takes 84 bytes at worst and about 9 bytes at a 5:1    */
+/* ratio: the ring holds 97 samples at worst and about 900 typically,     */
+/* i.e. below 1 s of context at 1 ms, not several seconds.                */
+#define SPY_CMP_RING_SIZE             0x2000UL
+/* Bytes of the stream recorded after the trigger sample before freezing  */
+/* the ring: half of it, the other half keeps the pre-trigger context     */
+#define SPY_CMP_POST_EVENT_SIZE       (SPY_CMP_RING_SIZE / 2)
+/* A key sample (encoded without reference) starts every SPY_CMP_KEY_DIST */
+/* bytes; the positions of the last SPY_CMP_KEY_TBL_SIZE key samples are  */
+/* kept so that the whole ring can be decoded (power of 2)                */
+#define SPY_CMP_KEY_DIST              256UL
+#define SPY_CMP_KEY_TBL_SIZE          64
+
+/* Triggers of the compressed recorder (bits of SPY_u8TrigArmMskC)        */
+#define SPY_TRIG_SMPL_THD             0x01  /* sample byte above threshold */
+#define SPY_TRIG_CAN_TOUT             0x02  /* CAN Rx timeout              */
+#define SPY_TRIG_DTC                  0x04  /* DTC test failed             */
+#define SPY_TRIG_MANUAL               0x80  /* SPY_vidStopDataAcq call     */
+
+#define SPY_TRIG_CAN_TOUT_FLG         BSW_bCbkRxTOutFlag_SGECM1
+#define SPY_TRIG_DTC_EVT_ID           DemConf_DemEventParameter_APPL_E_DDVFD_HVLowVoltage
+
 
 
 extern uint8 SPY_ValueArray[SPY_MAX_QTY_DATA][SPY_NB_SGN];
@@ -0,0 +1,192 @@
+/******************************************************************************/
+/* !Layer           : TST                                                     */
+/* !Component       : TST_MATHSRV                                             */
+/* !Description     : Test of MATH and MATHSRV optimised services             */
+/*                                                                            */
+/* !File            : TST_MATHSRV.c                                           */
+/* !Description     : Test runner. Each test compares an optimised service    */
+/*                    with its reference and times both. On target the run    */
+/*                    is requested over CCP; built with TST_MATHSRV_coHOST    */
+/*                    the file provides the main() of a host program.         */
+/*                                                                            */
+/* !Reference       :                                                         */
+/*                                                                            */
+/* Coding language  : C                                                       */
+/*                                                                            */
+/* COPYRIGHT VALEO all rights reserved                                        */
+/******************************************************************************/
+/* Dimension Informations
+ * %PCMS_HEADER_SUBSTITUTION_START:%
+ * The PID has this format: <Product ID>:<Item ID>.<Variant>-<Item Type>;<Revision>
+ * %PID:%
+ * %PCMS_HEADER_SUBSTITUTION_END:%
+ ******************************************************************************/
+
+#include "Std_Types.h"
+#include "TST_MATHSRV.h"
+#include "TST_MATHSRV_Cfg.h"
+
+#if (TST_MATHSRV_coHOST == STD_ON)
+#include <stdio.h>
+#include <time.h>
+#endif
+
+/******************************************************************************/
+/* LOCAL DEFINES                                                              */
+/******************************************************************************/
+
+#define TST_MATHSRV_u32RAND_SEED           0x12345678UL
+
+/******************************************************************************/
+/* GLOBAL VARIABLES DEFINITION                                                */
+/******************************************************************************/
+
+#define TST_START_SEC_TST_VAR
+#include "TST_MemMap.h"
+
+boolean TST_MATHSRV_bRunReq;
+uint32 TST_MATHSRV_u32MismatchCnt;
+TST_MATHSRV_tstrRes TST_MATHSRV_astrRes[TST_MATHSRV_u8RES_NB];
+
+static uint32 TST_MATHSRV_u32RandSt;
+
+#define TST_STOP_SEC_TST_VAR
+#include "TST_MemMap.h"
+
+/******************************************************************************/
+/* GLOBAL FUNCTIONS DEFINITION                                                */
+/******************************************************************************/
+
+#define TST_START_SEC_TST_CODE
+#include "TST_MemMap.h"
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidInit                                         */
+/* !Description : Initialization of TST_MATHSRV internal variables            */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+void TST_MATHSRV_vidInit(void)
+{
+   uint8 u8LocIdx;
+
+
+   TST_MATHSRV_bRunReq        = FALSE;
+   TST_MATHSRV_u32MismatchCnt = 0;
+   TST_MATHSRV_u32RandSt      = TST_MATHSRV_u32RAND_SEED;
+   for (u8LocIdx = 0; u8LocIdx < TST_MATHSRV_u8RES_NB; u8LocIdx++)
+   {
+      TST_MATHSRV_astrRes[u8LocIdx].u32CaseCnt     = 0;
+      TST_MATHSRV_astrRes[u8LocIdx].u32MismatchCnt = 0;
+      TST_MATHSRV_astrRes[u8LocIdx].u32RefTicks    = 0;
+      TST_MATHSRV_astrRes[u8LocIdx].u32OptTicks    = 0;
+   }
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidMainFunction                                 */
+/* !Description : Run every test once when TST_MATHSRV_bRunReq is set. A run  */
+/*                lasts several seconds on target, call it from a background  */
+/*                task only.                                                  */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+void TST_MATHSRV_vidMainFunction(void)
+{
+   if (TST_MATHSRV_bRunReq != FALSE)
+   {
+      TST_MATHSRV_vidRun();
+      TST_MATHSRV_bRunReq = FALSE;
+   }
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidRun                                          */
+/* !Description : Reset the results and run every test                        */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+void TST_MATHSRV_vidRun(void)
+{
+   uint8 u8LocIdx;
+
+
+   TST_MATHSRV_vidInit();
+
+   TST_MATHSRV_vidBkptTest();
+   TST_MATHSRV_vidInterpTest();
+   TST_MATHSRV_vidMulDivTest();
+   TST_MATHSRV_vidFilterTest();
+   TST_MATHSRV_vidMathTest();
+   TST_MATHSRV_vidCrntTest();
+
+   for (u8LocIdx = 0; u8LocIdx < TST_MATHSRV_u8RES_NB; u8LocIdx++)
+   {
+      TST_MATHSRV_u32MismatchCnt += TST_MATHSRV_astrRes[u8LocIdx].u32MismatchCnt;
+   }
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_u32Rand                                         */
+/* !Description : Reproducible pseudo random generator (xorshift 32)          */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+uint32 TST_MATHSRV_u32Rand(void)
+{
+   uint32 u32LocSt;
+
+
+   u32LocSt = TST_MATHSRV_u32RandSt;
+   u32LocSt ^= u32LocSt << 13;
+   u32LocSt ^= u32LocSt >> 17;
+   u32LocSt ^= u32LocSt << 5;
+   TST_MATHSRV_u32RandSt = u32LocSt;
+   return(u32LocSt);
+}
+
+#if (TST_MATHSRV_coHOST == STD_ON)
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_u32HostTimeStamp                                */
+/* !Description : Host monotonic clock in 10 ns ticks, same unit as STM0      */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+uint32 TST_MATHSRV_u32HostTimeStamp(void)
+{
+   struct timespec strLocTs;
+
+
+   (void)clock_gettime(CLOCK_MONOTONIC, &strLocTs);
+   return((uint32)(((uint64)strLocTs.tv_sec * 100000000ULL)
+                   + ((uint64)strLocTs.tv_nsec / 10U)));
+}
+
+/******************************************************************************/
+/* !FuncName    : main                                                        */
+/* !Description : Host program: run the tests, print one line per test and    */
+/*                return 0 when every result matches its reference            */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+int main(void)
+{
+   uint8 u8LocIdx;
+   TST_MATHSRV_tstrRes *pstrLocRes;
+
+
+   TST_MATHSRV_vidRun();
+
+   for (u8LocIdx = 0; u8LocIdx < TST_MATHSRV_u8RES_NB; u8LocIdx++)
+   {
+      pstrLocRes = &TST_MATHSRV_astrRes[u8LocIdx];
+      (void)printf("test %2u: %10lu cases %8lu mismatches"
+                   "  ref %10lu ticks  opt %10lu ticks\n",
+                   (unsigned int)u8LocIdx,
+                   (unsigned long)pstrLocRes->u32CaseCnt,
+                   (unsigned long)pstrLocRes->u32MismatchCnt,
+                   (unsigned long)pstrLocRes->u32RefTicks,
+                   (unsigned long)pstrLocRes->u32OptTicks);
+   }
+   return((TST_MATHSRV_u32MismatchCnt == 0) ? 0 : 1);
+}
+#endif
+
+#define TST_STOP_SEC_TST_CODE
+#include "TST_MemMap.h"
+
+/*------------------------------- end of file --------------------------------*/
@@ -0,0 +1,142 @@
+/******************************************************************************/
+/* !Layer           : TST                                                     */
+/* !Component       : TST_MATHSRV                                             */
+/* !Description     : Test of MATH and MATHSRV optimised services             */
+/*                                                                            */
+/* !File            : TST_MATHSRV.h                                           */
+/* !Description     : TST_MATHSRV APIs and results                            */
+/*                                                                            */
+/* !Reference       :                                                         */
+/*                                                                            */
+/* Coding language  : C                                                       */
+/*                                                                            */
+/* COPYRIGHT VALEO all rights reserved                                        */
+/******************************************************************************/
+/* Dimension Informations
+ * %PCMS_HEADER_SUBSTITUTION_START:%
+ * The PID has this format: <Product ID>:<Item ID>.<Variant>-<Item Type>;<Revision>
+ * %PID:%
+ * %PCMS_HEADER_SUBSTITUTION_END:%
+ ******************************************************************************/
+
+#ifndef TST_MATHSRV_H
+#define TST_MATHSRV_H
+
+#include "Std_Types.h"
+#include "TST_MATHSRV_Cfg.h"
+
+/******************************************************************************/
+/* DEFINES                                                                    */
+/******************************************************************************/
+
+/* !Comment : Index of each test in TST_MATHSRV_astrRes                       */
+#define TST_MATHSRV_u8BKPT_U8              0U
+#define TST_MATHSRV_u8BKPT_U16_SEQ         1U
+#define TST_MATHSRV_u8BKPT_U16_RND         2U
+#define TST_MATHSRV_u8BKPT_EDGE            3U
+#define TST_MATHSRV_u8INTERP_1D            4U
+#define TST_MATHSRV_u8INTERP_2D            5U
+#define TST_MATHSRV_u8MATH_INTERP_1D       6U
+#define TST_MATHSRV_u8MATH_INTERP_2D       7U
+#define TST_MATHSRV_u8MULDIV_U32_U32_U32    8U
+#define TST_MATHSRV_u8MULDIV_U32_U32_S32    9U
+#define TST_MATHSRV_u8MULDIV_U32_S32_U32    10U
+#define TST_MATHSRV_u8MULDIV_U32_S32_S32    11U
+#define TST_MATHSRV_u8MULDIV_S32_S32_S32    12U
+#define TST_MATHSRV_u8MULDIV_S32_S32_U32    13U
+#define TST_MATHSRV_u8MULDIV_S32_U32_S32    14U
+#define TST_MATHSRV_u8MULDIV_S32_U32_U32    15U
+#define TST_MATHSRV_u8MULDIV_WRAP           16U
+#define TST_MATHSRV_u8FILTER_FIRST_ORDER    17U
+#define TST_MATHSRV_u8FILTER_SLEW           18U
+#define TST_MATHSRV_u8FILTER_MEDIAN_3       19U
+#define TST_MATHSRV_u8FILTER_MEDIAN_5       20U
+#define TST_MATHSRV_u8FILTER_MEDIAN_7       21U
+#define TST_MATHSRV_u8FILTER_WINDOW         22U
+#define TST_MATHSRV_u8MATH_SQRT             23U
+#define TST_MATHSRV_u8MATH_SIN_COS_TAB      24U
+#define TST_MATHSRV_u8MATH_SIN_COS_POLY     25U
+#define TST_MATHSRV_u8MATH_ATAN2            26U
+#define TST_MATHSRV_u8CRNT_SET_POINT        27U
+#define TST_MATHSRV_u8CRNT_DITHER_STEP      28U
+#define TST_MATHSRV_u8CRNT_FB               29U
+#define TST_MATHSRV_u8RES_NB                30U
+
+/******************************************************************************/
+/* TYPES                                                                      */
+/******************************************************************************/
+
+/* !Comment : Result of one test. The times are the sums of the timed loops,  */
+/*            in TST_MATHSRV_u32GET_TIME_STAMP ticks                          */
+typedef struct
+{
+   uint32 u32CaseCnt;      /* Number of compared results                     */
+   uint32 u32MismatchCnt;  /* Results different from the reference           */
+   uint32 u32RefTicks;     /* Time of the reference service                  */
+   uint32 u32OptTicks;     /* Time of the optimised service                  */
+} TST_MATHSRV_tstrRes;
+
+/******************************************************************************/
+/* GLOBAL VARIABLES DECLARATION                                               */
+/******************************************************************************/
+
+#define TST_START_SEC_TST_VAR
+#include "TST_MemMap.h"
+
+/* !Comment : Set over CCP to run every test once in the main function        */
+extern boolean TST_MATHSRV_bRunReq;
+extern uint32 TST_MATHSRV_u32MismatchCnt;
+extern TST_MATHSRV_tstrRes TST_MATHSRV_astrRes[TST_MATHSRV_u8RES_NB];
+
+#define TST_STOP_SEC_TST_VAR
+#include "TST_MemMap.h"
+
+/******************************************************************************/
+/* GLOBAL FUNCTIONS DECLARATION                                               */
+/******************************************************************************/
+
+#define TST_START_SEC_TST_CODE
+#include "TST_MemMap.h"
+
+void TST_MATHSRV_vidInit(void);
+void TST_MATHSRV_vidMainFunction(void);
+void TST_MATHSRV_vidRun(void);
+uint32 TST_MATHSRV_u32Rand(void);
+#if (TST_MATHSRV_coHOST == STD_ON)
+uint32 TST_MATHSRV_u32HostTimeStamp(void);
+#endif
+
+/* !Comment : Tests, one file each                                            */
+void TST_MATHSRV_vidBkptTest(void);
+void TST_MATHSRV_vidInterpTest(void);
+void TST_MATHSRV_vidMulDivTest(void);
+void TST_MATHSRV_vidFilterTest(void);
+void TST_MATHSRV_vidMathTest(void);
+void TST_MATHSRV_vidCrntTest(void);
+
+/* !Comment : MATHSRV MulDiv services built with the emulated backend by      */
+/*            TST_MATHSRV_MulDivEmul.c and the native one by                  */
+/*            TST_MATHSRV_MulDivNat.c                                         */
+uint32 TST_MATHSRV_u32Mul_u32_u32_div_u32Emul(uint32 u32FirstValue, uint32 u32SecondValue, uint32 u32Denominator);
+uint32 TST_MATHSRV_u32Mul_u32_u32_div_s32Emul(uint32 u32FirstValue, uint32 u32SecondValue, sint32 s32Denominator);
+uint32 TST_MATHSRV_u32Mul_u32_s32_div_u32Emul(uint32 u32FirstValue, sint32 s32SecondValue, uint32 u32Denominator);
+uint32 TST_MATHSRV_u32Mul_u32_s32_div_s32Emul(uint32 u32FirstValue, sint32 s32SecondValue, sint32 s32Denominator);
+sint32 TST_MATHSRV_s32Mul_s32_s32_div_s32Emul(sint32 s32FirstValue, sint32 s32SecondValue, sint32 s32Denominator);
+sint32 TST_MATHSRV_s32Mul_s32_s32_div_u32Emul(sint32 s32FirstValue, sint32 s32SecondValue, uint32 u32Denominator);
+sint32 TST_MATHSRV_s32Mul_u32_s32_div_s32Emul(uint32 u32FirstValue, sint32 s32SecondValue, sint32 s32Denominator);
+sint32 TST_MATHSRV_s32Mul_u32_s32_div_u32Emul(uint32 u32FirstValue, sint32 s32SecondValue, uint32 u32Denominator);
+uint32 TST_MATHSRV_u32Mul_u32_u32_div_u32Nat(uint32 u32FirstValue, uint32 u32SecondValue, uint32 u32Denominator);
+uint32 TST_MATHSRV_u32Mul_u32_u32_div_s32Nat(uint32 u32FirstValue, uint32 u32SecondValue, sint32 s32Denominator);
+uint32 TST_MATHSRV_u32Mul_u32_s32_div_u32Nat(uint32 u32FirstValue, sint32 s32SecondValue, uint32 u32Denominator);
+uint32 TST_MATHSRV_u32Mul_u32_s32_div_s32Nat(uint32 u32FirstValue, sint32 s32SecondValue, sint32 s32Denominator);
+sint32 TST_MATHSRV_s32Mul_s32_s32_div_s32Nat(sint32 s32FirstValue, sint32 s32SecondValue, sint32 s32Denominator);
+sint32 TST_MATHSRV_s32Mul_s32_s32_div_u32Nat(sint32 s32FirstValue, sint32 s32SecondValue, uint32 u32Denominator);
+sint32 TST_MATHSRV_s32Mul_u32_s32_div_s32Nat(uint32 u32FirstValue, sint32 s32SecondValue, sint32 s32Denominator);
+sint32 TST_MATHSRV_s32Mul_u32_s32_div_u32Nat(uint32 u32FirstValue, sint32 s32SecondValue, uint32 u32Denominator);
+
+#define TST_STOP_SEC_TST_CODE
+#include "TST_MemMap.h"
+
+#endif /* TST_MATHSRV_H */
+
+/*------------------------------- end of file --------------------------------*/
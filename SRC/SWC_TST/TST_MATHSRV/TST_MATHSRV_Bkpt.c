@@ -0,0 +1,558 @@
+/******************************************************************************/
+/* !Layer           : TST                                                     */
+/* !Component       : TST_MATHSRV                                             */
+/* !Description     : Test of MATH and MATHSRV optimised services             */
+/*                                                                            */
+/* !File            : TST_MATHSRV_Bkpt.c                                      */
+/* !Description     : Breakpoint search with call site hint. The results of   */
+/*                    MATHSRV_u16CalcParaIncAryU8/U16HintLoc and              */
+/*                    MathCalcBkptHintU8/U16 are compared with a linear       */
+/*                    search and with the binary search services, which are   */
+/*                    timed against the hinted MATHSRV services.              */
+/*                                                                            */
+/* !Reference       :                                                         */
+/*                                                                            */
+/* Coding language  : C                                                       */
+/*                                                                            */
+/* COPYRIGHT VALEO all rights reserved                                        */
+/******************************************************************************/
+/* Dimension Informations
+ * %PCMS_HEADER_SUBSTITUTION_START:%
+ * The PID has this format: <Product ID>:<Item ID>.<Variant>-<Item Type>;<Revision>
+ * %PID:%
+ * %PCMS_HEADER_SUBSTITUTION_END:%
+ ******************************************************************************/
+
+#include "Std_Types.h"
+#include "MATHSRV.h"
+#include "MATH_SC.H"
+#include "TST_MATHSRV.h"
+#include "TST_MATHSRV_Cfg.h"
+
+/******************************************************************************/
+/* LOCAL DEFINES                                                              */
+/******************************************************************************/
+
+#define TST_MATHSRV_u8BKPT_U8_AXIS_NB      9U
+#define TST_MATHSRV_u8BKPT_U16_AXIS_NB     8U
+#define TST_MATHSRV_u8BKPT_RAM_AXIS_NB     33U
+
+/******************************************************************************/
+/* LOCAL TYPES                                                                */
+/******************************************************************************/
+
+typedef struct
+{
+   const uint8 *pku8Map;
+   uint8        u8NbM1;
+} TST_MATHSRV_tstrAxisU8;
+
+typedef struct
+{
+   const uint16 *pku16Map;
+   uint8         u8NbM1;
+} TST_MATHSRV_tstrAxisU16;
+
+/******************************************************************************/
+/* LOCAL CONSTANTS                                                            */
+/******************************************************************************/
+
+#define TST_START_SEC_TST_CONST
+#include "TST_MemMap.h"
+
+/* !Comment : Single point, widths 1, equal neighbours (zero width segments   */
+/*            never selected), extreme and power of two widths                */
+static const uint8 TST_MATHSRV_kau8Axis0[1] = {50};
+static const uint8 TST_MATHSRV_kau8Axis1[2] = {0, 255};
+static const uint8 TST_MATHSRV_kau8Axis2[2] = {100, 101};
+static const uint8 TST_MATHSRV_kau8Axis3[6] = {10, 11, 12, 13, 14, 15};
+static const uint8 TST_MATHSRV_kau8Axis4[8] = {0, 1, 3, 6, 13, 26, 77, 255};
+static const uint8 TST_MATHSRV_kau8Axis5[7] = {5, 5, 9, 9, 9, 200, 201};
+static const uint8 TST_MATHSRV_kau8Axis6[9] = {1, 2, 4, 8, 16, 32, 64, 128, 254};
+
+/* !Comment : Width 65535 (reciprocal 256), 1 next to 65534, half range,      */
+/*            widths 1/2/3, 255/257/4097, equal neighbours, prime width       */
+static const uint16 TST_MATHSRV_kau16Axis0[2] = {0, 65535};
+static const uint16 TST_MATHSRV_kau16Axis1[3] = {0, 1, 65535};
+static const uint16 TST_MATHSRV_kau16Axis2[3] = {0, 32768, 65535};
+static const uint16 TST_MATHSRV_kau16Axis3[8] =
+   {100, 101, 103, 106, 1000, 1001, 40000, 65534};
+static const uint16 TST_MATHSRV_kau16Axis4[9] =
+   {1000, 1003, 1010, 1265, 1522, 5619, 5619, 5620, 65535};
+static const uint16 TST_MATHSRV_kau16Axis5[2] = {7, 65528};
+
+#define TST_STOP_SEC_TST_CONST
+#include "TST_MemMap.h"
+
+/******************************************************************************/
+/* LOCAL VARIABLES                                                            */
+/******************************************************************************/
+
+#define TST_START_SEC_TST_VAR
+#include "TST_MemMap.h"
+
+/* !Comment : Axes built at run time: 64 points of width 4, 255 points of     */
+/*            width 1 (u8), 255 points of width 257 and random widths (u16)   */
+static uint8 TST_MATHSRV_au8Axis7[64];
+static uint8 TST_MATHSRV_au8Axis8[255];
+static uint16 TST_MATHSRV_au16Axis6[255];
+static uint16 TST_MATHSRV_au16Axis7[TST_MATHSRV_u8BKPT_RAM_AXIS_NB];
+
+static uint16 TST_MATHSRV_au16In[TST_MATHSRV_u16BUF_SIZE];
+static uint8  TST_MATHSRV_au8In[TST_MATHSRV_u16BUF_SIZE];
+static uint16 TST_MATHSRV_au16Ref[TST_MATHSRV_u16BUF_SIZE];
+static uint16 TST_MATHSRV_au16Opt[TST_MATHSRV_u16BUF_SIZE];
+
+static MATHSRV_tstrBkptHint TST_MATHSRV_strHint;
+static MathBkptHintType     TST_MATHSRV_strMathHint;
+
+#define TST_STOP_SEC_TST_VAR
+#include "TST_MemMap.h"
+
+/******************************************************************************/
+/* LOCAL FUNCTIONS DECLARATION                                                */
+/******************************************************************************/
+
+#define TST_START_SEC_TST_CODE
+#include "TST_MemMap.h"
+
+static uint16 TST_MATHSRV_u16LinParaU8(const uint8 *pku8Map,
+                                       uint8 u8Value,
+                                       uint8 u8NbM1);
+static uint16 TST_MATHSRV_u16LinParaU16(const uint16 *pku16Map,
+                                        uint16 u16Value,
+                                        uint8 u8NbM1);
+static void TST_MATHSRV_vidBkptChkU8(const uint8 *pku8Map,
+                                     uint8 u8NbM1,
+                                     uint16 u16Nb,
+                                     TST_MATHSRV_tstrRes *pstrRes);
+static void TST_MATHSRV_vidBkptChkU16(const uint16 *pku16Map,
+                                      uint8 u8NbM1,
+                                      uint16 u16Nb,
+                                      TST_MATHSRV_tstrRes *pstrRes);
+static void TST_MATHSRV_vidBkptEdgeTest(void);
+
+/******************************************************************************/
+/* GLOBAL FUNCTIONS DEFINITION                                                */
+/******************************************************************************/
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidBkptTest                                     */
+/* !Description : u8 axes: every value, ascending then descending. u16 axes:  */
+/*                every value ascending then descending with a hint per axis  */
+/*                (slowly varying input), then random values and values       */
+/*                around the breakpoints with one hint shared by every axis,  */
+/*                so the site and the width of the hint are stale at each     */
+/*                axis change. Last the reciprocal edge cases.                */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+void TST_MATHSRV_vidBkptTest(void)
+{
+   TST_MATHSRV_tstrAxisU8  astrLocAxisU8[TST_MATHSRV_u8BKPT_U8_AXIS_NB];
+   TST_MATHSRV_tstrAxisU16 astrLocAxisU16[TST_MATHSRV_u8BKPT_U16_AXIS_NB];
+   const uint16 *pku16LocMap;
+   uint32 u32LocIdx;
+   uint32 u32LocVal;
+   uint32 u32LocRnd;
+   uint8  u8LocAxis;
+   uint8  u8LocNbM1;
+
+
+   /* !Comment : Run time axes                                               */
+   for (u32LocIdx = 0; u32LocIdx < 64U; u32LocIdx++)
+   {
+      TST_MATHSRV_au8Axis7[u32LocIdx] = (uint8)(u32LocIdx * 4U);
+   }
+   for (u32LocIdx = 0; u32LocIdx < 255U; u32LocIdx++)
+   {
+      TST_MATHSRV_au8Axis8[u32LocIdx]  = (uint8)u32LocIdx;
+      TST_MATHSRV_au16Axis6[u32LocIdx] = (uint16)(u32LocIdx * 257U);
+   }
+   u32LocVal = TST_MATHSRV_u32Rand() & 0xFFU;
+   for (u32LocIdx = 0; u32LocIdx < TST_MATHSRV_u8BKPT_RAM_AXIS_NB; u32LocIdx++)
+   {
+      TST_MATHSRV_au16Axis7[u32LocIdx] = (uint16)u32LocVal;
+      u32LocVal += 1U + (TST_MATHSRV_u32Rand() % 2000U);
+   }
+
+   astrLocAxisU8[0].pku8Map = TST_MATHSRV_kau8Axis0;
+   astrLocAxisU8[0].u8NbM1  = 0;
+   astrLocAxisU8[1].pku8Map = TST_MATHSRV_kau8Axis1;
+   astrLocAxisU8[1].u8NbM1  = 1;
+   astrLocAxisU8[2].pku8Map = TST_MATHSRV_kau8Axis2;
+   astrLocAxisU8[2].u8NbM1  = 1;
+   astrLocAxisU8[3].pku8Map = TST_MATHSRV_kau8Axis3;
+   astrLocAxisU8[3].u8NbM1  = 5;
+   astrLocAxisU8[4].pku8Map = TST_MATHSRV_kau8Axis4;
+   astrLocAxisU8[4].u8NbM1  = 7;
+   astrLocAxisU8[5].pku8Map = TST_MATHSRV_kau8Axis5;
+   astrLocAxisU8[5].u8NbM1  = 6;
+   astrLocAxisU8[6].pku8Map = TST_MATHSRV_kau8Axis6;
+   astrLocAxisU8[6].u8NbM1  = 8;
+   astrLocAxisU8[7].pku8Map = TST_MATHSRV_au8Axis7;
+   astrLocAxisU8[7].u8NbM1  = 63;
+   astrLocAxisU8[8].pku8Map = TST_MATHSRV_au8Axis8;
+   astrLocAxisU8[8].u8NbM1  = 254;
+
+   astrLocAxisU16[0].pku16Map = TST_MATHSRV_kau16Axis0;
+   astrLocAxisU16[0].u8NbM1   = 1;
+   astrLocAxisU16[1].pku16Map = TST_MATHSRV_kau16Axis1;
+   astrLocAxisU16[1].u8NbM1   = 2;
+   astrLocAxisU16[2].pku16Map = TST_MATHSRV_kau16Axis2;
+   astrLocAxisU16[2].u8NbM1   = 2;
+   astrLocAxisU16[3].pku16Map = TST_MATHSRV_kau16Axis3;
+   astrLocAxisU16[3].u8NbM1   = 7;
+   astrLocAxisU16[4].pku16Map = TST_MATHSRV_kau16Axis4;
+   astrLocAxisU16[4].u8NbM1   = 8;
+   astrLocAxisU16[5].pku16Map = TST_MATHSRV_kau16Axis5;
+   astrLocAxisU16[5].u8NbM1   = 1;
+   astrLocAxisU16[6].pku16Map = TST_MATHSRV_au16Axis6;
+   astrLocAxisU16[6].u8NbM1   = 254;
+   astrLocAxisU16[7].pku16Map = TST_MATHSRV_au16Axis7;
+   astrLocAxisU16[7].u8NbM1   = TST_MATHSRV_u8BKPT_RAM_AXIS_NB - 1U;
+
+   /* !Comment : u8, hint kept from one axis to the next                     */
+   TST_MATHSRV_strHint.u8Site       = 0;
+   TST_MATHSRV_strHint.u16Width     = 0;
+   TST_MATHSRV_strHint.u32Rcp       = 0;
+   TST_MATHSRV_strMathHint.site     = 0;
+   TST_MATHSRV_strMathHint.width    = 0;
+   TST_MATHSRV_strMathHint.rcp      = 0;
+   for (u8LocAxis = 0; u8LocAxis < TST_MATHSRV_u8BKPT_U8_AXIS_NB; u8LocAxis++)
+   {
+      for (u32LocIdx = 0; u32LocIdx < 256U; u32LocIdx++)
+      {
+         TST_MATHSRV_au8In[u32LocIdx] = (uint8)u32LocIdx;
+      }
+      TST_MATHSRV_vidBkptChkU8(astrLocAxisU8[u8LocAxis].pku8Map,
+                               astrLocAxisU8[u8LocAxis].u8NbM1,
+                               256U,
+                               &TST_MATHSRV_astrRes[TST_MATHSRV_u8BKPT_U8]);
+      for (u32LocIdx = 0; u32LocIdx < 256U; u32LocIdx++)
+      {
+         TST_MATHSRV_au8In[u32LocIdx] = (uint8)(255U - u32LocIdx);
+      }
+      TST_MATHSRV_vidBkptChkU8(astrLocAxisU8[u8LocAxis].pku8Map,
+                               astrLocAxisU8[u8LocAxis].u8NbM1,
+                               256U,
+                               &TST_MATHSRV_astrRes[TST_MATHSRV_u8BKPT_U8]);
+   }
+
+   /* !Comment : u16 sequential, zero initialised hint per axis              */
+   for (u8LocAxis = 0; u8LocAxis < TST_MATHSRV_u8BKPT_U16_AXIS_NB; u8LocAxis++)
+   {
+      TST_MATHSRV_strHint.u8Site    = 0;
+      TST_MATHSRV_strHint.u16Width  = 0;
+      TST_MATHSRV_strHint.u32Rcp    = 0;
+      TST_MATHSRV_strMathHint.site  = 0;
+      TST_MATHSRV_strMathHint.width = 0;
+      TST_MATHSRV_strMathHint.rcp   = 0;
+      for (u32LocVal = 0; u32LocVal < 0x20000UL;
+           u32LocVal += TST_MATHSRV_u16BUF_SIZE)
+      {
+         for (u32LocIdx = 0; u32LocIdx < TST_MATHSRV_u16BUF_SIZE; u32LocIdx++)
+         {
+            if (u32LocVal < 0x10000UL)
+            {
+               TST_MATHSRV_au16In[u32LocIdx] = (uint16)(u32LocVal + u32LocIdx);
+            }
+            else
+            {
+               TST_MATHSRV_au16In[u32LocIdx] =
+                  (uint16)(0x1FFFFUL - (u32LocVal + u32LocIdx));
+            }
+         }
+         TST_MATHSRV_vidBkptChkU16(astrLocAxisU16[u8LocAxis].pku16Map,
+                                   astrLocAxisU16[u8LocAxis].u8NbM1,
+                                   TST_MATHSRV_u16BUF_SIZE,
+                                   &TST_MATHSRV_astrRes[TST_MATHSRV_u8BKPT_U16_SEQ]);
+      }
+   }
+
+   /* !Comment : u16 random, half uniform, half breakpoint - 1/+0/+1; the    */
+   /*            hint is not reset between axes                              */
+   for (u8LocAxis = 0; u8LocAxis < TST_MATHSRV_u8BKPT_U16_AXIS_NB; u8LocAxis++)
+   {
+      pku16LocMap = astrLocAxisU16[u8LocAxis].pku16Map;
+      u8LocNbM1   = astrLocAxisU16[u8LocAxis].u8NbM1;
+      for (u32LocVal = 0; u32LocVal < TST_MATHSRV_u32BKPT_RND_NB;
+           u32LocVal += TST_MATHSRV_u16BUF_SIZE)
+      {
+         for (u32LocIdx = 0; u32LocIdx < TST_MATHSRV_u16BUF_SIZE; u32LocIdx++)
+         {
+            u32LocRnd = TST_MATHSRV_u32Rand();
+            if ((u32LocRnd & 0x10000UL) != 0)
+            {
+               TST_MATHSRV_au16In[u32LocIdx] = (uint16)u32LocRnd;
+            }
+            else
+            {
+               TST_MATHSRV_au16In[u32LocIdx] =
+                  (uint16)( pku16LocMap[(u32LocRnd >> 20) % ((uint32)u8LocNbM1 + 1U)]
+                          + ((u32LocRnd >> 17) % 3U) - 1U);
+            }
+         }
+         TST_MATHSRV_vidBkptChkU16(pku16LocMap,
+                                   u8LocNbM1,
+                                   TST_MATHSRV_u16BUF_SIZE,
+                                   &TST_MATHSRV_astrRes[TST_MATHSRV_u8BKPT_U16_RND]);
+      }
+   }
+
+   TST_MATHSRV_vidBkptEdgeTest();
+}
+
+/******************************************************************************/
+/* LOCAL FUNCTIONS DEFINITION                                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidBkptEdgeTest                                 */
+/* !Description : Reciprocal edge cases: for each width of a two point axis,  */
+/*                the deltas 0 and width - 1 and, for each quotient k of      */
+/*                1..255, the smallest delta giving k and the delta before.   */
+/*                These are the deltas where the estimate from the cached     */
+/*                reciprocal is one below the exact quotient. The hint is     */
+/*                shared, so each width change recomputes the reciprocal.     */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static void TST_MATHSRV_vidBkptEdgeTest(void)
+{
+   uint16 au16LocMap[2];
+   uint32 u32LocWidth;
+   uint32 u32LocBase;
+   uint32 u32LocDelta;
+   uint32 u32LocK;
+   uint16 u16LocNb;
+   uint8  u8LocPass;
+
+
+   for (u32LocWidth = 1; u32LocWidth <= 0xFFFFUL;
+        u32LocWidth += TST_MATHSRV_u32BKPT_WIDTH_STEP)
+   {
+      u32LocBase    = TST_MATHSRV_u32Rand() % (0x10000UL - u32LocWidth);
+      au16LocMap[0] = (uint16)u32LocBase;
+      au16LocMap[1] = (uint16)(u32LocBase + u32LocWidth);
+
+      for (u8LocPass = 0; u8LocPass < 2U; u8LocPass++)
+      {
+         u16LocNb = 0;
+         if (u8LocPass == 0)
+         {
+            TST_MATHSRV_au16In[u16LocNb] = (uint16)u32LocBase;
+            u16LocNb++;
+            TST_MATHSRV_au16In[u16LocNb] = (uint16)(u32LocBase + u32LocWidth - 1U);
+            u16LocNb++;
+         }
+         for (u32LocK = (u8LocPass * 127U) + 1U;
+              u32LocK < ((u8LocPass * 128U) + 128U);
+              u32LocK++)
+         {
+            u32LocDelta = ((u32LocK * u32LocWidth) + 255U) >> 8;
+            TST_MATHSRV_au16In[u16LocNb] = (uint16)(u32LocBase + u32LocDelta);
+            u16LocNb++;
+            TST_MATHSRV_au16In[u16LocNb] = (uint16)(u32LocBase + u32LocDelta - 1U);
+            u16LocNb++;
+         }
+         TST_MATHSRV_vidBkptChkU16(au16LocMap,
+                                   1,
+                                   u16LocNb,
+                                   &TST_MATHSRV_astrRes[TST_MATHSRV_u8BKPT_EDGE]);
+      }
+   }
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidBkptChkU8                                    */
+/* !Description : Time MATHSRV_u16CalcParaIncAryU8Loc and ...HintLoc over     */
+/*                TST_MATHSRV_au8In, then compare them and the MATH services  */
+/*                with the linear search                                      */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static void TST_MATHSRV_vidBkptChkU8
+(
+   const uint8 *pku8Map,
+   uint8 u8NbM1,
+   uint16 u16Nb,
+   TST_MATHSRV_tstrRes *pstrRes
+)
+{
+   uint32 u32LocT0;
+   uint32 u32LocT1;
+   uint32 u32LocT2;
+   uint16 u16LocIdx;
+   uint16 u16LocLin;
+
+
+   u32LocT0 = TST_MATHSRV_u32GET_TIME_STAMP();
+   for (u16LocIdx = 0; u16LocIdx < u16Nb; u16LocIdx++)
+   {
+      TST_MATHSRV_au16Ref[u16LocIdx] =
+         MATHSRV_u16CalcParaIncAryU8Loc(pku8Map,
+                                        TST_MATHSRV_au8In[u16LocIdx],
+                                        u8NbM1);
+   }
+   u32LocT1 = TST_MATHSRV_u32GET_TIME_STAMP();
+   for (u16LocIdx = 0; u16LocIdx < u16Nb; u16LocIdx++)
+   {
+      TST_MATHSRV_au16Opt[u16LocIdx] =
+         MATHSRV_u16CalcParaIncAryU8HintLoc(pku8Map,
+                                            TST_MATHSRV_au8In[u16LocIdx],
+                                            u8NbM1,
+                                            &TST_MATHSRV_strHint);
+   }
+   u32LocT2 = TST_MATHSRV_u32GET_TIME_STAMP();
+   pstrRes->u32RefTicks += u32LocT1 - u32LocT0;
+   pstrRes->u32OptTicks += u32LocT2 - u32LocT1;
+
+   for (u16LocIdx = 0; u16LocIdx < u16Nb; u16LocIdx++)
+   {
+      u16LocLin = TST_MATHSRV_u16LinParaU8(pku8Map,
+                                           TST_MATHSRV_au8In[u16LocIdx],
+                                           u8NbM1);
+      pstrRes->u32CaseCnt++;
+      if (  (TST_MATHSRV_au16Ref[u16LocIdx] != u16LocLin)
+         || (TST_MATHSRV_au16Opt[u16LocIdx] != u16LocLin)
+         || (MathCalcBkptU8(pku8Map, TST_MATHSRV_au8In[u16LocIdx], u8NbM1)
+             != u16LocLin)
+         || (MathCalcBkptHintU8(pku8Map, TST_MATHSRV_au8In[u16LocIdx], u8NbM1,
+                                &TST_MATHSRV_strMathHint)
+             != u16LocLin))
+      {
+         pstrRes->u32MismatchCnt++;
+      }
+   }
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidBkptChkU16                                   */
+/* !Description : Time MATHSRV_u16CalcParaIncAryU16Loc and ...HintLoc over    */
+/*                TST_MATHSRV_au16In, then compare them and the MATH services */
+/*                with the linear search                                      */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static void TST_MATHSRV_vidBkptChkU16
+(
+   const uint16 *pku16Map,
+   uint8 u8NbM1,
+   uint16 u16Nb,
+   TST_MATHSRV_tstrRes *pstrRes
+)
+{
+   uint32 u32LocT0;
+   uint32 u32LocT1;
+   uint32 u32LocT2;
+   uint16 u16LocIdx;
+   uint16 u16LocLin;
+
+
+   u32LocT0 = TST_MATHSRV_u32GET_TIME_STAMP();
+   for (u16LocIdx = 0; u16LocIdx < u16Nb; u16LocIdx++)
+   {
+      TST_MATHSRV_au16Ref[u16LocIdx] =
+         MATHSRV_u16CalcParaIncAryU16Loc(pku16Map,
+                                         TST_MATHSRV_au16In[u16LocIdx],
+                                         u8NbM1);
+   }
+   u32LocT1 = TST_MATHSRV_u32GET_TIME_STAMP();
+   for (u16LocIdx = 0; u16LocIdx < u16Nb; u16LocIdx++)
+   {
+      TST_MATHSRV_au16Opt[u16LocIdx] =
+         MATHSRV_u16CalcParaIncAryU16HintLoc(pku16Map,
+                                             TST_MATHSRV_au16In[u16LocIdx],
+                                             u8NbM1,
+                                             &TST_MATHSRV_strHint);
+   }
+   u32LocT2 = TST_MATHSRV_u32GET_TIME_STAMP();
+   pstrRes->u32RefTicks += u32LocT1 - u32LocT0;
+   pstrRes->u32OptTicks += u32LocT2 - u32LocT1;
+
+   for (u16LocIdx = 0; u16LocIdx < u16Nb; u16LocIdx++)
+   {
+      u16LocLin = TST_MATHSRV_u16LinParaU16(pku16Map,
+                                            TST_MATHSRV_au16In[u16LocIdx],
+                                            u8NbM1);
+      pstrRes->u32CaseCnt++;
+      if (  (TST_MATHSRV_au16Ref[u16LocIdx] != u16LocLin)
+         || (TST_MATHSRV_au16Opt[u16LocIdx] != u16LocLin)
+         || (MathCalcBkptU16(pku16Map, TST_MATHSRV_au16In[u16LocIdx], u8NbM1)
+             != u16LocLin)
+         || (MathCalcBkptHintU16(pku16Map, TST_MATHSRV_au16In[u16LocIdx], u8NbM1,
+                                 &TST_MATHSRV_strMathHint)
+             != u16LocLin))
+      {
+         pstrRes->u32MismatchCnt++;
+      }
+   }
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_u16LinParaU8                                    */
+/* !Description : Reference: linear search of the segment and division        */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static uint16 TST_MATHSRV_u16LinParaU8
+(
+   const uint8 *pku8Map,
+   uint8 u8Value,
+   uint8 u8NbM1
+)
+{
+   uint32 u32LocSite;
+
+
+   if (u8Value >= pku8Map[u8NbM1])
+   {
+      return((uint16)((uint32)u8NbM1 << 8));
+   }
+   if (u8Value < pku8Map[0])
+   {
+      return(0);
+   }
+   u32LocSite = 0;
+   while (u8Value >= pku8Map[u32LocSite + 1U])
+   {
+      u32LocSite++;
+   }
+   return((uint16)( (u32LocSite << 8)
+                  + (((uint32)(u8Value - pku8Map[u32LocSite]) << 8)
+                     / (uint32)(pku8Map[u32LocSite + 1U] - pku8Map[u32LocSite]))));
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_u16LinParaU16                                   */
+/* !Description : Reference: linear search of the segment and division        */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static uint16 TST_MATHSRV_u16LinParaU16
+(
+   const uint16 *pku16Map,
+   uint16 u16Value,
+   uint8 u8NbM1
+)
+{
+   uint32 u32LocSite;
+
+
+   if (u16Value >= pku16Map[u8NbM1])
+   {
+      return((uint16)((uint32)u8NbM1 << 8));
+   }
+   if (u16Value < pku16Map[0])
+   {
+      return(0);
+   }
+   u32LocSite = 0;
+   while (u16Value >= pku16Map[u32LocSite + 1U])
+   {
+      u32LocSite++;
+   }
+   return((uint16)( (u32LocSite << 8)
+                  + (((uint32)(u16Value - pku16Map[u32LocSite]) << 8)
+                     / (uint32)(pku16Map[u32LocSite + 1U] - pku16Map[u32LocSite]))));
+}
+
+#define TST_STOP_SEC_TST_CODE
+#include "TST_MemMap.h"
+
+/*------------------------------- end of file --------------------------------*/
@@ -0,0 +1,78 @@
+/******************************************************************************/
+/* !Layer           : TST                                                     */
+/* !Component       : TST_MATHSRV                                             */
+/* !Description     : Test of MATH and MATHSRV optimised services             */
+/*                                                                            */
+/* !File            : TST_MATHSRV_Cfg.h                                       */
+/* !Description     : Configuration of the TST_MATHSRV component              */
+/*                                                                            */
+/* !Reference       :                                                         */
+/*                                                                            */
+/* Coding language  : C                                                       */
+/*                                                                            */
+/* COPYRIGHT VALEO all rights reserved                                        */
+/******************************************************************************/
+/* Dimension Informations
+ * %PCMS_HEADER_SUBSTITUTION_START:%
+ * The PID has this format: <Product ID>:<Item ID>.<Variant>-<Item Type>;<Revision>
+ * %PID:%
+ * %PCMS_HEADER_SUBSTITUTION_END:%
+ ******************************************************************************/
+
+#ifndef TST_MATHSRV_CFG_H
+#define TST_MATHSRV_CFG_H
+
+#include "Std_Types.h"
+
+/* !Comment : STD_ON to build the component as a host program (main() runs    */
+/*            every test, prints the results and returns the mismatch         */
+/*            number). Set it from the host compiler command line. uint32     */
+/*            and sint32 shall be 32 bit wide as on target (-m32 or a host    */
+/*            Platform_Types.h on LP64 hosts).                                */
+#ifndef TST_MATHSRV_coHOST
+#define TST_MATHSRV_coHOST                 STD_OFF
+#endif
+
+/* !Comment : Number of values computed by each timed loop                    */
+#define TST_MATHSRV_u16BUF_SIZE            256U
+
+/* !Comment : Random values per breakpoint axis                               */
+#define TST_MATHSRV_u32BKPT_RND_NB         16384UL
+
+/* !Comment : Step between two widths of the reciprocal edge case test, 1     */
+/*            tests every width 1..65535                                      */
+#define TST_MATHSRV_u32BKPT_WIDTH_STEP     1UL
+
+/* !Comment : Values per call of the array interpolation services (<= 255)    */
+#define TST_MATHSRV_u8ARY_SIZE             128U
+
+/* !Comment : Random axes, maps and input traces of the interpolation test    */
+#define TST_MATHSRV_u32INTERP_RUN_NB       600UL
+
+/* !Comment : Inputs per MulDiv service                                       */
+#define TST_MATHSRV_u32MULDIV_NB           1048576UL
+
+/* !Comment : Channels of the filter banks (<= 255)                           */
+#define TST_MATHSRV_u8FILTER_CHAN_NB       32U
+
+/* !Comment : Samples per channel and filter bank                             */
+#define TST_MATHSRV_u32FILTER_STEP_NB      4096UL
+
+/* !Comment : Random inputs of the square root test                           */
+#define TST_MATHSRV_u32SQRT_RND_NB         1048576UL
+
+/* !Comment : Step of the (sinus, cosinus) grid of the atan2 test             */
+#define TST_MATHSRV_u16ATAN2_STEP          97U
+
+#if (TST_MATHSRV_coHOST == STD_ON)
+/* !Comment : Host clock, converted to 10 ns ticks                            */
+#define TST_MATHSRV_u32GET_TIME_STAMP()    TST_MATHSRV_u32HostTimeStamp()
+#else
+#include "IfxStm_reg.h"
+/* !Comment : Free running STM0 time base (100 MHz, 10 ns ticks)              */
+#define TST_MATHSRV_u32GET_TIME_STAMP()    ((uint32)MODULE_STM0.TIM0.U)
+#endif
+
+#endif /* TST_MATHSRV_CFG_H */
+
+/*------------------------------- end of file --------------------------------*/
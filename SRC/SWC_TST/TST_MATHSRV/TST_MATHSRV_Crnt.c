@@ -0,0 +1,391 @@
+/******************************************************************************/
+/* !Layer           : TST                                                     */
+/* !Component       : TST_MATHSRV                                             */
+/* !Description     : Test of MATH and MATHSRV optimised services             */
+/*                                                                            */
+/* !File            : TST_MATHSRV_Crnt.c                                      */
+/* !Description     : TLE8242 integer current conversions. The Q28 gain       */
+/*                    functions of TLE8242_interface.c are compared with the  */
+/*                    float32 path they replace, on every code of each        */
+/*                    conversion. The host build sweeps several shunt         */
+/*                    values, the target uses the calibrated shunt. The host  */
+/*                    program links TLE8242_interface.c and TLE8242_cfg.c.    */
+/*                                                                            */
+/* !Reference       :                                                         */
+/*                                                                            */
+/* Coding language  : C                                                       */
+/*                                                                            */
+/* COPYRIGHT VALEO all rights reserved                                        */
+/******************************************************************************/
+/* Dimension Informations
+ * %PCMS_HEADER_SUBSTITUTION_START:%
+ * The PID has this format: <Product ID>:<Item ID>.<Variant>-<Item Type>;<Revision>
+ * %PID:%
+ * %PCMS_HEADER_SUBSTITUTION_END:%
+ ******************************************************************************/
+
+#include "Std_Types.h"
+#include "TLE8242_interface.h"
+#include "MAIN_L.h"
+#include "TST_MATHSRV.h"
+#include "TST_MATHSRV_Cfg.h"
+
+/******************************************************************************/
+/* LOCAL DEFINES                                                              */
+/******************************************************************************/
+
+/* !Comment : Accepted differences with the float32 path. Both paths round    */
+/*            or truncate a quotient that carries an error, the float32 one   */
+/*            in its 24 bit mantissa, the integer one in the Q28 gain. Near   */
+/*            a rounding boundary they land on each side of it, on a few      */
+/*            codes in 10000.                                                 */
+/*            Set-point: 1 LSB.                                               */
+/*            Dither step: 2 LSB, one set-point LSB times 4 / 2.              */
+/*            Feedback: 1 mA.                                                 */
+#define TST_MATHSRV_u32CRNT_SET_POINT_TOL  1UL
+#define TST_MATHSRV_u32CRNT_DITHER_TOL     2UL
+#define TST_MATHSRV_u32CRNT_FB_TOL         1UL
+
+/* !Comment : Dither set-point to current point ratio of the TLE8242          */
+#define TST_MATHSRV_u32CRNT_DITHER_RAT     \
+   ((uint32)TLE8242_u8DITHER_SETPOINT_TO_CURRENT_POINT)
+
+/* !Comment : Feedback read configurations of TLE8242_u16GetCrntFb            */
+#define TST_MATHSRV_u8CRNT_FB_CFG_NB       6U
+
+#if (TST_MATHSRV_coHOST == STD_ON)
+#define TST_MATHSRV_u8CRNT_SHUNT_NB        5U
+#else
+#define TST_MATHSRV_u8CRNT_SHUNT_NB        1U
+#endif
+
+/******************************************************************************/
+/* LOCAL TYPES                                                                */
+/******************************************************************************/
+
+/* !Comment : One feedback read configuration: number of raw codes, power of  */
+/*            two part of the averaging ratio, and whether the number of      */
+/*            dither steps divides the sum                                    */
+typedef struct
+{
+   uint32  u32CodeNb;
+   uint8   u8Shift;
+   boolean bStepDiv;
+} TST_MATHSRV_tstrCrntFbCfg;
+
+/******************************************************************************/
+/* LOCAL CONSTANTS                                                            */
+/******************************************************************************/
+
+#define TST_START_SEC_TST_CONST
+#include "TST_MemMap.h"
+
+/* !Comment : Min/max current (11 bit) in current control and direct PWM      */
+/*            mode, then average current (20 bit) without and with dither in  */
+/*            both modes                                                      */
+static const TST_MATHSRV_tstrCrntFbCfg TST_MATHSRV_kastrCrntFbCfg[TST_MATHSRV_u8CRNT_FB_CFG_NB] =
+{
+   {0x00000800UL, 0U, FALSE},
+   {0x00000800UL, 2U, FALSE},
+   {0x00100000UL, 2U, FALSE},
+   {0x00100000UL, 4U, FALSE},
+   {0x00100000UL, 4U, TRUE},
+   {0x00100000UL, 6U, TRUE}
+};
+
+#if (TST_MATHSRV_coHOST == STD_ON)
+/* !Comment : Shunt values of the host run, in Ohm                            */
+static const float32 TST_MATHSRV_kaf32CrntShunt[TST_MATHSRV_u8CRNT_SHUNT_NB] =
+{
+   0.1234F, 0.15F, 0.2F, 0.25F, 0.33F
+};
+#endif
+
+#define TST_STOP_SEC_TST_CONST
+#include "TST_MemMap.h"
+
+/******************************************************************************/
+/* LOCAL VARIABLES                                                            */
+/******************************************************************************/
+
+#define TST_START_SEC_TST_VAR
+#include "TST_MemMap.h"
+
+static uint32 TST_MATHSRV_au32CrntIn[TST_MATHSRV_u16BUF_SIZE];
+static uint32 TST_MATHSRV_au32CrntRef[TST_MATHSRV_u16BUF_SIZE];
+static uint32 TST_MATHSRV_au32CrntOpt[TST_MATHSRV_u16BUF_SIZE];
+
+#define TST_STOP_SEC_TST_VAR
+#include "TST_MemMap.h"
+
+/******************************************************************************/
+/* LOCAL FUNCTIONS DECLARATION                                                */
+/******************************************************************************/
+
+#define TST_START_SEC_TST_CODE
+#include "TST_MemMap.h"
+
+static void TST_MATHSRV_vidCrntSetPointTest(void);
+static void TST_MATHSRV_vidCrntDitherTest(void);
+static void TST_MATHSRV_vidCrntFbTest(void);
+static uint32 TST_MATHSRV_u32CrntToSetPointRef(float32 f32Crnt);
+static uint32 TST_MATHSRV_u32SetPointToCrntRef(uint32 u32SetPoint, uint32 u32Rat);
+static void TST_MATHSRV_vidCrntErrChk(TST_MATHSRV_tstrRes *pstrRes,
+                                      uint16 u16Nb,
+                                      uint32 u32Tol);
+
+/******************************************************************************/
+/* GLOBAL FUNCTIONS DEFINITION                                                */
+/******************************************************************************/
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidCrntTest                                     */
+/* !Description : Set-point, dither step and feedback conversions, for each   */
+/*                shunt value                                                 */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+void TST_MATHSRV_vidCrntTest(void)
+{
+   uint8 u8LocShuntIdx;
+
+
+   for (u8LocShuntIdx = 0; u8LocShuntIdx < TST_MATHSRV_u8CRNT_SHUNT_NB; u8LocShuntIdx++)
+   {
+#if (TST_MATHSRV_coHOST == STD_ON)
+      TLE8242_kf32R_Shunt = TST_MATHSRV_kaf32CrntShunt[u8LocShuntIdx];
+#endif
+      TLE8242_vidInitCrntGain();
+
+      TST_MATHSRV_vidCrntSetPointTest();
+      TST_MATHSRV_vidCrntDitherTest();
+      TST_MATHSRV_vidCrntFbTest();
+   }
+}
+
+/******************************************************************************/
+/* LOCAL FUNCTIONS DEFINITION                                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidCrntSetPointTest                             */
+/* !Description : TLE8242_u32CnvCrntToSetPoint on every mA value              */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static void TST_MATHSRV_vidCrntSetPointTest(void)
+{
+   TST_MATHSRV_tstrRes *pstrLocRes;
+   uint32 u32LocNb;
+   uint32 u32LocT0;
+   uint32 u32LocT1;
+   uint32 u32LocT2;
+   uint16 u16LocIdx;
+
+
+   pstrLocRes = &TST_MATHSRV_astrRes[TST_MATHSRV_u8CRNT_SET_POINT];
+   for (u32LocNb = 0; u32LocNb < 65536UL; u32LocNb += TST_MATHSRV_u16BUF_SIZE)
+   {
+      u32LocT0 = TST_MATHSRV_u32GET_TIME_STAMP();
+      for (u16LocIdx = 0; u16LocIdx < TST_MATHSRV_u16BUF_SIZE; u16LocIdx++)
+      {
+         TST_MATHSRV_au32CrntRef[u16LocIdx] =
+            TST_MATHSRV_u32CrntToSetPointRef((float32)(u32LocNb + u16LocIdx));
+      }
+      u32LocT1 = TST_MATHSRV_u32GET_TIME_STAMP();
+      for (u16LocIdx = 0; u16LocIdx < TST_MATHSRV_u16BUF_SIZE; u16LocIdx++)
+      {
+         TST_MATHSRV_au32CrntOpt[u16LocIdx] =
+            TLE8242_u32CnvCrntToSetPoint((uint16)(u32LocNb + u16LocIdx), 1UL);
+      }
+      u32LocT2 = TST_MATHSRV_u32GET_TIME_STAMP();
+      pstrLocRes->u32RefTicks += u32LocT1 - u32LocT0;
+      pstrLocRes->u32OptTicks += u32LocT2 - u32LocT1;
+
+      TST_MATHSRV_vidCrntErrChk(pstrLocRes,
+                                TST_MATHSRV_u16BUF_SIZE,
+                                TST_MATHSRV_u32CRNT_SET_POINT_TOL);
+   }
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidCrntDitherTest                               */
+/* !Description : Dither step size of TLE8242_vidSetDitherAmpBuf on every mA  */
+/*                value and every number of dither steps                      */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static void TST_MATHSRV_vidCrntDitherTest(void)
+{
+   TST_MATHSRV_tstrRes *pstrLocRes;
+   uint32 u32LocNb;
+   uint32 u32LocSteps;
+   uint32 u32LocT0;
+   uint32 u32LocT1;
+   uint32 u32LocT2;
+   uint16 u16LocIdx;
+
+
+   pstrLocRes = &TST_MATHSRV_astrRes[TST_MATHSRV_u8CRNT_DITHER_STEP];
+   for (u32LocSteps = 1; u32LocSteps <= TLE8242_u8_MAX_VALID_DITHER_STEPS; u32LocSteps++)
+   {
+      for (u32LocNb = 0; u32LocNb < 65536UL; u32LocNb += TST_MATHSRV_u16BUF_SIZE)
+      {
+         u32LocT0 = TST_MATHSRV_u32GET_TIME_STAMP();
+         for (u16LocIdx = 0; u16LocIdx < TST_MATHSRV_u16BUF_SIZE; u16LocIdx++)
+         {
+            TST_MATHSRV_au32CrntRef[u16LocIdx] =
+               (TST_MATHSRV_u32CrntToSetPointRef((float32)(u32LocNb + u16LocIdx)
+                                                 / (float32)u32LocSteps)
+                * TST_MATHSRV_u32CRNT_DITHER_RAT) / 2UL;
+         }
+         u32LocT1 = TST_MATHSRV_u32GET_TIME_STAMP();
+         for (u16LocIdx = 0; u16LocIdx < TST_MATHSRV_u16BUF_SIZE; u16LocIdx++)
+         {
+            TST_MATHSRV_au32CrntOpt[u16LocIdx] =
+               (TLE8242_u32CnvCrntToSetPoint((uint16)(u32LocNb + u16LocIdx), u32LocSteps)
+                * TST_MATHSRV_u32CRNT_DITHER_RAT) / 2UL;
+         }
+         u32LocT2 = TST_MATHSRV_u32GET_TIME_STAMP();
+         pstrLocRes->u32RefTicks += u32LocT1 - u32LocT0;
+         pstrLocRes->u32OptTicks += u32LocT2 - u32LocT1;
+
+         TST_MATHSRV_vidCrntErrChk(pstrLocRes,
+                                   TST_MATHSRV_u16BUF_SIZE,
+                                   TST_MATHSRV_u32CRNT_DITHER_TOL);
+      }
+   }
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidCrntFbTest                                   */
+/* !Description : TLE8242_u16CnvPointToCrnt on every raw code of each         */
+/*                feedback read configuration, every number of dither steps   */
+/*                when it divides the sum                                     */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static void TST_MATHSRV_vidCrntFbTest(void)
+{
+   const TST_MATHSRV_tstrCrntFbCfg *pkstrLocCfg;
+   TST_MATHSRV_tstrRes *pstrLocRes;
+   uint32 u32LocNb;
+   uint32 u32LocSteps;
+   uint32 u32LocStepsMax;
+   uint32 u32LocT0;
+   uint32 u32LocT1;
+   uint32 u32LocT2;
+   uint16 u16LocIdx;
+   uint8 u8LocCfgIdx;
+
+
+   pstrLocRes = &TST_MATHSRV_astrRes[TST_MATHSRV_u8CRNT_FB];
+   for (u8LocCfgIdx = 0; u8LocCfgIdx < TST_MATHSRV_u8CRNT_FB_CFG_NB; u8LocCfgIdx++)
+   {
+      pkstrLocCfg = &TST_MATHSRV_kastrCrntFbCfg[u8LocCfgIdx];
+      u32LocStepsMax = (pkstrLocCfg->bStepDiv != FALSE) ? TLE8242_u8_MAX_VALID_DITHER_STEPS : 1UL;
+      for (u32LocSteps = 1; u32LocSteps <= u32LocStepsMax; u32LocSteps++)
+      {
+         for (u32LocNb = 0; u32LocNb < pkstrLocCfg->u32CodeNb; u32LocNb += TST_MATHSRV_u16BUF_SIZE)
+         {
+            for (u16LocIdx = 0; u16LocIdx < TST_MATHSRV_u16BUF_SIZE; u16LocIdx++)
+            {
+               TST_MATHSRV_au32CrntIn[u16LocIdx] = u32LocNb + u16LocIdx;
+            }
+
+            u32LocT0 = TST_MATHSRV_u32GET_TIME_STAMP();
+            for (u16LocIdx = 0; u16LocIdx < TST_MATHSRV_u16BUF_SIZE; u16LocIdx++)
+            {
+               TST_MATHSRV_au32CrntRef[u16LocIdx] =
+                  TST_MATHSRV_u32SetPointToCrntRef(TST_MATHSRV_au32CrntIn[u16LocIdx],
+                                                   u32LocSteps << pkstrLocCfg->u8Shift);
+            }
+            u32LocT1 = TST_MATHSRV_u32GET_TIME_STAMP();
+            for (u16LocIdx = 0; u16LocIdx < TST_MATHSRV_u16BUF_SIZE; u16LocIdx++)
+            {
+               TST_MATHSRV_au32CrntOpt[u16LocIdx] =
+                  TLE8242_u16CnvPointToCrnt(TST_MATHSRV_au32CrntIn[u16LocIdx],
+                                            pkstrLocCfg->u8Shift,
+                                            u32LocSteps);
+            }
+            u32LocT2 = TST_MATHSRV_u32GET_TIME_STAMP();
+            pstrLocRes->u32RefTicks += u32LocT1 - u32LocT0;
+            pstrLocRes->u32OptTicks += u32LocT2 - u32LocT1;
+
+            TST_MATHSRV_vidCrntErrChk(pstrLocRes,
+                                      TST_MATHSRV_u16BUF_SIZE,
+                                      TST_MATHSRV_u32CRNT_FB_TOL);
+         }
+      }
+   }
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_u32CrntToSetPointRef                            */
+/* !Description : float32 set-point conversion replaced by                    */
+/*                TLE8242_u32CnvCrntToSetPoint                                */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static uint32 TST_MATHSRV_u32CrntToSetPointRef(float32 f32Crnt)
+{
+   float32 f32LocTmp;
+
+
+   f32LocTmp = f32Crnt * 2048;
+   f32LocTmp = f32LocTmp * TLE8242_kf32R_Shunt;
+   f32LocTmp = f32LocTmp / 320;
+   f32LocTmp += 0.5;
+   return((uint32)f32LocTmp);
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_u32SetPointToCrntRef                            */
+/* !Description : float32 feedback conversion replaced by                     */
+/*                TLE8242_u16CnvPointToCrnt, truncated to uint16 mA as the    */
+/*                wrapper did                                                 */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static uint32 TST_MATHSRV_u32SetPointToCrntRef(uint32 u32SetPoint, uint32 u32Rat)
+{
+   float32 f32LocTmp;
+
+
+   f32LocTmp = u32SetPoint * 320;
+   f32LocTmp = f32LocTmp / 2048;
+   f32LocTmp = f32LocTmp / TLE8242_kf32R_Shunt;
+   f32LocTmp = f32LocTmp / u32Rat;
+   return((f32LocTmp > 65535.0F) ? 0xFFFFUL : (uint32)f32LocTmp);
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidCrntErrChk                                   */
+/* !Description : Count the cases of the buffers, and one mismatch for each   */
+/*                difference above the tolerance                              */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static void TST_MATHSRV_vidCrntErrChk(TST_MATHSRV_tstrRes *pstrRes,
+                                      uint16 u16Nb,
+                                      uint32 u32Tol)
+{
+   uint32 u32LocErr;
+   uint16 u16LocIdx;
+
+
+   for (u16LocIdx = 0; u16LocIdx < u16Nb; u16LocIdx++)
+   {
+      if (TST_MATHSRV_au32CrntOpt[u16LocIdx] > TST_MATHSRV_au32CrntRef[u16LocIdx])
+      {
+         u32LocErr = TST_MATHSRV_au32CrntOpt[u16LocIdx] - TST_MATHSRV_au32CrntRef[u16LocIdx];
+      }
+      else
+      {
+         u32LocErr = TST_MATHSRV_au32CrntRef[u16LocIdx] - TST_MATHSRV_au32CrntOpt[u16LocIdx];
+      }
+      pstrRes->u32CaseCnt++;
+      if (u32LocErr > u32Tol)
+      {
+         pstrRes->u32MismatchCnt++;
+      }
+   }
+}
+
+#define TST_STOP_SEC_TST_CODE
+#include "TST_MemMap.h"
+
+/*------------------------------- end of file --------------------------------*/
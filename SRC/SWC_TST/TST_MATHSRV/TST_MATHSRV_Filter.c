@@ -0,0 +1,522 @@
+/******************************************************************************/
+/* !Layer           : TST                                                     */
+/* !Component       : TST_MATHSRV                                             */
+/* !Description     : Test of MATH and MATHSRV optimised services             */
+/*                                                                            */
+/* !File            : TST_MATHSRV_Filter.c                                    */
+/* !Description     : Filter banks. The MATHSRV_vid*FilterBankU16 services    */
+/*                    are compared channel by channel with the scalar filter  */
+/*                    loops they replace, and timed against them. The median  */
+/*                    window check of MATHSRV_vidFilterBankInitU16 is tested  */
+/*                    with out of range windows.                              */
+/*                                                                            */
+/* !Reference       :                                                         */
+/*                                                                            */
+/* Coding language  : C                                                       */
+/*                                                                            */
+/* COPYRIGHT VALEO all rights reserved                                        */
+/******************************************************************************/
+/* Dimension Informations
+ * %PCMS_HEADER_SUBSTITUTION_START:%
+ * The PID has this format: <Product ID>:<Item ID>.<Variant>-<Item Type>;<Revision>
+ * %PID:%
+ * %PCMS_HEADER_SUBSTITUTION_END:%
+ ******************************************************************************/
+
+#include "Std_Types.h"
+#include "MATHSRV.h"
+#include "TST_MATHSRV.h"
+#include "TST_MATHSRV_Cfg.h"
+
+/******************************************************************************/
+/* LOCAL DEFINES                                                              */
+/******************************************************************************/
+
+/* !Comment : History of the biggest window, plus a guard sample checked by   */
+/*            the window check test                                           */
+#define TST_MATHSRV_u16FILTER_HIST_SIZE    \
+   ((TST_MATHSRV_u8FILTER_CHAN_NB * MATHSRV_u8MEDIAN_WINDOW_MAX) + 1U)
+
+#define TST_MATHSRV_u16FILTER_GUARD        0xA5A5U
+
+/* !Comment : Highest window given to the window check test                   */
+#define TST_MATHSRV_u8FILTER_WINDOW_CHK    9U
+
+/******************************************************************************/
+/* LOCAL VARIABLES                                                            */
+/******************************************************************************/
+
+#define TST_START_SEC_TST_VAR
+#include "TST_MemMap.h"
+
+static MATHSRV_tstrFilterBankU16 TST_MATHSRV_strFilterBank;
+static uint32 TST_MATHSRV_au32FilterAcc[TST_MATHSRV_u8FILTER_CHAN_NB];
+static uint16 TST_MATHSRV_au16FilterOut[TST_MATHSRV_u8FILTER_CHAN_NB];
+static uint16 TST_MATHSRV_au16FilterHist[TST_MATHSRV_u16FILTER_HIST_SIZE];
+
+static uint32 TST_MATHSRV_au32FilterRefAcc[TST_MATHSRV_u8FILTER_CHAN_NB];
+static uint16 TST_MATHSRV_au16FilterRefHist[TST_MATHSRV_u16FILTER_HIST_SIZE];
+
+static uint16 TST_MATHSRV_au16FilterInit[TST_MATHSRV_u8FILTER_CHAN_NB];
+static uint16 TST_MATHSRV_au16FilterMeas[TST_MATHSRV_u8FILTER_CHAN_NB];
+static uint16 TST_MATHSRV_au16FilterPar1[TST_MATHSRV_u8FILTER_CHAN_NB];
+static uint16 TST_MATHSRV_au16FilterPar2[TST_MATHSRV_u8FILTER_CHAN_NB];
+static uint16 TST_MATHSRV_au16FilterRef[TST_MATHSRV_u8FILTER_CHAN_NB];
+static uint16 TST_MATHSRV_au16FilterOpt[TST_MATHSRV_u8FILTER_CHAN_NB];
+
+#define TST_STOP_SEC_TST_VAR
+#include "TST_MemMap.h"
+
+/******************************************************************************/
+/* LOCAL FUNCTIONS DECLARATION                                                */
+/******************************************************************************/
+
+#define TST_START_SEC_TST_CODE
+#include "TST_MemMap.h"
+
+static void TST_MATHSRV_vidFilterInit(uint8 u8Window);
+static void TST_MATHSRV_vidFilterMeas(uint32 u32Step);
+static uint16 TST_MATHSRV_u16FilterMedianRef(const uint16 *pku16Hist, uint8 u8Window);
+static void TST_MATHSRV_vidFirstOrderBankTest(void);
+static void TST_MATHSRV_vidSlewBankTest(void);
+static void TST_MATHSRV_vidMedianBankTest(uint8 u8ResIdx, uint8 u8Window);
+static void TST_MATHSRV_vidFilterWindowTest(void);
+static void TST_MATHSRV_vidFilterCmp(uint8 u8ResIdx,
+                                     uint32 u32T0,
+                                     uint32 u32T1,
+                                     uint32 u32T2);
+
+/******************************************************************************/
+/* GLOBAL FUNCTIONS DEFINITION                                                */
+/******************************************************************************/
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidFilterTest                                   */
+/* !Description : First order, slew and median 3/5/7 banks against the scalar */
+/*                loops, then the median window check of the bank init        */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+void TST_MATHSRV_vidFilterTest(void)
+{
+   TST_MATHSRV_vidFirstOrderBankTest();
+   TST_MATHSRV_vidSlewBankTest();
+   TST_MATHSRV_vidMedianBankTest(TST_MATHSRV_u8FILTER_MEDIAN_3, MATHSRV_u8MEDIAN_WINDOW_3);
+   TST_MATHSRV_vidMedianBankTest(TST_MATHSRV_u8FILTER_MEDIAN_5, MATHSRV_u8MEDIAN_WINDOW_5);
+   TST_MATHSRV_vidMedianBankTest(TST_MATHSRV_u8FILTER_MEDIAN_7, MATHSRV_u8MEDIAN_WINDOW_7);
+   TST_MATHSRV_vidFilterWindowTest();
+}
+
+/******************************************************************************/
+/* LOCAL FUNCTIONS DEFINITION                                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidFilterInit                                   */
+/* !Description : Random initial values, bank and reference states set on     */
+/*                them                                                        */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static void TST_MATHSRV_vidFilterInit(uint8 u8Window)
+{
+   uint32 u32LocIdx;
+
+
+   for (u32LocIdx = 0; u32LocIdx < TST_MATHSRV_u8FILTER_CHAN_NB; u32LocIdx++)
+   {
+      TST_MATHSRV_au16FilterInit[u32LocIdx] = (uint16)TST_MATHSRV_u32Rand();
+      TST_MATHSRV_au32FilterRefAcc[u32LocIdx] =
+         (uint32)TST_MATHSRV_au16FilterInit[u32LocIdx] << 16;
+      TST_MATHSRV_au16FilterRef[u32LocIdx] = TST_MATHSRV_au16FilterInit[u32LocIdx];
+   }
+   for (u32LocIdx = 0;
+        (u32LocIdx < (uint32)TST_MATHSRV_u8FILTER_CHAN_NB * u8Window)
+        && (u32LocIdx < TST_MATHSRV_u16FILTER_HIST_SIZE);
+        u32LocIdx++)
+   {
+      TST_MATHSRV_au16FilterRefHist[u32LocIdx] =
+         TST_MATHSRV_au16FilterInit[u32LocIdx / u8Window];
+   }
+
+   TST_MATHSRV_strFilterBank.pau32AccuracyFilterValue = TST_MATHSRV_au32FilterAcc;
+   TST_MATHSRV_strFilterBank.pau16FilteredValue       = TST_MATHSRV_au16FilterOut;
+   TST_MATHSRV_strFilterBank.pau16MedianHistory       = TST_MATHSRV_au16FilterHist;
+   TST_MATHSRV_strFilterBank.u8ChannelNumber          = TST_MATHSRV_u8FILTER_CHAN_NB;
+   TST_MATHSRV_strFilterBank.u8MedianWindow           = u8Window;
+   MATHSRV_vidFilterBankInitU16(&TST_MATHSRV_strFilterBank, TST_MATHSRV_au16FilterInit);
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidFilterMeas                                   */
+/* !Description : One sample per channel: noisy slow trace on most steps,     */
+/*                spikes, uniform values and the 0/0xFFFF extremes otherwise  */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static void TST_MATHSRV_vidFilterMeas(uint32 u32Step)
+{
+   uint32 u32LocRnd;
+   sint32 s32LocVal;
+   uint32 u32LocIdx;
+
+
+   for (u32LocIdx = 0; u32LocIdx < TST_MATHSRV_u8FILTER_CHAN_NB; u32LocIdx++)
+   {
+      u32LocRnd = TST_MATHSRV_u32Rand();
+      switch ((u32Step + u32LocIdx) % 8U)
+      {
+         case 0U:
+            TST_MATHSRV_au16FilterMeas[u32LocIdx] = (uint16)u32LocRnd;
+            break;
+
+         case 1U:
+            TST_MATHSRV_au16FilterMeas[u32LocIdx] =
+               (((u32LocRnd >> 16) & 1U) != 0U) ? 0xFFFFU : 0U;
+            break;
+
+         default:
+            s32LocVal = (sint32)TST_MATHSRV_au16FilterMeas[u32LocIdx]
+                      + (sint32)(u32LocRnd & 0x7FFU) - 1024;
+            if (s32LocVal < 0)
+            {
+               s32LocVal = 0;
+            }
+            if (s32LocVal > 0xFFFF)
+            {
+               s32LocVal = 0xFFFF;
+            }
+            TST_MATHSRV_au16FilterMeas[u32LocIdx] = (uint16)s32LocVal;
+            break;
+      }
+   }
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_u16FilterMedianRef                              */
+/* !Description : Reference median: full insertion sort of a local copy of    */
+/*                the u8Window samples                                        */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static uint16 TST_MATHSRV_u16FilterMedianRef(const uint16 *pku16Hist, uint8 u8Window)
+{
+   uint16 au16LocSorted[MATHSRV_u8MEDIAN_WINDOW_MAX];
+   uint16 u16LocVal;
+   uint8  u8LocIdx;
+   uint8  u8LocPos;
+
+
+   for (u8LocIdx = 0; u8LocIdx < u8Window; u8LocIdx++)
+   {
+      u16LocVal = pku16Hist[u8LocIdx];
+      u8LocPos  = u8LocIdx;
+      while ((u8LocPos > 0U) && (au16LocSorted[u8LocPos - 1U] > u16LocVal))
+      {
+         au16LocSorted[u8LocPos] = au16LocSorted[u8LocPos - 1U];
+         u8LocPos--;
+      }
+      au16LocSorted[u8LocPos] = u16LocVal;
+   }
+   return(au16LocSorted[u8Window / 2U]);
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidFirstOrderBankTest                           */
+/* !Description : Random gains including 0 and 0xFFFF, scalar                 */
+/*                MATHSRV_u16FirstOrderFilterGu16 loop against the bank       */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static void TST_MATHSRV_vidFirstOrderBankTest(void)
+{
+   uint32 u32LocStep;
+   uint32 u32LocIdx;
+   uint32 u32LocT0;
+   uint32 u32LocT1;
+   uint32 u32LocT2;
+
+
+   for (u32LocStep = 0; u32LocStep < TST_MATHSRV_u32FILTER_STEP_NB; u32LocStep++)
+   {
+      if ((u32LocStep % 256U) == 0U)
+      {
+         TST_MATHSRV_vidFilterInit(MATHSRV_u8MEDIAN_WINDOW_3);
+         for (u32LocIdx = 0; u32LocIdx < TST_MATHSRV_u8FILTER_CHAN_NB; u32LocIdx++)
+         {
+            TST_MATHSRV_au16FilterPar1[u32LocIdx] = (uint16)TST_MATHSRV_u32Rand();
+         }
+         TST_MATHSRV_au16FilterPar1[0] = 0U;
+         TST_MATHSRV_au16FilterPar1[1] = 0xFFFFU;
+      }
+      TST_MATHSRV_vidFilterMeas(u32LocStep);
+
+      u32LocT0 = TST_MATHSRV_u32GET_TIME_STAMP();
+      for (u32LocIdx = 0; u32LocIdx < TST_MATHSRV_u8FILTER_CHAN_NB; u32LocIdx++)
+      {
+         TST_MATHSRV_au16FilterRef[u32LocIdx] =
+            MATHSRV_u16FirstOrderFilterGu16(TST_MATHSRV_au16FilterPar1[u32LocIdx],
+                                            &TST_MATHSRV_au32FilterRefAcc[u32LocIdx],
+                                            TST_MATHSRV_au16FilterMeas[u32LocIdx]);
+      }
+      u32LocT1 = TST_MATHSRV_u32GET_TIME_STAMP();
+      MATHSRV_vidFirstOrderFilterBankGu16(&TST_MATHSRV_strFilterBank,
+                                          TST_MATHSRV_au16FilterPar1,
+                                          TST_MATHSRV_au16FilterMeas);
+      u32LocT2 = TST_MATHSRV_u32GET_TIME_STAMP();
+
+      for (u32LocIdx = 0; u32LocIdx < TST_MATHSRV_u8FILTER_CHAN_NB; u32LocIdx++)
+      {
+         TST_MATHSRV_au16FilterOpt[u32LocIdx] = TST_MATHSRV_au16FilterOut[u32LocIdx];
+         if (TST_MATHSRV_au32FilterAcc[u32LocIdx] != TST_MATHSRV_au32FilterRefAcc[u32LocIdx])
+         {
+            /* !Comment : Accuracy drift, reported on the filtered value     */
+            TST_MATHSRV_au16FilterOpt[u32LocIdx] =
+               (uint16)~TST_MATHSRV_au16FilterRef[u32LocIdx];
+         }
+      }
+      TST_MATHSRV_vidFilterCmp(TST_MATHSRV_u8FILTER_FIRST_ORDER,
+                               u32LocT0, u32LocT1, u32LocT2);
+   }
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidSlewBankTest                                 */
+/* !Description : Random slopes including 0 and 0xFFFF, scalar                */
+/*                MATHSRV_u16SlewFilter loop against the bank                 */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static void TST_MATHSRV_vidSlewBankTest(void)
+{
+   uint32 u32LocStep;
+   uint32 u32LocIdx;
+   uint32 u32LocT0;
+   uint32 u32LocT1;
+   uint32 u32LocT2;
+
+
+   for (u32LocStep = 0; u32LocStep < TST_MATHSRV_u32FILTER_STEP_NB; u32LocStep++)
+   {
+      if ((u32LocStep % 256U) == 0U)
+      {
+         TST_MATHSRV_vidFilterInit(MATHSRV_u8MEDIAN_WINDOW_3);
+         for (u32LocIdx = 0; u32LocIdx < TST_MATHSRV_u8FILTER_CHAN_NB; u32LocIdx++)
+         {
+            TST_MATHSRV_au16FilterPar1[u32LocIdx] =
+               (uint16)(TST_MATHSRV_u32Rand() >> (u32LocIdx % 16U));
+            TST_MATHSRV_au16FilterPar2[u32LocIdx] =
+               (uint16)(TST_MATHSRV_u32Rand() >> (u32LocIdx % 16U));
+         }
+         TST_MATHSRV_au16FilterPar1[0] = 0U;
+         TST_MATHSRV_au16FilterPar2[1] = 0U;
+         TST_MATHSRV_au16FilterPar1[2] = 0xFFFFU;
+         TST_MATHSRV_au16FilterPar2[3] = 0xFFFFU;
+      }
+      TST_MATHSRV_vidFilterMeas(u32LocStep);
+
+      u32LocT0 = TST_MATHSRV_u32GET_TIME_STAMP();
+      for (u32LocIdx = 0; u32LocIdx < TST_MATHSRV_u8FILTER_CHAN_NB; u32LocIdx++)
+      {
+         TST_MATHSRV_au16FilterRef[u32LocIdx] =
+            MATHSRV_u16SlewFilter(TST_MATHSRV_au16FilterRef[u32LocIdx],
+                                  TST_MATHSRV_au16FilterMeas[u32LocIdx],
+                                  TST_MATHSRV_au16FilterPar1[u32LocIdx],
+                                  TST_MATHSRV_au16FilterPar2[u32LocIdx]);
+      }
+      u32LocT1 = TST_MATHSRV_u32GET_TIME_STAMP();
+      MATHSRV_vidSlewFilterBankU16(&TST_MATHSRV_strFilterBank,
+                                   TST_MATHSRV_au16FilterMeas,
+                                   TST_MATHSRV_au16FilterPar1,
+                                   TST_MATHSRV_au16FilterPar2);
+      u32LocT2 = TST_MATHSRV_u32GET_TIME_STAMP();
+
+      for (u32LocIdx = 0; u32LocIdx < TST_MATHSRV_u8FILTER_CHAN_NB; u32LocIdx++)
+      {
+         TST_MATHSRV_au16FilterOpt[u32LocIdx] = TST_MATHSRV_au16FilterOut[u32LocIdx];
+      }
+      TST_MATHSRV_vidFilterCmp(TST_MATHSRV_u8FILTER_SLEW,
+                               u32LocT0, u32LocT1, u32LocT2);
+   }
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidMedianBankTest                               */
+/* !Description : Median bank of u8Window samples against a per channel loop: */
+/*                MATHSRV_u16MedianFilter for 3 samples, the full sort of     */
+/*                TST_MATHSRV_u16FilterMedianRef for 5 and 7                  */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static void TST_MATHSRV_vidMedianBankTest(uint8 u8ResIdx, uint8 u8Window)
+{
+   const uint16 *pku16LocHist;
+   uint32 u32LocStep;
+   uint32 u32LocIdx;
+   uint32 u32LocT0;
+   uint32 u32LocT1;
+   uint32 u32LocT2;
+   uint8  u8LocSample;
+
+
+   u8LocSample = 0;
+   for (u32LocStep = 0; u32LocStep < TST_MATHSRV_u32FILTER_STEP_NB; u32LocStep++)
+   {
+      if ((u32LocStep % 256U) == 0U)
+      {
+         TST_MATHSRV_vidFilterInit(u8Window);
+         u8LocSample = 0;
+      }
+      TST_MATHSRV_vidFilterMeas(u32LocStep);
+
+      u32LocT0 = TST_MATHSRV_u32GET_TIME_STAMP();
+      for (u32LocIdx = 0; u32LocIdx < TST_MATHSRV_u8FILTER_CHAN_NB; u32LocIdx++)
+      {
+         TST_MATHSRV_au16FilterRefHist[(u32LocIdx * u8Window) + u8LocSample] =
+            TST_MATHSRV_au16FilterMeas[u32LocIdx];
+         pku16LocHist = &TST_MATHSRV_au16FilterRefHist[u32LocIdx * u8Window];
+         if (u8Window == MATHSRV_u8MEDIAN_WINDOW_3)
+         {
+            TST_MATHSRV_au16FilterRef[u32LocIdx] =
+               MATHSRV_u16MedianFilter(pku16LocHist[0], pku16LocHist[1], pku16LocHist[2]);
+         }
+         else
+         {
+            TST_MATHSRV_au16FilterRef[u32LocIdx] =
+               TST_MATHSRV_u16FilterMedianRef(pku16LocHist, u8Window);
+         }
+      }
+      u32LocT1 = TST_MATHSRV_u32GET_TIME_STAMP();
+      MATHSRV_vidMedianFilterBankU16(&TST_MATHSRV_strFilterBank,
+                                     TST_MATHSRV_au16FilterMeas,
+                                     TST_MATHSRV_au16FilterOpt);
+      u32LocT2 = TST_MATHSRV_u32GET_TIME_STAMP();
+
+      u8LocSample++;
+      if (u8LocSample >= u8Window)
+      {
+         u8LocSample = 0;
+      }
+      TST_MATHSRV_vidFilterCmp(u8ResIdx, u32LocT0, u32LocT1, u32LocT2);
+   }
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidFilterWindowTest                             */
+/* !Description : Windows 0 to TST_MATHSRV_u8FILTER_WINDOW_CHK with and       */
+/*                without history: the init shall clamp the window down to    */
+/*                7, 5 or 3 or disable the median, never write the history    */
+/*                past window x channels, and a disabled median shall return  */
+/*                its samples. One case per window and history, not timed.    */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static void TST_MATHSRV_vidFilterWindowTest(void)
+{
+   TST_MATHSRV_tstrRes *pstrLocRes;
+   uint32 u32LocIdx;
+   uint32 u32LocHistSize;
+   uint8  u8LocWindow;
+   uint8  u8LocExpected;
+   uint8  u8LocNoHist;
+   boolean bLocOk;
+
+
+   pstrLocRes = &TST_MATHSRV_astrRes[TST_MATHSRV_u8FILTER_WINDOW];
+   for (u8LocNoHist = 0; u8LocNoHist < 2U; u8LocNoHist++)
+   {
+      for (u8LocWindow = 0; u8LocWindow <= TST_MATHSRV_u8FILTER_WINDOW_CHK; u8LocWindow++)
+      {
+         if ((u8LocNoHist != 0U) || (u8LocWindow < MATHSRV_u8MEDIAN_WINDOW_3))
+         {
+            u8LocExpected = MATHSRV_u8MEDIAN_WINDOW_OFF;
+         }
+         else if (u8LocWindow >= MATHSRV_u8MEDIAN_WINDOW_7)
+         {
+            u8LocExpected = MATHSRV_u8MEDIAN_WINDOW_7;
+         }
+         else if (u8LocWindow >= MATHSRV_u8MEDIAN_WINDOW_5)
+         {
+            u8LocExpected = MATHSRV_u8MEDIAN_WINDOW_5;
+         }
+         else
+         {
+            u8LocExpected = MATHSRV_u8MEDIAN_WINDOW_3;
+         }
+
+         /* !Comment : The history is sized for the expected window only,  */
+         /*            the guard sample follows it                          */
+         u32LocHistSize = (uint32)TST_MATHSRV_u8FILTER_CHAN_NB * u8LocExpected;
+         if (u8LocNoHist == 0U)
+         {
+            TST_MATHSRV_au16FilterHist[u32LocHistSize] = TST_MATHSRV_u16FILTER_GUARD;
+            TST_MATHSRV_vidFilterInit(u8LocWindow);
+         }
+         else
+         {
+            TST_MATHSRV_vidFilterInit(u8LocWindow);
+            TST_MATHSRV_au16FilterHist[u32LocHistSize] = TST_MATHSRV_u16FILTER_GUARD;
+            TST_MATHSRV_strFilterBank.pau16MedianHistory = NULL_PTR;
+            TST_MATHSRV_strFilterBank.u8MedianWindow     = u8LocWindow;
+            MATHSRV_vidFilterBankInitU16(&TST_MATHSRV_strFilterBank,
+                                         TST_MATHSRV_au16FilterInit);
+         }
+
+         bLocOk = (boolean)(   (TST_MATHSRV_strFilterBank.u8MedianWindow == u8LocExpected)
+                            && (TST_MATHSRV_au16FilterHist[u32LocHistSize]
+                                == TST_MATHSRV_u16FILTER_GUARD));
+         TST_MATHSRV_vidFilterMeas(0U);
+         MATHSRV_vidMedianFilterBankU16(&TST_MATHSRV_strFilterBank,
+                                        TST_MATHSRV_au16FilterMeas,
+                                        TST_MATHSRV_au16FilterOpt);
+         if (TST_MATHSRV_au16FilterHist[u32LocHistSize] != TST_MATHSRV_u16FILTER_GUARD)
+         {
+            bLocOk = FALSE;
+         }
+         if (u8LocExpected == MATHSRV_u8MEDIAN_WINDOW_OFF)
+         {
+            for (u32LocIdx = 0; u32LocIdx < TST_MATHSRV_u8FILTER_CHAN_NB; u32LocIdx++)
+            {
+               if (TST_MATHSRV_au16FilterOpt[u32LocIdx] != TST_MATHSRV_au16FilterMeas[u32LocIdx])
+               {
+                  bLocOk = FALSE;
+               }
+            }
+         }
+
+         pstrLocRes->u32CaseCnt++;
+         if (bLocOk == FALSE)
+         {
+            pstrLocRes->u32MismatchCnt++;
+         }
+      }
+   }
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidFilterCmp                                    */
+/* !Description : Accumulate the times and compare the bank results with the  */
+/*                scalar ones                                                 */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static void TST_MATHSRV_vidFilterCmp
+(
+   uint8 u8ResIdx,
+   uint32 u32T0,
+   uint32 u32T1,
+   uint32 u32T2
+)
+{
+   TST_MATHSRV_tstrRes *pstrLocRes;
+   uint32 u32LocIdx;
+
+
+   pstrLocRes = &TST_MATHSRV_astrRes[u8ResIdx];
+   pstrLocRes->u32RefTicks += u32T1 - u32T0;
+   pstrLocRes->u32OptTicks += u32T2 - u32T1;
+   for (u32LocIdx = 0; u32LocIdx < TST_MATHSRV_u8FILTER_CHAN_NB; u32LocIdx++)
+   {
+      pstrLocRes->u32CaseCnt++;
+      if (TST_MATHSRV_au16FilterRef[u32LocIdx] != TST_MATHSRV_au16FilterOpt[u32LocIdx])
+      {
+         pstrLocRes->u32MismatchCnt++;
+      }
+   }
+}
+
+#define TST_STOP_SEC_TST_CODE
+#include "TST_MemMap.h"
+
+/*------------------------------- end of file --------------------------------*/
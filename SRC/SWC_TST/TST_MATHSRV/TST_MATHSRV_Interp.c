@@ -0,0 +1,335 @@
+/******************************************************************************/
+/* !Layer           : TST                                                     */
+/* !Component       : TST_MATHSRV                                             */
+/* !Description     : Test of MATH and MATHSRV optimised services             */
+/*                                                                            */
+/* !File            : TST_MATHSRV_Interp.c                                    */
+/* !Description     : Array interpolation. MATHSRV_vidInterp1d/2dAryU16 and   */
+/*                    MathInterp1d/2dAryU16 are compared point by point with  */
+/*                    the scalar breakpoint search and interpolation calls    */
+/*                    they replace, and timed against them.                   */
+/*                                                                            */
+/* !Reference       :                                                         */
+/*                                                                            */
+/* Coding language  : C                                                       */
+/*                                                                            */
+/* COPYRIGHT VALEO all rights reserved                                        */
+/******************************************************************************/
+/* Dimension Informations
+ * %PCMS_HEADER_SUBSTITUTION_START:%
+ * The PID has this format: <Product ID>:<Item ID>.<Variant>-<Item Type>;<Revision>
+ * %PID:%
+ * %PCMS_HEADER_SUBSTITUTION_END:%
+ ******************************************************************************/
+
+#include "Std_Types.h"
+#include "MATHSRV.h"
+#include "MATH_SC.H"
+#include "TST_MATHSRV.h"
+#include "TST_MATHSRV_Cfg.h"
+
+/******************************************************************************/
+/* LOCAL DEFINES                                                              */
+/******************************************************************************/
+
+#define TST_MATHSRV_u8INTERP_AXIS_MAX      32U
+
+/* !Comment : The scalar interpolations read the point after the site, also   */
+/*            with a zero ratio on the last point: one line and one point of  */
+/*            margin                                                          */
+#define TST_MATHSRV_u16INTERP_MAP_SIZE     \
+   (((TST_MATHSRV_u8INTERP_AXIS_MAX + 1U) * TST_MATHSRV_u8INTERP_AXIS_MAX) + 1U)
+
+/******************************************************************************/
+/* LOCAL VARIABLES                                                            */
+/******************************************************************************/
+
+#define TST_START_SEC_TST_VAR
+#include "TST_MemMap.h"
+
+static uint16 TST_MATHSRV_au16InterpAxisX[TST_MATHSRV_u8INTERP_AXIS_MAX];
+static uint16 TST_MATHSRV_au16InterpAxisY[TST_MATHSRV_u8INTERP_AXIS_MAX];
+static uint16 TST_MATHSRV_au16InterpMap[TST_MATHSRV_u16INTERP_MAP_SIZE];
+static uint16 TST_MATHSRV_au16InterpInX[TST_MATHSRV_u8ARY_SIZE];
+static uint16 TST_MATHSRV_au16InterpInY[TST_MATHSRV_u8ARY_SIZE];
+static uint16 TST_MATHSRV_au16InterpRef[TST_MATHSRV_u8ARY_SIZE];
+static uint16 TST_MATHSRV_au16InterpOpt[TST_MATHSRV_u8ARY_SIZE];
+
+#define TST_STOP_SEC_TST_VAR
+#include "TST_MemMap.h"
+
+/******************************************************************************/
+/* LOCAL FUNCTIONS DECLARATION                                                */
+/******************************************************************************/
+
+#define TST_START_SEC_TST_CODE
+#include "TST_MemMap.h"
+
+static void TST_MATHSRV_vidInterpAxis(uint16 *pu16Axis, uint8 u8Nb);
+static void TST_MATHSRV_vidInterpIn(uint16 *pu16In,
+                                    const uint16 *pku16Axis,
+                                    uint8 u8Nb,
+                                    uint32 u32Kind);
+static void TST_MATHSRV_vidInterpCmp(uint8 u8ResIdx,
+                                     uint32 u32T0,
+                                     uint32 u32T1,
+                                     uint32 u32T2);
+
+/******************************************************************************/
+/* GLOBAL FUNCTIONS DEFINITION                                                */
+/******************************************************************************/
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidInterpTest                                   */
+/* !Description : For each run: random axes of 1 to 32 points, random map and */
+/*                TST_MATHSRV_u8ARY_SIZE inputs per axis, in turn a slowly    */
+/*                varying trace, uniform values and the breakpoints - 1/+0/+1.*/
+/*                The scalar loop gives the reference and its time, the array */
+/*                service the result to compare and its time.                 */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+void TST_MATHSRV_vidInterpTest(void)
+{
+   const uint16 *pku16LocMap;
+   uint32 u32LocRun;
+   uint32 u32LocIdx;
+   uint32 u32LocT0;
+   uint32 u32LocT1;
+   uint32 u32LocT2;
+   uint16 u16LocSiteX;
+   uint16 u16LocSiteY;
+   uint8  u8LocNbX;
+   uint8  u8LocNbY;
+
+
+   pku16LocMap = TST_MATHSRV_au16InterpMap;
+
+   for (u32LocRun = 0; u32LocRun < TST_MATHSRV_u32INTERP_RUN_NB; u32LocRun++)
+   {
+      u8LocNbX = (uint8)(1U + (TST_MATHSRV_u32Rand() % TST_MATHSRV_u8INTERP_AXIS_MAX));
+      u8LocNbY = (uint8)(1U + (TST_MATHSRV_u32Rand() % TST_MATHSRV_u8INTERP_AXIS_MAX));
+      TST_MATHSRV_vidInterpAxis(TST_MATHSRV_au16InterpAxisX, u8LocNbX);
+      TST_MATHSRV_vidInterpAxis(TST_MATHSRV_au16InterpAxisY, u8LocNbY);
+      for (u32LocIdx = 0; u32LocIdx < TST_MATHSRV_u16INTERP_MAP_SIZE; u32LocIdx++)
+      {
+         TST_MATHSRV_au16InterpMap[u32LocIdx] = (uint16)TST_MATHSRV_u32Rand();
+      }
+      TST_MATHSRV_vidInterpIn(TST_MATHSRV_au16InterpInX,
+                              TST_MATHSRV_au16InterpAxisX,
+                              u8LocNbX,
+                              u32LocRun % 3U);
+      TST_MATHSRV_vidInterpIn(TST_MATHSRV_au16InterpInY,
+                              TST_MATHSRV_au16InterpAxisY,
+                              u8LocNbY,
+                              u32LocRun % 3U);
+
+      /* !Comment : MATHSRV 1D                                               */
+      u32LocT0 = TST_MATHSRV_u32GET_TIME_STAMP();
+      for (u32LocIdx = 0; u32LocIdx < TST_MATHSRV_u8ARY_SIZE; u32LocIdx++)
+      {
+         u16LocSiteX =
+            MATHSRV_u16CalcParaIncAryU16(TST_MATHSRV_au16InterpAxisX,
+                                         TST_MATHSRV_au16InterpInX[u32LocIdx],
+                                         u8LocNbX);
+         TST_MATHSRV_au16InterpRef[u32LocIdx] =
+            MATHSRV_u16Interp1d(pku16LocMap, u16LocSiteX);
+      }
+      u32LocT1 = TST_MATHSRV_u32GET_TIME_STAMP();
+      MATHSRV_vidInterp1dAryU16(TST_MATHSRV_au16InterpAxisX,
+                                pku16LocMap,
+                                u8LocNbX,
+                                TST_MATHSRV_au16InterpInX,
+                                TST_MATHSRV_au16InterpOpt,
+                                TST_MATHSRV_u8ARY_SIZE);
+      u32LocT2 = TST_MATHSRV_u32GET_TIME_STAMP();
+      TST_MATHSRV_vidInterpCmp(TST_MATHSRV_u8INTERP_1D,
+                               u32LocT0, u32LocT1, u32LocT2);
+
+      /* !Comment : MATHSRV 2D, X is the line axis                           */
+      u32LocT0 = TST_MATHSRV_u32GET_TIME_STAMP();
+      for (u32LocIdx = 0; u32LocIdx < TST_MATHSRV_u8ARY_SIZE; u32LocIdx++)
+      {
+         u16LocSiteX =
+            MATHSRV_u16CalcParaIncAryU16(TST_MATHSRV_au16InterpAxisX,
+                                         TST_MATHSRV_au16InterpInX[u32LocIdx],
+                                         u8LocNbX);
+         u16LocSiteY =
+            MATHSRV_u16CalcParaIncAryU16(TST_MATHSRV_au16InterpAxisY,
+                                         TST_MATHSRV_au16InterpInY[u32LocIdx],
+                                         u8LocNbY);
+         TST_MATHSRV_au16InterpRef[u32LocIdx] =
+            MATHSRV_u16Interp2d(pku16LocMap, u16LocSiteX, u16LocSiteY, u8LocNbY);
+      }
+      u32LocT1 = TST_MATHSRV_u32GET_TIME_STAMP();
+      MATHSRV_vidInterp2dAryU16(pku16LocMap,
+                                TST_MATHSRV_au16InterpAxisX,
+                                u8LocNbX,
+                                TST_MATHSRV_au16InterpAxisY,
+                                u8LocNbY,
+                                TST_MATHSRV_au16InterpInX,
+                                TST_MATHSRV_au16InterpInY,
+                                TST_MATHSRV_au16InterpOpt,
+                                TST_MATHSRV_u8ARY_SIZE);
+      u32LocT2 = TST_MATHSRV_u32GET_TIME_STAMP();
+      TST_MATHSRV_vidInterpCmp(TST_MATHSRV_u8INTERP_2D,
+                               u32LocT0, u32LocT1, u32LocT2);
+
+      /* !Comment : MATH 1D                                                  */
+      u32LocT0 = TST_MATHSRV_u32GET_TIME_STAMP();
+      for (u32LocIdx = 0; u32LocIdx < TST_MATHSRV_u8ARY_SIZE; u32LocIdx++)
+      {
+         u16LocSiteX = MathCalcBkptU16(TST_MATHSRV_au16InterpAxisX,
+                                       TST_MATHSRV_au16InterpInX[u32LocIdx],
+                                       (uint8)(u8LocNbX - 1U));
+         TST_MATHSRV_au16InterpRef[u32LocIdx] =
+            MathInterp1dU16(pku16LocMap, u16LocSiteX);
+      }
+      u32LocT1 = TST_MATHSRV_u32GET_TIME_STAMP();
+      MathInterp1dAryU16(TST_MATHSRV_au16InterpAxisX,
+                         pku16LocMap,
+                         (uint8)(u8LocNbX - 1U),
+                         TST_MATHSRV_au16InterpInX,
+                         TST_MATHSRV_au16InterpOpt,
+                         TST_MATHSRV_u8ARY_SIZE);
+      u32LocT2 = TST_MATHSRV_u32GET_TIME_STAMP();
+      TST_MATHSRV_vidInterpCmp(TST_MATHSRV_u8MATH_INTERP_1D,
+                               u32LocT0, u32LocT1, u32LocT2);
+
+      /* !Comment : MATH 2D, Y is the line axis                              */
+      u32LocT0 = TST_MATHSRV_u32GET_TIME_STAMP();
+      for (u32LocIdx = 0; u32LocIdx < TST_MATHSRV_u8ARY_SIZE; u32LocIdx++)
+      {
+         u16LocSiteY = MathCalcBkptU16(TST_MATHSRV_au16InterpAxisY,
+                                       TST_MATHSRV_au16InterpInY[u32LocIdx],
+                                       (uint8)(u8LocNbY - 1U));
+         u16LocSiteX = MathCalcBkptU16(TST_MATHSRV_au16InterpAxisX,
+                                       TST_MATHSRV_au16InterpInX[u32LocIdx],
+                                       (uint8)(u8LocNbX - 1U));
+         TST_MATHSRV_au16InterpRef[u32LocIdx] =
+            MathInterp2dU16(pku16LocMap, u16LocSiteY, u16LocSiteX, u8LocNbX);
+      }
+      u32LocT1 = TST_MATHSRV_u32GET_TIME_STAMP();
+      MathInterp2dAryU16(pku16LocMap,
+                         TST_MATHSRV_au16InterpAxisY,
+                         (uint8)(u8LocNbY - 1U),
+                         TST_MATHSRV_au16InterpAxisX,
+                         (uint8)(u8LocNbX - 1U),
+                         TST_MATHSRV_au16InterpInY,
+                         TST_MATHSRV_au16InterpInX,
+                         TST_MATHSRV_au16InterpOpt,
+                         TST_MATHSRV_u8ARY_SIZE);
+      u32LocT2 = TST_MATHSRV_u32GET_TIME_STAMP();
+      TST_MATHSRV_vidInterpCmp(TST_MATHSRV_u8MATH_INTERP_2D,
+                               u32LocT0, u32LocT1, u32LocT2);
+   }
+}
+
+/******************************************************************************/
+/* LOCAL FUNCTIONS DEFINITION                                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidInterpAxis                                   */
+/* !Description : Strictly increasing random axis of u8Nb points              */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static void TST_MATHSRV_vidInterpAxis(uint16 *pu16Axis, uint8 u8Nb)
+{
+   uint32 u32LocVal;
+   uint32 u32LocStepMax;
+   uint8  u8LocIdx;
+
+
+   u32LocVal     = TST_MATHSRV_u32Rand() % 4096U;
+   u32LocStepMax = (0xFFFFUL - u32LocVal) / u8Nb;
+   for (u8LocIdx = 0; u8LocIdx < u8Nb; u8LocIdx++)
+   {
+      pu16Axis[u8LocIdx] = (uint16)u32LocVal;
+      u32LocVal += 1U + (TST_MATHSRV_u32Rand() % u32LocStepMax);
+   }
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidInterpIn                                     */
+/* !Description : TST_MATHSRV_u8ARY_SIZE inputs: u32Kind 0 slowly varying     */
+/*                trace, 1 uniform values, 2 breakpoints - 1/+0/+1            */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static void TST_MATHSRV_vidInterpIn
+(
+   uint16 *pu16In,
+   const uint16 *pku16Axis,
+   uint8 u8Nb,
+   uint32 u32Kind
+)
+{
+   uint32 u32LocRnd;
+   sint32 s32LocVal;
+   uint32 u32LocIdx;
+
+
+   s32LocVal = (sint32)(TST_MATHSRV_u32Rand() & 0xFFFFU);
+   for (u32LocIdx = 0; u32LocIdx < TST_MATHSRV_u8ARY_SIZE; u32LocIdx++)
+   {
+      u32LocRnd = TST_MATHSRV_u32Rand();
+      if (u32Kind == 0U)
+      {
+         s32LocVal += (sint32)(u32LocRnd & 0x3FFU) - 512;
+         if (s32LocVal < 0)
+         {
+            s32LocVal = 0;
+         }
+         if (s32LocVal > 0xFFFF)
+         {
+            s32LocVal = 0xFFFF;
+         }
+         pu16In[u32LocIdx] = (uint16)s32LocVal;
+      }
+      else if (u32Kind == 1U)
+      {
+         pu16In[u32LocIdx] = (uint16)u32LocRnd;
+      }
+      else
+      {
+         pu16In[u32LocIdx] =
+            (uint16)( pku16Axis[(u32LocRnd >> 8) % u8Nb]
+                    + (u32LocRnd % 3U) - 1U);
+      }
+   }
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidInterpCmp                                    */
+/* !Description : Accumulate the times and compare the array results with the */
+/*                scalar ones                                                 */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static void TST_MATHSRV_vidInterpCmp
+(
+   uint8 u8ResIdx,
+   uint32 u32T0,
+   uint32 u32T1,
+   uint32 u32T2
+)
+{
+   TST_MATHSRV_tstrRes *pstrLocRes;
+   uint32 u32LocIdx;
+
+
+   pstrLocRes = &TST_MATHSRV_astrRes[u8ResIdx];
+   pstrLocRes->u32RefTicks += u32T1 - u32T0;
+   pstrLocRes->u32OptTicks += u32T2 - u32T1;
+   for (u32LocIdx = 0; u32LocIdx < TST_MATHSRV_u8ARY_SIZE; u32LocIdx++)
+   {
+      pstrLocRes->u32CaseCnt++;
+      if (TST_MATHSRV_au16InterpRef[u32LocIdx] != TST_MATHSRV_au16InterpOpt[u32LocIdx])
+      {
+         pstrLocRes->u32MismatchCnt++;
+      }
+   }
+}
+
+#define TST_STOP_SEC_TST_CODE
+#include "TST_MemMap.h"
+
+/*------------------------------- end of file --------------------------------*/
@@ -0,0 +1,532 @@
+/******************************************************************************/
+/* !Layer           : TST                                                     */
+/* !Component       : TST_MATHSRV                                             */
+/* !Description     : Test of MATH and MATHSRV optimised services             */
+/*                                                                            */
+/* !File            : TST_MATHSRV_Math.c                                      */
+/* !Description     : MATH square root and trigonometry kernels.              */
+/*                    MathSquareRootNewton is compared with MathSquareRoot,   */
+/*                    the sin/cos and atan2 kernels with a float64 reference  */
+/*                    against the maximum errors documented in MATH_TRI.H.    */
+/*                    The reference uses no libm, so that the module builds   */
+/*                    with the target headers.                                */
+/*                                                                            */
+/* !Reference       :                                                         */
+/*                                                                            */
+/* Coding language  : C                                                       */
+/*                                                                            */
+/* COPYRIGHT VALEO all rights reserved                                        */
+/******************************************************************************/
+/* Dimension Informations
+ * %PCMS_HEADER_SUBSTITUTION_START:%
+ * The PID has this format: <Product ID>:<Item ID>.<Variant>-<Item Type>;<Revision>
+ * %PID:%
+ * %PCMS_HEADER_SUBSTITUTION_END:%
+ ******************************************************************************/
+
+#include "Std_Types.h"
+#include "MATH_LIB.H"
+#include "MATH_TRI.H"
+#include "TST_MATHSRV.h"
+#include "TST_MATHSRV_Cfg.h"
+
+/******************************************************************************/
+/* LOCAL DEFINES                                                              */
+/******************************************************************************/
+
+/* !Comment : Maximum errors documented in MATH_TRI.H, in LSB of the result   */
+/*            (sinus 32767 = 1, angle 65536 = 2*PI)                           */
+#define TST_MATHSRV_f64SIN_TAB_ERR_MAX      4.5
+#define TST_MATHSRV_f64SIN_COS_TAB_ERR_MAX  5.3
+#define TST_MATHSRV_f64SIN_COS_POLY_ERR_MAX 1.1
+#define TST_MATHSRV_f64ATAN2_ERR_MAX        1.7
+
+#define TST_MATHSRV_f64PI                  3.14159265358979323846
+#define TST_MATHSRV_f64SQRT_3              1.73205080756887729353
+/* !Comment : tan(PI/12), limit of the atan argument reduction                */
+#define TST_MATHSRV_f64TAN_PI_DIV_12       0.26794919243112270647
+#define TST_MATHSRV_f64SIN_ONE             32767.0
+#define TST_MATHSRV_f64ANGLE_2_PI          65536.0
+
+/* !Comment : Terms of the reference series, error below 1e-15 on the         */
+/*            reduced arguments                                               */
+#define TST_MATHSRV_u8REF_TERM_NB          12U
+
+/* !Comment : Square root inputs: k^2 and k^2 - 1 for k = 1..65536, then      */
+/*            random values                                                   */
+#define TST_MATHSRV_u32SQRT_SQUARE_NB      131072UL
+
+/* !Comment : Values per axis of the atan2 grid                               */
+#define TST_MATHSRV_u32ATAN2_AXIS_NB       \
+   ((65534UL / TST_MATHSRV_u16ATAN2_STEP) + 1UL)
+
+/******************************************************************************/
+/* LOCAL VARIABLES                                                            */
+/******************************************************************************/
+
+#define TST_START_SEC_TST_VAR
+#include "TST_MemMap.h"
+
+static uint32  TST_MATHSRV_au32MathIn[TST_MATHSRV_u16BUF_SIZE];
+static uint16  TST_MATHSRV_au16MathRef[TST_MATHSRV_u16BUF_SIZE];
+static uint16  TST_MATHSRV_au16MathOpt[TST_MATHSRV_u16BUF_SIZE];
+static float64 TST_MATHSRV_af64MathRefSin[TST_MATHSRV_u16BUF_SIZE];
+static float64 TST_MATHSRV_af64MathRefCos[TST_MATHSRV_u16BUF_SIZE];
+static float64 TST_MATHSRV_af64MathRefAngle[TST_MATHSRV_u16BUF_SIZE];
+static sint16  TST_MATHSRV_as16MathSin[TST_MATHSRV_u16BUF_SIZE];
+static sint16  TST_MATHSRV_as16MathCos[TST_MATHSRV_u16BUF_SIZE];
+
+#define TST_STOP_SEC_TST_VAR
+#include "TST_MemMap.h"
+
+/******************************************************************************/
+/* LOCAL FUNCTIONS DECLARATION                                                */
+/******************************************************************************/
+
+#define TST_START_SEC_TST_CODE
+#include "TST_MemMap.h"
+
+static void TST_MATHSRV_vidSqrtTest(void);
+static void TST_MATHSRV_vidSinCosTabTest(void);
+static void TST_MATHSRV_vidSinCosPolyTest(void);
+static void TST_MATHSRV_vidAtan2Test(void);
+static void TST_MATHSRV_vidSinCosRef(uint16 u16Angle, float64 *pf64Sin, float64 *pf64Cos);
+static float64 TST_MATHSRV_f64Atan2Ref(sint16 s16Sin, sint16 s16Cos);
+static float64 TST_MATHSRV_f64Abs(float64 f64Val);
+static void TST_MATHSRV_vidMathErrChk(TST_MATHSRV_tstrRes *pstrRes,
+                                      float64 f64Err,
+                                      float64 f64ErrMax);
+
+/******************************************************************************/
+/* GLOBAL FUNCTIONS DEFINITION                                                */
+/******************************************************************************/
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidMathTest                                     */
+/* !Description : Square root, table and polynomial sin/cos, atan2            */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+void TST_MATHSRV_vidMathTest(void)
+{
+   TST_MATHSRV_vidSqrtTest();
+   TST_MATHSRV_vidSinCosTabTest();
+   TST_MATHSRV_vidSinCosPolyTest();
+   TST_MATHSRV_vidAtan2Test();
+}
+
+/******************************************************************************/
+/* LOCAL FUNCTIONS DEFINITION                                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidSqrtTest                                     */
+/* !Description : MathSquareRootNewton against MathSquareRoot, every          */
+/*                difference is a mismatch                                    */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static void TST_MATHSRV_vidSqrtTest(void)
+{
+   TST_MATHSRV_tstrRes *pstrLocRes;
+   uint32 u32LocNb;
+   uint32 u32LocK;
+   uint32 u32LocT0;
+   uint32 u32LocT1;
+   uint32 u32LocT2;
+   uint16 u16LocIdx;
+
+
+   pstrLocRes = &TST_MATHSRV_astrRes[TST_MATHSRV_u8MATH_SQRT];
+   for (u32LocNb = 0;
+        u32LocNb < (TST_MATHSRV_u32SQRT_SQUARE_NB + TST_MATHSRV_u32SQRT_RND_NB);
+        u32LocNb += TST_MATHSRV_u16BUF_SIZE)
+   {
+      for (u16LocIdx = 0; u16LocIdx < TST_MATHSRV_u16BUF_SIZE; u16LocIdx++)
+      {
+         if ((u32LocNb + u16LocIdx) < TST_MATHSRV_u32SQRT_SQUARE_NB)
+         {
+            u32LocK = ((u32LocNb + u16LocIdx) >> 1) + 1U;
+            TST_MATHSRV_au32MathIn[u16LocIdx] =
+               (u32LocK * u32LocK) - ((u32LocNb + u16LocIdx) & 1U);
+         }
+         else
+         {
+            TST_MATHSRV_au32MathIn[u16LocIdx] = TST_MATHSRV_u32Rand();
+         }
+      }
+
+      u32LocT0 = TST_MATHSRV_u32GET_TIME_STAMP();
+      for (u16LocIdx = 0; u16LocIdx < TST_MATHSRV_u16BUF_SIZE; u16LocIdx++)
+      {
+         TST_MATHSRV_au16MathRef[u16LocIdx] = MathSquareRoot(TST_MATHSRV_au32MathIn[u16LocIdx]);
+      }
+      u32LocT1 = TST_MATHSRV_u32GET_TIME_STAMP();
+      for (u16LocIdx = 0; u16LocIdx < TST_MATHSRV_u16BUF_SIZE; u16LocIdx++)
+      {
+         TST_MATHSRV_au16MathOpt[u16LocIdx] = MathSquareRootNewton(TST_MATHSRV_au32MathIn[u16LocIdx]);
+      }
+      u32LocT2 = TST_MATHSRV_u32GET_TIME_STAMP();
+      pstrLocRes->u32RefTicks += u32LocT1 - u32LocT0;
+      pstrLocRes->u32OptTicks += u32LocT2 - u32LocT1;
+
+      for (u16LocIdx = 0; u16LocIdx < TST_MATHSRV_u16BUF_SIZE; u16LocIdx++)
+      {
+         pstrLocRes->u32CaseCnt++;
+         if (TST_MATHSRV_au16MathRef[u16LocIdx] != TST_MATHSRV_au16MathOpt[u16LocIdx])
+         {
+            pstrLocRes->u32MismatchCnt++;
+         }
+      }
+   }
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidSinCosTabTest                                */
+/* !Description : MathSinusCosinus on every angle against the reference,      */
+/*                timed against it. MathSinus and MathCosinus are checked on  */
+/*                the same angles with their own bound.                       */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static void TST_MATHSRV_vidSinCosTabTest(void)
+{
+   TST_MATHSRV_tstrRes *pstrLocRes;
+   uint32 u32LocNb;
+   uint32 u32LocT0;
+   uint32 u32LocT1;
+   uint32 u32LocT2;
+   uint16 u16LocIdx;
+   uint16 u16LocAngle;
+
+
+   pstrLocRes = &TST_MATHSRV_astrRes[TST_MATHSRV_u8MATH_SIN_COS_TAB];
+   for (u32LocNb = 0; u32LocNb < 65536UL; u32LocNb += TST_MATHSRV_u16BUF_SIZE)
+   {
+      u32LocT0 = TST_MATHSRV_u32GET_TIME_STAMP();
+      for (u16LocIdx = 0; u16LocIdx < TST_MATHSRV_u16BUF_SIZE; u16LocIdx++)
+      {
+         TST_MATHSRV_vidSinCosRef((uint16)(u32LocNb + u16LocIdx),
+                                  &TST_MATHSRV_af64MathRefSin[u16LocIdx],
+                                  &TST_MATHSRV_af64MathRefCos[u16LocIdx]);
+      }
+      u32LocT1 = TST_MATHSRV_u32GET_TIME_STAMP();
+      for (u16LocIdx = 0; u16LocIdx < TST_MATHSRV_u16BUF_SIZE; u16LocIdx++)
+      {
+         MathSinusCosinus((uint16)(u32LocNb + u16LocIdx),
+                          &TST_MATHSRV_as16MathSin[u16LocIdx],
+                          &TST_MATHSRV_as16MathCos[u16LocIdx]);
+      }
+      u32LocT2 = TST_MATHSRV_u32GET_TIME_STAMP();
+      pstrLocRes->u32RefTicks += u32LocT1 - u32LocT0;
+      pstrLocRes->u32OptTicks += u32LocT2 - u32LocT1;
+
+      for (u16LocIdx = 0; u16LocIdx < TST_MATHSRV_u16BUF_SIZE; u16LocIdx++)
+      {
+         u16LocAngle = (uint16)(u32LocNb + u16LocIdx);
+         TST_MATHSRV_vidMathErrChk(pstrLocRes,
+                                   (float64)TST_MATHSRV_as16MathSin[u16LocIdx]
+                                   - TST_MATHSRV_af64MathRefSin[u16LocIdx],
+                                   TST_MATHSRV_f64SIN_COS_TAB_ERR_MAX);
+         TST_MATHSRV_vidMathErrChk(pstrLocRes,
+                                   (float64)TST_MATHSRV_as16MathCos[u16LocIdx]
+                                   - TST_MATHSRV_af64MathRefCos[u16LocIdx],
+                                   TST_MATHSRV_f64SIN_COS_TAB_ERR_MAX);
+         TST_MATHSRV_vidMathErrChk(pstrLocRes,
+                                   (float64)MathSinus(u16LocAngle)
+                                   - TST_MATHSRV_af64MathRefSin[u16LocIdx],
+                                   TST_MATHSRV_f64SIN_TAB_ERR_MAX);
+         TST_MATHSRV_vidMathErrChk(pstrLocRes,
+                                   (float64)MathCosinus(u16LocAngle)
+                                   - TST_MATHSRV_af64MathRefCos[u16LocIdx],
+                                   TST_MATHSRV_f64SIN_TAB_ERR_MAX);
+      }
+   }
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidSinCosPolyTest                               */
+/* !Description : MathSinusCosinusPoly on every angle against the reference.  */
+/*                The reference time is the one of MathSinusCosinus, to show  */
+/*                the cost of the accuracy class.                             */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static void TST_MATHSRV_vidSinCosPolyTest(void)
+{
+   TST_MATHSRV_tstrRes *pstrLocRes;
+   uint32 u32LocNb;
+   uint32 u32LocT0;
+   uint32 u32LocT1;
+   uint32 u32LocT2;
+   uint16 u16LocIdx;
+
+
+   pstrLocRes = &TST_MATHSRV_astrRes[TST_MATHSRV_u8MATH_SIN_COS_POLY];
+   for (u32LocNb = 0; u32LocNb < 65536UL; u32LocNb += TST_MATHSRV_u16BUF_SIZE)
+   {
+      for (u16LocIdx = 0; u16LocIdx < TST_MATHSRV_u16BUF_SIZE; u16LocIdx++)
+      {
+         TST_MATHSRV_vidSinCosRef((uint16)(u32LocNb + u16LocIdx),
+                                  &TST_MATHSRV_af64MathRefSin[u16LocIdx],
+                                  &TST_MATHSRV_af64MathRefCos[u16LocIdx]);
+      }
+
+      u32LocT0 = TST_MATHSRV_u32GET_TIME_STAMP();
+      for (u16LocIdx = 0; u16LocIdx < TST_MATHSRV_u16BUF_SIZE; u16LocIdx++)
+      {
+         MathSinusCosinus((uint16)(u32LocNb + u16LocIdx),
+                          &TST_MATHSRV_as16MathSin[u16LocIdx],
+                          &TST_MATHSRV_as16MathCos[u16LocIdx]);
+      }
+      u32LocT1 = TST_MATHSRV_u32GET_TIME_STAMP();
+      for (u16LocIdx = 0; u16LocIdx < TST_MATHSRV_u16BUF_SIZE; u16LocIdx++)
+      {
+         MathSinusCosinusPoly((uint16)(u32LocNb + u16LocIdx),
+                              &TST_MATHSRV_as16MathSin[u16LocIdx],
+                              &TST_MATHSRV_as16MathCos[u16LocIdx]);
+      }
+      u32LocT2 = TST_MATHSRV_u32GET_TIME_STAMP();
+      pstrLocRes->u32RefTicks += u32LocT1 - u32LocT0;
+      pstrLocRes->u32OptTicks += u32LocT2 - u32LocT1;
+
+      for (u16LocIdx = 0; u16LocIdx < TST_MATHSRV_u16BUF_SIZE; u16LocIdx++)
+      {
+         TST_MATHSRV_vidMathErrChk(pstrLocRes,
+                                   (float64)TST_MATHSRV_as16MathSin[u16LocIdx]
+                                   - TST_MATHSRV_af64MathRefSin[u16LocIdx],
+                                   TST_MATHSRV_f64SIN_COS_POLY_ERR_MAX);
+         TST_MATHSRV_vidMathErrChk(pstrLocRes,
+                                   (float64)TST_MATHSRV_as16MathCos[u16LocIdx]
+                                   - TST_MATHSRV_af64MathRefCos[u16LocIdx],
+                                   TST_MATHSRV_f64SIN_COS_POLY_ERR_MAX);
+      }
+   }
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidAtan2Test                                    */
+/* !Description : MathArctangente2 on a grid of (sinus, cosinus) pairs of     */
+/*                step TST_MATHSRV_u16ATAN2_STEP covering the full circle,    */
+/*                against the reference and timed against it                  */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static void TST_MATHSRV_vidAtan2Test(void)
+{
+   TST_MATHSRV_tstrRes *pstrLocRes;
+   float64 f64LocErr;
+   uint32 u32LocNb;
+   uint32 u32LocPair;
+   uint32 u32LocT0;
+   uint32 u32LocT1;
+   uint32 u32LocT2;
+   uint16 u16LocIdx;
+   uint16 u16LocBufNb;
+   sint16 s16LocSin;
+   sint16 s16LocCos;
+
+
+   pstrLocRes = &TST_MATHSRV_astrRes[TST_MATHSRV_u8MATH_ATAN2];
+   for (u32LocNb = 0;
+        u32LocNb < (TST_MATHSRV_u32ATAN2_AXIS_NB * TST_MATHSRV_u32ATAN2_AXIS_NB);
+        u32LocNb += TST_MATHSRV_u16BUF_SIZE)
+   {
+      u16LocBufNb = 0;
+      for (u16LocIdx = 0; u16LocIdx < TST_MATHSRV_u16BUF_SIZE; u16LocIdx++)
+      {
+         u32LocPair = u32LocNb + u16LocIdx;
+         if (u32LocPair < (TST_MATHSRV_u32ATAN2_AXIS_NB * TST_MATHSRV_u32ATAN2_AXIS_NB))
+         {
+            s16LocSin = (sint16)(-32767 + (sint32)((u32LocPair / TST_MATHSRV_u32ATAN2_AXIS_NB)
+                                                   * TST_MATHSRV_u16ATAN2_STEP));
+            s16LocCos = (sint16)(-32767 + (sint32)((u32LocPair % TST_MATHSRV_u32ATAN2_AXIS_NB)
+                                                   * TST_MATHSRV_u16ATAN2_STEP));
+            if ((s16LocSin != 0) || (s16LocCos != 0))
+            {
+               TST_MATHSRV_as16MathSin[u16LocBufNb] = s16LocSin;
+               TST_MATHSRV_as16MathCos[u16LocBufNb] = s16LocCos;
+               u16LocBufNb++;
+            }
+         }
+      }
+
+      u32LocT0 = TST_MATHSRV_u32GET_TIME_STAMP();
+      for (u16LocIdx = 0; u16LocIdx < u16LocBufNb; u16LocIdx++)
+      {
+         TST_MATHSRV_af64MathRefAngle[u16LocIdx] =
+            TST_MATHSRV_f64Atan2Ref(TST_MATHSRV_as16MathSin[u16LocIdx],
+                                    TST_MATHSRV_as16MathCos[u16LocIdx]);
+      }
+      u32LocT1 = TST_MATHSRV_u32GET_TIME_STAMP();
+      for (u16LocIdx = 0; u16LocIdx < u16LocBufNb; u16LocIdx++)
+      {
+         TST_MATHSRV_au16MathOpt[u16LocIdx] =
+            MathArctangente2(TST_MATHSRV_as16MathSin[u16LocIdx],
+                             TST_MATHSRV_as16MathCos[u16LocIdx]);
+      }
+      u32LocT2 = TST_MATHSRV_u32GET_TIME_STAMP();
+      pstrLocRes->u32RefTicks += u32LocT1 - u32LocT0;
+      pstrLocRes->u32OptTicks += u32LocT2 - u32LocT1;
+
+      for (u16LocIdx = 0; u16LocIdx < u16LocBufNb; u16LocIdx++)
+      {
+         /* !Comment : Error taken modulo 2*PI                                */
+         f64LocErr = (float64)TST_MATHSRV_au16MathOpt[u16LocIdx]
+                   - TST_MATHSRV_af64MathRefAngle[u16LocIdx];
+         if (f64LocErr > (TST_MATHSRV_f64ANGLE_2_PI / 2.0))
+         {
+            f64LocErr -= TST_MATHSRV_f64ANGLE_2_PI;
+         }
+         else if (f64LocErr < (-TST_MATHSRV_f64ANGLE_2_PI / 2.0))
+         {
+            f64LocErr += TST_MATHSRV_f64ANGLE_2_PI;
+         }
+         else
+         {
+            /* Nothing to do */
+         }
+         TST_MATHSRV_vidMathErrChk(pstrLocRes, f64LocErr, TST_MATHSRV_f64ATAN2_ERR_MAX);
+      }
+   }
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidSinCosRef                                    */
+/* !Description : Reference sinus and cosinus of an angle (65536 = 2*PI),     */
+/*                scaled to 32767. Taylor series on the quadrant.             */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static void TST_MATHSRV_vidSinCosRef(uint16 u16Angle, float64 *pf64Sin, float64 *pf64Cos)
+{
+   float64 f64LocU;
+   float64 f64LocU2;
+   float64 f64LocSinTerm;
+   float64 f64LocCosTerm;
+   float64 f64LocSin;
+   float64 f64LocCos;
+   uint8   u8LocTerm;
+
+
+   f64LocU  = (float64)(u16Angle & 0x3FFFU) * (TST_MATHSRV_f64PI / 32768.0);
+   f64LocU2 = f64LocU * f64LocU;
+   f64LocSinTerm = f64LocU;
+   f64LocCosTerm = 1.0;
+   f64LocSin     = f64LocSinTerm;
+   f64LocCos     = f64LocCosTerm;
+   for (u8LocTerm = 1U; u8LocTerm <= TST_MATHSRV_u8REF_TERM_NB; u8LocTerm++)
+   {
+      f64LocSinTerm *= -f64LocU2 / ((float64)(2U * u8LocTerm) * (float64)((2U * u8LocTerm) + 1U));
+      f64LocCosTerm *= -f64LocU2 / ((float64)((2U * u8LocTerm) - 1U) * (float64)(2U * u8LocTerm));
+      f64LocSin += f64LocSinTerm;
+      f64LocCos += f64LocCosTerm;
+   }
+
+   switch (u16Angle >> 14)
+   {
+      case 0:
+         *pf64Sin = f64LocSin;
+         *pf64Cos = f64LocCos;
+         break;
+      case 1:
+         *pf64Sin = f64LocCos;
+         *pf64Cos = -f64LocSin;
+         break;
+      case 2:
+         *pf64Sin = -f64LocSin;
+         *pf64Cos = -f64LocCos;
+         break;
+      default:
+         *pf64Sin = -f64LocCos;
+         *pf64Cos = f64LocSin;
+         break;
+   }
+   *pf64Sin *= TST_MATHSRV_f64SIN_ONE;
+   *pf64Cos *= TST_MATHSRV_f64SIN_ONE;
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_f64Atan2Ref                                     */
+/* !Description : Reference angle of (sinus, cosinus) in [0, 65536[ (65536 =  */
+/*                2*PI). Octant reduction, atan(t) = PI/6 + atan((t*sqrt(3)   */
+/*                - 1) / (sqrt(3) + t)) above tan(PI/12), then series.        */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static float64 TST_MATHSRV_f64Atan2Ref(sint16 s16Sin, sint16 s16Cos)
+{
+   float64 f64LocX;
+   float64 f64LocY;
+   float64 f64LocT;
+   float64 f64LocT2;
+   float64 f64LocPow;
+   float64 f64LocAngle;
+   uint8   u8LocTerm;
+
+
+   f64LocX = TST_MATHSRV_f64Abs((float64)s16Cos);
+   f64LocY = TST_MATHSRV_f64Abs((float64)s16Sin);
+   if (f64LocY > f64LocX)
+   {
+      f64LocT = f64LocX / f64LocY;
+   }
+   else
+   {
+      f64LocT = f64LocY / f64LocX;
+   }
+
+   f64LocAngle = 0.0;
+   if (f64LocT > TST_MATHSRV_f64TAN_PI_DIV_12)
+   {
+      f64LocAngle = TST_MATHSRV_f64PI / 6.0;
+      f64LocT = ((f64LocT * TST_MATHSRV_f64SQRT_3) - 1.0) / (TST_MATHSRV_f64SQRT_3 + f64LocT);
+   }
+   f64LocT2  = f64LocT * f64LocT;
+   f64LocPow = f64LocT;
+   f64LocAngle += f64LocT;
+   for (u8LocTerm = 1U; u8LocTerm <= TST_MATHSRV_u8REF_TERM_NB; u8LocTerm++)
+   {
+      f64LocPow   *= -f64LocT2;
+      f64LocAngle += f64LocPow / (float64)((2U * u8LocTerm) + 1U);
+   }
+
+   if (f64LocY > f64LocX)
+   {
+      f64LocAngle = (TST_MATHSRV_f64PI / 2.0) - f64LocAngle;
+   }
+   if (s16Cos < 0)
+   {
+      f64LocAngle = TST_MATHSRV_f64PI - f64LocAngle;
+   }
+   if (s16Sin < 0)
+   {
+      f64LocAngle = (2.0 * TST_MATHSRV_f64PI) - f64LocAngle;
+   }
+   return(f64LocAngle * (TST_MATHSRV_f64ANGLE_2_PI / (2.0 * TST_MATHSRV_f64PI)));
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_f64Abs                                          */
+/* !Description : Absolute value                                              */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static float64 TST_MATHSRV_f64Abs(float64 f64Val)
+{
+   return((f64Val < 0.0) ? -f64Val : f64Val);
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidMathErrChk                                   */
+/* !Description : Count one case, and one mismatch if the error is above the  */
+/*                documented maximum                                          */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static void TST_MATHSRV_vidMathErrChk(TST_MATHSRV_tstrRes *pstrRes,
+                                      float64 f64Err,
+                                      float64 f64ErrMax)
+{
+   pstrRes->u32CaseCnt++;
+   if (TST_MATHSRV_f64Abs(f64Err) > f64ErrMax)
+   {
+      pstrRes->u32MismatchCnt++;
+   }
+}
+
+#define TST_STOP_SEC_TST_CODE
+#include "TST_MemMap.h"
+
+/*------------------------------- end of file --------------------------------*/
@@ -0,0 +1,374 @@
+/******************************************************************************/
+/* !Layer           : TST                                                     */
+/* !Component       : TST_MATHSRV                                             */
+/* !Description     : Test of MATH and MATHSRV optimised services             */
+/*                                                                            */
+/* !File            : TST_MATHSRV_MulDiv.c                                    */
+/* !Description     : 32 bit MulDiv services. The native 64 bit backend is    */
+/*                    compared with the emulated one, service by service, and */
+/*                    both are timed.                                         */
+/*                                                                            */
+/* !Reference       :                                                         */
+/*                                                                            */
+/* Coding language  : C                                                       */
+/*                                                                            */
+/* COPYRIGHT VALEO all rights reserved                                        */
+/******************************************************************************/
+/* Dimension Informations
+ * %PCMS_HEADER_SUBSTITUTION_START:%
+ * The PID has this format: <Product ID>:<Item ID>.<Variant>-<Item Type>;<Revision>
+ * %PID:%
+ * %PCMS_HEADER_SUBSTITUTION_END:%
+ ******************************************************************************/
+
+#include "Std_Types.h"
+#include "Std_Limits.h"
+#include "TST_MATHSRV.h"
+#include "TST_MATHSRV_Cfg.h"
+
+/******************************************************************************/
+/* LOCAL DEFINES                                                              */
+/******************************************************************************/
+
+#define TST_MATHSRV_u8MULDIV_SRV_NB        8U
+#define TST_MATHSRV_u8MULDIV_EXT_NB        12U
+
+/* !Comment : Service signature: bit 2 first factor, bit 1 second factor,     */
+/*            bit 0 denominator signed                                        */
+#define TST_MATHSRV_u8MULDIV_SGN_A         4U
+#define TST_MATHSRV_u8MULDIV_SGN_B         2U
+#define TST_MATHSRV_u8MULDIV_SGN_D         1U
+
+/******************************************************************************/
+/* LOCAL MACROS                                                               */
+/******************************************************************************/
+
+/* !Comment : Timed loops of the emulated then of the native service over     */
+/*            the input buffers                                               */
+#define TST_MATHSRV_vidMULDIV_LOOPS(Srv, TypA, TypB, TypD)                              \
+   u32LocT0 = TST_MATHSRV_u32GET_TIME_STAMP();                                          \
+   for (u16LocIdx = 0; u16LocIdx < TST_MATHSRV_u16BUF_SIZE; u16LocIdx++)                \
+   {                                                                                    \
+      TST_MATHSRV_au32MulDivRef[u16LocIdx] =                                            \
+         (uint32)TST_MATHSRV_##Srv##Emul((TypA)TST_MATHSRV_au32MulDivA[u16LocIdx],      \
+                                         (TypB)TST_MATHSRV_au32MulDivB[u16LocIdx],      \
+                                         (TypD)TST_MATHSRV_au32MulDivD[u16LocIdx]);     \
+   }                                                                                    \
+   u32LocT1 = TST_MATHSRV_u32GET_TIME_STAMP();                                          \
+   for (u16LocIdx = 0; u16LocIdx < TST_MATHSRV_u16BUF_SIZE; u16LocIdx++)                \
+   {                                                                                    \
+      TST_MATHSRV_au32MulDivOpt[u16LocIdx] =                                            \
+         (uint32)TST_MATHSRV_##Srv##Nat((TypA)TST_MATHSRV_au32MulDivA[u16LocIdx],       \
+                                        (TypB)TST_MATHSRV_au32MulDivB[u16LocIdx],       \
+                                        (TypD)TST_MATHSRV_au32MulDivD[u16LocIdx]);      \
+   }                                                                                    \
+   u32LocT2 = TST_MATHSRV_u32GET_TIME_STAMP()
+
+/******************************************************************************/
+/* LOCAL CONSTANTS                                                            */
+/******************************************************************************/
+
+#define TST_START_SEC_TST_CONST
+#include "TST_MemMap.h"
+
+/* !Comment : Signedness of the operands of each service, in the order of     */
+/*            TST_MATHSRV_u8MULDIV_U32_U32_U32..._S32_U32_U32                 */
+static const uint8 TST_MATHSRV_kau8MulDivSgn[TST_MATHSRV_u8MULDIV_SRV_NB] =
+{
+   0U,
+   TST_MATHSRV_u8MULDIV_SGN_D,
+   TST_MATHSRV_u8MULDIV_SGN_B,
+   TST_MATHSRV_u8MULDIV_SGN_B | TST_MATHSRV_u8MULDIV_SGN_D,
+   TST_MATHSRV_u8MULDIV_SGN_A | TST_MATHSRV_u8MULDIV_SGN_B | TST_MATHSRV_u8MULDIV_SGN_D,
+   TST_MATHSRV_u8MULDIV_SGN_A | TST_MATHSRV_u8MULDIV_SGN_B,
+   TST_MATHSRV_u8MULDIV_SGN_B | TST_MATHSRV_u8MULDIV_SGN_D,
+   TST_MATHSRV_u8MULDIV_SGN_B
+};
+
+/* !Comment : Signed and unsigned extremes                                    */
+static const uint32 TST_MATHSRV_kau32MulDivExt[TST_MATHSRV_u8MULDIV_EXT_NB] =
+{
+   0x00000000UL, 0x00000001UL, 0x00000002UL, 0x0000FFFFUL,
+   0x00010000UL, 0x40000000UL, 0x7FFFFFFEUL, 0x7FFFFFFFUL,
+   0x80000000UL, 0x80000001UL, 0xFFFFFFFEUL, 0xFFFFFFFFUL
+};
+
+#define TST_STOP_SEC_TST_CONST
+#include "TST_MemMap.h"
+
+/******************************************************************************/
+/* LOCAL VARIABLES                                                            */
+/******************************************************************************/
+
+#define TST_START_SEC_TST_VAR
+#include "TST_MemMap.h"
+
+static uint32 TST_MATHSRV_au32MulDivA[TST_MATHSRV_u16BUF_SIZE];
+static uint32 TST_MATHSRV_au32MulDivB[TST_MATHSRV_u16BUF_SIZE];
+static uint32 TST_MATHSRV_au32MulDivD[TST_MATHSRV_u16BUF_SIZE];
+static uint32 TST_MATHSRV_au32MulDivRef[TST_MATHSRV_u16BUF_SIZE];
+static uint32 TST_MATHSRV_au32MulDivOpt[TST_MATHSRV_u16BUF_SIZE];
+
+#define TST_STOP_SEC_TST_VAR
+#include "TST_MemMap.h"
+
+/******************************************************************************/
+/* LOCAL FUNCTIONS DECLARATION                                                */
+/******************************************************************************/
+
+#define TST_START_SEC_TST_CODE
+#include "TST_MemMap.h"
+
+static uint32 TST_MATHSRV_u32MulDivOp(void);
+static uint32 TST_MATHSRV_u32MulDivMag(uint32 u32Val, boolean bSgn);
+static void TST_MATHSRV_vidMulDivIn(uint8 u8Sgn);
+static boolean TST_MATHSRV_bMulDivWrap(uint8 u8Srv, uint16 u16Idx);
+
+/******************************************************************************/
+/* GLOBAL FUNCTIONS DEFINITION                                                */
+/******************************************************************************/
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidMulDivTest                                   */
+/* !Description : TST_MATHSRV_u32MULDIV_NB inputs per service, mixing random  */
+/*                values, extremes, small values, powers of two and           */
+/*                denominators at the overflow and rounding boundaries of the */
+/*                product. Any difference is a mismatch, except the           */
+/*                documented one of u32Mul_u32_s32_div_u32/_s32 (emulated 0,  */
+/*                native UINT32_MAX when the rounded quotient is 2^32) which  */
+/*                is counted in TST_MATHSRV_u8MULDIV_WRAP.                    */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+void TST_MATHSRV_vidMulDivTest(void)
+{
+   TST_MATHSRV_tstrRes *pstrLocRes;
+   uint32 u32LocNb;
+   uint32 u32LocT0;
+   uint32 u32LocT1;
+   uint32 u32LocT2;
+   uint16 u16LocIdx;
+   uint8  u8LocSrv;
+
+
+   for (u8LocSrv = 0; u8LocSrv < TST_MATHSRV_u8MULDIV_SRV_NB; u8LocSrv++)
+   {
+      pstrLocRes = &TST_MATHSRV_astrRes[TST_MATHSRV_u8MULDIV_U32_U32_U32 + u8LocSrv];
+      for (u32LocNb = 0; u32LocNb < TST_MATHSRV_u32MULDIV_NB;
+           u32LocNb += TST_MATHSRV_u16BUF_SIZE)
+      {
+         TST_MATHSRV_vidMulDivIn(TST_MATHSRV_kau8MulDivSgn[u8LocSrv]);
+         switch (u8LocSrv)
+         {
+            case 0:
+               TST_MATHSRV_vidMULDIV_LOOPS(u32Mul_u32_u32_div_u32, uint32, uint32, uint32);
+               break;
+            case 1:
+               TST_MATHSRV_vidMULDIV_LOOPS(u32Mul_u32_u32_div_s32, uint32, uint32, sint32);
+               break;
+            case 2:
+               TST_MATHSRV_vidMULDIV_LOOPS(u32Mul_u32_s32_div_u32, uint32, sint32, uint32);
+               break;
+            case 3:
+               TST_MATHSRV_vidMULDIV_LOOPS(u32Mul_u32_s32_div_s32, uint32, sint32, sint32);
+               break;
+            case 4:
+               TST_MATHSRV_vidMULDIV_LOOPS(s32Mul_s32_s32_div_s32, sint32, sint32, sint32);
+               break;
+            case 5:
+               TST_MATHSRV_vidMULDIV_LOOPS(s32Mul_s32_s32_div_u32, sint32, sint32, uint32);
+               break;
+            case 6:
+               TST_MATHSRV_vidMULDIV_LOOPS(s32Mul_u32_s32_div_s32, uint32, sint32, sint32);
+               break;
+            default:
+               TST_MATHSRV_vidMULDIV_LOOPS(s32Mul_u32_s32_div_u32, uint32, sint32, uint32);
+               break;
+         }
+         pstrLocRes->u32RefTicks += u32LocT1 - u32LocT0;
+         pstrLocRes->u32OptTicks += u32LocT2 - u32LocT1;
+
+         for (u16LocIdx = 0; u16LocIdx < TST_MATHSRV_u16BUF_SIZE; u16LocIdx++)
+         {
+            pstrLocRes->u32CaseCnt++;
+            if (TST_MATHSRV_au32MulDivRef[u16LocIdx] != TST_MATHSRV_au32MulDivOpt[u16LocIdx])
+            {
+               if (TST_MATHSRV_bMulDivWrap(u8LocSrv, u16LocIdx) != FALSE)
+               {
+                  TST_MATHSRV_astrRes[TST_MATHSRV_u8MULDIV_WRAP].u32CaseCnt++;
+               }
+               else
+               {
+                  pstrLocRes->u32MismatchCnt++;
+               }
+            }
+         }
+      }
+   }
+}
+
+/******************************************************************************/
+/* LOCAL FUNCTIONS DEFINITION                                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_vidMulDivIn                                     */
+/* !Description : Fill the input buffers. One denominator out of four is put  */
+/*                next to the high word of the product (quotient around 2^32, */
+/*                saturation boundary) or next to product / (2^32 - 1/2)      */
+/*                (rounding boundary).                                        */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static void TST_MATHSRV_vidMulDivIn(uint8 u8Sgn)
+{
+   uint64 u64LocProd;
+   uint32 u32LocRnd;
+   uint32 u32LocD;
+   uint16 u16LocIdx;
+
+
+   for (u16LocIdx = 0; u16LocIdx < TST_MATHSRV_u16BUF_SIZE; u16LocIdx++)
+   {
+      TST_MATHSRV_au32MulDivA[u16LocIdx] = TST_MATHSRV_u32MulDivOp();
+      TST_MATHSRV_au32MulDivB[u16LocIdx] = TST_MATHSRV_u32MulDivOp();
+      u32LocRnd = TST_MATHSRV_u32Rand();
+      if ((u32LocRnd & 3U) == 0U)
+      {
+         u64LocProd =
+            (uint64)TST_MATHSRV_u32MulDivMag(TST_MATHSRV_au32MulDivA[u16LocIdx],
+                                             (boolean)((u8Sgn & TST_MATHSRV_u8MULDIV_SGN_A) != 0U))
+          * (uint64)TST_MATHSRV_u32MulDivMag(TST_MATHSRV_au32MulDivB[u16LocIdx],
+                                             (boolean)((u8Sgn & TST_MATHSRV_u8MULDIV_SGN_B) != 0U));
+         if ((u32LocRnd & 4U) == 0U)
+         {
+            u32LocD = (uint32)(u64LocProd >> 32);
+         }
+         else
+         {
+            u32LocD = (uint32)((u64LocProd * 2U) / 0x1FFFFFFFFULL);
+         }
+         u32LocD += ((u32LocRnd >> 3) % 4U) - 1U;
+         if ((u8Sgn & TST_MATHSRV_u8MULDIV_SGN_D) != 0U)
+         {
+            u32LocD &= 0x7FFFFFFFUL;
+            if ((u32LocRnd & 0x20U) != 0U)
+            {
+               u32LocD = 0U - u32LocD;
+            }
+         }
+         TST_MATHSRV_au32MulDivD[u16LocIdx] = u32LocD;
+      }
+      else
+      {
+         TST_MATHSRV_au32MulDivD[u16LocIdx] = TST_MATHSRV_u32MulDivOp();
+      }
+   }
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_u32MulDivOp                                     */
+/* !Description : Random operand: full range, extreme, small signed value or  */
+/*                power of two - 1/+0/+1                                      */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static uint32 TST_MATHSRV_u32MulDivOp(void)
+{
+   uint32 u32LocRnd;
+   uint32 u32LocOp;
+
+
+   u32LocRnd = TST_MATHSRV_u32Rand();
+   switch (u32LocRnd >> 30)
+   {
+      case 0:
+         u32LocOp = TST_MATHSRV_u32Rand();
+         break;
+      case 1:
+         u32LocOp = TST_MATHSRV_kau32MulDivExt[u32LocRnd % TST_MATHSRV_u8MULDIV_EXT_NB];
+         break;
+      case 2:
+         u32LocOp = (uint32)(sint32)(sint16)u32LocRnd;
+         break;
+      default:
+         u32LocOp = (1UL << (u32LocRnd & 31U)) + ((u32LocRnd >> 5) % 3U) - 1U;
+         break;
+   }
+   return(u32LocOp);
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_u32MulDivMag                                    */
+/* !Description : Magnitude of an operand                                     */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static uint32 TST_MATHSRV_u32MulDivMag(uint32 u32Val, boolean bSgn)
+{
+   uint32 u32LocMag;
+
+
+   u32LocMag = u32Val;
+   if (  (bSgn != FALSE)
+      && ((sint32)u32Val < 0))
+   {
+      u32LocMag = 0U - u32Val;
+   }
+   return(u32LocMag);
+}
+
+/******************************************************************************/
+/* !FuncName    : TST_MATHSRV_bMulDivWrap                                     */
+/* !Description : TRUE if the difference is the documented one: service       */
+/*                u32Mul_u32_s32_div_u32/_s32, positive quotient, rounded     */
+/*                quotient equal to 2^32, emulated 0 and native UINT32_MAX    */
+/* !LastAuthor  : V. Becquet                                                  */
+/******************************************************************************/
+static boolean TST_MATHSRV_bMulDivWrap(uint8 u8Srv, uint16 u16Idx)
+{
+   uint64  u64LocQuot;
+   uint32  u32LocMagB;
+   uint32  u32LocMagD;
+   sint32  s32LocB;
+   sint32  s32LocD;
+   boolean bLocPositive;
+   boolean bLocWrap;
+
+
+   s32LocB = (sint32)TST_MATHSRV_au32MulDivB[u16Idx];
+   s32LocD = (sint32)TST_MATHSRV_au32MulDivD[u16Idx];
+   if (u8Srv == (TST_MATHSRV_u8MULDIV_U32_S32_U32 - TST_MATHSRV_u8MULDIV_U32_U32_U32))
+   {
+      bLocPositive = (boolean)(  (s32LocB > 0)
+                              && (TST_MATHSRV_au32MulDivD[u16Idx] != 0U));
+   }
+   else if (u8Srv == (TST_MATHSRV_u8MULDIV_U32_S32_S32 - TST_MATHSRV_u8MULDIV_U32_U32_U32))
+   {
+      bLocPositive = (boolean)(  ((s32LocB > 0) && (s32LocD > 0))
+                              || ((s32LocB < 0) && (s32LocD < 0)));
+   }
+   else
+   {
+      bLocPositive = FALSE;
+   }
+   bLocWrap = FALSE;
+   if (  (bLocPositive != FALSE)
+      && (TST_MATHSRV_au32MulDivRef[u16Idx] == 0U)
+      && (TST_MATHSRV_au32MulDivOpt[u16Idx] == UINT32_MAX))
+   {
+      u32LocMagB = TST_MATHSRV_u32MulDivMag(TST_MATHSRV_au32MulDivB[u16Idx], TRUE);
+      u32LocMagD = TST_MATHSRV_u32MulDivMag(TST_MATHSRV_au32MulDivD[u16Idx],
+                                            (boolean)(u8Srv == (TST_MATHSRV_u8MULDIV_U32_S32_S32
+                                                                - TST_MATHSRV_u8MULDIV_U32_U32_U32)));
+      u64LocQuot = (((uint64)TST_MATHSRV_au32MulDivA[u16Idx] * u32LocMagB)
+                    + (u32LocMagD / 2U))
+                   / u32LocMagD;
+      if (u64LocQuot == 0x100000000ULL)
+      {
+         bLocWrap = TRUE;
+      }
+   }
+   return(bLocWrap);
+}
+
+#define TST_STOP_SEC_TST_CODE
+#include "TST_MemMap.h"
+
+/*------------------------------- end of file --------------------------------*/
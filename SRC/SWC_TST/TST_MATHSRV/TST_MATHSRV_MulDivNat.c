@@ -0,0 +1,38 @@
+/******************************************************************************/
+/* !Layer           : TST                                                     */
+/* !Component       : TST_MATHSRV                                             */
+/* !Description     : Test of MATH and MATHSRV optimised services             */
+/*                                                                            */
+/* !File            : TST_MATHSRV_MulDivNat.c                                 */
+/* !Description     : MATHSRV_MulDiv_32.c built with the native backend,      */
+/*                    services renamed with the Nat suffix, whatever the      */
+/*                    MATHSRV_coMULDIV_NATIVE_64 setting of the project       */
+/*                                                                            */
+/* !Reference       :                                                         */
+/*                                                                            */
+/* Coding language  : C                                                       */
+/*                                                                            */
+/* COPYRIGHT VALEO all rights reserved                                        */
+/******************************************************************************/
+/* Dimension Informations
+ * %PCMS_HEADER_SUBSTITUTION_START:%
+ * The PID has this format: <Product ID>:<Item ID>.<Variant>-<Item Type>;<Revision>
+ * %PID:%
+ * %PCMS_HEADER_SUBSTITUTION_END:%
+ ******************************************************************************/
+
+#undef  MATHSRV_coMULDIV_NATIVE_64
+#define MATHSRV_coMULDIV_NATIVE_64      STD_ON
+
+#define MATHSRV_u32Mul_u32_u32_div_u32  TST_MATHSRV_u32Mul_u32_u32_div_u32Nat
+#define MATHSRV_u32Mul_u32_u32_div_s32  TST_MATHSRV_u32Mul_u32_u32_div_s32Nat
+#define MATHSRV_u32Mul_u32_s32_div_u32  TST_MATHSRV_u32Mul_u32_s32_div_u32Nat
+#define MATHSRV_u32Mul_u32_s32_div_s32  TST_MATHSRV_u32Mul_u32_s32_div_s32Nat
+#define MATHSRV_s32Mul_s32_s32_div_s32  TST_MATHSRV_s32Mul_s32_s32_div_s32Nat
+#define MATHSRV_s32Mul_s32_s32_div_u32  TST_MATHSRV_s32Mul_s32_s32_div_u32Nat
+#define MATHSRV_s32Mul_u32_s32_div_s32  TST_MATHSRV_s32Mul_u32_s32_div_s32Nat
+#define MATHSRV_s32Mul_u32_s32_div_u32  TST_MATHSRV_s32Mul_u32_s32_div_u32Nat
+
+#include "MATHSRV_MulDiv_32.c"
+
+/*------------------------------- end of file --------------------------------*/
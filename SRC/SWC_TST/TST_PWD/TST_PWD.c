@@ -40,12 +40,6 @@ void TST_PWD_vidInit(void)
 	TST_PWD_u32_M_GEAR_POS_PWM_DUTYCYC = 0;
 	TST_PWD_u32_M_GEAR_POS_CHECK_PWM_FRQ = 0;
 	TST_PWD_u32_M_GEAR_POS_CHECK_PWM_DUTYCYC = 0;
-	TST_PWD_u32_M_TOSS_PWM_FRQ = 0;
-	TST_PWD_u32_M_TOSS_PWM_DUTYCYC = 0;
-	TST_PWD_u32_M_G4_SPD_SNS_PWM_FRQ = 0;
-	TST_PWD_u32_M_G4_SPD_SNS_PWM_DUTYCYC = 0;
-	TST_PWD_u32_M_C4_SPD_SNS_PWM_FRQ = 0;
-	TST_PWD_u32_M_C4_SPD_SNS_PWM_DUTYCYC = 0;
 
 	Shrexp_set_Speed(&(Speed[0]));
 
@@ -80,15 +74,6 @@ void TST_PWD_vidMainFunction(void)
 
 	      TST_PWD_u32_M_GEAR_POS_CHECK_PWM_FRQ		  = 	   IOHWABS_udtREAD_CHANNEL(M_GEAR_POS_CHECK_PWM_FRQ);
 		TST_PWD_u32_M_GEAR_POS_CHECK_PWM_DUTYCYC	   =		IOHWABS_udtREAD_CHANNEL(M_GEAR_POS_CHECK_PWM_DUTYCYC);
-	
-	      TST_PWD_u32_M_TOSS_PWM_FRQ		  = 	   IOHWABS_udtREAD_CHANNEL(M_TOSS_PWM_FRQ);
-		TST_PWD_u32_M_TOSS_PWM_DUTYCYC	   =		IOHWABS_udtREAD_CHANNEL(M_TOSS_PWM_DUTYCYC);
-
-	      TST_PWD_u32_M_G4_SPD_SNS_PWM_FRQ          =        IOHWABS_udtREAD_CHANNEL(M_G4_SPD_SNS_PWM_FRQ);
-            TST_PWD_u32_M_G4_SPD_SNS_PWM_DUTYCYC      =        IOHWABS_udtREAD_CHANNEL(M_G4_SPD_SNS_PWM_DUTYCYC);
-
-	     TST_PWD_u32_M_C4_SPD_SNS_PWM_FRQ 	 =  IOHWABS_udtREAD_CHANNEL(M_C4_SPD_SNS_PWM_FRQ);
-	     TST_PWD_u32_M_C4_SPD_SNS_PWM_DUTYCYC = IOHWABS_udtREAD_CHANNEL(M_C4_SPD_SNS_PWM_DUTYCYC);
 
 	    //ShrExp_Get_Speed(SWTST_kbPwdSpeedTstIdx,&SWTST_kbPwdSpeedTstRPM, &SWTST_kbPwdSpeedTstDir, &bSply, &stDiaRdy, &stDiaDsbc);
 	    //ShrExp_Get_Position(SWTST_kbPwdPositionTstIdx, &SWTST_kbPwdPositionTstDuty, &bSply, &stDiaRdy, &stDiaDsbc);
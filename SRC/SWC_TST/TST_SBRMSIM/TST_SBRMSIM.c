@@ -0,0 +1,476 @@
+/**********************************************************************************************************************/
+/* !Layer           : TST                                                                                             */
+/* !Component       : TST_SBRMSIM                                                                                     */
+/* !Description     : Simulated BR93H66 Microwire EEPROM on the SubRom pins                                           */
+/*                                                                                                                    */
+/* !File            : TST_SBRMSIM.c                                                                                   */
+/* !Description     : Pin level model of the EEPROM: commands are decoded on the SK rising edges like the chip, so    */
+/*                    the frames of the blocking and asynchronous SubRom services are checked bit by bit. The write  */
+/*                    cycle lasts TST_SBRMSIM_u8WrCycleTime calls of TST_SBRMSIM_vidMainFunction (1ms).              */
+/*                    Built with TST_SBRMSIM_coHOST the file provides the main() of a host program.                   */
+/*                                                                                                                    */
+/* !Reference       : BR93H66-W datasheet                                                                             */
+/*                                                                                                                    */
+/* Coding language  : C                                                                                               */
+/*                                                                                                                    */
+/* COPYRIGHT VALEO all rights reserved                                                                                */
+/**********************************************************************************************************************/
+
+#include "Std_Types.h"
+#include "TST_SBRMSIM.h"
+
+#if (TST_SBRMSIM_coHOST == STD_ON)
+#include <stdio.h>
+#include "SubRom.h"
+#include "Gpio_Spi.h"
+#include "RbBaseSw.h"
+#endif
+
+/* model states, CS high */
+#define TST_SBRMSIM_u8STS_WAIT_START    0
+#define TST_SBRMSIM_u8STS_CMD           1
+#define TST_SBRMSIM_u8STS_READ          2
+#define TST_SBRMSIM_u8STS_WR_DATA       3
+#define TST_SBRMSIM_u8STS_WR_READY      4
+#define TST_SBRMSIM_u8STS_IGNORE        5
+
+/* instructions, opcode and address bits 7..6 for opcode 00 */
+#define TST_SBRMSIM_u8OP_EXT            0
+#define TST_SBRMSIM_u8OP_WRITE          1
+#define TST_SBRMSIM_u8OP_READ           2
+#define TST_SBRMSIM_u8EXT_EWDS          0
+#define TST_SBRMSIM_u8EXT_WRAL          1
+#define TST_SBRMSIM_u8EXT_ERAL          2
+#define TST_SBRMSIM_u8EXT_EWEN          3
+
+#define TST_SBRMSIM_u8NB_CMD_BIT        10
+#define TST_SBRMSIM_u8NB_DATA_BIT       16
+#define TST_SBRMSIM_u16BLOCK_LEN        128
+
+/* host program: read window crossing the end of the memory, words of the write test, 1ms steps before a timeout */
+#define TST_SBRMSIM_u8HOST_RD_ADDR      230
+#define TST_SBRMSIM_u8HOST_WR_ADDR      10
+#define TST_SBRMSIM_u8HOST_WR_NB        4
+#define TST_SBRMSIM_u16HOST_MAX_STEP    1000
+
+#define TST_START_SEC_TST_VAR
+#include "TST_MemMap.h"
+
+uint16 TST_SBRMSIM_au16Mem[TST_SBRMSIM_u16NB_WORD];
+uint8 TST_SBRMSIM_u8WrCycleTime = 4;
+
+uint32 TST_SBRMSIM_u32ClkCnt;
+uint16 TST_SBRMSIM_u16MaxClkPerTick;
+uint16 TST_SBRMSIM_u16BusTickCnt;
+uint16 TST_SBRMSIM_u16RdWordCnt;
+uint16 TST_SBRMSIM_u16WrWordCnt;
+uint8 TST_SBRMSIM_u8ProtErrCnt;
+boolean TST_SBRMSIM_bWrEna;
+
+static Dio_LevelType TST_SBRMSIM_sudtCs;
+static Dio_LevelType TST_SBRMSIM_sudtSk;
+static Dio_LevelType TST_SBRMSIM_sudtDi;
+static uint8 TST_SBRMSIM_su8Do;
+static boolean TST_SBRMSIM_sbRdyOut;
+static uint8 TST_SBRMSIM_su8State;
+static uint8 TST_SBRMSIM_su8BitCnt;
+static uint16 TST_SBRMSIM_su16Shift;
+static uint8 TST_SBRMSIM_su8Op;
+static uint8 TST_SBRMSIM_su8Addr;
+static uint8 TST_SBRMSIM_su8BusyTmr;
+static uint16 TST_SBRMSIM_su16TickClkCnt;
+#if (TST_SBRMSIM_coHOST == STD_ON)
+static uint32 TST_SBRMSIM_su32HostErrCnt;
+#endif
+
+#define TST_STOP_SEC_TST_VAR
+#include "TST_MemMap.h"
+
+#define TST_START_SEC_TST_CODE
+#include "TST_MemMap.h"
+
+/**********************************************************************************************************************/
+/* !FuncName    : TST_SBRMSIM_vidCmd                                                                                  */
+/* !Description : Instruction and address received                                                                    */
+/**********************************************************************************************************************/
+static void TST_SBRMSIM_vidCmd(void)
+{
+    TST_SBRMSIM_su8Op = (uint8)(TST_SBRMSIM_su16Shift >> 8);
+    TST_SBRMSIM_su8Addr = (uint8)TST_SBRMSIM_su16Shift;
+    TST_SBRMSIM_su8BitCnt = 0;
+    TST_SBRMSIM_su16Shift = 0;
+
+    if (TST_SBRMSIM_u8OP_READ == TST_SBRMSIM_su8Op)
+    {
+        /* dummy 0 before D15 */
+        TST_SBRMSIM_su8Do = 0;
+        TST_SBRMSIM_su8State = TST_SBRMSIM_u8STS_READ;
+    }
+    else if (TST_SBRMSIM_u8OP_WRITE == TST_SBRMSIM_su8Op)
+    {
+        TST_SBRMSIM_su8State = TST_SBRMSIM_u8STS_WR_DATA;
+    }
+    else
+    {
+        switch (TST_SBRMSIM_su8Addr >> 6)
+        {
+            case TST_SBRMSIM_u8EXT_EWEN:
+                TST_SBRMSIM_bWrEna = TRUE;
+                TST_SBRMSIM_su8State = TST_SBRMSIM_u8STS_IGNORE;
+                break;
+            case TST_SBRMSIM_u8EXT_EWDS:
+                TST_SBRMSIM_bWrEna = FALSE;
+                TST_SBRMSIM_su8State = TST_SBRMSIM_u8STS_IGNORE;
+                break;
+            case TST_SBRMSIM_u8EXT_WRAL:
+                TST_SBRMSIM_su8State = TST_SBRMSIM_u8STS_WR_DATA;
+                break;
+            default:
+                /* ERAL, started by CS low */
+                TST_SBRMSIM_su16Shift = 0xFFFF;
+                TST_SBRMSIM_su8State = TST_SBRMSIM_u8STS_WR_READY;
+                break;
+        }
+    }
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : TST_SBRMSIM_vidSkRise                                                                               */
+/* !Description : SK rising edge with CS high: DI latched, DO updated                                                 */
+/**********************************************************************************************************************/
+static void TST_SBRMSIM_vidSkRise(void)
+{
+    uint8 u8LocDi = (STD_HIGH == TST_SBRMSIM_sudtDi) ? 1 : 0;
+
+    TST_SBRMSIM_u32ClkCnt++;
+    TST_SBRMSIM_su16TickClkCnt++;
+
+    switch (TST_SBRMSIM_su8State)
+    {
+        case TST_SBRMSIM_u8STS_WAIT_START:
+            /* leading 0 are ignored, the first 1 is the start bit */
+            if (1 == u8LocDi)
+            {
+                TST_SBRMSIM_sbRdyOut = FALSE;
+                TST_SBRMSIM_su8BitCnt = 0;
+                TST_SBRMSIM_su16Shift = 0;
+                if (0 != TST_SBRMSIM_su8BusyTmr)
+                {
+                    TST_SBRMSIM_u8ProtErrCnt++;
+                    TST_SBRMSIM_su8State = TST_SBRMSIM_u8STS_IGNORE;
+                }
+                else
+                {
+                    TST_SBRMSIM_su8State = TST_SBRMSIM_u8STS_CMD;
+                }
+            }
+            break;
+
+        case TST_SBRMSIM_u8STS_CMD:
+            TST_SBRMSIM_su16Shift = (uint16)((TST_SBRMSIM_su16Shift << 1) | u8LocDi);
+            TST_SBRMSIM_su8BitCnt++;
+            if (TST_SBRMSIM_u8NB_CMD_BIT == TST_SBRMSIM_su8BitCnt)
+            {
+                TST_SBRMSIM_vidCmd();
+            }
+            break;
+
+        case TST_SBRMSIM_u8STS_READ:
+            /* sequential read, the address rolls over */
+            TST_SBRMSIM_su8Do = (uint8)((TST_SBRMSIM_au16Mem[TST_SBRMSIM_su8Addr] >> (15 - TST_SBRMSIM_su8BitCnt)) & 1);
+            TST_SBRMSIM_su8BitCnt++;
+            if (TST_SBRMSIM_u8NB_DATA_BIT == TST_SBRMSIM_su8BitCnt)
+            {
+                TST_SBRMSIM_su8BitCnt = 0;
+                TST_SBRMSIM_su8Addr++;
+                TST_SBRMSIM_u16RdWordCnt++;
+            }
+            break;
+
+        case TST_SBRMSIM_u8STS_WR_DATA:
+            TST_SBRMSIM_su16Shift = (uint16)((TST_SBRMSIM_su16Shift << 1) | u8LocDi);
+            TST_SBRMSIM_su8BitCnt++;
+            if (TST_SBRMSIM_u8NB_DATA_BIT == TST_SBRMSIM_su8BitCnt)
+            {
+                TST_SBRMSIM_su8State = TST_SBRMSIM_u8STS_WR_READY;
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : TST_SBRMSIM_vidCsFall                                                                               */
+/* !Description : CS low: a complete write, WRAL or ERAL starts the write cycle, an incomplete frame is an error      */
+/**********************************************************************************************************************/
+static void TST_SBRMSIM_vidCsFall(void)
+{
+    uint16 u16LocIdx;
+    uint16 u16LocFirst = 0;
+    uint16 u16LocNb = 1;
+
+    if (TST_SBRMSIM_u8STS_WR_READY == TST_SBRMSIM_su8State)
+    {
+        if (FALSE == TST_SBRMSIM_bWrEna)
+        {
+            TST_SBRMSIM_u8ProtErrCnt++;
+        }
+        else
+        {
+            if (TST_SBRMSIM_u8OP_WRITE == TST_SBRMSIM_su8Op)
+            {
+                u16LocFirst = TST_SBRMSIM_su8Addr;
+            }
+            else if (TST_SBRMSIM_u8EXT_WRAL == (TST_SBRMSIM_su8Addr >> 6))
+            {
+                u16LocFirst = (uint16)((TST_SBRMSIM_su8Addr & 1) * TST_SBRMSIM_u16BLOCK_LEN);
+                u16LocNb = TST_SBRMSIM_u16BLOCK_LEN;
+            }
+            else
+            {
+                u16LocNb = TST_SBRMSIM_u16NB_WORD;
+            }
+            for (u16LocIdx = u16LocFirst; u16LocIdx < (u16LocFirst + u16LocNb); u16LocIdx++)
+            {
+                TST_SBRMSIM_au16Mem[u16LocIdx] = TST_SBRMSIM_su16Shift;
+            }
+            TST_SBRMSIM_u16WrWordCnt++;
+            TST_SBRMSIM_su8BusyTmr = TST_SBRMSIM_u8WrCycleTime;
+        }
+    }
+    else if ((TST_SBRMSIM_u8STS_CMD == TST_SBRMSIM_su8State) || (TST_SBRMSIM_u8STS_WR_DATA == TST_SBRMSIM_su8State))
+    {
+        TST_SBRMSIM_u8ProtErrCnt++;
+    }
+    else
+    {
+    }
+    TST_SBRMSIM_su8State = TST_SBRMSIM_u8STS_WAIT_START;
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : TST_SBRMSIM_vidInit                                                                                 */
+/* !Description : Power on reset of the model, the memory content is kept                                             */
+/**********************************************************************************************************************/
+void TST_SBRMSIM_vidInit(void)
+{
+    TST_SBRMSIM_su8State = TST_SBRMSIM_u8STS_WAIT_START;
+    TST_SBRMSIM_su8BusyTmr = 0;
+    TST_SBRMSIM_sbRdyOut = FALSE;
+    TST_SBRMSIM_bWrEna = FALSE;
+    TST_SBRMSIM_u32ClkCnt = 0;
+    TST_SBRMSIM_u16MaxClkPerTick = 0;
+    TST_SBRMSIM_u16BusTickCnt = 0;
+    TST_SBRMSIM_u16RdWordCnt = 0;
+    TST_SBRMSIM_u16WrWordCnt = 0;
+    TST_SBRMSIM_u8ProtErrCnt = 0;
+    TST_SBRMSIM_su16TickClkCnt = 0;
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : TST_SBRMSIM_vidMainFunction                                                                         */
+/* !Description : 1ms step: write cycle time and bus load of the last tick                                            */
+/**********************************************************************************************************************/
+void TST_SBRMSIM_vidMainFunction(void)
+{
+    if (0 != TST_SBRMSIM_su8BusyTmr)
+    {
+        TST_SBRMSIM_su8BusyTmr--;
+    }
+    if (0 != TST_SBRMSIM_su16TickClkCnt)
+    {
+        TST_SBRMSIM_u16BusTickCnt++;
+        if (TST_SBRMSIM_su16TickClkCnt > TST_SBRMSIM_u16MaxClkPerTick)
+        {
+            TST_SBRMSIM_u16MaxClkPerTick = TST_SBRMSIM_su16TickClkCnt;
+        }
+        TST_SBRMSIM_su16TickClkCnt = 0;
+    }
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : TST_SBRMSIM_vidWriteChannel                                                                         */
+/* !Description : Same as Dio_WriteChannel for the SubRom CS, SK and DI pins                                          */
+/**********************************************************************************************************************/
+void TST_SBRMSIM_vidWriteChannel(Dio_ChannelType udtChannelId, Dio_LevelType udtLevel)
+{
+    if (DioConf_DioChannel_M_SUBROM_CS == udtChannelId)
+    {
+        if ((STD_LOW == TST_SBRMSIM_sudtCs) && (STD_HIGH == udtLevel))
+        {
+            /* R/B is shown until the next start bit */
+            TST_SBRMSIM_sbRdyOut = TRUE;
+            TST_SBRMSIM_su8State = TST_SBRMSIM_u8STS_WAIT_START;
+        }
+        else if ((STD_HIGH == TST_SBRMSIM_sudtCs) && (STD_LOW == udtLevel))
+        {
+            TST_SBRMSIM_vidCsFall();
+        }
+        else
+        {
+        }
+        TST_SBRMSIM_sudtCs = udtLevel;
+    }
+    else if (DioConf_DioChannel_M_SUBROM_CLK == udtChannelId)
+    {
+        if ((STD_LOW == TST_SBRMSIM_sudtSk) && (STD_HIGH == udtLevel) && (STD_HIGH == TST_SBRMSIM_sudtCs))
+        {
+            TST_SBRMSIM_vidSkRise();
+        }
+        TST_SBRMSIM_sudtSk = udtLevel;
+    }
+    else if (DioConf_DioChannel_M_SUBROM_W == udtChannelId)
+    {
+        TST_SBRMSIM_sudtDi = udtLevel;
+    }
+    else
+    {
+    }
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : TST_SBRMSIM_udtReadChannel                                                                          */
+/* !Description : Same as Dio_ReadChannel for the SubRom DO pin, inverted like the board (see Read_MISO)              */
+/**********************************************************************************************************************/
+Dio_LevelType TST_SBRMSIM_udtReadChannel(Dio_ChannelType udtChannelId)
+{
+    uint8 u8LocDo = 1;
+
+    if ((DioConf_DioChannel_M_SUBROM_R == udtChannelId) && (STD_HIGH == TST_SBRMSIM_sudtCs))
+    {
+        if (FALSE != TST_SBRMSIM_sbRdyOut)
+        {
+            u8LocDo = (0 != TST_SBRMSIM_su8BusyTmr) ? 0 : 1;
+        }
+        else
+        {
+            u8LocDo = TST_SBRMSIM_su8Do;
+        }
+    }
+    return (1 == u8LocDo) ? STD_LOW : STD_HIGH;
+}
+
+#if (TST_SBRMSIM_coHOST == STD_ON)
+/**********************************************************************************************************************/
+/* !FuncName    : TST_SBRMSIM_vidHostChk                                                                              */
+/* !Description : Host program: one check, printed when it fails                                                      */
+/**********************************************************************************************************************/
+static void TST_SBRMSIM_vidHostChk(const char *pcLocName, uint32 u32LocVal, uint32 u32LocExp)
+{
+    if (u32LocVal != u32LocExp)
+    {
+        TST_SBRMSIM_su32HostErrCnt++;
+        (void)printf("%-24s 0x%04lx, expected 0x%04lx\n", pcLocName, (unsigned long)u32LocVal,
+                     (unsigned long)u32LocExp);
+    }
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : TST_SBRMSIM_u16HostRun                                                                              */
+/* !Description : Host program: 1ms steps of the driver and of the model until the transfer is not BUSY               */
+/**********************************************************************************************************************/
+static uint16 TST_SBRMSIM_u16HostRun(void)
+{
+    uint16 u16LocStep = 0;
+
+    while ((BUSY == SpiGetOpeStatus()) && (u16LocStep < TST_SBRMSIM_u16HOST_MAX_STEP))
+    {
+        SubRom_MainFunction();
+        TST_SBRMSIM_vidMainFunction();
+        u16LocStep++;
+    }
+    return u16LocStep;
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : main                                                                                                */
+/* !Description : Host program: RbBaseSw read sequence, BUSY and error statuses, asynchronous write, returns 0 when   */
+/*                every check passes                                                                                  */
+/**********************************************************************************************************************/
+int main(void)
+{
+    uint16 u16LocIdx;
+    uint16 u16LocRdStep;
+    uint16 u16LocWrStep;
+    uint8 u8LocSts;
+    uint16 au16LocBuf[MAX_READ_BYTE];
+    static const uint16 au16LocWr[TST_SBRMSIM_u8HOST_WR_NB] = {0x0000, 0xFFFF, 0xA55A, 0x1234};
+
+    for (u16LocIdx = 0; u16LocIdx < TST_SBRMSIM_u16NB_WORD; u16LocIdx++)
+    {
+        TST_SBRMSIM_au16Mem[u16LocIdx] = (uint16)((u16LocIdx * 0x0101U) ^ 0x5A3CU);
+    }
+    TST_SBRMSIM_vidInit();
+    SubRom_Init();
+    ShrExp_SubRom_Init();
+
+    /* read request, then the buffer and a second request while the transfer runs */
+    u8LocSts = IDLE;
+    ShrExp_Read_SbrmData(&u8LocSts, TST_SBRMSIM_u8HOST_RD_ADDR, MAX_READ_BYTE);
+    TST_SBRMSIM_vidHostChk("read request", u8LocSts, ACCEPTED);
+    ShrExp_Get_SbrmIntBuffer(&u8LocSts, au16LocBuf, MAX_READ_BYTE);
+    TST_SBRMSIM_vidHostChk("buffer while busy", u8LocSts, BUSY);
+    ShrExp_Read_SbrmData(&u8LocSts, 0, MIN_READ_BYTE);
+    TST_SBRMSIM_vidHostChk("request while busy", u8LocSts, BUSY);
+    u16LocRdStep = TST_SBRMSIM_u16HostRun();
+    TST_SBRMSIM_vidHostChk("read end", SpiGetOpeStatus(), DONE);
+
+    /* u8LocSts still holds BUSY from the calls above, it shall not block the buffer */
+    ShrExp_Get_SbrmIntBuffer(&u8LocSts, au16LocBuf, MAX_READ_BYTE);
+    TST_SBRMSIM_vidHostChk("buffer after busy", u8LocSts, IDLE);
+    for (u16LocIdx = 0; u16LocIdx < MAX_READ_BYTE; u16LocIdx++)
+    {
+        TST_SBRMSIM_vidHostChk("read data", au16LocBuf[u16LocIdx],
+                               TST_SBRMSIM_au16Mem[(TST_SBRMSIM_u8HOST_RD_ADDR + u16LocIdx) % TST_SBRMSIM_u16NB_WORD]);
+    }
+
+    /* nor a new request */
+    u8LocSts = BUSY;
+    ShrExp_Read_SbrmData(&u8LocSts, 0, MIN_READ_BYTE);
+    TST_SBRMSIM_vidHostChk("request after busy", u8LocSts, ACCEPTED);
+    (void)TST_SBRMSIM_u16HostRun();
+    ShrExp_Get_SbrmIntBuffer(&u8LocSts, au16LocBuf, MIN_READ_BYTE);
+    TST_SBRMSIM_vidHostChk("buffer of one word", u8LocSts, IDLE);
+    TST_SBRMSIM_vidHostChk("read one word", au16LocBuf[0], TST_SBRMSIM_au16Mem[0]);
+
+    /* parameter errors, nothing is started */
+    ShrExp_Read_SbrmData(&u8LocSts, 0, MAX_READ_BYTE + 1);
+    TST_SBRMSIM_vidHostChk("request too long", u8LocSts, TOOLONG);
+    ShrExp_Read_SbrmData(&u8LocSts, 0, MIN_READ_BYTE - 1);
+    TST_SBRMSIM_vidHostChk("request too short", u8LocSts, TOOSHORT);
+    ShrExp_Read_SbrmData(&u8LocSts, MAX_READ_ADDR + 1, MIN_READ_BYTE);
+    TST_SBRMSIM_vidHostChk("request address", u8LocSts, INVALID);
+    ShrExp_Get_SbrmIntBuffer(&u8LocSts, au16LocBuf, MAX_READ_BYTE + 1);
+    TST_SBRMSIM_vidHostChk("buffer too long", u8LocSts, TOOLONG);
+    ShrExp_Get_SbrmIntBuffer(&u8LocSts, au16LocBuf, MIN_READ_BYTE - 1);
+    TST_SBRMSIM_vidHostChk("buffer too short", u8LocSts, TOOSHORT);
+    TST_SBRMSIM_vidHostChk("status after errors", SpiGetOpeStatus(), DONE);
+
+    /* asynchronous write, one write cycle per word */
+    TST_SBRMSIM_vidHostChk("write request",
+                           GpioSpiAsyncBurstWrite(TST_SBRMSIM_u8HOST_WR_ADDR, au16LocWr, TST_SBRMSIM_u8HOST_WR_NB, 0),
+                           ACCEPTED);
+    u16LocWrStep = TST_SBRMSIM_u16HostRun();
+    TST_SBRMSIM_vidHostChk("write end", SpiGetOpeStatus(), DONE);
+    for (u16LocIdx = 0; u16LocIdx < TST_SBRMSIM_u8HOST_WR_NB; u16LocIdx++)
+    {
+        TST_SBRMSIM_vidHostChk("write data", TST_SBRMSIM_au16Mem[TST_SBRMSIM_u8HOST_WR_ADDR + u16LocIdx],
+                               au16LocWr[u16LocIdx]);
+    }
+    TST_SBRMSIM_vidHostChk("write disabled", TST_SBRMSIM_bWrEna, FALSE);
+    TST_SBRMSIM_vidHostChk("protocol errors", TST_SBRMSIM_u8ProtErrCnt, 0);
+
+    (void)printf("read %u words: %u ms, write %u words: %u ms, max %u clocks per ms, %lu failed checks\n",
+                 (unsigned int)MAX_READ_BYTE, (unsigned int)u16LocRdStep, (unsigned int)TST_SBRMSIM_u8HOST_WR_NB,
+                 (unsigned int)u16LocWrStep, (unsigned int)TST_SBRMSIM_u16MaxClkPerTick,
+                 (unsigned long)TST_SBRMSIM_su32HostErrCnt);
+    return ((0 == TST_SBRMSIM_su32HostErrCnt) ? 0 : 1);
+}
+#endif
+
+#define TST_STOP_SEC_TST_CODE
+#include "TST_MemMap.h"
+
+/*----------------------------------------------------endoffile---------------------------------------------------*/
@@ -0,0 +1,72 @@
+/**********************************************************************************************************************/
+/* !Layer           : TST                                                                                             */
+/* !Component       : TST_SBRMSIM                                                                                     */
+/* !Description     : Simulated BR93H66 Microwire EEPROM on the SubRom pins                                           */
+/*                                                                                                                    */
+/* !File            : TST_SBRMSIM.h                                                                                   */
+/* !Description     : TST_SBRMSIM APIs and Dio redirection                                                            */
+/*                                                                                                                    */
+/* !Reference       :                                                                                                 */
+/*                                                                                                                    */
+/* Coding language  : C                                                                                               */
+/*                                                                                                                    */
+/* COPYRIGHT VALEO all rights reserved                                                                                */
+/**********************************************************************************************************************/
+
+#ifndef TST_SBRMSIM_H
+#define TST_SBRMSIM_H
+
+#include "Std_Types.h"
+#include "Dio.h"
+
+/* Build level switch, set to 1 in the compiler options of a test build only: the SubRom pins are routed to the       */
+/* EEPROM model, no chip is needed. Without it SubRom.c and MAIN do not include this header.                          */
+#ifndef TST_SBRMSIM_bENA
+#define TST_SBRMSIM_bENA                0
+#endif
+
+/* Host program switch, set to STD_ON with TST_SBRMSIM_bENA 1 from the host compiler command line only: TST_SBRMSIM.c */
+/* then provides a main() driving RbBaseSw, Gpio_Spi and SubRom on the model, it returns 0 when every check passes.   */
+#ifndef TST_SBRMSIM_coHOST
+#define TST_SBRMSIM_coHOST              STD_OFF
+#endif
+
+#define TST_SBRMSIM_u16NB_WORD          256
+
+#if TST_SBRMSIM_bENA == 1
+#define Dio_WriteChannel(ChannelId, Level)           TST_SBRMSIM_vidWriteChannel((ChannelId), (Level))
+#define Dio_ReadChannel(ChannelId)                   TST_SBRMSIM_udtReadChannel(ChannelId)
+#endif
+
+#define TST_START_SEC_TST_VAR
+#include "TST_MemMap.h"
+
+/* script */
+extern uint16 TST_SBRMSIM_au16Mem[TST_SBRMSIM_u16NB_WORD];
+extern uint8 TST_SBRMSIM_u8WrCycleTime;
+/* observation */
+extern uint32 TST_SBRMSIM_u32ClkCnt;
+extern uint16 TST_SBRMSIM_u16MaxClkPerTick;
+extern uint16 TST_SBRMSIM_u16BusTickCnt;
+extern uint16 TST_SBRMSIM_u16RdWordCnt;
+extern uint16 TST_SBRMSIM_u16WrWordCnt;
+extern uint8 TST_SBRMSIM_u8ProtErrCnt;
+extern boolean TST_SBRMSIM_bWrEna;
+
+#define TST_STOP_SEC_TST_VAR
+#include "TST_MemMap.h"
+
+#define TST_START_SEC_TST_CODE
+#include "TST_MemMap.h"
+
+extern void TST_SBRMSIM_vidInit(void);
+extern void TST_SBRMSIM_vidMainFunction(void);
+extern void TST_SBRMSIM_vidWriteChannel(Dio_ChannelType udtChannelId, Dio_LevelType udtLevel);
+extern Dio_LevelType TST_SBRMSIM_udtReadChannel(Dio_ChannelType udtChannelId);
+
+#define TST_STOP_SEC_TST_CODE
+#include "TST_MemMap.h"
+
+#endif /* TST_SBRMSIM_H */
+
+/*----------------------------------------------------endoffile---------------------------------------------------*/
@@ -0,0 +1,501 @@
+/**********************************************************************************************************************/
+/* !Layer           : TST                                                                                             */
+/* !Component       : TST_SPISIM                                                                                      */
+/* !Description     : Simulated Spi driver with TLE8242 and TLF35584 models                                           */
+/*                                                                                                                    */
+/* !File            : TST_SPISIM.c                                                                                    */
+/* !Description     : Spi IB services on top of behavioural device models, to run the TLE8242 and TLF35584 CDDs       */
+/*                    without the chips. A transmitted sequence completes in TST_SPISIM_vidMainFunction after         */
+/*                    TST_SPISIM_u8SeqLatency calls, like the driver the rx data is only read back with ReadIB.       */
+/*                                                                                                                    */
+/* !Reference       :                                                                                                 */
+/*                                                                                                                    */
+/* Coding language  : C                                                                                               */
+/*                                                                                                                    */
+/* COPYRIGHT VALEO all rights reserved                                                                                */
+/**********************************************************************************************************************/
+
+#include "Std_Types.h"
+#include "TST_SPISIM.h"
+#include "TLE8242_cfg.h"
+#include "TLF35584.h"
+#include <string.h>
+
+#define TST_SPISIM_u8NB_CH              4
+#define TST_SPISIM_u8MAX_FRM            TLE8242_u8MAX_FRM_CTRL_CH_1
+
+/* TLE8242 */
+#define TST_SPISIM_u8TLE_NB_REG         96
+#define TST_SPISIM_u8TLE_GEN_FLG_ID     0x78
+#define TST_SPISIM_u8TLE_DIAG_03_ID     4
+#define TST_SPISIM_u8TLE_DIAG_47_ID     5
+#define TST_SPISIM_u8TLE_CRNT_DITHER_ID 24
+#define TST_SPISIM_u8TLE_DITHER_PERD_ID 32
+#define TST_SPISIM_u8TLE_MAX_MIN_ID     40
+#define TST_SPISIM_u8TLE_AVG_ID         48
+#define TST_SPISIM_u16TLE_SETPOINT_MAX  2047
+#define TST_SPISIM_u32TLE_AVG_MAX       0xFFFFF
+
+/* TLF35584 */
+#define TST_SPISIM_u8TLF_PROTCFG        0x03
+#define TST_SPISIM_u8TLF_WDCFG          0x06
+#define TST_SPISIM_u8TLF_PROT_FIRST     0x04
+#define TST_SPISIM_u8TLF_PROT_LAST      0x0E
+#define TST_SPISIM_u8TLF_DEVCTRL        0x15
+#define TST_SPISIM_u8TLF_DEVCTRLN       0x16
+
+#define TST_START_SEC_TST_VAR
+#include "TST_MemMap.h"
+
+uint8 TST_SPISIM_au8FltReq[TST_SPISIM_u8NB_TLE8242_CH] = {0};
+uint16 TST_SPISIM_au16FltDly[TST_SPISIM_u8NB_TLE8242_CH] = {0};
+uint8 TST_SPISIM_u8SeqLatency = 0;
+uint8 TST_SPISIM_u8CrntLagShift = 2;
+uint8 TST_SPISIM_u8AvgVldDly = 2;
+uint8 TST_SPISIM_u8TlfCorruptNb = 0;
+uint16 TST_SPISIM_u16TlfWdTmo = 40;
+
+uint8 TST_SPISIM_au8FltAct[TST_SPISIM_u8NB_TLE8242_CH];
+uint16 TST_SPISIM_au16CrntSetPoint[TST_SPISIM_u8NB_TLE8242_CH];
+uint16 TST_SPISIM_au16SeqCnt[SPI_MAXIMUM_SEQUENCE];
+uint8 TST_SPISIM_u8TlfDevSts = TST_SPISIM_u8TLF_STS_INIT;
+boolean TST_SPISIM_bTlfWdDis;
+uint8 TST_SPISIM_u8TlfProtErrCnt;
+uint8 TST_SPISIM_u8TlfWdRstCnt;
+
+static uint32 TST_SPISIM_sau32TxBuf[TST_SPISIM_u8NB_CH][TST_SPISIM_u8MAX_FRM];
+static uint32 TST_SPISIM_sau32RxBuf[TST_SPISIM_u8NB_CH][TST_SPISIM_u8MAX_FRM];
+static uint8 TST_SPISIM_sau8SeqPend[SPI_MAXIMUM_SEQUENCE];
+
+/* TLE8242 register file, indexed by the 7 bit message id, and the load model in set point units Q8 */
+static uint32 TST_SPISIM_sau32TleReg[TST_SPISIM_u8TLE_NB_REG];
+static uint32 TST_SPISIM_su32TleRspPend;
+static sint32 TST_SPISIM_sas32TleCrntQ8[TST_SPISIM_u8NB_TLE8242_CH];
+static uint16 TST_SPISIM_sau16TleSetPointOld[TST_SPISIM_u8NB_TLE8242_CH];
+static uint8 TST_SPISIM_sau8TleVldCnt[TST_SPISIM_u8NB_TLE8242_CH];
+static uint16 TST_SPISIM_sau16FltDlyCnt[TST_SPISIM_u8NB_TLE8242_CH];
+
+/* TLF35584 */
+static uint8 TST_SPISIM_su8TlfUnlockIdx;
+static uint8 TST_SPISIM_su8TlfLockIdx;
+static boolean TST_SPISIM_sbTlfUnlocked;
+static uint8 TST_SPISIM_su8TlfDevCtrl;
+static uint16 TST_SPISIM_su16TlfWdTmr;
+
+#define TST_STOP_SEC_TST_VAR
+#include "TST_MemMap.h"
+
+#define TST_START_SEC_TST_CALIB
+#include "TST_MemMap.h"
+
+/* IB size in bytes, indexed by Spi channel */
+static const uint8 TST_SPISIM_kau8ChSize[TST_SPISIM_u8NB_CH] =
+{
+    TLE8242_u8MAX_FRM_INIT_CH_1 * 4,
+    TLE8242_u8MAX_FRM_CTRL_CH_1 * 4,
+    TLE8242_u8MAX_FRM_DIAG_CH_1 * 4,
+    2
+};
+/* channel of each sequence, indexed by Spi sequence */
+static const Spi_ChannelType TST_SPISIM_kaudtSeqCh[SPI_MAXIMUM_SEQUENCE] =
+{
+    SpiConf_SpiChannel_TLF35584_CH,
+    SpiConf_SpiChannel_TLE8242_1_INIT_CH,
+    SpiConf_SpiChannel_TLE8242_1_CTRL_CH,
+    SpiConf_SpiChannel_TLE8242_1_DIAG_CH
+};
+static const uint8 TST_SPISIM_kau8TlfUnlock[4] = {0xAB, 0xEF, 0x56, 0x12};
+static const uint8 TST_SPISIM_kau8TlfLock[4] = {0xDF, 0x34, 0xBE, 0xCA};
+
+#define TST_STOP_SEC_TST_CALIB
+#include "TST_MemMap.h"
+
+#define TST_START_SEC_TST_CODE
+#include "TST_MemMap.h"
+
+/**********************************************************************************************************************/
+/* !FuncName    : TST_SPISIM_u32TleDiagWord                                                                           */
+/* !Description : Diagnosis read word of 4 channels, 6 bits per channel, the tests are always reported complete       */
+/**********************************************************************************************************************/
+static uint32 TST_SPISIM_u32TleDiagWord(uint8 u8LocFirstCh)
+{
+    uint8 u8LocIdx, u8LocFlt;
+    uint32 u32LocFld, u32LocWord = 0;
+
+    for (u8LocIdx = 0; u8LocIdx < 4; u8LocIdx++)
+    {
+        u8LocFlt = TST_SPISIM_au8FltAct[u8LocFirstCh + u8LocIdx];
+        u32LocFld = (1 << TLE8242_u8_FLT_OFF_TST_BIT) | (1 << TLE8242_u8_FLT_SCS_TST_BIT);
+        if (0 != (u8LocFlt & TST_SPISIM_u8FLT_OPEN))
+        {
+            u32LocFld |= (1 << TLE8242_u8_FLT_OL_OFF_BIT);
+        }
+        if (0 != (u8LocFlt & TST_SPISIM_u8FLT_SC_GND))
+        {
+            u32LocFld |= (1 << TLE8242_u8_FLT_SC_BIT);
+        }
+        if (0 != (u8LocFlt & TST_SPISIM_u8FLT_SC_BATT))
+        {
+            u32LocFld |= (1 << TLE8242_u8_FLT_SCS_BIT);
+        }
+        u32LocWord |= u32LocFld << ((3 - u8LocIdx) * TLE8242_u8_FLT_NB_BIT);
+    }
+    return u32LocWord;
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : TST_SPISIM_u32TleRead                                                                               */
+/* !Description : Content of one TLE8242 register, the current reads come from the load model                         */
+/**********************************************************************************************************************/
+static uint32 TST_SPISIM_u32TleRead(uint8 u8LocMsgId)
+{
+    uint8 u8LocCh;
+    uint32 u32LocCrntDither, u32LocSteps, u32LocCrnt, u32LocAmpl, u32LocMax, u32LocMin, u32LocData, u32LocVld;
+
+    u8LocCh = u8LocMsgId & 0x07;
+    u32LocCrntDither = TST_SPISIM_sau32TleReg[TST_SPISIM_u8TLE_CRNT_DITHER_ID + u8LocCh];
+    u32LocSteps = TST_SPISIM_sau32TleReg[TST_SPISIM_u8TLE_DITHER_PERD_ID + u8LocCh] & 0x1F;
+    u32LocCrnt = (uint32)(TST_SPISIM_sas32TleCrntQ8[u8LocCh] >> 8);
+    u32LocVld = (TST_SPISIM_sau8TleVldCnt[u8LocCh] >= TST_SPISIM_u8AvgVldDly) ? 1 : 0;
+
+    if ((TST_SPISIM_u8TLE_DIAG_03_ID == u8LocMsgId) || (TST_SPISIM_u8TLE_DIAG_47_ID == u8LocMsgId))
+    {
+        u32LocData = TST_SPISIM_u32TleDiagWord((uint8)((u8LocMsgId - TST_SPISIM_u8TLE_DIAG_03_ID) * 4));
+    }
+    else if ((u8LocMsgId & 0x78) == TST_SPISIM_u8TLE_MAX_MIN_ID)
+    {
+        /* triangle dither: peak = step size * steps / 4 in set point units */
+        u32LocAmpl = 0;
+        if (0 != (u32LocCrntDither & (1 << 23)))
+        {
+            u32LocAmpl = (((u32LocCrntDither >> 11) & 0x7FF) * u32LocSteps) >> 2;
+        }
+        u32LocMax = u32LocCrnt + u32LocAmpl;
+        u32LocMax = (u32LocMax > TST_SPISIM_u16TLE_SETPOINT_MAX) ? TST_SPISIM_u16TLE_SETPOINT_MAX : u32LocMax;
+        u32LocMin = (u32LocCrnt > u32LocAmpl) ? (u32LocCrnt - u32LocAmpl) : 0;
+        u32LocData = u32LocMin | (u32LocMax << 11) | (u32LocVld << 22);
+    }
+    else if ((u8LocMsgId & 0x78) == TST_SPISIM_u8TLE_AVG_ID)
+    {
+        /* sum over the dither period as read by TLE8242_u16GetCrntFb in current mode */
+        u32LocData = (0 != (u32LocCrntDither & (1 << 23))) ? (u32LocCrnt * 16 * u32LocSteps) : (u32LocCrnt * 4);
+        u32LocData = (u32LocData > TST_SPISIM_u32TLE_AVG_MAX) ? TST_SPISIM_u32TLE_AVG_MAX : u32LocData;
+        u32LocData |= (u32LocVld << 20);
+    }
+    else
+    {
+        u32LocData = TST_SPISIM_sau32TleReg[u8LocMsgId] & 0x00FFFFFF;
+    }
+    return (((uint32)u8LocMsgId << 24) | u32LocData);
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : TST_SPISIM_vidTleSeq                                                                                */
+/* !Description : Clock one TLE8242 sequence: a write is applied at once, the answer to frame n is sent in frame n+1  */
+/**********************************************************************************************************************/
+static void TST_SPISIM_vidTleSeq(uint8 u8LocCh)
+{
+    uint8 u8LocIdx, u8LocMsgId;
+    uint32 u32LocFrm;
+
+    for (u8LocIdx = 0; u8LocIdx < (TST_SPISIM_kau8ChSize[u8LocCh] / 4); u8LocIdx++)
+    {
+        u32LocFrm = TST_SPISIM_sau32TxBuf[u8LocCh][u8LocIdx];
+        u8LocMsgId = (uint8)((u32LocFrm >> 24) & 0x7F);
+
+        TST_SPISIM_sau32RxBuf[u8LocCh][u8LocIdx] = TST_SPISIM_su32TleRspPend;
+        if (TST_SPISIM_u8TLE_GEN_FLG_ID == u8LocMsgId)
+        {
+            TST_SPISIM_su32TleRspPend = (uint32)TST_SPISIM_u8TLE_GEN_FLG_ID << 24;
+        }
+        else if (u8LocMsgId < TST_SPISIM_u8TLE_NB_REG)
+        {
+            /* IC version, diagnosis and current reads are read only */
+            if ((0 != (u32LocFrm >> 31)) && (0 != u8LocMsgId)
+                && (TST_SPISIM_u8TLE_DIAG_03_ID != u8LocMsgId) && (TST_SPISIM_u8TLE_DIAG_47_ID != u8LocMsgId)
+                && ((u8LocMsgId & 0x78) != TST_SPISIM_u8TLE_MAX_MIN_ID) && ((u8LocMsgId & 0x78) != TST_SPISIM_u8TLE_AVG_ID))
+            {
+                TST_SPISIM_sau32TleReg[u8LocMsgId] = u32LocFrm & 0x7FFFFFFF;
+            }
+            TST_SPISIM_su32TleRspPend = TST_SPISIM_u32TleRead(u8LocMsgId);
+        }
+        else
+        {
+            TST_SPISIM_su32TleRspPend = 0;
+        }
+    }
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : TST_SPISIM_vidTleStep                                                                               */
+/* !Description : One 5ms step of the scripted faults and of the first order load, a short switches the output off    */
+/*                (to gnd / open) or to full scale (to battery)                                                       */
+/**********************************************************************************************************************/
+static void TST_SPISIM_vidTleStep(void)
+{
+    uint8 u8LocCh;
+    uint16 u16LocSetPoint;
+    sint32 s32LocTar;
+
+    for (u8LocCh = 0; u8LocCh < TST_SPISIM_u8NB_TLE8242_CH; u8LocCh++)
+    {
+        if (TST_SPISIM_au8FltReq[u8LocCh] != TST_SPISIM_au8FltAct[u8LocCh])
+        {
+            if (TST_SPISIM_sau16FltDlyCnt[u8LocCh] >= TST_SPISIM_au16FltDly[u8LocCh])
+            {
+                TST_SPISIM_au8FltAct[u8LocCh] = TST_SPISIM_au8FltReq[u8LocCh];
+                TST_SPISIM_sau16FltDlyCnt[u8LocCh] = 0;
+            }
+            else
+            {
+                TST_SPISIM_sau16FltDlyCnt[u8LocCh]++;
+            }
+        }
+
+        u16LocSetPoint = (uint16)(TST_SPISIM_sau32TleReg[TST_SPISIM_u8TLE_CRNT_DITHER_ID + u8LocCh] & 0x7FF);
+        TST_SPISIM_au16CrntSetPoint[u8LocCh] = u16LocSetPoint;
+        if (u16LocSetPoint != TST_SPISIM_sau16TleSetPointOld[u8LocCh])
+        {
+            TST_SPISIM_sau16TleSetPointOld[u8LocCh] = u16LocSetPoint;
+            TST_SPISIM_sau8TleVldCnt[u8LocCh] = 0;
+        }
+        else if (TST_SPISIM_sau8TleVldCnt[u8LocCh] < 0xFF)
+        {
+            TST_SPISIM_sau8TleVldCnt[u8LocCh]++;
+        }
+
+        if (0 != (TST_SPISIM_au8FltAct[u8LocCh] & TST_SPISIM_u8FLT_SC_BATT))
+        {
+            s32LocTar = (sint32)TST_SPISIM_u16TLE_SETPOINT_MAX << 8;
+        }
+        else if (0 != (TST_SPISIM_au8FltAct[u8LocCh] & (TST_SPISIM_u8FLT_OPEN | TST_SPISIM_u8FLT_SC_GND)))
+        {
+            s32LocTar = 0;
+        }
+        else
+        {
+            s32LocTar = (sint32)u16LocSetPoint << 8;
+        }
+        TST_SPISIM_sas32TleCrntQ8[u8LocCh] += (s32LocTar - TST_SPISIM_sas32TleCrntQ8[u8LocCh])
+                                              >> TST_SPISIM_u8CrntLagShift;
+    }
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : TST_SPISIM_u16TlfFrm                                                                                */
+/* !Description : TLF35584 answer to one 16 bit frame (cmd:1, addr:6, data:8, even parity:1). Protected registers     */
+/*                are only written between the unlock and the lock sequence, a state request needs                    */
+/*                DEVCTRLN = ~DEVCTRL                                                                                 */
+/**********************************************************************************************************************/
+static uint16 TST_SPISIM_u16TlfFrm(uint16 u16LocFrm)
+{
+    uint8 u8LocAddr, u8LocData, u8LocBitCnt;
+    uint16 u16LocTmp;
+
+    for (u8LocBitCnt = 0, u16LocTmp = u16LocFrm; u16LocTmp != 0; u16LocTmp &= (uint16)(u16LocTmp - 1))
+    {
+        u8LocBitCnt++;
+    }
+    if (0 != (u8LocBitCnt & 1))
+    {
+        /* parity error: the frame is ignored */
+        return 0;
+    }
+
+    u8LocAddr = (uint8)((u16LocFrm >> 9) & 0x3F);
+    u8LocData = (uint8)(u16LocFrm >> 1);
+    if (0 != (u16LocFrm & 0x8000))
+    {
+        if (TST_SPISIM_u8TLF_PROTCFG == u8LocAddr)
+        {
+            TST_SPISIM_su8TlfUnlockIdx = (u8LocData == TST_SPISIM_kau8TlfUnlock[TST_SPISIM_su8TlfUnlockIdx]) ?
+                                         (TST_SPISIM_su8TlfUnlockIdx + 1) : 0;
+            TST_SPISIM_su8TlfLockIdx = (u8LocData == TST_SPISIM_kau8TlfLock[TST_SPISIM_su8TlfLockIdx]) ?
+                                       (TST_SPISIM_su8TlfLockIdx + 1) : 0;
+            if (4 == TST_SPISIM_su8TlfUnlockIdx)
+            {
+                TST_SPISIM_sbTlfUnlocked = TRUE;
+                TST_SPISIM_su8TlfUnlockIdx = 0;
+            }
+            if (4 == TST_SPISIM_su8TlfLockIdx)
+            {
+                TST_SPISIM_sbTlfUnlocked = FALSE;
+                TST_SPISIM_su8TlfLockIdx = 0;
+            }
+        }
+        else if ((u8LocAddr >= TST_SPISIM_u8TLF_PROT_FIRST) && (u8LocAddr <= TST_SPISIM_u8TLF_PROT_LAST))
+        {
+            if (FALSE == TST_SPISIM_sbTlfUnlocked)
+            {
+                TST_SPISIM_u8TlfProtErrCnt++;
+            }
+            else if (TST_SPISIM_u8TLF_WDCFG == u8LocAddr)
+            {
+                TST_SPISIM_bTlfWdDis = TRUE;
+            }
+        }
+        else if (TST_SPISIM_u8TLF_DEVCTRL == u8LocAddr)
+        {
+            TST_SPISIM_su8TlfDevCtrl = u8LocData;
+        }
+        else if ((TST_SPISIM_u8TLF_DEVCTRLN == u8LocAddr) && (u8LocData == (uint8)~TST_SPISIM_su8TlfDevCtrl))
+        {
+            TST_SPISIM_u8TlfDevSts = TST_SPISIM_su8TlfDevCtrl & 0x07;
+        }
+    }
+
+    if (0 != TST_SPISIM_u8TlfCorruptNb)
+    {
+        TST_SPISIM_u8TlfCorruptNb--;
+        return (uint16)~u16LocFrm;
+    }
+    return u16LocFrm;
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : TST_SPISIM_vidTlfStep                                                                               */
+/* !Description : Watchdog of the TLF35584: not serviced by the software, it resets the device to INIT unless it was  */
+/*                disabled in time                                                                                    */
+/**********************************************************************************************************************/
+static void TST_SPISIM_vidTlfStep(void)
+{
+    if (FALSE != TST_SPISIM_bTlfWdDis)
+    {
+        TST_SPISIM_su16TlfWdTmr = 0;
+    }
+    else if (TST_SPISIM_su16TlfWdTmr >= TST_SPISIM_u16TlfWdTmo)
+    {
+        TST_SPISIM_su16TlfWdTmr = 0;
+        TST_SPISIM_u8TlfWdRstCnt++;
+        TST_SPISIM_u8TlfDevSts = TST_SPISIM_u8TLF_STS_INIT;
+    }
+    else
+    {
+        TST_SPISIM_su16TlfWdTmr++;
+    }
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : TST_SPISIM_vidInit                                                                                  */
+/* !Description : Power on reset of the device models: TLE8242 registers holding their message id, TLF35584 in INIT.  */
+/*                Called by BSW_vidInit before the CDD inits, and again to restart a script. Pending sequences are    */
+/*                kept.                                                                                               */
+/**********************************************************************************************************************/
+void TST_SPISIM_vidInit(void)
+{
+    uint8 u8LocIdx;
+
+    for (u8LocIdx = 0; u8LocIdx < TST_SPISIM_u8TLE_NB_REG; u8LocIdx++)
+    {
+        TST_SPISIM_sau32TleReg[u8LocIdx] = (uint32)u8LocIdx << 24;
+    }
+    for (u8LocIdx = 0; u8LocIdx < TST_SPISIM_u8NB_TLE8242_CH; u8LocIdx++)
+    {
+        TST_SPISIM_sas32TleCrntQ8[u8LocIdx] = 0;
+        TST_SPISIM_sau8TleVldCnt[u8LocIdx] = 0;
+        TST_SPISIM_sau16FltDlyCnt[u8LocIdx] = 0;
+        TST_SPISIM_au8FltAct[u8LocIdx] = 0;
+    }
+    for (u8LocIdx = 0; u8LocIdx < SPI_MAXIMUM_SEQUENCE; u8LocIdx++)
+    {
+        TST_SPISIM_au16SeqCnt[u8LocIdx] = 0;
+    }
+    TST_SPISIM_su32TleRspPend = 0;
+
+    TST_SPISIM_su8TlfUnlockIdx = 0;
+    TST_SPISIM_su8TlfLockIdx = 0;
+    TST_SPISIM_sbTlfUnlocked = FALSE;
+    TST_SPISIM_bTlfWdDis = FALSE;
+    TST_SPISIM_su16TlfWdTmr = 0;
+    TST_SPISIM_u8TlfDevSts = TST_SPISIM_u8TLF_STS_INIT;
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : TST_SPISIM_vidMainFunction                                                                          */
+/* !Description : 5ms step of the models, then completion of the sequences whose latency elapsed. Must run before     */
+/*                BSW_5msPreCall, where the TLE8242 answers are parsed.                                               */
+/**********************************************************************************************************************/
+void TST_SPISIM_vidMainFunction(void)
+{
+    uint8 u8LocSeq, u8LocCh;
+    uint16 u16LocFrm;
+
+    TST_SPISIM_vidTleStep();
+    TST_SPISIM_vidTlfStep();
+
+    for (u8LocSeq = 0; u8LocSeq < SPI_MAXIMUM_SEQUENCE; u8LocSeq++)
+    {
+        if (1 == TST_SPISIM_sau8SeqPend[u8LocSeq])
+        {
+            TST_SPISIM_sau8SeqPend[u8LocSeq] = 0;
+            TST_SPISIM_au16SeqCnt[u8LocSeq]++;
+            u8LocCh = (uint8)TST_SPISIM_kaudtSeqCh[u8LocSeq];
+            if (SpiConf_SpiChannel_TLF35584_CH == u8LocCh)
+            {
+                (void)memcpy(&u16LocFrm, &TST_SPISIM_sau32TxBuf[u8LocCh][0], 2);
+                u16LocFrm = TST_SPISIM_u16TlfFrm(u16LocFrm);
+                (void)memcpy(&TST_SPISIM_sau32RxBuf[u8LocCh][0], &u16LocFrm, 2);
+                /* sequence end notification, as configured for TLF35584_SEQ */
+                TLF35584_vidSpiEndNotification();
+            }
+            else
+            {
+                TST_SPISIM_vidTleSeq(u8LocCh);
+            }
+        }
+        else if (TST_SPISIM_sau8SeqPend[u8LocSeq] > 1)
+        {
+            TST_SPISIM_sau8SeqPend[u8LocSeq]--;
+        }
+        else
+        {
+        }
+    }
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : TST_SPISIM_udtWriteIB                                                                               */
+/* !Description : Same as Spi_WriteIB                                                                                 */
+/**********************************************************************************************************************/
+Std_ReturnType TST_SPISIM_udtWriteIB(Spi_ChannelType udtChannel, const Spi_DataType *pudtSrc)
+{
+    if (udtChannel >= TST_SPISIM_u8NB_CH)
+    {
+        return E_NOT_OK;
+    }
+    (void)memcpy(TST_SPISIM_sau32TxBuf[udtChannel], pudtSrc, TST_SPISIM_kau8ChSize[udtChannel]);
+    return E_OK;
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : TST_SPISIM_udtReadIB                                                                                */
+/* !Description : Same as Spi_ReadIB, returns the data of the last completed sequence                                 */
+/**********************************************************************************************************************/
+Std_ReturnType TST_SPISIM_udtReadIB(Spi_ChannelType udtChannel, Spi_DataType *pudtDst)
+{
+    if (udtChannel >= TST_SPISIM_u8NB_CH)
+    {
+        return E_NOT_OK;
+    }
+    (void)memcpy(pudtDst, TST_SPISIM_sau32RxBuf[udtChannel], TST_SPISIM_kau8ChSize[udtChannel]);
+    return E_OK;
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : TST_SPISIM_udtAsyncTransmit                                                                         */
+/* !Description : Same as Spi_AsyncTransmit, refused while the sequence is pending                                    */
+/**********************************************************************************************************************/
+Std_ReturnType TST_SPISIM_udtAsyncTransmit(Spi_SequenceType udtSequence)
+{
+    if ((udtSequence >= SPI_MAXIMUM_SEQUENCE) || (0 != TST_SPISIM_sau8SeqPend[udtSequence]))
+    {
+        return E_NOT_OK;
+    }
+    TST_SPISIM_sau8SeqPend[udtSequence] = (uint8)(TST_SPISIM_u8SeqLatency + 1);
+    return E_OK;
+}
+
+#define TST_STOP_SEC_TST_CODE
+#include "TST_MemMap.h"
+
+/*----------------------------------------------------endoffile---------------------------------------------------*/
@@ -0,0 +1,84 @@
+/**********************************************************************************************************************/
+/* !Layer           : TST                                                                                             */
+/* !Component       : TST_SPISIM                                                                                      */
+/* !Description     : Simulated Spi driver with TLE8242 and TLF35584 models                                           */
+/*                                                                                                                    */
+/* !File            : TST_SPISIM.h                                                                                    */
+/* !Description     : TST_SPISIM APIs and Spi redirection                                                             */
+/*                                                                                                                    */
+/* !Reference       :                                                                                                 */
+/*                                                                                                                    */
+/* Coding language  : C                                                                                               */
+/*                                                                                                                    */
+/* COPYRIGHT VALEO all rights reserved                                                                                */
+/**********************************************************************************************************************/
+
+#ifndef TST_SPISIM_H
+#define TST_SPISIM_H
+
+#include "Std_Types.h"
+#include "Spi.h"
+
+/* Build level switch, set to 1 in the compiler options of a test build only: the Spi IB services used by the TLE8242 */
+/* and TLF35584 CDDs are routed to the device models, no chip is needed. Without it the CDDs, BSW and MAIN do not     */
+/* include this header and the production Spi driver is called.                                                       */
+#ifndef TST_SPISIM_bENA
+#define TST_SPISIM_bENA                 0
+#endif
+
+#define TST_SPISIM_u8NB_TLE8242_CH      8
+
+/* scripted faults, per TLE8242 channel */
+#define TST_SPISIM_u8FLT_OPEN           0x01
+#define TST_SPISIM_u8FLT_SC_GND         0x02
+#define TST_SPISIM_u8FLT_SC_BATT        0x04
+
+/* TLF35584 device states (DEVCTRL.STATEREQ) */
+#define TST_SPISIM_u8TLF_STS_INIT       1
+#define TST_SPISIM_u8TLF_STS_NORMAL     2
+#define TST_SPISIM_u8TLF_STS_STANDBY    4
+
+#if TST_SPISIM_bENA == 1
+#define Spi_WriteIB(Channel, DataBufferPtr)          TST_SPISIM_udtWriteIB((Channel), (DataBufferPtr))
+#define Spi_ReadIB(Channel, DataBufferPointer)       TST_SPISIM_udtReadIB((Channel), (DataBufferPointer))
+#define Spi_AsyncTransmit(Sequence)                  TST_SPISIM_udtAsyncTransmit(Sequence)
+#endif
+
+#define TST_START_SEC_TST_VAR
+#include "TST_MemMap.h"
+
+/* script */
+extern uint8 TST_SPISIM_au8FltReq[TST_SPISIM_u8NB_TLE8242_CH];
+extern uint16 TST_SPISIM_au16FltDly[TST_SPISIM_u8NB_TLE8242_CH];
+extern uint8 TST_SPISIM_u8SeqLatency;
+extern uint8 TST_SPISIM_u8CrntLagShift;
+extern uint8 TST_SPISIM_u8AvgVldDly;
+extern uint8 TST_SPISIM_u8TlfCorruptNb;
+extern uint16 TST_SPISIM_u16TlfWdTmo;
+/* observation */
+extern uint8 TST_SPISIM_au8FltAct[TST_SPISIM_u8NB_TLE8242_CH];
+extern uint16 TST_SPISIM_au16CrntSetPoint[TST_SPISIM_u8NB_TLE8242_CH];
+extern uint16 TST_SPISIM_au16SeqCnt[SPI_MAXIMUM_SEQUENCE];
+extern uint8 TST_SPISIM_u8TlfDevSts;
+extern boolean TST_SPISIM_bTlfWdDis;
+extern uint8 TST_SPISIM_u8TlfProtErrCnt;
+extern uint8 TST_SPISIM_u8TlfWdRstCnt;
+
+#define TST_STOP_SEC_TST_VAR
+#include "TST_MemMap.h"
+
+#define TST_START_SEC_TST_CODE
+#include "TST_MemMap.h"
+
+extern void TST_SPISIM_vidInit(void);
+extern void TST_SPISIM_vidMainFunction(void);
+extern Std_ReturnType TST_SPISIM_udtWriteIB(Spi_ChannelType udtChannel, const Spi_DataType *pudtSrc);
+extern Std_ReturnType TST_SPISIM_udtReadIB(Spi_ChannelType udtChannel, Spi_DataType *pudtDst);
+extern Std_ReturnType TST_SPISIM_udtAsyncTransmit(Spi_SequenceType udtSequence);
+
+#define TST_STOP_SEC_TST_CODE
+#include "TST_MemMap.h"
+
+#endif /* TST_SPISIM_H */
+
+/*----------------------------------------------------endoffile---------------------------------------------------*/
@@ -23,6 +23,16 @@
 #include "Trim_8242.h"
 #include "SWTST_L.h"
 #include "TLE8242_wrapper.h"
+#include "TLE8242.h"
+#include "TLE8242_cfg.h"
+#include "IfxStm_reg.h"
+
+/* Free running STM0 time base (100 MHz, 10 ns ticks) */
+#define TST_TLE8242_u32GET_TIME_STAMP()      ((uint32)MODULE_STM0.TIM0.U)
+/* Timed TLE8242_vidFaultDet calls per benchmark case, once the fault is debounced */
+#define TST_TLE8242_u16FLT_BENCH_NB_CALL     100U
+/* Samples needed by the TLE8242 fault debounce to toggle a status */
+#define TST_TLE8242_u8FLT_DEB_NB_CALL        4U
 
 #define TST_START_SEC_TST_CODE
 #include "TST_MemMap.h"
@@ -38,6 +48,16 @@ uint16 SW_TST_TLE8242_ilnFb[8] = {0};
 uint8 SW_TST_TLE8242_stDiaRdy[8] = {0};
 uint8 SW_TST_TLE8242_stDiaDsbc[8] = {0};
 
+/* fault detection benchmark, set over CCP */
+boolean SW_TST_TLE8242_bFltBenchReq = FALSE;
+/* ticks of TST_TLE8242_u16FLT_BENCH_NB_CALL calls with a stable fault state, per case */
+uint32 SW_TST_TLE8242_au32FltBenchTicks[TST_TLE8242_u8FLT_BENCH_NB_CASE];
+/* ticks of the call on which the debounced status toggles, per case */
+uint32 SW_TST_TLE8242_au32FltBenchTglTicks[TST_TLE8242_u8FLT_BENCH_NB_CASE];
+
+static uint32 TST_TLE8242_u32FltBenchWord(uint32 u32LocOldWord, uint16 u16LocFltMsk, uint8 u8LocFirstChIdx);
+static void TST_TLE8242_vidFltBenchSet(uint16 u16LocFltMsk);
+
 
 /**********************************************************************************************************************/
 /* !Runnable    : TST_TLE8242_vidInit                                                                                     */
@@ -62,6 +82,12 @@ void TST_TLE8242_vidMainFunction(void)
 {
 	uint8 u8LocTstCase;
 
+	if (SW_TST_TLE8242_bFltBenchReq != FALSE)
+	{
+		TST_TLE8242_vidFltBench();
+		SW_TST_TLE8242_bFltBenchReq = FALSE;
+	}
+
 	#if 0
 	if(SWTST_kbTle8242TstEnaC == TRUE)
 	{
@@ -139,6 +165,118 @@ void TST_TLE8242_vidMainFunction(void)
 
 }
 
+/**********************************************************************************************************************/
+/* !Runnable    : TST_TLE8242_vidFltBench                                                                             */
+/* !Trigger     : SW_TST_TLE8242_bFltBenchReq                                                                         */
+/* !Description : Times TLE8242_vidFaultDet with no channel, channel 0 and all channels in short to ground. The       */
+/*                diagnosis read words of TLE8242_astSpiRx are replaced for the run and restored at the end. It runs  */
+/*                in the 5 ms task, like TLE8242_vidFaultDet, so that the Spi parsing does not overwrite them. Run it */
+/*                with no fault present: a latched short of the chip is only read again on its next test.           */
+/*                                                                                                                    */
+/* !LastAuthor  : Liping.Liu                                                                                          */
+/**********************************************************************************************************************/
+void TST_TLE8242_vidFltBench(void)
+{
+	uint32 au32LocWordSave[TLE8242_u8CH_NR][2];
+	uint16 au16LocFltMsk[TST_TLE8242_u8FLT_BENCH_NB_CASE];
+	uint32 u32LocT0, u32LocT1, u32LocT2;
+	uint16 u16LocCallIdx;
+	uint8 u8LocChipIdx, u8LocMsgIdx, u8LocCaseIdx;
+
+	au16LocFltMsk[0] = 0;
+	au16LocFltMsk[1] = 1;
+	au16LocFltMsk[2] = (uint16)((1UL << TLE8242_u8MAX_CH_NR) - 1UL);
+
+	for (u8LocChipIdx = 0; u8LocChipIdx < TLE8242_u8CH_NR; u8LocChipIdx++)
+	{
+		for (u8LocMsgIdx = 0; u8LocMsgIdx < 2; u8LocMsgIdx++)
+		{
+			au32LocWordSave[u8LocChipIdx][u8LocMsgIdx] = TLE8242_astSpiRx[u8LocChipIdx].DiagnosticReadchannel[u8LocMsgIdx].u32Data;
+		}
+	}
+
+	for (u8LocCaseIdx = 0; u8LocCaseIdx < TST_TLE8242_u8FLT_BENCH_NB_CASE; u8LocCaseIdx++)
+	{
+		TST_TLE8242_vidFltBenchSet(au16LocFltMsk[u8LocCaseIdx]);
+		for (u16LocCallIdx = 1; u16LocCallIdx < TST_TLE8242_u8FLT_DEB_NB_CALL; u16LocCallIdx++)
+		{
+			TLE8242_vidFaultDet();
+		}
+		u32LocT0 = TST_TLE8242_u32GET_TIME_STAMP();
+		TLE8242_vidFaultDet();
+		u32LocT1 = TST_TLE8242_u32GET_TIME_STAMP();
+		for (u16LocCallIdx = 0; u16LocCallIdx < TST_TLE8242_u16FLT_BENCH_NB_CALL; u16LocCallIdx++)
+		{
+			TLE8242_vidFaultDet();
+		}
+		u32LocT2 = TST_TLE8242_u32GET_TIME_STAMP();
+		SW_TST_TLE8242_au32FltBenchTglTicks[u8LocCaseIdx] = u32LocT1 - u32LocT0;
+		SW_TST_TLE8242_au32FltBenchTicks[u8LocCaseIdx] = u32LocT2 - u32LocT1;
+
+		/* tested and fault free: clears the raw shorts, then the debounced status */
+		TST_TLE8242_vidFltBenchSet(0);
+		for (u16LocCallIdx = 0; u16LocCallIdx < TST_TLE8242_u8FLT_DEB_NB_CALL; u16LocCallIdx++)
+		{
+			TLE8242_vidFaultDet();
+		}
+	}
+
+	for (u8LocChipIdx = 0; u8LocChipIdx < TLE8242_u8CH_NR; u8LocChipIdx++)
+	{
+		for (u8LocMsgIdx = 0; u8LocMsgIdx < 2; u8LocMsgIdx++)
+		{
+			TLE8242_astSpiRx[u8LocChipIdx].DiagnosticReadchannel[u8LocMsgIdx].u32Data = au32LocWordSave[u8LocChipIdx][u8LocMsgIdx];
+		}
+	}
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : TST_TLE8242_vidFltBenchSet                                                                          */
+/* !Description : Writes the diagnosis read words of every chip: all channels tested, short to ground on the channels */
+/*                of u16LocFltMsk                                                                                     */
+/*                                                                                                                    */
+/* !LastAuthor  : Liping.Liu                                                                                          */
+/**********************************************************************************************************************/
+static void TST_TLE8242_vidFltBenchSet(uint16 u16LocFltMsk)
+{
+	uint8 u8LocChipIdx, u8LocMsgIdx;
+	uint32 u32LocWord;
+
+	for (u8LocChipIdx = 0; u8LocChipIdx < TLE8242_u8CH_NR; u8LocChipIdx++)
+	{
+		for (u8LocMsgIdx = 0; u8LocMsgIdx < 2; u8LocMsgIdx++)
+		{
+			u32LocWord = TLE8242_astSpiRx[u8LocChipIdx].DiagnosticReadchannel[u8LocMsgIdx].u32Data;
+			TLE8242_astSpiRx[u8LocChipIdx].DiagnosticReadchannel[u8LocMsgIdx].u32Data =
+				TST_TLE8242_u32FltBenchWord(u32LocWord, u16LocFltMsk, (uint8)((u8LocChipIdx * 8) + (u8LocMsgIdx * 4)));
+		}
+	}
+}
+
+/**********************************************************************************************************************/
+/* !FuncName    : TST_TLE8242_u32FltBenchWord                                                                         */
+/* !Description : One diagnosis read word (4 channels, 6 bits each), the message id of u32LocOldWord is kept          */
+/*                                                                                                                    */
+/* !LastAuthor  : Liping.Liu                                                                                          */
+/**********************************************************************************************************************/
+static uint32 TST_TLE8242_u32FltBenchWord(uint32 u32LocOldWord, uint16 u16LocFltMsk, uint8 u8LocFirstChIdx)
+{
+	uint32 u32LocWord, u32LocFld;
+	uint8 u8LocIdx;
+
+	u32LocWord = u32LocOldWord & 0xFF000000UL;
+	for (u8LocIdx = 0; u8LocIdx < 4; u8LocIdx++)
+	{
+		u32LocFld = (1UL << TLE8242_u8_FLT_OFF_TST_BIT) | (1UL << TLE8242_u8_FLT_SCS_TST_BIT);
+		if (0 != (u16LocFltMsk & (1 << (u8LocFirstChIdx + u8LocIdx))))
+		{
+			u32LocFld |= (1UL << TLE8242_u8_FLT_SC_BIT);
+		}
+		u32LocWord |= u32LocFld << ((3 - u8LocIdx) * TLE8242_u8_FLT_NB_BIT);
+	}
+	return (u32LocWord);
+}
+
 #define TST_STOP_SEC_TST_CODE
 #include"TST_MemMap.h"
 
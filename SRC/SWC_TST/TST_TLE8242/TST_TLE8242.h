@@ -27,6 +27,9 @@
 
 #include "Std_Types.h" 
 
+/* fault detection benchmark cases: no channel, one channel, all channels faulted */
+#define TST_TLE8242_u8FLT_BENCH_NB_CASE      3U
+
 /**********************************************************************************************************************/
 /* FUNCTIONS                                                                                                          */
 /**********************************************************************************************************************/
@@ -41,9 +44,13 @@ extern uint16 SW_TST_TLE8242_Iout[8];
 extern uint8 SW_TST_TLE8242_Mode[8];
 extern uint16 SW_TST_TLE8242_DitherAmp[8];
 extern uint16 SW_TST_TLE8242_DitherFreq[8];
+extern boolean SW_TST_TLE8242_bFltBenchReq;
+extern uint32 SW_TST_TLE8242_au32FltBenchTicks[TST_TLE8242_u8FLT_BENCH_NB_CASE];
+extern uint32 SW_TST_TLE8242_au32FltBenchTglTicks[TST_TLE8242_u8FLT_BENCH_NB_CASE];
 
 extern void TST_TLE8242_vidInit(void);
 extern void TST_TLE8242_vidMainFunction(void);
+extern void TST_TLE8242_vidFltBench(void);
 
 
 #define TST_STOP_SEC_TST_CODE